@@ -23,6 +23,7 @@
 #include "parser/ddl/create_type.h"
 #include "parser/ddl/drop.h"
 #include "parser/expression/parsed_literal_expression.h"
+#include "storage/index/property_index.h"
 
 using namespace kuzu::common;
 using namespace kuzu::parser;
@@ -415,6 +416,12 @@ std::unique_ptr<BoundStatement> Binder::bindAlter(const Statement& statement) {
     case AlterType::COMMENT: {
         return bindCommentOn(statement);
     }
+    case AlterType::CREATE_INDEX: {
+        return bindCreateIndex(statement);
+    }
+    case AlterType::DROP_INDEX: {
+        return bindDropIndex(statement);
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -559,5 +566,59 @@ std::unique_ptr<BoundStatement> Binder::bindCommentOn(const Statement& statement
     return std::make_unique<BoundAlter>(std::move(boundInfo));
 }
 
+std::unique_ptr<BoundStatement> Binder::bindCreateIndex(const Statement& statement) {
+    auto& alter = statement.constCast<Alter>();
+    auto info = alter.getInfo();
+    auto& propertyName = info->extraInfo->constPtrCast<ExtraIndexInfo>()->propertyName;
+    auto tableName = info->tableName;
+    validateTableExist(tableName);
+    auto catalog = clientContext->getCatalog();
+    auto tableEntry = catalog->getTableCatalogEntry(clientContext->getTx(), tableName);
+    if (tableEntry->getTableType() != TableType::NODE) {
+        throw BinderException{stringFormat(
+            "Cannot create an index on {}. Only node tables can be indexed.", tableName)};
+    }
+    auto nodeTableEntry = tableEntry->constPtrCast<NodeTableCatalogEntry>();
+    if (!nodeTableEntry->containsProperty(propertyName)) {
+        throw BinderException{
+            stringFormat("Table {} does not have property {}.", tableName, propertyName)};
+    }
+    if (nodeTableEntry->getPrimaryKeyName() == propertyName) {
+        throw BinderException{stringFormat(
+            "Property {} is the primary key of table {}, which is always indexed.", propertyName,
+            tableName)};
+    }
+    if (nodeTableEntry->hasAnyIndex(propertyName)) {
+        throw BinderException{
+            stringFormat("Property {} of table {} is already indexed.", propertyName, tableName)};
+    }
+    auto& type = nodeTableEntry->getProperty(propertyName).getType();
+    if (!storage::PropertyIndex::isSupportedType(type)) {
+        throw BinderException{stringFormat("Cannot create an index on property {} of type {}.",
+            propertyName, type.toString())};
+    }
+    auto boundInfo = BoundAlterInfo(AlterType::CREATE_INDEX, tableName,
+        std::make_unique<BoundExtraIndexInfo>(propertyName));
+    return std::make_unique<BoundAlter>(std::move(boundInfo));
+}
+
+std::unique_ptr<BoundStatement> Binder::bindDropIndex(const Statement& statement) {
+    auto& alter = statement.constCast<Alter>();
+    auto info = alter.getInfo();
+    auto& propertyName = info->extraInfo->constPtrCast<ExtraIndexInfo>()->propertyName;
+    auto tableName = info->tableName;
+    validateTableExist(tableName);
+    auto tableEntry =
+        clientContext->getCatalog()->getTableCatalogEntry(clientContext->getTx(), tableName);
+    if (tableEntry->getTableType() != TableType::NODE ||
+        !tableEntry->constPtrCast<NodeTableCatalogEntry>()->hasIndex(propertyName)) {
+        throw BinderException{
+            stringFormat("Property {} of table {} is not indexed.", propertyName, tableName)};
+    }
+    auto boundInfo = BoundAlterInfo(AlterType::DROP_INDEX, tableName,
+        std::make_unique<BoundExtraIndexInfo>(propertyName));
+    return std::make_unique<BoundAlter>(std::move(boundInfo));
+}
+
 } // namespace binder
 } // namespace kuzu
@@ -29,6 +29,44 @@ std::string BoundAlterInfo::toString() const {
                   " in Table " + tableName;
         break;
     }
+    case common::AlterType::CREATE_INDEX: {
+        auto indexInfo = common::ku_dynamic_cast<BoundExtraIndexInfo*>(extraInfo.get());
+        result += "Create Index on Property " + indexInfo->propertyName + " in Table " + tableName;
+        break;
+    }
+    case common::AlterType::DROP_INDEX: {
+        auto indexInfo = common::ku_dynamic_cast<BoundExtraIndexInfo*>(extraInfo.get());
+        result += "Drop Index on Property " + indexInfo->propertyName + " in Table " + tableName;
+        break;
+    }
+    case common::AlterType::CREATE_VECTOR_INDEX: {
+        auto indexInfo = common::ku_dynamic_cast<BoundExtraVectorIndexInfo*>(extraInfo.get());
+        result +=
+            "Create Vector Index on Property " + indexInfo->propertyName + " in Table " + tableName;
+        break;
+    }
+    case common::AlterType::DROP_VECTOR_INDEX: {
+        auto indexInfo = common::ku_dynamic_cast<BoundExtraIndexInfo*>(extraInfo.get());
+        result +=
+            "Drop Vector Index on Property " + indexInfo->propertyName + " in Table " + tableName;
+        break;
+    }
+    case common::AlterType::CREATE_FTS_INDEX: {
+        auto indexInfo = common::ku_dynamic_cast<BoundExtraIndexInfo*>(extraInfo.get());
+        result += "Create Full-Text Index on Property " + indexInfo->propertyName + " in Table " +
+                  tableName;
+        break;
+    }
+    case common::AlterType::DROP_FTS_INDEX: {
+        auto indexInfo = common::ku_dynamic_cast<BoundExtraIndexInfo*>(extraInfo.get());
+        result += "Drop Full-Text Index on Property " + indexInfo->propertyName + " in Table " +
+                  tableName;
+        break;
+    }
+    case common::AlterType::UPDATE_STATISTICS: {
+        result += "Update Statistics of Table " + tableName;
+        break;
+    }
     case common::AlterType::COMMENT: {
         result += "Comment on Table " + tableName;
         break;
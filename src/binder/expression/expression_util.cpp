@@ -225,6 +225,12 @@ int64_t ExpressionUtil::getLiteralValue(const Expression& expr) {
     return expr.constCast<LiteralExpression>().getValue().getValue<int64_t>();
 }
 template<>
+double ExpressionUtil::getLiteralValue(const Expression& expr) {
+    validateExpressionType(expr, ExpressionType::LITERAL);
+    validateDataType(expr, LogicalType::DOUBLE());
+    return expr.constCast<LiteralExpression>().getValue().getValue<double>();
+}
+template<>
 bool ExpressionUtil::getLiteralValue(const Expression& expr) {
     validateExpressionType(expr, ExpressionType::LITERAL);
     validateDataType(expr, LogicalType::BOOL());
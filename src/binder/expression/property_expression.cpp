@@ -50,6 +50,14 @@ bool PropertyExpression::hasProperty(common::table_id_t tableID) const {
     return infos.at(tableID).exists;
 }
 
+std::vector<table_id_t> PropertyExpression::getTableIDs() const {
+    std::vector<table_id_t> tableIDs;
+    for (auto& [tableID, _] : infos) {
+        tableIDs.push_back(tableID);
+    }
+    return tableIDs;
+}
+
 column_id_t PropertyExpression::getColumnID(const TableCatalogEntry& entry) const {
     if (!hasProperty(entry.getTableID())) {
         return INVALID_COLUMN_ID;
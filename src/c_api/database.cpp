@@ -1,9 +1,11 @@
 #include "c_api/kuzu.h"
 #include "common/exception/exception.h"
 #include "main/kuzu.h"
+#include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::main;
 using namespace kuzu::common;
+using namespace kuzu::storage;
 
 kuzu_state kuzu_database_init(const char* database_path, kuzu_system_config config,
     kuzu_database* out_database) {
@@ -32,3 +34,24 @@ kuzu_system_config kuzu_default_system_config() {
     return {0 /*bufferPoolSize*/, 0 /*maxNumThreads*/, true /*enableCompression*/,
         false /*readOnly*/, BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE};
 }
+
+kuzu_state kuzu_database_get_buffer_pool_info(kuzu_database* database,
+    kuzu_buffer_pool_info* out_info) {
+    if (database == nullptr || database->_database == nullptr) {
+        return KuzuError;
+    }
+    auto bm = static_cast<Database*>(database->_database)->getBufferManager();
+    auto info = bm->getBufferPoolInfo();
+    out_info->buffer_pool_size = info.bufferPoolSize;
+    out_info->used_memory = info.usedMemory;
+    out_info->cache_hits = info.numCacheHits;
+    out_info->cache_misses = info.numCacheMisses;
+    out_info->evictions = info.numEvictions;
+    out_info->failed_evictions = info.numFailedEvictions;
+    out_info->optimistic_read_retries = info.numOptimisticReadRetries;
+    out_info->temp_page_allocations = info.numTempPageAllocations;
+    out_info->temp_pages_in_use = info.numTempPagesInUse;
+    out_info->bytes_read = info.numBytesRead;
+    out_info->bytes_written = info.numBytesWritten;
+    return KuzuSuccess;
+}
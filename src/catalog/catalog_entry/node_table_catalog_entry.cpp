@@ -1,5 +1,7 @@
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 
+#include <algorithm>
+
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog_set.h"
 #include "common/serializer/deserializer.h"
@@ -9,31 +11,152 @@ using namespace kuzu::binder;
 namespace kuzu {
 namespace catalog {
 
+void VectorIndexDefinition::serialize(common::Serializer& serializer) const {
+    serializer.write(propertyName);
+    serializer.write(metric);
+}
+
+VectorIndexDefinition VectorIndexDefinition::deserialize(common::Deserializer& deserializer) {
+    VectorIndexDefinition definition;
+    deserializer.deserializeValue(definition.propertyName);
+    deserializer.deserializeValue(definition.metric);
+    return definition;
+}
+
 void NodeTableCatalogEntry::serialize(common::Serializer& serializer) const {
     TableCatalogEntry::serialize(serializer);
     serializer.writeDebuggingInfo("primaryKeyName");
     serializer.write(primaryKeyName);
+    serializer.writeDebuggingInfo("indexedProperties");
+    serializer.serializeVector(indexedProperties);
+    serializer.writeDebuggingInfo("vectorIndexes");
+    serializer.serializeVector(vectorIndexes);
+    serializer.writeDebuggingInfo("ftsIndexedProperties");
+    serializer.serializeVector(ftsIndexedProperties);
 }
 
 std::unique_ptr<NodeTableCatalogEntry> NodeTableCatalogEntry::deserialize(
     common::Deserializer& deserializer) {
     std::string debuggingInfo;
     std::string primaryKeyName;
+    std::vector<std::string> indexedProperties;
+    std::vector<VectorIndexDefinition> vectorIndexes;
+    std::vector<std::string> ftsIndexedProperties;
     deserializer.validateDebuggingInfo(debuggingInfo, "primaryKeyName");
     deserializer.deserializeValue(primaryKeyName);
+    deserializer.validateDebuggingInfo(debuggingInfo, "indexedProperties");
+    deserializer.deserializeVector(indexedProperties);
+    deserializer.validateDebuggingInfo(debuggingInfo, "vectorIndexes");
+    deserializer.deserializeVector(vectorIndexes);
+    deserializer.validateDebuggingInfo(debuggingInfo, "ftsIndexedProperties");
+    deserializer.deserializeVector(ftsIndexedProperties);
     auto nodeTableEntry = std::make_unique<NodeTableCatalogEntry>();
     nodeTableEntry->primaryKeyName = primaryKeyName;
+    nodeTableEntry->indexedProperties = std::move(indexedProperties);
+    nodeTableEntry->vectorIndexes = std::move(vectorIndexes);
+    nodeTableEntry->ftsIndexedProperties = std::move(ftsIndexedProperties);
     return nodeTableEntry;
 }
 
+bool NodeTableCatalogEntry::hasIndex(const std::string& propertyName) const {
+    return std::find(indexedProperties.begin(), indexedProperties.end(), propertyName) !=
+           indexedProperties.end();
+}
+
+void NodeTableCatalogEntry::addIndex(const std::string& propertyName) {
+    KU_ASSERT(!hasIndex(propertyName));
+    indexedProperties.push_back(propertyName);
+}
+
+void NodeTableCatalogEntry::dropIndex(const std::string& propertyName) {
+    KU_ASSERT(hasIndex(propertyName));
+    std::erase(indexedProperties, propertyName);
+}
+
+bool NodeTableCatalogEntry::hasVectorIndex(const std::string& propertyName) const {
+    return std::any_of(vectorIndexes.begin(), vectorIndexes.end(),
+        [&](const auto& definition) { return definition.propertyName == propertyName; });
+}
+
+const VectorIndexDefinition& NodeTableCatalogEntry::getVectorIndex(
+    const std::string& propertyName) const {
+    KU_ASSERT(hasVectorIndex(propertyName));
+    return *std::find_if(vectorIndexes.begin(), vectorIndexes.end(),
+        [&](const auto& definition) { return definition.propertyName == propertyName; });
+}
+
+void NodeTableCatalogEntry::addVectorIndex(VectorIndexDefinition definition) {
+    KU_ASSERT(!hasVectorIndex(definition.propertyName));
+    vectorIndexes.push_back(std::move(definition));
+}
+
+void NodeTableCatalogEntry::dropVectorIndex(const std::string& propertyName) {
+    KU_ASSERT(hasVectorIndex(propertyName));
+    std::erase_if(vectorIndexes,
+        [&](const auto& definition) { return definition.propertyName == propertyName; });
+}
+
+bool NodeTableCatalogEntry::hasFTSIndex(const std::string& propertyName) const {
+    return std::find(ftsIndexedProperties.begin(), ftsIndexedProperties.end(), propertyName) !=
+           ftsIndexedProperties.end();
+}
+
+void NodeTableCatalogEntry::addFTSIndex(const std::string& propertyName) {
+    KU_ASSERT(!hasFTSIndex(propertyName));
+    ftsIndexedProperties.push_back(propertyName);
+}
+
+void NodeTableCatalogEntry::dropFTSIndex(const std::string& propertyName) {
+    KU_ASSERT(hasFTSIndex(propertyName));
+    std::erase(ftsIndexedProperties, propertyName);
+}
+
+void NodeTableCatalogEntry::dropProperty(const std::string& propertyName) {
+    TableCatalogEntry::dropProperty(propertyName);
+    // Dropping a property drops its index as well.
+    std::erase(indexedProperties, propertyName);
+    std::erase_if(vectorIndexes,
+        [&](const auto& definition) { return definition.propertyName == propertyName; });
+    std::erase(ftsIndexedProperties, propertyName);
+}
+
+void NodeTableCatalogEntry::renameProperty(const std::string& propertyName,
+    const std::string& newName) {
+    TableCatalogEntry::renameProperty(propertyName, newName);
+    std::replace(indexedProperties.begin(), indexedProperties.end(), propertyName, newName);
+    for (auto& definition : vectorIndexes) {
+        if (definition.propertyName == propertyName) {
+            definition.propertyName = newName;
+        }
+    }
+    std::replace(ftsIndexedProperties.begin(), ftsIndexedProperties.end(), propertyName,
+        newName);
+}
+
 std::string NodeTableCatalogEntry::toCypher(main::ClientContext* /*clientContext*/) const {
-    return common::stringFormat("CREATE NODE TABLE {} ({} PRIMARY KEY({}));", getName(),
+    auto result = common::stringFormat("CREATE NODE TABLE {} ({} PRIMARY KEY({}));", getName(),
         propertyCollection.toCypher(), primaryKeyName);
+    for (auto& propertyName : indexedProperties) {
+        result += common::stringFormat("\nCREATE INDEX ON {}({});", getName(), propertyName);
+    }
+    for (auto& definition : vectorIndexes) {
+        result += common::stringFormat("\nCALL create_vector_index('{}', '{}', '{}') RETURN *;",
+            getName(), definition.propertyName,
+            common::VectorDistanceMetricUtil::toString(definition.metric));
+    }
+    for (auto& propertyName : ftsIndexedProperties) {
+        result += common::stringFormat("\nCALL create_fts_index('{}', '{}') RETURN *;", getName(),
+            propertyName);
+    }
+    return result;
 }
 
 std::unique_ptr<TableCatalogEntry> NodeTableCatalogEntry::copy() const {
     auto other = std::make_unique<NodeTableCatalogEntry>();
     other->primaryKeyName = primaryKeyName;
+    other->indexedProperties = indexedProperties;
+    other->vectorIndexes = vectorIndexes;
+    other->ftsIndexedProperties = ftsIndexedProperties;
     other->copyFrom(*this);
     return other;
 }
@@ -33,6 +33,35 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::alter(const BoundAlterInfo
         auto& dropPropInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraDropPropertyInfo>();
         newEntry->dropProperty(dropPropInfo.propertyName);
     } break;
+    case AlterType::CREATE_INDEX: {
+        auto& indexInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        newEntry->ptrCast<NodeTableCatalogEntry>()->addIndex(indexInfo.propertyName);
+    } break;
+    case AlterType::DROP_INDEX: {
+        auto& indexInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        newEntry->ptrCast<NodeTableCatalogEntry>()->dropIndex(indexInfo.propertyName);
+    } break;
+    case AlterType::CREATE_VECTOR_INDEX: {
+        auto& indexInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraVectorIndexInfo>();
+        newEntry->ptrCast<NodeTableCatalogEntry>()->addVectorIndex(
+            VectorIndexDefinition{indexInfo.propertyName, indexInfo.metric});
+    } break;
+    case AlterType::DROP_VECTOR_INDEX: {
+        auto& indexInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        newEntry->ptrCast<NodeTableCatalogEntry>()->dropVectorIndex(indexInfo.propertyName);
+    } break;
+    case AlterType::CREATE_FTS_INDEX: {
+        auto& indexInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        newEntry->ptrCast<NodeTableCatalogEntry>()->addFTSIndex(indexInfo.propertyName);
+    } break;
+    case AlterType::DROP_FTS_INDEX: {
+        auto& indexInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        newEntry->ptrCast<NodeTableCatalogEntry>()->dropFTSIndex(indexInfo.propertyName);
+    } break;
+    case AlterType::UPDATE_STATISTICS: {
+        auto& statisticsInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraStatisticsInfo>();
+        newEntry->setStatistics(statisticsInfo.statistics);
+    } break;
     case AlterType::COMMENT: {
         auto& commentInfo = *alterInfo.extraInfo->constPtrCast<BoundExtraCommentInfo>();
         newEntry->setComment(commentInfo.comment);
@@ -82,11 +111,17 @@ void TableCatalogEntry::addProperty(const PropertyDefinition& propertyDefinition
 
 void TableCatalogEntry::dropProperty(const std::string& propertyName) {
     propertyCollection.drop(propertyName);
+    if (statistics) {
+        statistics->dropProperty(propertyName);
+    }
 }
 
 void TableCatalogEntry::renameProperty(const std::string& propertyName,
     const std::string& newName) {
     propertyCollection.rename(propertyName, newName);
+    if (statistics) {
+        statistics->renameProperty(propertyName, newName);
+    }
 }
 
 void TableCatalogEntry::serialize(Serializer& serializer) const {
@@ -95,6 +130,11 @@ void TableCatalogEntry::serialize(Serializer& serializer) const {
     serializer.write(comment);
     serializer.writeDebuggingInfo("properties");
     propertyCollection.serialize(serializer);
+    serializer.writeDebuggingInfo("statistics");
+    serializer.write<bool>(statistics != nullptr);
+    if (statistics) {
+        statistics->serialize(serializer);
+    }
 }
 
 std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(Deserializer& deserializer,
@@ -105,6 +145,13 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(Deserializer&
     deserializer.deserializeValue(comment);
     deserializer.validateDebuggingInfo(debuggingInfo, "properties");
     auto propertyCollection = PropertyDefinitionCollection::deserialize(deserializer);
+    std::unique_ptr<TableStatistics> statistics;
+    deserializer.validateDebuggingInfo(debuggingInfo, "statistics");
+    bool hasStatistics = false;
+    deserializer.deserializeValue(hasStatistics);
+    if (hasStatistics) {
+        statistics = std::make_unique<TableStatistics>(TableStatistics::deserialize(deserializer));
+    }
     std::unique_ptr<TableCatalogEntry> result;
     switch (type) {
     case CatalogEntryType::NODE_TABLE_ENTRY:
@@ -124,6 +171,7 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(Deserializer&
     }
     result->comment = std::move(comment);
     result->propertyCollection = std::move(propertyCollection);
+    result->statistics = std::move(statistics);
     return result;
 }
 
@@ -133,6 +181,9 @@ void TableCatalogEntry::copyFrom(const CatalogEntry& other) {
     set = otherTable.set;
     comment = otherTable.comment;
     propertyCollection = otherTable.propertyCollection.copy();
+    if (otherTable.statistics) {
+        setStatistics(*otherTable.statistics);
+    }
 }
 
 BoundCreateTableInfo TableCatalogEntry::getBoundCreateTableInfo(
@@ -0,0 +1,156 @@
+#include "catalog/table_statistics.h"
+
+#include <algorithm>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace catalog {
+
+double ColumnStatistics::getNullFraction() const {
+    const auto numRows = numNonNulls + numNulls;
+    return numRows == 0 ? 0 : (double)numNulls / (double)numRows;
+}
+
+double ColumnStatistics::getEqualitySelectivity() const {
+    if (numDistinctValues == 0) {
+        return 0;
+    }
+    return (1 - getNullFraction()) / (double)numDistinctValues;
+}
+
+double ColumnStatistics::getRangeSelectivity(ExpressionType comparison, double value) const {
+    KU_ASSERT(hasHistogram());
+    const auto equalFraction = numDistinctValues == 0 ? 0 : 1 / (double)numDistinctValues;
+    const auto inRange = value >= getMin() && value <= getMax();
+    double fraction = 0;
+    switch (comparison) {
+    case ExpressionType::LESS_THAN: {
+        fraction = getFractionBelow(value);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        fraction = getFractionBelow(value) + (inRange ? equalFraction : 0);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        fraction = 1 - getFractionBelow(value) - (inRange ? equalFraction : 0);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        fraction = 1 - getFractionBelow(value);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return std::clamp(fraction, 0.0, 1.0) * (1 - getNullFraction());
+}
+
+double ColumnStatistics::getFractionBelow(double value) const {
+    if (value <= getMin()) {
+        return 0;
+    }
+    if (value > getMax()) {
+        return 1;
+    }
+    if (value == getMax()) {
+        return std::max(0.0, 1 - 1 / (double)std::max<uint64_t>(numDistinctValues, 1));
+    }
+    // Values are assumed to be uniformly distributed inside each bucket.
+    const auto bucketIdx =
+        std::upper_bound(histogramBounds.begin(), histogramBounds.end(), value) -
+        histogramBounds.begin() - 1;
+    const auto lower = histogramBounds[bucketIdx];
+    const auto upper = histogramBounds[bucketIdx + 1];
+    return ((double)bucketIdx + (value - lower) / (upper - lower)) /
+           (double)getNumHistogramBuckets();
+}
+
+void ColumnStatistics::serialize(Serializer& serializer) const {
+    serializer.write(numNonNulls);
+    serializer.write(numNulls);
+    serializer.write(numDistinctValues);
+    serializer.serializeVector(histogramBounds);
+}
+
+ColumnStatistics ColumnStatistics::deserialize(Deserializer& deserializer) {
+    ColumnStatistics statistics;
+    deserializer.deserializeValue(statistics.numNonNulls);
+    deserializer.deserializeValue(statistics.numNulls);
+    deserializer.deserializeValue(statistics.numDistinctValues);
+    deserializer.deserializeVector(statistics.histogramBounds);
+    return statistics;
+}
+
+double DegreeStatistics::getExcessDegree() const {
+    return numRels == 0 ? 0 : sumSquaredDegrees / (double)numRels;
+}
+
+void DegreeStatistics::serialize(Serializer& serializer) const {
+    serializer.write(numRels);
+    serializer.write(numNodesWithRels);
+    serializer.write(maxDegree);
+    serializer.write(sumSquaredDegrees);
+}
+
+DegreeStatistics DegreeStatistics::deserialize(Deserializer& deserializer) {
+    DegreeStatistics statistics;
+    deserializer.deserializeValue(statistics.numRels);
+    deserializer.deserializeValue(statistics.numNodesWithRels);
+    deserializer.deserializeValue(statistics.maxDegree);
+    deserializer.deserializeValue(statistics.sumSquaredDegrees);
+    return statistics;
+}
+
+void TableStatistics::renameProperty(const std::string& propertyName,
+    const std::string& newName) {
+    const auto iter = columnStatistics.find(propertyName);
+    if (iter == columnStatistics.end()) {
+        return;
+    }
+    auto statistics = std::move(iter->second);
+    columnStatistics.erase(iter);
+    columnStatistics.emplace(newName, std::move(statistics));
+}
+
+void TableStatistics::dropProperty(const std::string& propertyName) {
+    columnStatistics.erase(propertyName);
+}
+
+void TableStatistics::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("numRows");
+    serializer.write(numRows);
+    serializer.writeDebuggingInfo("columnStatistics");
+    serializer.write<uint64_t>(columnStatistics.size());
+    for (auto& [propertyName, statistics] : columnStatistics) {
+        serializer.write(propertyName);
+        statistics.serialize(serializer);
+    }
+    serializer.writeDebuggingInfo("degreeStatistics");
+    fwdDegrees.serialize(serializer);
+    bwdDegrees.serialize(serializer);
+}
+
+TableStatistics TableStatistics::deserialize(Deserializer& deserializer) {
+    std::string debuggingInfo;
+    uint64_t numRows = 0;
+    deserializer.validateDebuggingInfo(debuggingInfo, "numRows");
+    deserializer.deserializeValue(numRows);
+    TableStatistics statistics{numRows};
+    deserializer.validateDebuggingInfo(debuggingInfo, "columnStatistics");
+    uint64_t numColumnStatistics = 0;
+    deserializer.deserializeValue(numColumnStatistics);
+    for (auto i = 0u; i < numColumnStatistics; i++) {
+        std::string propertyName;
+        deserializer.deserializeValue(propertyName);
+        statistics.columnStatistics.emplace(propertyName,
+            ColumnStatistics::deserialize(deserializer));
+    }
+    deserializer.validateDebuggingInfo(debuggingInfo, "degreeStatistics");
+    statistics.fwdDegrees = DegreeStatistics::deserialize(deserializer);
+    statistics.bwdDegrees = DegreeStatistics::deserialize(deserializer);
+    return statistics;
+}
+
+} // namespace catalog
+} // namespace kuzu
@@ -0,0 +1,38 @@
+#include "common/enums/vector_distance_metric.h"
+
+#include "common/assert.h"
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+
+namespace kuzu {
+namespace common {
+
+VectorDistanceMetric VectorDistanceMetricUtil::fromString(const std::string& str) {
+    auto normalizedString = StringUtils::getUpper(str);
+    if (normalizedString == "L2") {
+        return VectorDistanceMetric::L2;
+    } else if (normalizedString == "COSINE") {
+        return VectorDistanceMetric::COSINE;
+    } else if (normalizedString == "INNER_PRODUCT") {
+        return VectorDistanceMetric::INNER_PRODUCT;
+    } else {
+        throw RuntimeException(stringFormat("Cannot parse {} as VectorDistanceMetric.", str));
+    }
+}
+
+std::string VectorDistanceMetricUtil::toString(VectorDistanceMetric metric) {
+    switch (metric) {
+    case VectorDistanceMetric::L2:
+        return "l2";
+    case VectorDistanceMetric::COSINE:
+        return "cosine";
+    case VectorDistanceMetric::INNER_PRODUCT:
+        return "inner_product";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace kuzu
@@ -27,6 +27,14 @@ void FileInfo::writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offs
     fileSystem->writeFile(*this, buffer, numBytes, offset);
 }
 
+void FileInfo::readFromFileBatch(std::span<const FileReadRequest> requests) {
+    fileSystem->readFromFileBatch(*this, requests);
+}
+
+void FileInfo::writeFileBatch(std::span<const FileWriteRequest> requests) {
+    fileSystem->writeFileBatch(*this, requests);
+}
+
 void FileInfo::syncFile() const {
     fileSystem->syncFile(*this);
 }
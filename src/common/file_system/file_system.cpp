@@ -45,6 +45,20 @@ void FileSystem::writeFile(FileInfo& /*fileInfo*/, const uint8_t* /*buffer*/, ui
     KU_UNREACHABLE;
 }
 
+void FileSystem::readFromFileBatch(FileInfo& fileInfo,
+    std::span<const FileReadRequest> requests) const {
+    for (auto& request : requests) {
+        readFromFile(fileInfo, request.buffer, request.numBytes, request.position);
+    }
+}
+
+void FileSystem::writeFileBatch(FileInfo& fileInfo,
+    std::span<const FileWriteRequest> requests) const {
+    for (auto& request : requests) {
+        writeFile(fileInfo, request.buffer, request.numBytes, request.offset);
+    }
+}
+
 void FileSystem::truncate(FileInfo& /*fileInfo*/, uint64_t /*size*/) const {
     KU_UNREACHABLE;
 }
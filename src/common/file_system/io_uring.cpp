@@ -0,0 +1,230 @@
+#include "common/file_system/io_uring.h"
+
+#include "common/assert.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define KUZU_IO_URING
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "common/copy_constructors.h"
+#include "common/exception/io.h"
+#include "common/system_message.h"
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace kuzu {
+namespace common {
+
+#ifdef KUZU_IO_URING
+
+namespace {
+
+// A minimal io_uring built directly on the io_uring_setup and io_uring_enter system calls, so no
+// dependency on liburing is needed.
+class Ring {
+public:
+    static constexpr uint32_t QUEUE_DEPTH = 64;
+
+    Ring() {
+        io_uring_params params{};
+        ringFD = static_cast<int>(syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params));
+        if (ringFD < 0) {
+            return;
+        }
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool isSingleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (isSingleMmap) {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+        sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ringFD, IORING_OFF_SQ_RING);
+        if (sqRing == MAP_FAILED) {
+            sqRing = nullptr;
+            return;
+        }
+        if (isSingleMmap) {
+            cqRing = sqRing;
+        } else {
+            cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ringFD, IORING_OFF_CQ_RING);
+            if (cqRing == MAP_FAILED) {
+                cqRing = nullptr;
+                return;
+            }
+        }
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        auto sqesPtr = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ringFD, IORING_OFF_SQES);
+        if (sqesPtr == MAP_FAILED) {
+            return;
+        }
+        sqes = static_cast<io_uring_sqe*>(sqesPtr);
+        auto sqBase = static_cast<uint8_t*>(sqRing);
+        sqHead = reinterpret_cast<uint32_t*>(sqBase + params.sq_off.head);
+        sqTail = reinterpret_cast<uint32_t*>(sqBase + params.sq_off.tail);
+        sqMask = *reinterpret_cast<uint32_t*>(sqBase + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<uint32_t*>(sqBase + params.sq_off.array);
+        numSQEntries = params.sq_entries;
+        auto cqBase = static_cast<uint8_t*>(cqRing);
+        cqHead = reinterpret_cast<uint32_t*>(cqBase + params.cq_off.head);
+        cqTail = reinterpret_cast<uint32_t*>(cqBase + params.cq_off.tail);
+        cqMask = *reinterpret_cast<uint32_t*>(cqBase + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cqBase + params.cq_off.cqes);
+        valid = true;
+    }
+
+    ~Ring() {
+        if (sqes != nullptr) {
+            munmap(sqes, sqesSize);
+        }
+        if (cqRing != nullptr && cqRing != sqRing) {
+            munmap(cqRing, cqRingSize);
+        }
+        if (sqRing != nullptr) {
+            munmap(sqRing, sqRingSize);
+        }
+        if (ringFD >= 0) {
+            close(ringFD);
+        }
+    }
+
+    DELETE_COPY_AND_MOVE(Ring);
+
+    bool isValid() const { return valid; }
+
+    void submitAndWait(std::span<IOUringRequest> requests) {
+        // The kernel may read the iovecs after io_uring_enter returns, so they have to outlive the
+        // requests in flight.
+        iovecs.resize(requests.size());
+        uint64_t numSubmitted = 0, numCompleted = 0;
+        uint32_t numInFlight = 0, numPendingSubmission = 0;
+        while (numCompleted < requests.size()) {
+            auto tail = *sqTail;
+            while (numSubmitted < requests.size() && numInFlight < numSQEntries) {
+                auto& request = requests[numSubmitted];
+                iovecs[numSubmitted] = {request.buffer, request.numBytes};
+                const auto index = tail & sqMask;
+                auto& sqe = sqes[index];
+                memset(&sqe, 0, sizeof(io_uring_sqe));
+                sqe.opcode = request.isWrite ? IORING_OP_WRITEV : IORING_OP_READV;
+                sqe.fd = request.fd;
+                sqe.addr = reinterpret_cast<uint64_t>(&iovecs[numSubmitted]);
+                sqe.len = 1;
+                sqe.off = request.offset;
+                sqe.user_data = numSubmitted;
+                sqArray[index] = index;
+                tail++;
+                numSubmitted++;
+                numInFlight++;
+                numPendingSubmission++;
+            }
+            __atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+            const auto numEntered = syscall(__NR_io_uring_enter, ringFD, numPendingSubmission,
+                1 /* minComplete */, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (numEntered < 0) {
+                if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                    // LCOV_EXCL_START
+                    valid = false;
+                    throw IOException(
+                        "Failed to submit io_uring requests. Error: " + posixErrMessage());
+                    // LCOV_EXCL_STOP
+                }
+            } else {
+                numPendingSubmission -= numEntered;
+            }
+            auto head = *cqHead;
+            const auto cqTailValue = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+            while (head != cqTailValue) {
+                auto& cqe = cqes[head & cqMask];
+                requests[cqe.user_data].result = cqe.res;
+                head++;
+                numCompleted++;
+                numInFlight--;
+            }
+            __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+        }
+    }
+
+private:
+    bool valid = false;
+    int ringFD = -1;
+    void* sqRing = nullptr;
+    size_t sqRingSize = 0;
+    void* cqRing = nullptr;
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+    uint32_t* sqHead = nullptr;
+    uint32_t* sqTail = nullptr;
+    uint32_t* sqArray = nullptr;
+    uint32_t sqMask = 0;
+    uint32_t numSQEntries = 0;
+    uint32_t* cqHead = nullptr;
+    uint32_t* cqTail = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    uint32_t cqMask = 0;
+    std::vector<iovec> iovecs;
+};
+
+std::atomic<bool> ioUringUnavailable{false};
+std::atomic<bool> ioUringDisabled{false};
+
+Ring* getThreadLocalRing() {
+    thread_local std::unique_ptr<Ring> ring;
+    if (ring == nullptr || !ring->isValid()) {
+        if (ioUringUnavailable.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        ring = std::make_unique<Ring>();
+        if (!ring->isValid()) {
+            ioUringUnavailable.store(true, std::memory_order_relaxed);
+            ring.reset();
+            return nullptr;
+        }
+    }
+    return ring.get();
+}
+
+} // namespace
+
+bool IOUring::isAvailable() {
+    return !ioUringDisabled.load(std::memory_order_relaxed) && getThreadLocalRing() != nullptr;
+}
+
+void IOUring::setDisabled(bool disabled) {
+    ioUringDisabled.store(disabled, std::memory_order_relaxed);
+}
+
+void IOUring::submitAndWait(std::span<IOUringRequest> requests) {
+    auto ring = getThreadLocalRing();
+    KU_ASSERT(ring != nullptr);
+    ring->submitAndWait(requests);
+}
+
+#else
+
+bool IOUring::isAvailable() {
+    return false;
+}
+
+void IOUring::setDisabled(bool /*disabled*/) {}
+
+void IOUring::submitAndWait(std::span<IOUringRequest> /*requests*/) {
+    KU_UNREACHABLE;
+}
+
+#endif
+
+} // namespace common
+} // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "common/assert.h"
 #include "common/exception/io.h"
+#include "common/file_system/io_uring.h"
 #include "common/string_format.h"
 #include "common/string_utils.h"
 #include "common/system_message.h"
@@ -368,6 +369,55 @@ void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint6
     }
 }
 
+void LocalFileSystem::readFromFileBatch(FileInfo& fileInfo,
+    std::span<const FileReadRequest> requests) const {
+#ifndef _WIN32
+    if (requests.size() > 1 && IOUring::isAvailable()) {
+        auto fd = fileInfo.constPtrCast<LocalFileInfo>()->fd;
+        std::vector<IOUringRequest> ioRequests;
+        ioRequests.reserve(requests.size());
+        for (auto& request : requests) {
+            ioRequests.push_back(
+                {false /* isWrite */, fd, request.buffer, request.numBytes, request.position});
+        }
+        IOUring::submitAndWait(ioRequests);
+        // Failed and short reads are redone synchronously, which either completes them or reports
+        // the error the same way as unbatched reads.
+        for (auto i = 0u; i < requests.size(); i++) {
+            if (ioRequests[i].result != (int64_t)requests[i].numBytes) {
+                readFromFile(fileInfo, requests[i].buffer, requests[i].numBytes,
+                    requests[i].position);
+            }
+        }
+        return;
+    }
+#endif
+    FileSystem::readFromFileBatch(fileInfo, requests);
+}
+
+void LocalFileSystem::writeFileBatch(FileInfo& fileInfo,
+    std::span<const FileWriteRequest> requests) const {
+#ifndef _WIN32
+    if (requests.size() > 1 && IOUring::isAvailable()) {
+        auto fd = fileInfo.constPtrCast<LocalFileInfo>()->fd;
+        std::vector<IOUringRequest> ioRequests;
+        ioRequests.reserve(requests.size());
+        for (auto& request : requests) {
+            ioRequests.push_back({true /* isWrite */, fd, const_cast<uint8_t*>(request.buffer),
+                request.numBytes, request.offset});
+        }
+        IOUring::submitAndWait(ioRequests);
+        for (auto i = 0u; i < requests.size(); i++) {
+            if (ioRequests[i].result != (int64_t)requests[i].numBytes) {
+                writeFile(fileInfo, requests[i].buffer, requests[i].numBytes, requests[i].offset);
+            }
+        }
+        return;
+    }
+#endif
+    FileSystem::writeFileBatch(fileInfo, requests);
+}
+
 void LocalFileSystem::syncFile(const FileInfo& fileInfo) const {
     auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
 #if defined(_WIN32)
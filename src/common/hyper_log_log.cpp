@@ -0,0 +1,44 @@
+#include "common/hyper_log_log.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace kuzu {
+namespace common {
+
+void HyperLogLog::insert(hash_t hash) {
+    // The leading PRECISION bits select the register, which keeps the position of the first set
+    // bit among the remaining ones.
+    const auto registerIdx = hash >> (64 - PRECISION);
+    const auto remainingBits = hash << PRECISION;
+    const auto rank = remainingBits == 0 ? (uint8_t)(64 - PRECISION + 1) :
+                                           (uint8_t)(std::countl_zero(remainingBits) + 1);
+    registers[registerIdx] = std::max(registers[registerIdx], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    for (auto i = 0u; i < NUM_REGISTERS; i++) {
+        registers[i] = std::max(registers[i], other.registers[i]);
+    }
+}
+
+uint64_t HyperLogLog::estimate() const {
+    constexpr auto numRegisters = (double)NUM_REGISTERS;
+    double sum = 0;
+    uint64_t numEmptyRegisters = 0;
+    for (const auto rank : registers) {
+        sum += std::ldexp(1.0, -rank);
+        numEmptyRegisters += rank == 0;
+    }
+    const auto alpha = 0.7213 / (1 + 1.079 / numRegisters);
+    auto estimate = alpha * numRegisters * numRegisters / sum;
+    // Small cardinalities are estimated much more accurately by linear counting.
+    if (estimate <= 2.5 * numRegisters && numEmptyRegisters > 0) {
+        estimate = numRegisters * std::log(numRegisters / (double)numEmptyRegisters);
+    }
+    return (uint64_t)std::llround(estimate);
+}
+
+} // namespace common
+} // namespace kuzu
@@ -29,6 +29,14 @@ uint8_t* InMemOverflowBuffer::allocateSpace(uint64_t size) {
     return data;
 }
 
+uint64_t InMemOverflowBuffer::getMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& block : blocks) {
+        memoryUsage += block->size();
+    }
+    return memoryUsage;
+}
+
 void InMemOverflowBuffer::resetBuffer() {
     if (!blocks.empty()) {
         auto firstBlock = std::move(blocks[0]);
@@ -39,6 +39,44 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
     }
     auto scheduledTask = pushTaskIntoQueue(task);
     cv.notify_all();
+    waitForTaskCompletion(task.get(), context);
+    if (launchNewWorkerThread) {
+        newWorkerThread.join();
+    }
+    if (task->hasException()) {
+        removeErroringTask(scheduledTask->ID);
+        std::rethrow_exception(task->getExceptionPtr());
+    }
+}
+
+void TaskScheduler::runTaskOnDedicatedThreadsAndWaitOrError(const std::shared_ptr<Task>& task,
+    processor::ExecutionContext* context, uint64_t numThreads) {
+    for (auto& dependency : task->children) {
+        scheduleTaskAndWaitOrError(dependency, context);
+    }
+    // Register all threads before starting any of them. Otherwise, a fast thread may finish the
+    // task before the others are able to register.
+    std::vector<std::thread> threads;
+    auto numThreadsToLaunch = 0u;
+    for (auto i = 0u; i < std::max<uint64_t>(numThreads, 1); ++i) {
+        if (!task->registerThread()) {
+            break;
+        }
+        numThreadsToLaunch++;
+    }
+    for (auto i = 0u; i < numThreadsToLaunch; ++i) {
+        threads.emplace_back(runTask, task.get());
+    }
+    waitForTaskCompletion(task.get(), context);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (task->hasException()) {
+        std::rethrow_exception(task->getExceptionPtr());
+    }
+}
+
+void TaskScheduler::waitForTaskCompletion(Task* task, processor::ExecutionContext* context) {
     std::unique_lock<std::mutex> taskLck{task->taskMtx, std::defer_lock};
     while (true) {
         taskLck.lock();
@@ -69,13 +107,6 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         }
         taskLck.unlock();
     }
-    if (launchNewWorkerThread) {
-        newWorkerThread.join();
-    }
-    if (task->hasException()) {
-        removeErroringTask(scheduledTask->ID);
-        std::rethrow_exception(task->getExceptionPtr());
-    }
 }
 
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
@@ -219,8 +219,11 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(ShowTablesFunction), TABLE_FUNCTION(ShowWarningsFunction),
         TABLE_FUNCTION(ClearWarningsFunction), TABLE_FUNCTION(TableInfoFunction),
         TABLE_FUNCTION(ShowConnectionFunction), TABLE_FUNCTION(StorageInfoFunction),
+        TABLE_FUNCTION(BufferPoolInfoFunction), TABLE_FUNCTION(BufferPoolFileInfoFunction),
         TABLE_FUNCTION(ShowAttachedDatabasesFunction), TABLE_FUNCTION(ShowSequencesFunction),
-        TABLE_FUNCTION(ShowFunctionsFunction),
+        TABLE_FUNCTION(ShowFunctionsFunction), TABLE_FUNCTION(CreateVectorIndexFunction),
+        TABLE_FUNCTION(DropVectorIndexFunction), TABLE_FUNCTION(CreateFTSIndexFunction),
+        TABLE_FUNCTION(DropFTSIndexFunction), TABLE_FUNCTION(AnalyzeFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
@@ -237,7 +240,14 @@ FunctionCollection* FunctionCollection::getFunctions() {
         ALGORITHM_FUNCTION(AllSPLengthsFunction), ALGORITHM_FUNCTION(AllSPPathsFunction),
         ALGORITHM_FUNCTION(SingleSPDestinationsFunction),
         ALGORITHM_FUNCTION(SingleSPLengthsFunction), ALGORITHM_FUNCTION(SingleSPPathsFunction),
-        ALGORITHM_FUNCTION(PageRankFunction),
+        ALGORITHM_FUNCTION(WeightedSPDestinationsFunction),
+        ALGORITHM_FUNCTION(WeightedSPLengthsFunction), ALGORITHM_FUNCTION(WeightedSPPathsFunction),
+        ALGORITHM_FUNCTION(PageRankFunction), ALGORITHM_FUNCTION(TriangleCountFunction),
+        ALGORITHM_FUNCTION(LocalClusteringCoefficientFunction),
+        ALGORITHM_FUNCTION(LouvainFunction),
+        ALGORITHM_FUNCTION(StronglyConnectedComponentsFunction),
+        ALGORITHM_FUNCTION(KCoreDecompositionFunction),
+        ALGORITHM_FUNCTION(QueryVectorIndexFunction), ALGORITHM_FUNCTION(QueryFTSIndexFunction),
 
         // Export functions
         EXPORT_FUNCTION(ExportCSVFunction), EXPORT_FUNCTION(ExportParquetFunction),
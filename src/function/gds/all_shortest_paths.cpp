@@ -232,6 +232,9 @@ public:
         mask.setToFiltered(activeCount);
     }
 
+    // Multiplicities sum over all frontier neighbors.
+    bool requiresAllFrontierNbrs() const override { return true; }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<AllSPLengthsEdgeCompute>(frontierPair, multiplicities);
     }
@@ -275,6 +278,9 @@ public:
         mask.setToFiltered(activeCount);
     }
 
+    // Every frontier neighbor is a parent.
+    bool requiresAllFrontierNbrs() const override { return true; }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<AllSPPathsEdgeCompute>(frontiersPair, bfsGraph);
     }
@@ -358,7 +364,7 @@ public:
     AllSPPathsAlgorithm(const AllSPPathsAlgorithm& other) : SPAlgorithm{other} {}
 
     expression_vector getResultColumns(Binder* binder) const override {
-        auto columns = getBaseResultColumns(binder);
+        auto columns = getPathsBaseResultColumns(binder);
         columns.push_back(getLengthColumn(binder));
         columns.push_back(getPathNodeIDsColumn(binder));
         columns.push_back(getPathEdgeIDsColumn(binder));
@@ -454,7 +460,7 @@ public:
     }
 
     binder::expression_vector getResultColumns(Binder* binder) const override {
-        auto columns = getBaseResultColumns(binder);
+        auto columns = getPathsBaseResultColumns(binder);
         columns.push_back(getLengthColumn(binder));
         columns.push_back(getPathNodeIDsColumn(binder));
         columns.push_back(getPathEdgeIDsColumn(binder));
@@ -1,8 +1,12 @@
 #include "function/gds/gds.h"
 
 #include "binder/binder.h"
+#include "binder/expression/property_expression.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
 
 using namespace kuzu::binder;
+using namespace kuzu::common;
 using namespace kuzu::main;
 using namespace kuzu::graph;
 using namespace kuzu::processor;
@@ -17,5 +21,37 @@ std::shared_ptr<Expression> GDSAlgorithm::bindNodeOutput(Binder* binder,
     return node;
 }
 
+std::shared_ptr<Expression> GDSAlgorithm::bindRelWeightProperty(const std::string& propertyName,
+    Binder* binder, const GraphEntry& graphEntry) {
+    auto rel = binder->createNonRecursiveQueryRel("", graphEntry.relEntries, nullptr /* srcNode */,
+        nullptr /* dstNode */, RelDirectionType::SINGLE);
+    auto property =
+        binder->getExpressionBinder()->bindNodeOrRelPropertyExpression(*rel, propertyName);
+    for (auto& entry : graphEntry.relEntries) {
+        if (!property->constCast<PropertyExpression>().hasProperty(entry->getTableID())) {
+            throw BinderException(stringFormat("Table {} does not have property {}.",
+                entry->getName(), propertyName));
+        }
+    }
+    switch (property->getDataType().getLogicalTypeID()) {
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+        break;
+    default:
+        throw BinderException(stringFormat("Cannot use property {} of type {} as weight. Weights "
+                                           "must be integers or floating points.",
+            propertyName, property->getDataType().toString()));
+    }
+    return property;
+}
+
 } // namespace function
 } // namespace kuzu
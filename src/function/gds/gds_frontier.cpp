@@ -5,8 +5,38 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace function {
 
+ActiveOffsets::ActiveOffsets(offset_t numOffsets, storage::MemoryManager* mm)
+    : numOffsets{numOffsets},
+      numWords{(numOffsets + NUM_OFFSETS_PER_WORD - 1) / NUM_OFFSETS_PER_WORD},
+      // The sparse list takes as much memory as the bitmap, except for tiny tables.
+      sparseCapacity{std::min(numOffsets, std::max(numWords, MIN_SPARSE_CAPACITY))} {
+    wordsBuffer = mm->allocateBuffer(false, numWords * sizeof(std::atomic<uint64_t>));
+    words = reinterpret_cast<std::atomic<uint64_t>*>(wordsBuffer->getData());
+    for (auto i = 0u; i < numWords; ++i) {
+        words[i].store(0, std::memory_order_relaxed);
+    }
+    sparseOffsetsBuffer = mm->allocateBuffer(false, sparseCapacity * sizeof(offset_t));
+    sparseOffsets = reinterpret_cast<offset_t*>(sparseOffsetsBuffer->getData());
+    numActiveOffsets.store(0, std::memory_order_relaxed);
+}
+
+void ActiveOffsets::clear() {
+    if (isSparse()) {
+        // Every set bit is in the sparse list, so clearing the words of the listed offsets clears
+        // the bitmap.
+        for (auto offset : getSparseOffsets()) {
+            words[offset / NUM_OFFSETS_PER_WORD].store(0, std::memory_order_relaxed);
+        }
+    } else {
+        for (auto i = 0u; i < numWords; ++i) {
+            words[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    numActiveOffsets.store(0, std::memory_order_relaxed);
+}
+
 FrontierMorselDispatcher::FrontierMorselDispatcher(uint64_t _maxThreadsForExec)
-    : morselSize(UINT64_MAX) {
+    : morselSize(UINT64_MAX), activeOffsets{nullptr}, activeOffsetsSparse{false} {
     maxThreadsForExec.store(_maxThreadsForExec);
     tableID.store(INVALID_TABLE_ID);
     numOffsets.store(INVALID_OFFSET);
@@ -17,6 +47,28 @@ void FrontierMorselDispatcher::init(common::table_id_t _tableID, common::offset_
     tableID.store(_tableID);
     numOffsets.store(_numOffsets);
     nextOffset.store(0u);
+    activeOffsets = nullptr;
+    activeOffsetsSparse = false;
+    initMorselSize();
+}
+
+void FrontierMorselDispatcher::init(common::table_id_t _tableID,
+    const ActiveOffsets& _activeOffsets) {
+    tableID.store(_tableID);
+    activeOffsets = &_activeOffsets;
+    activeOffsetsSparse = _activeOffsets.isSparse();
+    numOffsets.store(activeOffsetsSparse ? _activeOffsets.getSparseOffsets().size() :
+                                           _activeOffsets.getNumOffsets());
+    nextOffset.store(0u);
+    initMorselSize();
+    if (!activeOffsetsSparse) {
+        // Dense morsels start at the beginning of a bitmap word.
+        morselSize = (morselSize + ActiveOffsets::NUM_OFFSETS_PER_WORD - 1) /
+                     ActiveOffsets::NUM_OFFSETS_PER_WORD * ActiveOffsets::NUM_OFFSETS_PER_WORD;
+    }
+}
+
+void FrontierMorselDispatcher::initMorselSize() {
     // Frontier size calculation: The ideal scenario is to have k^2 many morsels where k
     // the number of maximum threads that could be working on this frontier. However if
     // that is too small then we default to MIN_FRONTIER_MORSEL_SIZE.
@@ -36,16 +88,26 @@ bool FrontierMorselDispatcher::getNextRangeMorsel(FrontierMorsel& frontierMorsel
         beginOffset + morselSize > numOffsets.load(std::memory_order_relaxed) ?
             numOffsets.load(std::memory_order_relaxed) :
             beginOffset + morselSize;
-    frontierMorsel.initMorsel(tableID.load(std::memory_order_relaxed), beginOffset,
-        endOffsetExclusive);
+    auto morselTableID = tableID.load(std::memory_order_relaxed);
+    if (activeOffsets == nullptr) {
+        frontierMorsel.initMorsel(morselTableID, beginOffset, endOffsetExclusive);
+    } else if (activeOffsetsSparse) {
+        frontierMorsel.initSparseMorsel(morselTableID, activeOffsets->getSparseOffsets().data(),
+            beginOffset, endOffsetExclusive);
+    } else {
+        frontierMorsel.initDenseMorsel(morselTableID, activeOffsets->getWords(), beginOffset,
+            endOffsetExclusive);
+    }
     return true;
 }
 
 PathLengths::PathLengths(std::unordered_map<common::table_id_t, uint64_t> nodeTableIDAndNumNodes,
-    storage::MemoryManager* mm) {
+    storage::MemoryManager* mm)
+    : totalNumNodes{0} {
     curIter.store(0);
     for (const auto& [tableID, numNodes] : nodeTableIDAndNumNodes) {
         nodeTableIDAndNumNodesMap[tableID] = numNodes;
+        totalNumNodes += numNodes;
         auto memBuffer = mm->allocateBuffer(false, numNodes * sizeof(std::atomic<uint16_t>));
         std::atomic<uint16_t>* memBufferPtr =
             reinterpret_cast<std::atomic<uint16_t>*>(memBuffer.get()->getData());
@@ -53,7 +115,21 @@ PathLengths::PathLengths(std::unordered_map<common::table_id_t, uint64_t> nodeTa
             memBufferPtr[i].store(UNVISITED, std::memory_order_relaxed);
         }
         masks.insert({tableID, std::move(memBuffer)});
+        curActiveOffsets.insert({tableID, std::make_unique<ActiveOffsets>(numNodes, mm)});
+        nextActiveOffsets.insert({tableID, std::make_unique<ActiveOffsets>(numNodes, mm)});
     }
+    curFrontierFixedActiveOffsets.store(nullptr, std::memory_order_relaxed);
+    nextFrontierFixedActiveOffsets.store(nullptr, std::memory_order_relaxed);
+}
+
+void PathLengths::incrementCurIter() {
+    curIter.fetch_add(1, std::memory_order_relaxed);
+    std::swap(curActiveOffsets, nextActiveOffsets);
+    for (auto& [_, activeOffsets] : nextActiveOffsets) {
+        activeOffsets->clear();
+    }
+    curFrontierFixedActiveOffsets.store(nullptr, std::memory_order_relaxed);
+    nextFrontierFixedActiveOffsets.store(nullptr, std::memory_order_relaxed);
 }
 
 void PathLengths::fixCurFrontierNodeTable(common::table_id_t tableID) {
@@ -65,6 +141,8 @@ void PathLengths::fixCurFrontierNodeTable(common::table_id_t tableID) {
     maxNodesInCurFrontierFixedMask.store(
         nodeTableIDAndNumNodesMap[curTableID.load(std::memory_order_relaxed)],
         std::memory_order_relaxed);
+    curFrontierFixedActiveOffsets.store(curActiveOffsets.at(tableID).get(),
+        std::memory_order_relaxed);
 }
 
 void PathLengths::fixNextFrontierNodeTable(common::table_id_t tableID) {
@@ -72,6 +150,8 @@ void PathLengths::fixNextFrontierNodeTable(common::table_id_t tableID) {
     nextFrontierFixedMask.store(
         reinterpret_cast<std::atomic<uint16_t>*>(masks.at(tableID).get()->getData()),
         std::memory_order_relaxed);
+    nextFrontierFixedActiveOffsets.store(nextActiveOffsets.at(tableID).get(),
+        std::memory_order_relaxed);
 }
 
 FrontierPair::FrontierPair(std::shared_ptr<GDSFrontier> curFrontier,
@@ -96,8 +176,15 @@ void SinglePathLengthsFrontierPair::beginFrontierComputeBetweenTables(table_id_t
     table_id_t nextFrontierTableID) {
     pathLengths->fixCurFrontierNodeTable(curFrontierTableID);
     pathLengths->fixNextFrontierNodeTable(nextFrontierTableID);
-    morselDispatcher.init(curFrontierTableID,
-        pathLengths->getNumNodesInCurFrontierFixedNodeTable());
+    // Pull iterations visit the nodes that are not in the current frontier, see
+    // GDSUtils::runFrontiersUntilConvergence.
+    if (pullIteration && curFrontierTableID == nextFrontierTableID) {
+        morselDispatcher.init(curFrontierTableID,
+            pathLengths->getNumNodesInCurFrontierFixedNodeTable());
+    } else {
+        morselDispatcher.init(curFrontierTableID,
+            pathLengths->getCurFrontierFixedActiveOffsets());
+    }
 }
 
 bool SinglePathLengthsFrontierPair::getNextRangeMorsel(FrontierMorsel& frontierMorsel) {
@@ -109,6 +196,23 @@ void SinglePathLengthsFrontierPair::initRJFromSource(nodeID_t source) {
     pathLengths->setActive(source);
 }
 
+void SinglePathLengthsFrontierPair::beginNewIterationInternalNoLock() {
+    pathLengths->incrementCurIter();
+    auto numActiveNodes = numApproxActiveNodesForCurIter.load();
+    auto numNodes = pathLengths->getTotalNumNodes();
+    numApproxVisitedNodes += numActiveNodes;
+    if (numNodes < MIN_NUM_NODES_TO_PULL) {
+        return;
+    }
+    auto numUnvisitedNodes =
+        numApproxVisitedNodes >= numNodes ? 0 : numNodes - numApproxVisitedNodes;
+    if (!pullIteration) {
+        pullIteration = numActiveNodes * PUSH_TO_PULL_FACTOR > numUnvisitedNodes;
+    } else {
+        pullIteration = numActiveNodes * PULL_TO_PUSH_FACTOR >= numNodes;
+    }
+}
+
 DoublePathLengthsFrontierPair::DoublePathLengthsFrontierPair(
     std::unordered_map<common::table_id_t, uint64_t> nodeTableIDAndNumNodes,
     uint64_t maxThreadsForExec, storage::MemoryManager* mm)
@@ -127,7 +231,7 @@ void DoublePathLengthsFrontierPair::beginFrontierComputeBetweenTables(table_id_t
     curFrontier->ptrCast<PathLengths>()->fixCurFrontierNodeTable(curFrontierTableID);
     nextFrontier->ptrCast<PathLengths>()->fixNextFrontierNodeTable(nextFrontierTableID);
     morselDispatcher->init(curFrontierTableID,
-        curFrontier->ptrCast<PathLengths>()->getNumNodesInCurFrontierFixedNodeTable());
+        curFrontier->ptrCast<PathLengths>()->getCurFrontierFixedActiveOffsets());
 }
 
 void DoublePathLengthsFrontierPair::initRJFromSource(nodeID_t source) {
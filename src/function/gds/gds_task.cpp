@@ -29,23 +29,23 @@ void FrontierTask::run() {
             if (sharedState->frontierPair.curFrontier->isActive(nodeID)) {
                 switch (info.direction) {
                 case ExtendDirection::FWD: {
-                    for (auto [nodes, edges, mask] : graph->scanFwd(nodeID, *scanState)) {
+                    for (auto [nodes, edges, weights, mask] : graph->scanFwd(nodeID, *scanState)) {
                         numApproxActiveNodesForNextIter += computeScanResult(nodeID, nodes, edges,
                             mask, *localEc, sharedState->frontierPair, true);
                     }
                 } break;
                 case ExtendDirection::BWD: {
-                    for (auto [nodes, edges, mask] : graph->scanBwd(nodeID, *scanState)) {
+                    for (auto [nodes, edges, weights, mask] : graph->scanBwd(nodeID, *scanState)) {
                         numApproxActiveNodesForNextIter += computeScanResult(nodeID, nodes, edges,
                             mask, *localEc, sharedState->frontierPair, false);
                     }
                 } break;
                 case ExtendDirection::BOTH: {
-                    for (auto [nodes, edges, mask] : graph->scanFwd(nodeID, *scanState)) {
+                    for (auto [nodes, edges, weights, mask] : graph->scanFwd(nodeID, *scanState)) {
                         numApproxActiveNodesForNextIter += computeScanResult(nodeID, nodes, edges,
                             mask, *localEc, sharedState->frontierPair, true);
                     }
-                    for (auto [nodes, edges, mask] : graph->scanBwd(nodeID, *scanState)) {
+                    for (auto [nodes, edges, weights, mask] : graph->scanBwd(nodeID, *scanState)) {
                         numApproxActiveNodesForNextIter += computeScanResult(nodeID, nodes, edges,
                             mask, *localEc, sharedState->frontierPair, false);
                     }
@@ -60,6 +60,76 @@ void FrontierTask::run() {
         numApproxActiveNodesForNextIter);
 }
 
+bool FrontierPullTask::pullFromFrontier(nodeID_t nodeID, graph::Graph::Iterator iterator,
+    EdgeCompute& ec, SelectionVector& mask, bool isFwd) {
+    auto& frontierPair = sharedState->frontierPair;
+    auto requiresAllNbrs = ec.requiresAllFrontierNbrs();
+    auto isActive = false;
+    for (const auto chunk : iterator) {
+        for (auto i = 0u; i < chunk.selVector.getSelSize(); i++) {
+            auto pos = chunk.selVector[i];
+            auto nbrNodeID = chunk.nbrNodes[pos];
+            if (!frontierPair.curFrontier->isActive(nbrNodeID)) {
+                continue;
+            }
+            mask.setToUnfiltered(1);
+            ec.edgeCompute(nbrNodeID, std::span(&nodeID, 1), chunk.edges.subspan(pos, 1), mask,
+                isFwd);
+            if (mask.getSelSize() > 0) {
+                // Set the node active right away, so that the edge computes of the frontier
+                // neighbors scanned after this one see it as visited in this iteration.
+                frontierPair.getNextFrontierUnsafe().setActive(nodeID);
+                isActive = true;
+            }
+            if (isActive && !requiresAllNbrs) {
+                return true;
+            }
+        }
+    }
+    return isActive;
+}
+
+void FrontierPullTask::run() {
+    FrontierMorsel frontierMorsel;
+    auto numApproxActiveNodesForNextIter = 0u;
+    auto graph = info.graph;
+    auto scanState = graph->prepareScan(info.relTableIDToScan);
+    auto localEc = info.edgeCompute.copy();
+    SelectionVector mask{1};
+    auto& frontierPair = sharedState->frontierPair;
+    while (frontierPair.getNextRangeMorsel(frontierMorsel)) {
+        while (frontierMorsel.hasNextOffset()) {
+            common::nodeID_t nodeID = frontierMorsel.getNextNodeID();
+            if (!frontierPair.isReachableInCurIter(nodeID)) {
+                continue;
+            }
+            auto isActive = false;
+            switch (info.direction) {
+            case ExtendDirection::FWD: {
+                isActive = pullFromFrontier(nodeID, graph->scanBwd(nodeID, *scanState), *localEc,
+                    mask, true);
+            } break;
+            case ExtendDirection::BWD: {
+                isActive = pullFromFrontier(nodeID, graph->scanFwd(nodeID, *scanState), *localEc,
+                    mask, false);
+            } break;
+            case ExtendDirection::BOTH: {
+                isActive = pullFromFrontier(nodeID, graph->scanBwd(nodeID, *scanState), *localEc,
+                    mask, true);
+                if (!isActive || localEc->requiresAllFrontierNbrs()) {
+                    isActive |= pullFromFrontier(nodeID, graph->scanFwd(nodeID, *scanState),
+                        *localEc, mask, false);
+                }
+            } break;
+            default:
+                KU_UNREACHABLE;
+            }
+            numApproxActiveNodesForNextIter += isActive;
+        }
+    }
+    frontierPair.incrementApproxActiveNodesForNextIter(numApproxActiveNodesForNextIter);
+}
+
 VertexComputeTaskSharedState::VertexComputeTaskSharedState(graph::Graph* graph, VertexCompute& vc,
     uint64_t maxThreadsForExecution)
     : graph{graph}, vc{vc} {
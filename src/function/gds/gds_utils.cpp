@@ -28,7 +28,15 @@ void GDSUtils::runFrontiersUntilConvergence(processor::ExecutionContext* context
             auto sharedState = std::make_shared<FrontierTaskSharedState>(*frontierPair);
             auto maxThreads =
                 clientContext->getCurrentSetting(main::ThreadsSetting::name).getValue<uint64_t>();
-            auto task = std::make_shared<FrontierTask>(maxThreads, info, sharedState);
+            std::shared_ptr<Task> task;
+            // Pulling iterates over the nodes of the next frontier, which the frontier pair only
+            // dispatches when they are in the same table as the current frontier.
+            if (frontierPair->isPullIteration() &&
+                relTableIDInfo.fromNodeTableID == relTableIDInfo.toNodeTableID) {
+                task = std::make_shared<FrontierPullTask>(maxThreads, info, sharedState);
+            } else {
+                task = std::make_shared<FrontierTask>(maxThreads, info, sharedState);
+            }
             // GDSUtils::runFrontiersUntilConvergence is called from a GDSCall operator, which is
             // already executed by a worker thread Tm of the task scheduler. So this function is
             // executed by Tm. Because this function will monitor the task and wait for it to
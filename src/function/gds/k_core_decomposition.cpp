@@ -0,0 +1,373 @@
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+#include "binder/binder.h"
+#include "common/task_system/task_scheduler.h"
+#include "common/types/types.h"
+#include "function/gds/gds_frontier.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds_function.h"
+#include "graph/graph.h"
+#include "main/client_context.h"
+#include "main/settings.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+// Neighbors of the graph viewed as an undirected simple graph in CSR format, i.e., edges are taken
+// in both directions, and parallel edges and self loops are ignored. Nodes are numbered
+// consecutively across node tables, in the order of Graph::getNodeTableIDs().
+struct UndirectedAdjacency {
+    offset_t numNodes = 0;
+    table_id_map_t<offset_t> firstNodeIdx;
+    std::vector<offset_t> csrOffsets;
+    std::vector<offset_t> nbrs;
+
+    explicit UndirectedAdjacency(Graph* graph) {
+        for (auto tableID : graph->getNodeTableIDs()) {
+            firstNodeIdx.insert({tableID, numNodes});
+            numNodes += graph->getNumNodes(tableID);
+        }
+        csrOffsets.resize(numNodes + 1, 0);
+    }
+
+    offset_t getNodeIdx(nodeID_t nodeID) const {
+        return firstNodeIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    // Must be called after the degree of each node is set at csrOffsets[u + 1].
+    void allocateNbrs() {
+        for (auto u = 0u; u < numNodes; ++u) {
+            csrOffsets[u + 1] += csrOffsets[u];
+        }
+        nbrs.resize(csrOffsets[numNodes]);
+    }
+
+    offset_t getDegree(offset_t u) const { return csrOffsets[u + 1] - csrOffsets[u]; }
+
+    std::span<const offset_t> getNbrs(offset_t u) const {
+        return std::span(nbrs.data() + csrOffsets[u], nbrs.data() + csrOffsets[u + 1]);
+    }
+};
+
+// Builds UndirectedAdjacency in two passes: the first one counts the distinct neighbors of each
+// node, the second one writes them.
+class UndirectedAdjacencyBuilderVC final : public VertexCompute {
+public:
+    UndirectedAdjacencyBuilderVC(Graph* graph, UndirectedAdjacency& adjacency, bool writeNbrs)
+        : graph{graph}, adjacency{adjacency}, writeNbrs{writeNbrs} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        fwdScanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+        bwdScanState = graph->prepareMultiTableScanBwd(nodeTableIDs);
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto nodeIdx = adjacency.getNodeIdx(nodeID);
+        nbrs.clear();
+        auto collect = [&](const GraphScanState::Chunk& chunk) {
+            chunk.selVector.forEach([&](auto i) {
+                auto nbrIdx = adjacency.getNodeIdx(chunk.nbrNodes[i]);
+                if (nbrIdx != nodeIdx) {
+                    nbrs.push_back(nbrIdx);
+                }
+            });
+        };
+        for (const auto chunk : graph->scanFwd(nodeID, *fwdScanState)) {
+            collect(chunk);
+        }
+        for (const auto chunk : graph->scanBwd(nodeID, *bwdScanState)) {
+            collect(chunk);
+        }
+        std::sort(nbrs.begin(), nbrs.end());
+        nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+        if (!writeNbrs) {
+            adjacency.csrOffsets[nodeIdx + 1] = nbrs.size();
+            return;
+        }
+        KU_ASSERT(adjacency.getDegree(nodeIdx) == nbrs.size());
+        std::copy(nbrs.begin(), nbrs.end(), adjacency.nbrs.begin() + adjacency.csrOffsets[nodeIdx]);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<UndirectedAdjacencyBuilderVC>(graph, adjacency, writeNbrs);
+    }
+
+private:
+    Graph* graph;
+    UndirectedAdjacency& adjacency;
+    bool writeNbrs;
+    std::unique_ptr<GraphScanState> fwdScanState;
+    std::unique_ptr<GraphScanState> bwdScanState;
+    std::vector<offset_t> nbrs;
+};
+
+// Thread-local state of a KCoreTask.
+struct KCoreLocalState {
+    std::vector<offset_t> nextNodes;
+    offset_t minDegree = INVALID_OFFSET;
+};
+
+using k_core_task_func_t = std::function<void(offset_t, KCoreLocalState&)>;
+
+struct KCoreTaskSharedState {
+    static constexpr uint64_t MORSEL_SIZE = 512;
+
+    std::span<const offset_t> nodes;
+    k_core_task_func_t func;
+    std::atomic<offset_t> nextPos;
+    std::mutex mtx;
+    std::vector<offset_t> nextNodes;
+    offset_t minDegree;
+
+    KCoreTaskSharedState(std::span<const offset_t> nodes, k_core_task_func_t func)
+        : nodes{nodes}, func{std::move(func)}, nextPos{0}, minDegree{INVALID_OFFSET} {}
+    DELETE_COPY_AND_MOVE(KCoreTaskSharedState);
+};
+
+// Runs func on each node of a list in parallel and collects the nodes each thread adds to its
+// nextNodes.
+class KCoreTask : public Task {
+public:
+    KCoreTask(uint64_t maxNumThreads, std::shared_ptr<KCoreTaskSharedState> sharedState)
+        : Task{maxNumThreads}, sharedState{std::move(sharedState)} {}
+
+    void run() override {
+        KCoreLocalState localState;
+        auto& nodes = sharedState->nodes;
+        while (true) {
+            auto begin = sharedState->nextPos.fetch_add(KCoreTaskSharedState::MORSEL_SIZE,
+                std::memory_order_relaxed);
+            if (begin >= nodes.size()) {
+                break;
+            }
+            auto end = std::min<offset_t>(begin + KCoreTaskSharedState::MORSEL_SIZE, nodes.size());
+            for (auto i = begin; i < end; ++i) {
+                sharedState->func(nodes[i], localState);
+            }
+        }
+        std::unique_lock lck{sharedState->mtx};
+        sharedState->nextNodes.insert(sharedState->nextNodes.end(), localState.nextNodes.begin(),
+            localState.nextNodes.end());
+        sharedState->minDegree = std::min(sharedState->minDegree, localState.minDegree);
+    }
+
+private:
+    std::shared_ptr<KCoreTaskSharedState> sharedState;
+};
+
+// Parallel peeling (Dasari et al., "ParK: An Efficient Algorithm for k-core Decomposition on
+// Multicore Processors"). For k = 0, 1, ..., nodes whose degree among the remaining nodes is at
+// most k are removed with core number k, which lowers the degrees of their neighbors and may
+// remove them too. k skips to the minimum degree of the remaining nodes so that there is a round
+// per distinct core number, and remaining nodes are compacted between rounds.
+class KCoreRunner {
+public:
+    KCoreRunner(ExecutionContext* context, Graph* graph)
+        : context{context}, graph{graph}, adjacency{graph}, degrees(adjacency.numNodes),
+          coreNumbers(adjacency.numNodes) {
+        maxThreads = context->clientContext->getCurrentSetting(main::ThreadsSetting::name)
+                         .getValue<uint64_t>();
+    }
+
+    void run() {
+        UndirectedAdjacencyBuilderVC countVC{graph, adjacency, false /* writeNbrs */};
+        GDSUtils::runVertexComputeIteration(context, graph, countVC);
+        adjacency.allocateNbrs();
+        UndirectedAdjacencyBuilderVC writeVC{graph, adjacency, true /* writeNbrs */};
+        GDSUtils::runVertexComputeIteration(context, graph, writeVC);
+        std::vector<offset_t> remainingNodes(adjacency.numNodes);
+        for (auto u = 0u; u < adjacency.numNodes; ++u) {
+            degrees[u].store(adjacency.getDegree(u), std::memory_order_relaxed);
+            coreNumbers[u].store(INVALID_OFFSET, std::memory_order_relaxed);
+            remainingNodes[u] = u;
+        }
+        offset_t k = 0;
+        while (true) {
+            auto compaction = runTask(remainingNodes, [&](offset_t u, KCoreLocalState& localState) {
+                if (!isRemoved(u)) {
+                    localState.nextNodes.push_back(u);
+                    localState.minDegree = std::min(localState.minDegree,
+                        degrees[u].load(std::memory_order_relaxed));
+                }
+            });
+            remainingNodes = std::move(compaction->nextNodes);
+            if (remainingNodes.empty()) {
+                break;
+            }
+            k = std::max(k, compaction->minDegree);
+            auto frontier =
+                std::move(runTask(remainingNodes, [&](offset_t u, KCoreLocalState& localState) {
+                    if (degrees[u].load(std::memory_order_relaxed) <= k && tryRemove(u, k)) {
+                        localState.nextNodes.push_back(u);
+                    }
+                })->nextNodes);
+            while (!frontier.empty()) {
+                frontier = std::move(
+                    runTask(frontier, [&](offset_t u, KCoreLocalState& localState) {
+                        peel(u, k, localState);
+                    })->nextNodes);
+            }
+        }
+    }
+
+    offset_t getNodeIdx(nodeID_t nodeID) const { return adjacency.getNodeIdx(nodeID); }
+
+    int64_t getCoreNumber(offset_t nodeIdx) const {
+        return coreNumbers[nodeIdx].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<KCoreTaskSharedState> runTask(std::span<const offset_t> nodes,
+        k_core_task_func_t func) {
+        auto sharedState = std::make_shared<KCoreTaskSharedState>(nodes, std::move(func));
+        auto task = std::make_shared<KCoreTask>(maxThreads, sharedState);
+        // See GDSUtils::runFrontiersUntilConvergence for why a new worker thread is launched.
+        context->clientContext->getTaskScheduler()->scheduleTaskAndWaitOrError(task, context,
+            true /* launchNewWorkerThread */);
+        return sharedState;
+    }
+
+    // Lowers the degrees of the remaining neighbors of u, which has been removed with core number
+    // k. Only the decrement that drops the degree of a neighbor to k removes it.
+    void peel(offset_t u, offset_t k, KCoreLocalState& localState) {
+        for (auto v : adjacency.getNbrs(u)) {
+            if (!isRemoved(v) && degrees[v].fetch_sub(1, std::memory_order_relaxed) == k + 1 &&
+                tryRemove(v, k)) {
+                localState.nextNodes.push_back(v);
+            }
+        }
+    }
+
+    bool isRemoved(offset_t u) const {
+        return coreNumbers[u].load(std::memory_order_relaxed) != INVALID_OFFSET;
+    }
+
+    bool tryRemove(offset_t u, offset_t k) {
+        auto expected = INVALID_OFFSET;
+        return coreNumbers[u].compare_exchange_strong(expected, k, std::memory_order_relaxed);
+    }
+
+private:
+    ExecutionContext* context;
+    Graph* graph;
+    uint64_t maxThreads;
+    UndirectedAdjacency adjacency;
+    // Number of neighbors that are not removed.
+    std::vector<std::atomic<offset_t>> degrees;
+    std::vector<std::atomic<offset_t>> coreNumbers;
+};
+
+class KCoreOutputWriterVC final : public VertexCompute {
+public:
+    KCoreOutputWriterVC(main::ClientContext* context, const KCoreRunner& runner,
+        FactorizedTable& globalFT, std::mutex& mtx)
+        : context{context}, runner{runner}, globalFT{globalFT}, mtx{mtx} {
+        auto mm = context->getMemoryManager();
+        localFT = std::make_unique<FactorizedTable>(mm, globalFT.getTableSchema()->copy());
+        nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        kDegreeVector = std::make_unique<ValueVector>(LogicalType::INT64(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        kDegreeVector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(nodeIDVector.get());
+        vectors.push_back(kDegreeVector.get());
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        kDegreeVector->setValue<int64_t>(0, runner.getCoreNumber(runner.getNodeIdx(nodeID)));
+        localFT->append(vectors);
+    }
+
+    void finalizeWorkerThread() override {
+        std::unique_lock lck{mtx};
+        globalFT.merge(*localFT);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<KCoreOutputWriterVC>(context, runner, globalFT, mtx);
+    }
+
+private:
+    main::ClientContext* context;
+    const KCoreRunner& runner;
+    FactorizedTable& globalFT;
+    std::mutex& mtx;
+    std::unique_ptr<FactorizedTable> localFT;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> kDegreeVector;
+    std::vector<ValueVector*> vectors;
+};
+
+class KCoreDecomposition final : public GDSAlgorithm {
+    static constexpr char K_DEGREE_COLUMN_NAME[] = "k_degree";
+
+public:
+    KCoreDecomposition() = default;
+    KCoreDecomposition(const KCoreDecomposition& other) : GDSAlgorithm{other} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     */
+    std::vector<common::LogicalTypeID> getParameterTypeIDs() const override {
+        return std::vector<LogicalTypeID>{LogicalTypeID::ANY};
+    }
+
+    /*
+     * Outputs are
+     *
+     * _node._id::INTERNAL_ID
+     * k_degree::INT64
+     */
+    binder::expression_vector getResultColumns(binder::Binder* binder) const override {
+        expression_vector columns;
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        columns.push_back(binder->createVariable(K_DEGREE_COLUMN_NAME, LogicalType::INT64()));
+        return columns;
+    }
+
+    void bind(const expression_vector&, Binder* binder, GraphEntry& graphEntry) override {
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        bindData = std::make_unique<GDSBindData>(nodeOutput);
+    }
+
+    void exec(processor::ExecutionContext* context) override {
+        auto graph = sharedState->graph.get();
+        if (graph->getNumNodes() == 0) {
+            return;
+        }
+        KCoreRunner runner{context, graph};
+        runner.run();
+        std::mutex mtx;
+        KCoreOutputWriterVC writerVC{context->clientContext, runner, *sharedState->fTable, mtx};
+        GDSUtils::runVertexComputeIteration(context, graph, writerVC);
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<KCoreDecomposition>(*this);
+    }
+};
+
+function_set KCoreDecompositionFunction::getFunctionSet() {
+    function_set result;
+    auto algo = std::make_unique<KCoreDecomposition>();
+    auto function =
+        std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo));
+    result.push_back(std::move(function));
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
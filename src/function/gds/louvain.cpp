@@ -0,0 +1,563 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "binder/binder.h"
+#include "binder/expression/expression_util.h"
+#include "common/exception/runtime.h"
+#include "common/task_system/task_scheduler.h"
+#include "common/types/types.h"
+#include "function/gds/gds_frontier.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds_function.h"
+#include "graph/graph.h"
+#include "main/client_context.h"
+#include "main/settings.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+// Undirected weighted graph in CSR format whose nodes Louvain moves between communities. The first
+// level is the projected graph and each following level has a node per community of the previous
+// level. The weight of the edge between two nodes of a level is the sum of the weights of the edges
+// between their members, including the edges within a node, which become a self loop. Every edge
+// is stored at both of its endpoints, so a self loop is stored twice.
+struct LouvainGraph {
+    offset_t numNodes = 0;
+    std::vector<offset_t> csrOffsets;
+    std::vector<offset_t> nbrs;
+    std::vector<double> weights;
+    // Sum of the weights of the edges of each node.
+    std::vector<double> nodeWeights;
+    // Sum of nodeWeights, i.e., twice the total edge weight.
+    double totalWeight = 0;
+
+    explicit LouvainGraph(offset_t numNodes) : numNodes{numNodes}, csrOffsets(numNodes + 1, 0) {}
+
+    // Must be called after csrOffsets are set.
+    void allocateEdges() {
+        nbrs.resize(csrOffsets[numNodes]);
+        weights.resize(csrOffsets[numNodes]);
+    }
+
+    void computeNodeWeights() {
+        nodeWeights.resize(numNodes);
+        totalWeight = 0;
+        for (auto u = 0u; u < numNodes; ++u) {
+            nodeWeights[u] = 0;
+            for (auto i = csrOffsets[u]; i < csrOffsets[u + 1]; ++i) {
+                nodeWeights[u] += weights[i];
+            }
+            totalWeight += nodeWeights[u];
+        }
+    }
+};
+
+// Thread-local accumulators of a LouvainTask.
+struct LouvainLocalState {
+    // Total weight of the edges from the node being processed to each neighboring community.
+    std::unordered_map<offset_t, double> communityWeights;
+    std::vector<std::pair<offset_t, double>> sortedCommunityWeights;
+    double modularityGain = 0;
+    uint64_t numMoves = 0;
+};
+
+using louvain_task_func_t = std::function<void(offset_t, LouvainLocalState&)>;
+
+struct LouvainTaskSharedState {
+    static constexpr uint64_t MORSEL_SIZE = 512;
+
+    offset_t numItems;
+    louvain_task_func_t func;
+    std::atomic<offset_t> nextItem;
+    std::mutex mtx;
+    double modularityGain;
+    uint64_t numMoves;
+
+    LouvainTaskSharedState(offset_t numItems, louvain_task_func_t func)
+        : numItems{numItems}, func{std::move(func)}, nextItem{0}, modularityGain{0},
+          numMoves{0} {}
+    DELETE_COPY_AND_MOVE(LouvainTaskSharedState);
+};
+
+// Runs func on items [0, numItems) in parallel.
+class LouvainTask : public Task {
+public:
+    LouvainTask(uint64_t maxNumThreads, std::shared_ptr<LouvainTaskSharedState> sharedState)
+        : Task{maxNumThreads}, sharedState{std::move(sharedState)} {}
+
+    void run() override {
+        LouvainLocalState localState;
+        while (true) {
+            auto begin = sharedState->nextItem.fetch_add(LouvainTaskSharedState::MORSEL_SIZE,
+                std::memory_order_relaxed);
+            if (begin >= sharedState->numItems) {
+                break;
+            }
+            auto end = std::min<offset_t>(begin + LouvainTaskSharedState::MORSEL_SIZE,
+                sharedState->numItems);
+            for (auto i = begin; i < end; ++i) {
+                sharedState->func(i, localState);
+            }
+        }
+        std::unique_lock lck{sharedState->mtx};
+        sharedState->modularityGain += localState.modularityGain;
+        sharedState->numMoves += localState.numMoves;
+    }
+
+private:
+    std::shared_ptr<LouvainTaskSharedState> sharedState;
+};
+
+// Builds the first level LouvainGraph from the projected graph in two passes: the first one counts
+// the distinct neighbors of each node, the second one writes its edges.
+class LouvainGraphBuilderVC final : public VertexCompute {
+public:
+    LouvainGraphBuilderVC(Graph* graph, const table_id_map_t<offset_t>& firstNodeIdx,
+        LouvainGraph& louvainGraph, bool writeEdges)
+        : graph{graph}, firstNodeIdx{firstNodeIdx}, louvainGraph{louvainGraph},
+          writeEdges{writeEdges} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        fwdScanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+        bwdScanState = graph->prepareMultiTableScanBwd(nodeTableIDs);
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        edges.clear();
+        for (const auto chunk : graph->scanFwd(nodeID, *fwdScanState)) {
+            collectEdges(chunk);
+        }
+        for (const auto chunk : graph->scanBwd(nodeID, *bwdScanState)) {
+            collectEdges(chunk);
+        }
+        std::sort(edges.begin(), edges.end());
+        // Merge parallel edges.
+        auto numNbrs = 0u;
+        for (auto i = 0u; i < edges.size(); ++i) {
+            if (numNbrs > 0 && edges[numNbrs - 1].first == edges[i].first) {
+                edges[numNbrs - 1].second += edges[i].second;
+            } else {
+                edges[numNbrs++] = edges[i];
+            }
+        }
+        auto nodeIdx = getNodeIdx(nodeID);
+        if (!writeEdges) {
+            louvainGraph.csrOffsets[nodeIdx + 1] = numNbrs;
+            return;
+        }
+        auto csrOffset = louvainGraph.csrOffsets[nodeIdx];
+        KU_ASSERT(csrOffset + numNbrs == louvainGraph.csrOffsets[nodeIdx + 1]);
+        for (auto i = 0u; i < numNbrs; ++i) {
+            louvainGraph.nbrs[csrOffset + i] = edges[i].first;
+            louvainGraph.weights[csrOffset + i] = edges[i].second;
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<LouvainGraphBuilderVC>(graph, firstNodeIdx, louvainGraph,
+            writeEdges);
+    }
+
+private:
+    offset_t getNodeIdx(nodeID_t nodeID) const {
+        return firstNodeIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    void collectEdges(const GraphScanState::Chunk& chunk) {
+        chunk.selVector.forEach([&](auto i) {
+            auto weight = 1.0;
+            if (!chunk.weights.empty()) {
+                weight = chunk.weights[i];
+                if (std::isnan(weight)) {
+                    return;
+                }
+                if (weight < 0) {
+                    throw RuntimeException("Louvain only works for non-negative weights.");
+                }
+            }
+            edges.emplace_back(getNodeIdx(chunk.nbrNodes[i]), weight);
+        });
+    }
+
+private:
+    Graph* graph;
+    const table_id_map_t<offset_t>& firstNodeIdx;
+    LouvainGraph& louvainGraph;
+    bool writeEdges;
+    std::unique_ptr<GraphScanState> fwdScanState;
+    std::unique_ptr<GraphScanState> bwdScanState;
+    std::vector<std::pair<offset_t, double>> edges;
+};
+
+// Community assignment of the nodes of a LouvainGraph. Community ids are node ids of the level and
+// every node starts in its own community.
+class LouvainCommunities {
+public:
+    explicit LouvainCommunities(const LouvainGraph& graph)
+        : graph{graph}, communities(graph.numNodes), communityWeights(graph.numNodes),
+          communitySizes(graph.numNodes) {
+        for (auto u = 0u; u < graph.numNodes; ++u) {
+            communities[u].store(u, std::memory_order_relaxed);
+            communityWeights[u].store(graph.nodeWeights[u], std::memory_order_relaxed);
+            communitySizes[u].store(1, std::memory_order_relaxed);
+        }
+    }
+
+    offset_t getCommunity(offset_t u) const {
+        return communities[u].load(std::memory_order_relaxed);
+    }
+
+    // Moves u to the neighboring community that increases modularity the most, if any. The gain of
+    // moving u from community a to community b is proportional to
+    //   (k_u,b - k_u,a) - k_u * (tot_b - (tot_a - k_u)) / totalWeight,
+    // where k_u,c is the weight of the edges between u and community c, k_u is the weight of u and
+    // tot_c is the weight of community c.
+    void moveNode(offset_t u, LouvainLocalState& localState) {
+        auto nodeWeight = graph.nodeWeights[u];
+        if (nodeWeight == 0) {
+            return;
+        }
+        auto& nbrCommunityWeights = localState.communityWeights;
+        nbrCommunityWeights.clear();
+        for (auto i = graph.csrOffsets[u]; i < graph.csrOffsets[u + 1]; ++i) {
+            if (graph.nbrs[i] != u) {
+                nbrCommunityWeights[getCommunity(graph.nbrs[i])] += graph.weights[i];
+            }
+        }
+        auto community = getCommunity(u);
+        auto isSingleton = communitySizes[community].load(std::memory_order_relaxed) == 1;
+        auto communityWeight =
+            communityWeights[community].load(std::memory_order_relaxed) - nodeWeight;
+        auto stayScore =
+            nbrCommunityWeights[community] - nodeWeight * communityWeight / graph.totalWeight;
+        // Visit the candidates in the order of their ids so that ties are broken deterministically.
+        auto& candidates = localState.sortedCommunityWeights;
+        candidates.assign(nbrCommunityWeights.begin(), nbrCommunityWeights.end());
+        std::sort(candidates.begin(), candidates.end());
+        auto bestCommunity = community;
+        auto bestScore = stayScore;
+        for (auto& [candidate, weight] : candidates) {
+            if (candidate == community) {
+                continue;
+            }
+            // Two singletons moving into each other's community in parallel would swap forever, so
+            // singletons only move to communities with smaller ids.
+            if (isSingleton && candidate > community &&
+                communitySizes[candidate].load(std::memory_order_relaxed) == 1) {
+                continue;
+            }
+            auto score = weight - nodeWeight *
+                                      communityWeights[candidate].load(std::memory_order_relaxed) /
+                                      graph.totalWeight;
+            if (score > bestScore) {
+                bestScore = score;
+                bestCommunity = candidate;
+            }
+        }
+        if (bestCommunity == community) {
+            return;
+        }
+        communities[u].store(bestCommunity, std::memory_order_relaxed);
+        communityWeights[community].fetch_sub(nodeWeight, std::memory_order_relaxed);
+        communityWeights[bestCommunity].fetch_add(nodeWeight, std::memory_order_relaxed);
+        communitySizes[community].fetch_sub(1, std::memory_order_relaxed);
+        communitySizes[bestCommunity].fetch_add(1, std::memory_order_relaxed);
+        localState.modularityGain += 2 * (bestScore - stayScore) / graph.totalWeight;
+        localState.numMoves++;
+    }
+
+private:
+    const LouvainGraph& graph;
+    std::vector<std::atomic<offset_t>> communities;
+    std::vector<std::atomic<double>> communityWeights;
+    std::vector<std::atomic<offset_t>> communitySizes;
+};
+
+// Parallel Louvain (Blondel et al., "Fast unfolding of communities in large networks"). Each phase
+// moves the nodes of the current level between communities in parallel until modularity stops
+// improving, then aggregates each community into a node of the next level.
+class LouvainRunner {
+    static constexpr uint64_t MAX_PHASES = 20;
+    static constexpr uint64_t MAX_ITERATIONS_PER_PHASE = 20;
+    static constexpr double MIN_MODULARITY_GAIN = 1e-7;
+
+public:
+    LouvainRunner(ExecutionContext* context, Graph* graph) : context{context}, graph{graph} {
+        maxThreads = context->clientContext->getCurrentSetting(main::ThreadsSetting::name)
+                         .getValue<uint64_t>();
+        offset_t numNodes = 0;
+        for (auto tableID : graph->getNodeTableIDs()) {
+            firstNodeIdx.insert({tableID, numNodes});
+            numNodes += graph->getNumNodes(tableID);
+        }
+        nodeCommunities.resize(numNodes);
+        for (auto i = 0u; i < numNodes; ++i) {
+            nodeCommunities[i] = i;
+        }
+    }
+
+    void run() {
+        auto level = buildFirstLevel();
+        for (auto phase = 0u; phase < MAX_PHASES; ++phase) {
+            if (level->totalWeight == 0) {
+                break;
+            }
+            LouvainCommunities communities{*level};
+            if (!moveNodes(*level, communities)) {
+                break;
+            }
+            level = aggregate(*level, communities);
+        }
+        renumberCommunities();
+    }
+
+    offset_t getNodeIdx(nodeID_t nodeID) const {
+        return firstNodeIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    // Communities are numbered consecutively in the order of their first nodes.
+    int64_t getCommunity(offset_t nodeIdx) const { return nodeCommunities[nodeIdx]; }
+
+private:
+    std::unique_ptr<LouvainGraph> buildFirstLevel() {
+        auto level = std::make_unique<LouvainGraph>(nodeCommunities.size());
+        LouvainGraphBuilderVC countVC{graph, firstNodeIdx, *level, false /* writeEdges */};
+        GDSUtils::runVertexComputeIteration(context, graph, countVC);
+        for (auto u = 0u; u < level->numNodes; ++u) {
+            level->csrOffsets[u + 1] += level->csrOffsets[u];
+        }
+        level->allocateEdges();
+        LouvainGraphBuilderVC writeVC{graph, firstNodeIdx, *level, true /* writeEdges */};
+        GDSUtils::runVertexComputeIteration(context, graph, writeVC);
+        level->computeNodeWeights();
+        return level;
+    }
+
+    std::shared_ptr<LouvainTaskSharedState> runTask(offset_t numItems, louvain_task_func_t func) {
+        auto sharedState = std::make_shared<LouvainTaskSharedState>(numItems, std::move(func));
+        auto task = std::make_shared<LouvainTask>(maxThreads, sharedState);
+        // See GDSUtils::runFrontiersUntilConvergence for why a new worker thread is launched.
+        context->clientContext->getTaskScheduler()->scheduleTaskAndWaitOrError(task, context,
+            true /* launchNewWorkerThread */);
+        return sharedState;
+    }
+
+    // Returns whether any node has moved.
+    bool moveNodes(const LouvainGraph& level, LouvainCommunities& communities) {
+        auto moved = false;
+        for (auto iter = 0u; iter < MAX_ITERATIONS_PER_PHASE; ++iter) {
+            auto result = runTask(level.numNodes, [&](offset_t u, LouvainLocalState& localState) {
+                communities.moveNode(u, localState);
+            });
+            moved |= result->numMoves > 0;
+            if (result->numMoves == 0 || result->modularityGain < MIN_MODULARITY_GAIN) {
+                break;
+            }
+        }
+        return moved;
+    }
+
+    // Maps the nodes of the first level to the communities of the current level and builds the
+    // next level, which has a node per community.
+    std::unique_ptr<LouvainGraph> aggregate(const LouvainGraph& level,
+        const LouvainCommunities& communities) {
+        std::vector<offset_t> communityIdx(level.numNodes, INVALID_OFFSET);
+        offset_t numCommunities = 0;
+        for (auto u = 0u; u < level.numNodes; ++u) {
+            auto community = communities.getCommunity(u);
+            if (communityIdx[community] == INVALID_OFFSET) {
+                communityIdx[community] = numCommunities++;
+            }
+        }
+        for (auto& nodeCommunity : nodeCommunities) {
+            nodeCommunity = communityIdx[communities.getCommunity(nodeCommunity)];
+        }
+        // Group the nodes of the level by community.
+        std::vector<offset_t> memberOffsets(numCommunities + 1, 0);
+        for (auto u = 0u; u < level.numNodes; ++u) {
+            memberOffsets[communityIdx[communities.getCommunity(u)] + 1]++;
+        }
+        for (auto c = 0u; c < numCommunities; ++c) {
+            memberOffsets[c + 1] += memberOffsets[c];
+        }
+        std::vector<offset_t> members(level.numNodes);
+        std::vector<offset_t> nextMemberPos(memberOffsets.begin(), memberOffsets.end() - 1);
+        for (auto u = 0u; u < level.numNodes; ++u) {
+            members[nextMemberPos[communityIdx[communities.getCommunity(u)]]++] = u;
+        }
+        // Sum the weights of the edges between communities in parallel.
+        std::vector<std::vector<std::pair<offset_t, double>>> communityEdges(numCommunities);
+        runTask(numCommunities, [&](offset_t c, LouvainLocalState& localState) {
+            auto& nbrCommunityWeights = localState.communityWeights;
+            nbrCommunityWeights.clear();
+            for (auto i = memberOffsets[c]; i < memberOffsets[c + 1]; ++i) {
+                auto u = members[i];
+                for (auto j = level.csrOffsets[u]; j < level.csrOffsets[u + 1]; ++j) {
+                    nbrCommunityWeights[communityIdx[communities.getCommunity(level.nbrs[j])]] +=
+                        level.weights[j];
+                }
+            }
+            auto& edges = communityEdges[c];
+            edges.assign(nbrCommunityWeights.begin(), nbrCommunityWeights.end());
+            std::sort(edges.begin(), edges.end());
+        });
+        auto nextLevel = std::make_unique<LouvainGraph>(numCommunities);
+        for (auto c = 0u; c < numCommunities; ++c) {
+            nextLevel->csrOffsets[c + 1] = nextLevel->csrOffsets[c] + communityEdges[c].size();
+        }
+        nextLevel->allocateEdges();
+        for (auto c = 0u; c < numCommunities; ++c) {
+            auto csrOffset = nextLevel->csrOffsets[c];
+            for (auto i = 0u; i < communityEdges[c].size(); ++i) {
+                nextLevel->nbrs[csrOffset + i] = communityEdges[c][i].first;
+                nextLevel->weights[csrOffset + i] = communityEdges[c][i].second;
+            }
+        }
+        nextLevel->computeNodeWeights();
+        return nextLevel;
+    }
+
+    void renumberCommunities() {
+        std::vector<offset_t> communityIdx(nodeCommunities.size(), INVALID_OFFSET);
+        offset_t numCommunities = 0;
+        for (auto& nodeCommunity : nodeCommunities) {
+            if (communityIdx[nodeCommunity] == INVALID_OFFSET) {
+                communityIdx[nodeCommunity] = numCommunities++;
+            }
+            nodeCommunity = communityIdx[nodeCommunity];
+        }
+    }
+
+private:
+    ExecutionContext* context;
+    Graph* graph;
+    uint64_t maxThreads;
+    table_id_map_t<offset_t> firstNodeIdx;
+    // Community of each node of the first level in the current level.
+    std::vector<offset_t> nodeCommunities;
+};
+
+class LouvainOutputWriterVC final : public VertexCompute {
+public:
+    LouvainOutputWriterVC(main::ClientContext* context, const LouvainRunner& runner,
+        FactorizedTable& globalFT, std::mutex& mtx)
+        : context{context}, runner{runner}, globalFT{globalFT}, mtx{mtx} {
+        auto mm = context->getMemoryManager();
+        localFT = std::make_unique<FactorizedTable>(mm, globalFT.getTableSchema()->copy());
+        nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        communityVector = std::make_unique<ValueVector>(LogicalType::INT64(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        communityVector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(nodeIDVector.get());
+        vectors.push_back(communityVector.get());
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        communityVector->setValue<int64_t>(0, runner.getCommunity(runner.getNodeIdx(nodeID)));
+        localFT->append(vectors);
+    }
+
+    void finalizeWorkerThread() override {
+        std::unique_lock lck{mtx};
+        globalFT.merge(*localFT);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<LouvainOutputWriterVC>(context, runner, globalFT, mtx);
+    }
+
+private:
+    main::ClientContext* context;
+    const LouvainRunner& runner;
+    FactorizedTable& globalFT;
+    std::mutex& mtx;
+    std::unique_ptr<FactorizedTable> localFT;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> communityVector;
+    std::vector<ValueVector*> vectors;
+};
+
+class Louvain final : public GDSAlgorithm {
+    static constexpr char COMMUNITY_ID_COLUMN_NAME[] = "louvain_id";
+
+public:
+    Louvain() = default;
+    Louvain(const Louvain& other) : GDSAlgorithm{other} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     * weightProperty::STRING (optional)
+     */
+    std::vector<common::LogicalTypeID> getParameterTypeIDs() const override {
+        return std::vector<LogicalTypeID>{LogicalTypeID::ANY};
+    }
+
+    /*
+     * Outputs are
+     *
+     * _node._id::INTERNAL_ID
+     * louvain_id::INT64
+     */
+    binder::expression_vector getResultColumns(binder::Binder* binder) const override {
+        expression_vector columns;
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        columns.push_back(binder->createVariable(COMMUNITY_ID_COLUMN_NAME, LogicalType::INT64()));
+        return columns;
+    }
+
+    void bind(const expression_vector& params, Binder* binder, GraphEntry& graphEntry) override {
+        KU_ASSERT(params.size() == 1 || params.size() == 2);
+        if (params.size() == 2) {
+            auto propertyName = ExpressionUtil::getLiteralValue<std::string>(*params[1]);
+            graphEntry.setRelWeightProperty(
+                bindRelWeightProperty(propertyName, binder, graphEntry));
+        }
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        bindData = std::make_unique<GDSBindData>(nodeOutput);
+    }
+
+    void exec(processor::ExecutionContext* context) override {
+        auto graph = sharedState->graph.get();
+        if (graph->getNumNodes() == 0) {
+            return;
+        }
+        LouvainRunner runner{context, graph};
+        runner.run();
+        std::mutex mtx;
+        LouvainOutputWriterVC writerVC{context->clientContext, runner, *sharedState->fTable, mtx};
+        GDSUtils::runVertexComputeIteration(context, graph, writerVC);
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<Louvain>(*this);
+    }
+};
+
+function_set LouvainFunction::getFunctionSet() {
+    function_set result;
+    auto algo = std::make_unique<Louvain>();
+    auto parameterTypeIDs = algo->getParameterTypeIDs();
+    result.push_back(std::make_unique<GDSFunction>(name, parameterTypeIDs, algo->copy()));
+    // Overload with the name of the edge weight property.
+    parameterTypeIDs.push_back(LogicalTypeID::STRING);
+    result.push_back(std::make_unique<GDSFunction>(name, parameterTypeIDs, std::move(algo)));
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,7 +1,11 @@
+#include <cmath>
+#include <mutex>
+
 #include "binder/binder.h"
-#include "common/types/internal_id_util.h"
 #include "function/gds/gds.h"
+#include "function/gds/gds_frontier.h"
 #include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
 #include "function/gds_function.h"
 #include "graph/graph.h"
 #include "main/client_context.h"
@@ -33,10 +37,134 @@ struct PageRankBindData final : public GDSBindData {
     }
 };
 
-class PageRankOutputWriter {
+// Ranks and out-degrees of the nodes of each table, stored in dense arrays indexed by offset. The
+// arrays are allocated before any vertex compute runs, so worker threads only write the entries of
+// the offsets in their own morsels.
+class PageRankState {
 public:
-    explicit PageRankOutputWriter(main::ClientContext* context) {
+    PageRankState(Graph* graph, double dampingFactor)
+        : numNodes{graph->getNumNodes()}, dampingFactor{dampingFactor}, change{0} {
+        for (auto& [tableID, numNodesInTable] : graph->getNodeTableIDAndNumNodes()) {
+            ranks[tableID].resize(numNodesInTable, 1.0 / numNodes);
+            nextRanks[tableID].resize(numNodesInTable, 0);
+            outDegrees[tableID].resize(numNodesInTable, 0);
+        }
+    }
+
+    // Number of nodes the rank of a node is divided among. The rank of a node without out-edges
+    // is divided among all nodes.
+    uint64_t getNumRankShares(nodeID_t nodeID) const {
+        const auto degree = outDegrees.at(nodeID.tableID)[nodeID.offset];
+        return degree == 0 ? numNodes : degree;
+    }
+
+    void beginNewIteration() { change = 0; }
+
+    void finalizeIteration() { std::swap(ranks, nextRanks); }
+
+    void mergeLocalChange(double localChange) {
+        std::unique_lock lck{mtx};
+        change += localChange;
+    }
+
+public:
+    offset_t numNodes;
+    double dampingFactor;
+    std::unordered_map<table_id_t, std::vector<double>> ranks;
+    std::unordered_map<table_id_t, std::vector<double>> nextRanks;
+    std::unordered_map<table_id_t, std::vector<uint64_t>> outDegrees;
+    // Sum of the absolute rank changes of all nodes in the last iteration.
+    double change;
+
+private:
+    std::mutex mtx;
+};
+
+// Counts the out-edges of every node once.
+class PageRankDegreeVC final : public VertexCompute {
+public:
+    PageRankDegreeVC(Graph* graph, PageRankState& state)
+        : graph{graph}, state{state}, outDegrees{nullptr} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+    }
+
+    void beginOnTable(table_id_t tableID) override { outDegrees = &state.outDegrees.at(tableID); }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        (*outDegrees)[nodeID.offset] = graph->scanFwd(nodeID, *scanState).count();
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        auto result = std::make_unique<PageRankDegreeVC>(graph, state);
+        result->outDegrees = outDegrees;
+        return result;
+    }
+
+private:
+    Graph* graph;
+    PageRankState& state;
+    std::unique_ptr<GraphScanState> scanState;
+    std::vector<uint64_t>* outDegrees;
+};
+
+// Sums the shares of the ranks of each node's out-neighbours. Ranks of the previous iteration are
+// only read and ranks of the next iteration are only written, so nodes can be updated in parallel.
+class PageRankComputeVC final : public VertexCompute {
+public:
+    PageRankComputeVC(Graph* graph, PageRankState& state)
+        : graph{graph}, state{state},
+          jumpRank{(1 - state.dampingFactor) / (double)state.numNodes}, curRanks{nullptr},
+          nextRanks{nullptr}, localChange{0} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+    }
+
+    void beginOnTable(table_id_t tableID) override {
+        curRanks = &state.ranks.at(tableID);
+        nextRanks = &state.nextRanks.at(tableID);
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto sum = 0.0;
+        for (const auto chunk : graph->scanFwd(nodeID, *scanState)) {
+            chunk.selVector.forEach([&](auto i) {
+                const auto nbrNodeID = chunk.nbrNodes[i];
+                sum += state.ranks.at(nbrNodeID.tableID)[nbrNodeID.offset] /
+                       (double)state.getNumRankShares(nbrNodeID);
+            });
+        }
+        const auto rank = jumpRank + state.dampingFactor * sum;
+        localChange += std::abs(rank - (*curRanks)[nodeID.offset]);
+        (*nextRanks)[nodeID.offset] = rank;
+    }
+
+    void finalizeWorkerThread() override { state.mergeLocalChange(localChange); }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        auto result = std::make_unique<PageRankComputeVC>(graph, state);
+        result->curRanks = curRanks;
+        result->nextRanks = nextRanks;
+        return result;
+    }
+
+private:
+    Graph* graph;
+    PageRankState& state;
+    std::unique_ptr<GraphScanState> scanState;
+    double jumpRank;
+    std::vector<double>* curRanks;
+    std::vector<double>* nextRanks;
+    double localChange;
+};
+
+class PageRankOutputWriterVC final : public VertexCompute {
+public:
+    PageRankOutputWriterVC(main::ClientContext* context, PageRankState& state,
+        FactorizedTable& globalFT, std::mutex& mtx)
+        : context{context}, state{state}, globalFT{globalFT}, mtx{mtx}, ranks{nullptr} {
         auto mm = context->getMemoryManager();
+        localFT = std::make_unique<FactorizedTable>(mm, globalFT.getTableSchema()->copy());
         nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
         rankVector = std::make_unique<ValueVector>(LogicalType::DOUBLE(), mm);
         nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
@@ -45,19 +173,32 @@ public:
         vectors.push_back(rankVector.get());
     }
 
-    void materialize(graph::Graph* graph, const common::node_id_map_t<double>& ranks,
-        FactorizedTable& table) const {
-        for (auto tableID : graph->getNodeTableIDs()) {
-            for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
-                auto nodeID = nodeID_t{offset, tableID};
-                nodeIDVector->setValue<nodeID_t>(0, nodeID);
-                rankVector->setValue<double>(0, ranks.at(nodeID));
-                table.append(vectors);
-            }
-        }
+    void beginOnTable(table_id_t tableID) override { ranks = &state.ranks.at(tableID); }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        rankVector->setValue<double>(0, (*ranks)[nodeID.offset]);
+        localFT->append(vectors);
+    }
+
+    void finalizeWorkerThread() override {
+        std::unique_lock lck{mtx};
+        globalFT.merge(*localFT);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        auto result = std::make_unique<PageRankOutputWriterVC>(context, state, globalFT, mtx);
+        result->ranks = ranks;
+        return result;
     }
 
 private:
+    main::ClientContext* context;
+    PageRankState& state;
+    FactorizedTable& globalFT;
+    std::mutex& mtx;
+    std::vector<double>* ranks;
+    std::unique_ptr<FactorizedTable> localFT;
     std::unique_ptr<ValueVector> nodeIDVector;
     std::unique_ptr<ValueVector> rankVector;
     std::vector<ValueVector*> vectors;
@@ -98,69 +239,34 @@ public:
         bindData = std::make_unique<PageRankBindData>(nodeOutput);
     }
 
-    void initLocalState(main::ClientContext* context) override {
-        localState = std::make_unique<PageRankOutputWriter>(context);
-    }
-
     void exec(processor::ExecutionContext* context) override {
         auto extraData = bindData->ptrCast<PageRankBindData>();
-        localState = std::make_unique<PageRankOutputWriter>(context->clientContext);
         auto graph = sharedState->graph.get();
-        // Initialize state.
-        common::node_id_map_t<double> ranks;
-        auto numNodes = graph->getNumNodes();
-        for (auto tableID : graph->getNodeTableIDs()) {
-            for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
-                auto nodeID = nodeID_t{offset, tableID};
-                ranks.insert({nodeID, 1.0 / numNodes});
-            }
+        if (graph->getNumNodes() == 0) {
+            return;
         }
-        auto dampingValue = (1 - extraData->dampingFactor) / numNodes;
-        // Compute page rank.
-        auto nodeTableIDs = graph->getNodeTableIDs();
-        auto scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
-        // We're using multiple overlapping iterators, both of which need access to a scan state, so
-        // we need multiple scan states
-        auto innerScanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
-        auto numNodesInGraph = graph->getNumNodes();
+        PageRankState state{graph, extraData->dampingFactor};
+        PageRankDegreeVC degreeVC{graph, state};
+        GDSUtils::runVertexComputeIteration(context, graph, degreeVC);
+        // The ranks of all nodes are updated at once from the ranks of the previous iteration
+        // until the total change of an iteration falls below delta.
         for (auto i = 0u; i < extraData->maxIteration; ++i) {
-            auto change = 0.0;
-            for (auto tableID : nodeTableIDs) {
-                for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
-                    auto nodeID = nodeID_t{offset, tableID};
-                    auto rank = 0.0;
-                    auto iter = graph->scanFwd(nodeID, *scanState);
-                    for (const auto chunk : iter) {
-                        chunk.selVector.forEach([&](auto i) {
-                            auto numNbrOfNbr =
-                                graph->scanFwd(chunk.nbrNodes[i], *innerScanState).count();
-                            if (numNbrOfNbr == 0) {
-                                numNbrOfNbr = numNodesInGraph;
-                            }
-                            rank +=
-                                extraData->dampingFactor * (ranks[chunk.nbrNodes[i]] / numNbrOfNbr);
-                        });
-                    }
-                    rank += dampingValue;
-                    double diff = ranks[nodeID] - rank;
-                    change += diff < 0 ? -diff : diff;
-                    ranks[nodeID] = rank;
-                }
-            }
-            if (change < extraData->delta) {
+            state.beginNewIteration();
+            PageRankComputeVC computeVC{graph, state};
+            GDSUtils::runVertexComputeIteration(context, graph, computeVC);
+            state.finalizeIteration();
+            if (state.change < extraData->delta) {
                 break;
             }
         }
-        // Materialize result.
-        localState->materialize(graph, ranks, *sharedState->fTable);
+        std::mutex mtx;
+        PageRankOutputWriterVC writerVC{context->clientContext, state, *sharedState->fTable, mtx};
+        GDSUtils::runVertexComputeIteration(context, graph, writerVC);
     }
 
     std::unique_ptr<GDSAlgorithm> copy() const override {
         return std::make_unique<PageRank>(*this);
     }
-
-private:
-    std::unique_ptr<PageRankOutputWriter> localState;
 };
 
 function_set PageRankFunction::getFunctionSet() {
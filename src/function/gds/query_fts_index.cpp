@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <optional>
+
+#include "binder/binder.h"
+#include "binder/expression/expression_util.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "function/gds/gds.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+struct QueryFTSIndexBindData final : public GDSBindData {
+    table_id_t tableID;
+    std::string propertyName;
+    std::vector<std::string> terms;
+    // Number of top results to return, or all matches if not set.
+    std::optional<uint64_t> k;
+
+    QueryFTSIndexBindData(std::shared_ptr<Expression> nodeOutput, table_id_t tableID,
+        std::string propertyName, std::vector<std::string> terms, std::optional<uint64_t> k)
+        : GDSBindData{std::move(nodeOutput)}, tableID{tableID},
+          propertyName{std::move(propertyName)}, terms{std::move(terms)}, k{k} {}
+    QueryFTSIndexBindData(const QueryFTSIndexBindData& other)
+        : GDSBindData{other}, tableID{other.tableID}, propertyName{other.propertyName},
+          terms{other.terms}, k{other.k} {}
+
+    std::unique_ptr<GDSBindData> copy() const override {
+        return std::make_unique<QueryFTSIndexBindData>(*this);
+    }
+};
+
+// Reads the visible text of candidate nodes, which may have been updated or deleted since they
+// were indexed.
+class TextLookup {
+public:
+    TextLookup(main::ClientContext* context, NodeTable& table, column_id_t columnID)
+        : transaction{context->getTx()}, table{table} {
+        auto mm = context->getMemoryManager();
+        nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        textVector = std::make_unique<ValueVector>(LogicalType::STRING(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        textVector->state = nodeIDVector->state;
+        scanState = std::make_unique<NodeTableScanState>(table.getTableID(),
+            std::vector<column_id_t>{columnID}, std::vector<Column*>{table.getColumnPtr(columnID)});
+        scanState->nodeIDVector = nodeIDVector.get();
+        scanState->outputVectors.push_back(textVector.get());
+        scanState->rowIdxVector->state = nodeIDVector->state;
+        scanState->outState = nodeIDVector->state.get();
+        scanState->source = TableScanSource::COMMITTED;
+    }
+
+    // Returns false if the node is not visible or its text is null.
+    bool lookup(offset_t offset, std::string& result) {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID_t{offset, table.getTableID()});
+        textVector->resetAuxiliaryBuffer();
+        scanState->nodeGroupIdx = StorageUtils::getNodeGroupIdx(offset);
+        table.initScanState(transaction, *scanState);
+        if (!table.lookup(transaction, *scanState) || textVector->isNull(0)) {
+            return false;
+        }
+        result = textVector->getValue<ku_string_t>(0).getAsString();
+        return true;
+    }
+
+private:
+    transaction::Transaction* transaction;
+    NodeTable& table;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> textVector;
+    std::unique_ptr<NodeTableScanState> scanState;
+};
+
+class QueryFTSIndex final : public GDSAlgorithm {
+    static constexpr char SCORE_COLUMN_NAME[] = "score";
+
+public:
+    explicit QueryFTSIndex(bool hasK) : hasK{hasK} {}
+    QueryFTSIndex(const QueryFTSIndex& other) : GDSAlgorithm{other}, hasK{other.hasK} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     * property::STRING
+     * query::STRING
+     * k::INT64 (optional)
+     */
+    std::vector<LogicalTypeID> getParameterTypeIDs() const override {
+        std::vector<LogicalTypeID> result{LogicalTypeID::ANY, LogicalTypeID::STRING,
+            LogicalTypeID::STRING};
+        if (hasK) {
+            result.push_back(LogicalTypeID::INT64);
+        }
+        return result;
+    }
+
+    /*
+     * Outputs are
+     *
+     * _node._id::INTERNAL_ID
+     * score::DOUBLE
+     */
+    expression_vector getResultColumns(Binder* binder) const override {
+        expression_vector columns;
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        columns.push_back(binder->createVariable(SCORE_COLUMN_NAME, LogicalType::DOUBLE()));
+        return columns;
+    }
+
+    void bind(const expression_vector& params, Binder* binder, GraphEntry& graphEntry) override {
+        if (graphEntry.nodeEntries.size() != 1) {
+            throw BinderException(stringFormat("{} requires a graph with exactly one node table.",
+                QueryFTSIndexFunction::name));
+        }
+        const auto nodeTableEntry = graphEntry.nodeEntries[0]->ptrCast<NodeTableCatalogEntry>();
+        auto propertyName = ExpressionUtil::getLiteralValue<std::string>(*params[1]);
+        if (!nodeTableEntry->hasFTSIndex(propertyName)) {
+            throw BinderException(
+                stringFormat("Property {} of table {} does not have a full-text index.",
+                    propertyName, nodeTableEntry->getName()));
+        }
+        auto terms =
+            FTSTokenizer::tokenize(ExpressionUtil::getLiteralValue<std::string>(*params[2]));
+        std::sort(terms.begin(), terms.end());
+        terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+        std::optional<uint64_t> k;
+        if (hasK) {
+            const auto value = ExpressionUtil::getLiteralValue<int64_t>(*params[3]);
+            if (value <= 0) {
+                throw BinderException("The number of results must be positive.");
+            }
+            k = value;
+        }
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        bindData = std::make_unique<QueryFTSIndexBindData>(nodeOutput,
+            nodeTableEntry->getTableID(), std::move(propertyName), std::move(terms), k);
+    }
+
+    void exec(ExecutionContext* context) override {
+        const auto extraData = bindData->ptrCast<QueryFTSIndexBindData>();
+        const auto clientContext = context->clientContext;
+        const auto tableEntry = clientContext->getCatalog()->getTableCatalogEntry(
+            clientContext->getTx(), extraData->tableID);
+        const auto columnID = tableEntry->getColumnID(extraData->propertyName);
+        auto& table =
+            clientContext->getStorageManager()->getTable(extraData->tableID)->cast<NodeTable>();
+        const auto index = table.getFTSIndex(columnID);
+        if (index == nullptr) {
+            // LCOV_EXCL_START
+            throw RuntimeException(stringFormat("Full-text index on {}({}) is not available.",
+                tableEntry->getName(), extraData->propertyName));
+            // LCOV_EXCL_STOP
+        }
+        auto results = search(clientContext, table, columnID, *index);
+        auto mm = clientContext->getMemoryManager();
+        auto nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        auto scoreVector = std::make_unique<ValueVector>(LogicalType::DOUBLE(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        scoreVector->state = DataChunkState::getSingleValueDataChunkState();
+        std::vector<ValueVector*> vectors{nodeIDVector.get(), scoreVector.get()};
+        for (auto& [offset, score] : results) {
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{offset, extraData->tableID});
+            scoreVector->setValue<double>(0, score);
+            sharedState->fTable->append(vectors);
+        }
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<QueryFTSIndex>(*this);
+    }
+
+private:
+    // Scores the visible text of every node matching at least one query term with BM25, and
+    // returns the matches in descending score order. Document frequencies are counted over the
+    // visible matches, so that outdated postings don't skew them.
+    std::vector<std::pair<offset_t, double>> search(main::ClientContext* context,
+        NodeTable& table, column_id_t columnID, const FTSIndex& index) const {
+        const auto extraData = bindData->ptrCast<QueryFTSIndexBindData>();
+        const auto& terms = extraData->terms;
+        std::vector<std::pair<offset_t, double>> results;
+        if (terms.empty()) {
+            return results;
+        }
+        struct Match {
+            offset_t offset;
+            std::vector<uint64_t> termFrequencies;
+            uint64_t docLength;
+        };
+        std::vector<Match> matches;
+        std::vector<uint64_t> docFrequencies(terms.size());
+        TextLookup lookup{context, table, columnID};
+        std::string text;
+        std::vector<uint64_t> termFrequencies(terms.size());
+        for (const auto offset : index.search(terms)) {
+            if (!lookup.lookup(offset, text)) {
+                continue;
+            }
+            const auto docTerms = FTSTokenizer::tokenize(text);
+            std::fill(termFrequencies.begin(), termFrequencies.end(), 0);
+            auto matched = false;
+            for (auto& docTerm : docTerms) {
+                const auto it = std::lower_bound(terms.begin(), terms.end(), docTerm);
+                if (it != terms.end() && *it == docTerm) {
+                    termFrequencies[it - terms.begin()]++;
+                    matched = true;
+                }
+            }
+            // The text matching the query may have been updated since it was indexed.
+            if (matched) {
+                for (auto i = 0u; i < terms.size(); i++) {
+                    docFrequencies[i] += termFrequencies[i] > 0;
+                }
+                matches.push_back(Match{offset, termFrequencies, docTerms.size()});
+            }
+        }
+        auto statistics = index.getStatistics();
+        FTSIndex::computeIDFs(statistics, docFrequencies);
+        for (auto& match : matches) {
+            results.emplace_back(match.offset,
+                FTSIndex::computeBM25(statistics, match.termFrequencies, match.docLength));
+        }
+        std::sort(results.begin(), results.end(), [](const auto& left, const auto& right) {
+            return left.second > right.second ||
+                   (left.second == right.second && left.first < right.first);
+        });
+        if (extraData->k && results.size() > *extraData->k) {
+            results.resize(*extraData->k);
+        }
+        return results;
+    }
+
+private:
+    bool hasK;
+};
+
+function_set QueryFTSIndexFunction::getFunctionSet() {
+    function_set result;
+    for (auto hasK : {false, true}) {
+        auto algo = std::make_unique<QueryFTSIndex>(hasK);
+        result.push_back(
+            std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo)));
+    }
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
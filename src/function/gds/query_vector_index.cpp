@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <optional>
+#include <unordered_set>
+
+#include "binder/binder.h"
+#include "binder/expression/expression_util.h"
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/type_utils.h"
+#include "common/types/value/nested.h"
+#include "function/gds/gds.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+struct QueryVectorIndexBindData final : public GDSBindData {
+    table_id_t tableID;
+    std::string propertyName;
+    std::vector<float> query;
+    uint64_t k;
+    uint64_t efSearch;
+
+    QueryVectorIndexBindData(std::shared_ptr<Expression> nodeOutput, table_id_t tableID,
+        std::string propertyName, std::vector<float> query, uint64_t k, uint64_t efSearch)
+        : GDSBindData{std::move(nodeOutput)}, tableID{tableID},
+          propertyName{std::move(propertyName)}, query{std::move(query)}, k{k},
+          efSearch{efSearch} {}
+    QueryVectorIndexBindData(const QueryVectorIndexBindData& other)
+        : GDSBindData{other}, tableID{other.tableID}, propertyName{other.propertyName},
+          query{other.query}, k{other.k}, efSearch{other.efSearch} {}
+
+    std::unique_ptr<GDSBindData> copy() const override {
+        return std::make_unique<QueryVectorIndexBindData>(*this);
+    }
+};
+
+// Reads the visible vectors of candidate nodes, which may have been updated or deleted since they
+// were indexed.
+class VectorLookup {
+public:
+    VectorLookup(main::ClientContext* context, NodeTable& table, column_id_t columnID)
+        : transaction{context->getTx()}, table{table} {
+        auto mm = context->getMemoryManager();
+        nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        vector = std::make_unique<ValueVector>(table.getColumn(columnID).getDataType().copy(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        vector->state = nodeIDVector->state;
+        scanState = std::make_unique<NodeTableScanState>(table.getTableID(),
+            std::vector<column_id_t>{columnID}, std::vector<Column*>{table.getColumnPtr(columnID)});
+        scanState->nodeIDVector = nodeIDVector.get();
+        scanState->outputVectors.push_back(vector.get());
+        scanState->rowIdxVector->state = nodeIDVector->state;
+        scanState->outState = nodeIDVector->state.get();
+        scanState->source = TableScanSource::COMMITTED;
+    }
+
+    // Returns false if the node is not visible or its vector is null.
+    bool lookup(offset_t offset, float* result) {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID_t{offset, table.getTableID()});
+        vector->resetAuxiliaryBuffer();
+        scanState->nodeGroupIdx = StorageUtils::getNodeGroupIdx(offset);
+        table.initScanState(transaction, *scanState);
+        if (!table.lookup(transaction, *scanState) || vector->isNull(0)) {
+            return false;
+        }
+        return HNSWIndex::readVector(*vector, 0, result);
+    }
+
+private:
+    transaction::Transaction* transaction;
+    NodeTable& table;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> vector;
+    std::unique_ptr<NodeTableScanState> scanState;
+};
+
+class QueryVectorIndex final : public GDSAlgorithm {
+    static constexpr char DISTANCE_COLUMN_NAME[] = "distance";
+
+public:
+    explicit QueryVectorIndex(bool hasEfSearch) : hasEfSearch{hasEfSearch} {}
+    QueryVectorIndex(const QueryVectorIndex& other)
+        : GDSAlgorithm{other}, hasEfSearch{other.hasEfSearch} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     * property::STRING
+     * query::ANY
+     * k::INT64
+     * efs::INT64 (optional)
+     */
+    std::vector<LogicalTypeID> getParameterTypeIDs() const override {
+        std::vector<LogicalTypeID> result{LogicalTypeID::ANY, LogicalTypeID::STRING,
+            LogicalTypeID::ANY, LogicalTypeID::INT64};
+        if (hasEfSearch) {
+            result.push_back(LogicalTypeID::INT64);
+        }
+        return result;
+    }
+
+    /*
+     * Outputs are
+     *
+     * _node._id::INTERNAL_ID
+     * distance::DOUBLE
+     */
+    expression_vector getResultColumns(Binder* binder) const override {
+        expression_vector columns;
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        columns.push_back(binder->createVariable(DISTANCE_COLUMN_NAME, LogicalType::DOUBLE()));
+        return columns;
+    }
+
+    void bind(const expression_vector& params, Binder* binder, GraphEntry& graphEntry) override {
+        if (graphEntry.nodeEntries.size() != 1) {
+            throw BinderException(stringFormat("{} requires a graph with exactly one node table.",
+                QueryVectorIndexFunction::name));
+        }
+        const auto nodeTableEntry = graphEntry.nodeEntries[0]->ptrCast<NodeTableCatalogEntry>();
+        auto propertyName = ExpressionUtil::getLiteralValue<std::string>(*params[1]);
+        if (!nodeTableEntry->hasVectorIndex(propertyName)) {
+            throw BinderException(
+                stringFormat("Property {} of table {} does not have a vector index.",
+                    propertyName, nodeTableEntry->getName()));
+        }
+        const auto& type = nodeTableEntry->getProperty(propertyName).getType();
+        auto query = bindQuery(*params[2], ArrayType::getNumElements(type));
+        const auto k = ExpressionUtil::getLiteralValue<int64_t>(*params[3]);
+        if (k <= 0) {
+            throw BinderException("The number of nearest neighbors must be positive.");
+        }
+        int64_t efSearch = HNSWIndexConstants::DEFAULT_EF_SEARCH;
+        if (hasEfSearch) {
+            efSearch = ExpressionUtil::getLiteralValue<int64_t>(*params[4]);
+            if (efSearch <= 0) {
+                throw BinderException("efs must be positive.");
+            }
+        }
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        bindData = std::make_unique<QueryVectorIndexBindData>(nodeOutput,
+            nodeTableEntry->getTableID(), std::move(propertyName), std::move(query), k, efSearch);
+    }
+
+    void exec(ExecutionContext* context) override {
+        const auto extraData = bindData->ptrCast<QueryVectorIndexBindData>();
+        const auto clientContext = context->clientContext;
+        const auto tableEntry = clientContext->getCatalog()->getTableCatalogEntry(
+            clientContext->getTx(), extraData->tableID);
+        const auto columnID = tableEntry->getColumnID(extraData->propertyName);
+        auto& table =
+            clientContext->getStorageManager()->getTable(extraData->tableID)->cast<NodeTable>();
+        const auto index = table.getVectorIndex(columnID);
+        if (index == nullptr) {
+            // LCOV_EXCL_START
+            throw RuntimeException(stringFormat("Vector index on {}({}) is not available.",
+                tableEntry->getName(), extraData->propertyName));
+            // LCOV_EXCL_STOP
+        }
+        auto results = search(clientContext, table, columnID, *index);
+        auto mm = clientContext->getMemoryManager();
+        auto nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        auto distanceVector = std::make_unique<ValueVector>(LogicalType::DOUBLE(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        distanceVector->state = DataChunkState::getSingleValueDataChunkState();
+        std::vector<ValueVector*> vectors{nodeIDVector.get(), distanceVector.get()};
+        for (auto& result : results) {
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{result.offset, extraData->tableID});
+            distanceVector->setValue<double>(0, result.distance);
+            sharedState->fTable->append(vectors);
+        }
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<QueryVectorIndex>(*this);
+    }
+
+private:
+    static std::vector<float> bindQuery(const Expression& expression, uint64_t dimension) {
+        auto getValue = [&]() {
+            switch (expression.expressionType) {
+            case ExpressionType::LITERAL:
+                return expression.constCast<LiteralExpression>().getValue();
+            case ExpressionType::PARAMETER:
+                return expression.constCast<ParameterExpression>().getValue();
+            default:
+                throw BinderException(
+                    stringFormat("The query vector {} must be a literal or a parameter.",
+                        expression.toString()));
+            }
+        };
+        const auto value = getValue();
+        const auto typeID = value.getDataType().getLogicalTypeID();
+        if ((typeID != LogicalTypeID::LIST && typeID != LogicalTypeID::ARRAY) || value.isNull() ||
+            NestedVal::getChildrenSize(&value) != dimension) {
+            throw BinderException(
+                stringFormat("The query vector must be a list of {} numbers.", dimension));
+        }
+        std::vector<float> query;
+        for (auto i = 0u; i < dimension; i++) {
+            const auto child = NestedVal::getChildVal(&value, i);
+            std::optional<float> element;
+            const auto childTypeID = child->getDataType().getLogicalTypeID();
+            if (!child->isNull() && childTypeID != LogicalTypeID::BOOL) {
+                TypeUtils::visit(
+                    child->getDataType().getPhysicalType(),
+                    [&]<typename T>(T)
+                        requires(std::is_arithmetic_v<T>)
+                    { element = (float)child->getValue<T>(); },
+                    [](auto) {});
+            }
+            if (!element) {
+                throw BinderException(
+                    stringFormat("The query vector must be a list of {} numbers.", dimension));
+            }
+            query.push_back(*element);
+        }
+        return query;
+    }
+
+    // Searches the index with a growing candidate list until k visible nodes are found, and
+    // ranks them by the distance of their visible vector.
+    std::vector<VectorSearchResult> search(main::ClientContext* context, NodeTable& table,
+        column_id_t columnID, const HNSWIndex& index) const {
+        const auto extraData = bindData->ptrCast<QueryVectorIndexBindData>();
+        const auto dimension = index.getDimension();
+        VectorLookup lookup{context, table, columnID};
+        std::vector<float> vector(dimension);
+        std::vector<VectorSearchResult> results;
+        auto efSearch = std::max(extraData->k, extraData->efSearch);
+        // Tombstoned elements are never returned, so at most `numPendingChanges` candidates can be
+        // invisible or outdated. A candidate list that large always holds k visible nodes.
+        const auto maxEfSearch = extraData->k + index.getNumPendingChanges();
+        while (true) {
+            const auto candidates = index.search(extraData->query, efSearch);
+            results.clear();
+            std::unordered_set<offset_t> visited;
+            for (auto& candidate : candidates) {
+                if (!visited.insert(candidate.offset).second ||
+                    !lookup.lookup(candidate.offset, vector.data())) {
+                    continue;
+                }
+                results.push_back({candidate.offset,
+                    HNSWIndex::computeDistance(index.getMetric(), extraData->query.data(),
+                        vector.data(), dimension)});
+            }
+            if (results.size() >= extraData->k || candidates.size() < efSearch ||
+                efSearch >= maxEfSearch) {
+                break;
+            }
+            // Too many candidates are stale. Search again with a larger candidate list.
+            efSearch *= 2;
+        }
+        std::sort(results.begin(), results.end(), [](const auto& left, const auto& right) {
+            return left.distance < right.distance ||
+                   (left.distance == right.distance && left.offset < right.offset);
+        });
+        if (results.size() > extraData->k) {
+            results.resize(extraData->k);
+        }
+        return results;
+    }
+
+private:
+    bool hasEfSearch;
+};
+
+function_set QueryVectorIndexFunction::getFunctionSet() {
+    function_set result;
+    for (auto hasEfSearch : {false, true}) {
+        auto algo = std::make_unique<QueryVectorIndex>(hasEfSearch);
+        result.push_back(
+            std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo)));
+    }
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
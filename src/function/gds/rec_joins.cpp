@@ -43,13 +43,19 @@ void RJAlgorithm::validateLowerUpperBound(int64_t lowerBound, int64_t upperBound
     }
 }
 
-expression_vector RJAlgorithm::getBaseResultColumns(Binder* binder) const {
+expression_vector RJAlgorithm::getBaseResultColumns(Binder*) const {
     expression_vector columns;
     auto& inputNode = bindData->getNodeInput()->constCast<NodeExpression>();
     columns.push_back(inputNode.getInternalID());
     auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
     columns.push_back(outputNode.getInternalID());
+    return columns;
+}
+
+expression_vector RJAlgorithm::getPathsBaseResultColumns(Binder* binder) const {
+    auto columns = getBaseResultColumns(binder);
     auto rjBindData = bindData->ptrCast<RJBindData>();
+    // Only paths record the directions of their edges.
     if (rjBindData->extendDirection == ExtendDirection::BOTH) {
         if (rjBindData->directionExpr != nullptr) {
             columns.push_back(rjBindData->directionExpr);
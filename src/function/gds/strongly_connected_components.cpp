@@ -0,0 +1,466 @@
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+#include "binder/binder.h"
+#include "common/task_system/task_scheduler.h"
+#include "common/types/types.h"
+#include "function/gds/gds_frontier.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds_function.h"
+#include "graph/graph.h"
+#include "main/client_context.h"
+#include "main/settings.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+// Forward and backward adjacency lists in CSR format. Nodes are numbered consecutively across node
+// tables, in the order of Graph::getNodeTableIDs(). Self loops are dropped since they do not
+// affect strongly connected components.
+struct DirectedAdjacency {
+    offset_t numNodes = 0;
+    table_id_map_t<offset_t> firstNodeIdx;
+    std::vector<offset_t> fwdCSROffsets;
+    std::vector<offset_t> fwdNbrs;
+    std::vector<offset_t> bwdCSROffsets;
+    std::vector<offset_t> bwdNbrs;
+
+    explicit DirectedAdjacency(Graph* graph) {
+        for (auto tableID : graph->getNodeTableIDs()) {
+            firstNodeIdx.insert({tableID, numNodes});
+            numNodes += graph->getNumNodes(tableID);
+        }
+        fwdCSROffsets.resize(numNodes + 1, 0);
+        bwdCSROffsets.resize(numNodes + 1, 0);
+    }
+
+    offset_t getNodeIdx(nodeID_t nodeID) const {
+        return firstNodeIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    // Must be called after the degree of each node is set at csrOffsets[u + 1].
+    void allocateNbrs() {
+        for (auto u = 0u; u < numNodes; ++u) {
+            fwdCSROffsets[u + 1] += fwdCSROffsets[u];
+            bwdCSROffsets[u + 1] += bwdCSROffsets[u];
+        }
+        fwdNbrs.resize(fwdCSROffsets[numNodes]);
+        bwdNbrs.resize(bwdCSROffsets[numNodes]);
+    }
+
+    std::span<const offset_t> getFwdNbrs(offset_t u) const {
+        return std::span(fwdNbrs.data() + fwdCSROffsets[u], fwdNbrs.data() + fwdCSROffsets[u + 1]);
+    }
+    std::span<const offset_t> getBwdNbrs(offset_t u) const {
+        return std::span(bwdNbrs.data() + bwdCSROffsets[u], bwdNbrs.data() + bwdCSROffsets[u + 1]);
+    }
+};
+
+// Builds DirectedAdjacency in two passes: the first one counts the neighbors of each node, the
+// second one writes them.
+class DirectedAdjacencyBuilderVC final : public VertexCompute {
+public:
+    DirectedAdjacencyBuilderVC(Graph* graph, DirectedAdjacency& adjacency, bool writeNbrs)
+        : graph{graph}, adjacency{adjacency}, writeNbrs{writeNbrs} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        fwdScanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+        bwdScanState = graph->prepareMultiTableScanBwd(nodeTableIDs);
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto nodeIdx = adjacency.getNodeIdx(nodeID);
+        offset_t numFwdNbrs = 0;
+        for (const auto chunk : graph->scanFwd(nodeID, *fwdScanState)) {
+            chunk.selVector.forEach([&](auto i) {
+                auto nbrIdx = adjacency.getNodeIdx(chunk.nbrNodes[i]);
+                if (nbrIdx == nodeIdx) {
+                    return;
+                }
+                if (writeNbrs) {
+                    adjacency.fwdNbrs[adjacency.fwdCSROffsets[nodeIdx] + numFwdNbrs] = nbrIdx;
+                }
+                numFwdNbrs++;
+            });
+        }
+        offset_t numBwdNbrs = 0;
+        for (const auto chunk : graph->scanBwd(nodeID, *bwdScanState)) {
+            chunk.selVector.forEach([&](auto i) {
+                auto nbrIdx = adjacency.getNodeIdx(chunk.nbrNodes[i]);
+                if (nbrIdx == nodeIdx) {
+                    return;
+                }
+                if (writeNbrs) {
+                    adjacency.bwdNbrs[adjacency.bwdCSROffsets[nodeIdx] + numBwdNbrs] = nbrIdx;
+                }
+                numBwdNbrs++;
+            });
+        }
+        if (!writeNbrs) {
+            adjacency.fwdCSROffsets[nodeIdx + 1] = numFwdNbrs;
+            adjacency.bwdCSROffsets[nodeIdx + 1] = numBwdNbrs;
+        }
+        KU_ASSERT(!writeNbrs || adjacency.fwdCSROffsets[nodeIdx] + numFwdNbrs ==
+                                    adjacency.fwdCSROffsets[nodeIdx + 1]);
+        KU_ASSERT(!writeNbrs || adjacency.bwdCSROffsets[nodeIdx] + numBwdNbrs ==
+                                    adjacency.bwdCSROffsets[nodeIdx + 1]);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<DirectedAdjacencyBuilderVC>(graph, adjacency, writeNbrs);
+    }
+
+private:
+    Graph* graph;
+    DirectedAdjacency& adjacency;
+    bool writeNbrs;
+    std::unique_ptr<GraphScanState> fwdScanState;
+    std::unique_ptr<GraphScanState> bwdScanState;
+};
+
+// Thread-local state of an SCCTask.
+struct SCCLocalState {
+    std::vector<offset_t> nextNodes;
+    bool changed = false;
+};
+
+using scc_task_func_t = std::function<void(offset_t, SCCLocalState&)>;
+
+struct SCCTaskSharedState {
+    static constexpr uint64_t MORSEL_SIZE = 512;
+
+    std::span<const offset_t> nodes;
+    scc_task_func_t func;
+    std::atomic<offset_t> nextPos;
+    std::mutex mtx;
+    std::vector<offset_t> nextNodes;
+    bool changed;
+
+    SCCTaskSharedState(std::span<const offset_t> nodes, scc_task_func_t func)
+        : nodes{nodes}, func{std::move(func)}, nextPos{0}, changed{false} {}
+    DELETE_COPY_AND_MOVE(SCCTaskSharedState);
+};
+
+// Runs func on each node of a list in parallel and collects the nodes each thread adds to its
+// nextNodes.
+class SCCTask : public Task {
+public:
+    SCCTask(uint64_t maxNumThreads, std::shared_ptr<SCCTaskSharedState> sharedState)
+        : Task{maxNumThreads}, sharedState{std::move(sharedState)} {}
+
+    void run() override {
+        SCCLocalState localState;
+        auto& nodes = sharedState->nodes;
+        while (true) {
+            auto begin = sharedState->nextPos.fetch_add(SCCTaskSharedState::MORSEL_SIZE,
+                std::memory_order_relaxed);
+            if (begin >= nodes.size()) {
+                break;
+            }
+            auto end = std::min<offset_t>(begin + SCCTaskSharedState::MORSEL_SIZE, nodes.size());
+            for (auto i = begin; i < end; ++i) {
+                sharedState->func(nodes[i], localState);
+            }
+        }
+        std::unique_lock lck{sharedState->mtx};
+        sharedState->nextNodes.insert(sharedState->nextNodes.end(), localState.nextNodes.begin(),
+            localState.nextNodes.end());
+        sharedState->changed |= localState.changed;
+    }
+
+private:
+    std::shared_ptr<SCCTaskSharedState> sharedState;
+};
+
+// Parallel forward-backward coloring (Orzan, "On Distributed Verification and Verified
+// Distribution"), with trimming of trivial components (Slota et al., "BFS and Coloring-based
+// Parallel Algorithms for Strongly Connected Components and Related Problems").
+// 1. Trimming: a node without incoming or outgoing edges from unassigned nodes is a component on
+// its own. Assigning it may trim its neighbors, which are tracked with atomic degree counters.
+// 2. Coloring: each unassigned node takes the largest node number that reaches it, i.e., the color
+// of the root r of the color. The component of r is the set of nodes of color r that reach r, found
+// by a backward BFS from r restricted to nodes of color r.
+// Steps 1 and 2 repeat until every node is assigned.
+class SCCRunner {
+public:
+    SCCRunner(ExecutionContext* context, Graph* graph)
+        : context{context}, graph{graph}, adjacency{graph}, components(adjacency.numNodes),
+          colors(adjacency.numNodes), inDegrees(adjacency.numNodes),
+          outDegrees(adjacency.numNodes) {
+        maxThreads = context->clientContext->getCurrentSetting(main::ThreadsSetting::name)
+                         .getValue<uint64_t>();
+    }
+
+    void run() {
+        DirectedAdjacencyBuilderVC countVC{graph, adjacency, false /* writeNbrs */};
+        GDSUtils::runVertexComputeIteration(context, graph, countVC);
+        adjacency.allocateNbrs();
+        DirectedAdjacencyBuilderVC writeVC{graph, adjacency, true /* writeNbrs */};
+        GDSUtils::runVertexComputeIteration(context, graph, writeVC);
+        std::vector<offset_t> remainingNodes(adjacency.numNodes);
+        for (auto u = 0u; u < adjacency.numNodes; ++u) {
+            components[u].store(INVALID_OFFSET, std::memory_order_relaxed);
+            inDegrees[u].store(adjacency.getBwdNbrs(u).size(), std::memory_order_relaxed);
+            outDegrees[u].store(adjacency.getFwdNbrs(u).size(), std::memory_order_relaxed);
+            remainingNodes[u] = u;
+        }
+        trim(runTask(remainingNodes, [&](offset_t u, SCCLocalState& localState) {
+            if ((inDegrees[u].load(std::memory_order_relaxed) == 0 ||
+                    outDegrees[u].load(std::memory_order_relaxed) == 0) &&
+                tryAssign(u, u)) {
+                localState.nextNodes.push_back(u);
+            }
+        })->nextNodes);
+        while (true) {
+            remainingNodes =
+                std::move(runTask(remainingNodes, [&](offset_t u, SCCLocalState& localState) {
+                    if (!isAssigned(u)) {
+                        colors[u].store(u, std::memory_order_relaxed);
+                        localState.nextNodes.push_back(u);
+                    }
+                })->nextNodes);
+            if (remainingNodes.empty()) {
+                break;
+            }
+            propagateColors(remainingNodes);
+            trim(assignRootComponents(remainingNodes));
+        }
+        renumberComponents();
+    }
+
+    offset_t getNodeIdx(nodeID_t nodeID) const { return adjacency.getNodeIdx(nodeID); }
+
+    // Components are numbered consecutively in the order of their first nodes.
+    int64_t getComponent(offset_t nodeIdx) const {
+        return components[nodeIdx].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<SCCTaskSharedState> runTask(std::span<const offset_t> nodes,
+        scc_task_func_t func) {
+        auto sharedState = std::make_shared<SCCTaskSharedState>(nodes, std::move(func));
+        auto task = std::make_shared<SCCTask>(maxThreads, sharedState);
+        // See GDSUtils::runFrontiersUntilConvergence for why a new worker thread is launched.
+        context->clientContext->getTaskScheduler()->scheduleTaskAndWaitOrError(task, context,
+            true /* launchNewWorkerThread */);
+        return sharedState;
+    }
+
+    bool isAssigned(offset_t u) const {
+        return components[u].load(std::memory_order_relaxed) != INVALID_OFFSET;
+    }
+
+    bool tryAssign(offset_t u, offset_t component) {
+        auto expected = INVALID_OFFSET;
+        return components[u].compare_exchange_strong(expected, component,
+            std::memory_order_relaxed);
+    }
+
+    // Removes the edges of newly assigned nodes from the degrees of their neighbors and assigns
+    // neighbors left without incoming or outgoing edges to their own components, until no more
+    // nodes are assigned.
+    void trim(std::vector<offset_t> assignedNodes) {
+        while (!assignedNodes.empty()) {
+            assignedNodes =
+                std::move(runTask(assignedNodes, [&](offset_t u, SCCLocalState& localState) {
+                    for (auto v : adjacency.getFwdNbrs(u)) {
+                        if (inDegrees[v].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                            tryAssign(v, v)) {
+                            localState.nextNodes.push_back(v);
+                        }
+                    }
+                    for (auto v : adjacency.getBwdNbrs(u)) {
+                        if (outDegrees[v].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                            tryAssign(v, v)) {
+                            localState.nextNodes.push_back(v);
+                        }
+                    }
+                })->nextNodes);
+        }
+    }
+
+    // Propagates the largest color along forward edges between unassigned nodes until no color
+    // changes.
+    void propagateColors(std::span<const offset_t> nodes) {
+        auto changed = true;
+        while (changed) {
+            changed = runTask(nodes, [&](offset_t u, SCCLocalState& localState) {
+                auto color = colors[u].load(std::memory_order_relaxed);
+                for (auto v : adjacency.getFwdNbrs(u)) {
+                    if (isAssigned(v)) {
+                        continue;
+                    }
+                    auto nbrColor = colors[v].load(std::memory_order_relaxed);
+                    while (nbrColor < color) {
+                        if (colors[v].compare_exchange_weak(nbrColor, color,
+                                std::memory_order_relaxed)) {
+                            localState.changed = true;
+                            break;
+                        }
+                    }
+                }
+            })->changed;
+        }
+    }
+
+    // Assigns the component of each root by a backward BFS over nodes of its color. Returns the
+    // assigned nodes.
+    std::vector<offset_t> assignRootComponents(std::span<const offset_t> nodes) {
+        auto frontier = std::move(runTask(nodes, [&](offset_t u, SCCLocalState& localState) {
+            if (colors[u].load(std::memory_order_relaxed) == u) {
+                components[u].store(u, std::memory_order_relaxed);
+                localState.nextNodes.push_back(u);
+            }
+        })->nextNodes);
+        std::vector<offset_t> assignedNodes;
+        while (!frontier.empty()) {
+            assignedNodes.insert(assignedNodes.end(), frontier.begin(), frontier.end());
+            frontier = std::move(runTask(frontier, [&](offset_t u, SCCLocalState& localState) {
+                auto color = colors[u].load(std::memory_order_relaxed);
+                for (auto v : adjacency.getBwdNbrs(u)) {
+                    if (!isAssigned(v) && colors[v].load(std::memory_order_relaxed) == color &&
+                        tryAssign(v, color)) {
+                        localState.nextNodes.push_back(v);
+                    }
+                }
+            })->nextNodes);
+        }
+        return assignedNodes;
+    }
+
+    void renumberComponents() {
+        std::vector<offset_t> componentIdx(adjacency.numNodes, INVALID_OFFSET);
+        offset_t numComponents = 0;
+        for (auto u = 0u; u < adjacency.numNodes; ++u) {
+            auto component = components[u].load(std::memory_order_relaxed);
+            if (componentIdx[component] == INVALID_OFFSET) {
+                componentIdx[component] = numComponents++;
+            }
+            components[u].store(componentIdx[component], std::memory_order_relaxed);
+        }
+    }
+
+private:
+    ExecutionContext* context;
+    Graph* graph;
+    uint64_t maxThreads;
+    DirectedAdjacency adjacency;
+    std::vector<std::atomic<offset_t>> components;
+    std::vector<std::atomic<offset_t>> colors;
+    // Number of incoming and outgoing edges from unassigned nodes.
+    std::vector<std::atomic<offset_t>> inDegrees;
+    std::vector<std::atomic<offset_t>> outDegrees;
+};
+
+class SCCOutputWriterVC final : public VertexCompute {
+public:
+    SCCOutputWriterVC(main::ClientContext* context, const SCCRunner& runner,
+        FactorizedTable& globalFT, std::mutex& mtx)
+        : context{context}, runner{runner}, globalFT{globalFT}, mtx{mtx} {
+        auto mm = context->getMemoryManager();
+        localFT = std::make_unique<FactorizedTable>(mm, globalFT.getTableSchema()->copy());
+        nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        groupVector = std::make_unique<ValueVector>(LogicalType::INT64(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        groupVector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(nodeIDVector.get());
+        vectors.push_back(groupVector.get());
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        groupVector->setValue<int64_t>(0, runner.getComponent(runner.getNodeIdx(nodeID)));
+        localFT->append(vectors);
+    }
+
+    void finalizeWorkerThread() override {
+        std::unique_lock lck{mtx};
+        globalFT.merge(*localFT);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<SCCOutputWriterVC>(context, runner, globalFT, mtx);
+    }
+
+private:
+    main::ClientContext* context;
+    const SCCRunner& runner;
+    FactorizedTable& globalFT;
+    std::mutex& mtx;
+    std::unique_ptr<FactorizedTable> localFT;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> groupVector;
+    std::vector<ValueVector*> vectors;
+};
+
+class StronglyConnectedComponent final : public GDSAlgorithm {
+    static constexpr char GROUP_ID_COLUMN_NAME[] = "group_id";
+
+public:
+    StronglyConnectedComponent() = default;
+    StronglyConnectedComponent(const StronglyConnectedComponent& other) : GDSAlgorithm{other} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     */
+    std::vector<common::LogicalTypeID> getParameterTypeIDs() const override {
+        return std::vector<LogicalTypeID>{LogicalTypeID::ANY};
+    }
+
+    /*
+     * Outputs are
+     *
+     * _node._id::INTERNAL_ID
+     * group_id::INT64
+     */
+    binder::expression_vector getResultColumns(binder::Binder* binder) const override {
+        expression_vector columns;
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        columns.push_back(binder->createVariable(GROUP_ID_COLUMN_NAME, LogicalType::INT64()));
+        return columns;
+    }
+
+    void bind(const expression_vector&, Binder* binder, GraphEntry& graphEntry) override {
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        bindData = std::make_unique<GDSBindData>(nodeOutput);
+    }
+
+    void exec(processor::ExecutionContext* context) override {
+        auto graph = sharedState->graph.get();
+        if (graph->getNumNodes() == 0) {
+            return;
+        }
+        SCCRunner runner{context, graph};
+        runner.run();
+        std::mutex mtx;
+        SCCOutputWriterVC writerVC{context->clientContext, runner, *sharedState->fTable, mtx};
+        GDSUtils::runVertexComputeIteration(context, graph, writerVC);
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<StronglyConnectedComponent>(*this);
+    }
+};
+
+function_set StronglyConnectedComponentsFunction::getFunctionSet() {
+    function_set result;
+    auto algo = std::make_unique<StronglyConnectedComponent>();
+    auto function =
+        std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo));
+    result.push_back(std::move(function));
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <mutex>
+
+#include "binder/binder.h"
+#include "common/types/types.h"
+#include "function/gds/gds_frontier.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds_function.h"
+#include "graph/graph.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+// Calls func on each element of both sorted lists. If one list is much longer than the other, the
+// elements of the shorter list are searched in the longer one by galloping, otherwise the lists
+// are merged.
+template<typename FUNC>
+static void intersectSortedLists(std::span<const offset_t> left, std::span<const offset_t> right,
+    FUNC&& func) {
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 32;
+    if (left.size() > right.size()) {
+        std::swap(left, right);
+    }
+    if (left.empty()) {
+        return;
+    }
+    if (left.size() * GALLOPING_SIZE_RATIO < right.size()) {
+        auto begin = right.begin();
+        for (auto value : left) {
+            // Find a range [begin + step / 2, begin + step] that contains value, then search it.
+            uint64_t step = 1;
+            auto remaining = static_cast<uint64_t>(right.end() - begin);
+            while (step < remaining && begin[step] < value) {
+                step *= 2;
+            }
+            begin = std::lower_bound(begin + step / 2, begin + std::min(step + 1, remaining),
+                value);
+            if (begin == right.end()) {
+                return;
+            }
+            if (*begin == value) {
+                func(value);
+            }
+        }
+        return;
+    }
+    auto leftPos = 0u, rightPos = 0u;
+    while (leftPos < left.size() && rightPos < right.size()) {
+        auto leftValue = left[leftPos];
+        auto rightValue = right[rightPos];
+        if (leftValue == rightValue) {
+            func(leftValue);
+        }
+        leftPos += leftValue <= rightValue;
+        rightPos += rightValue <= leftValue;
+    }
+}
+
+// Neighbors of the graph viewed as an undirected simple graph, i.e., edges are taken in both
+// directions, and parallel edges and self loops are ignored. Nodes are numbered consecutively
+// across node tables, in the order of Graph::getNodeTableIDs(). Each edge is only kept in the
+// adjacency list of its endpoint with the lower degree (ties are broken by node number), so every
+// node keeps O(sqrt(E)) neighbors and every triangle is found exactly once from its lowest node.
+class OrientedAdjacency {
+public:
+    OrientedAdjacency(Graph* graph, MemoryManager* mm) : mm{mm}, numNodes{0} {
+        for (auto tableID : graph->getNodeTableIDs()) {
+            firstNodeIdx.insert({tableID, numNodes});
+            numNodes += graph->getNumNodes(tableID);
+        }
+        degreesBuffer = mm->allocateBuffer(false, numNodes * sizeof(offset_t));
+        degrees = reinterpret_cast<offset_t*>(degreesBuffer->getData());
+        numNbrsBuffer = mm->allocateBuffer(false, numNodes * sizeof(offset_t));
+        numNbrs = reinterpret_cast<offset_t*>(numNbrsBuffer->getData());
+        csrOffsetsBuffer = mm->allocateBuffer(false, (numNodes + 1) * sizeof(offset_t));
+        csrOffsets = reinterpret_cast<offset_t*>(csrOffsetsBuffer->getData());
+    }
+
+    offset_t getNumNodes() const { return numNodes; }
+
+    offset_t getNodeIdx(nodeID_t nodeID) const {
+        return firstNodeIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    void setDegree(offset_t u, offset_t degree) { degrees[u] = degree; }
+    offset_t getDegree(offset_t u) const { return degrees[u]; }
+
+    // Reserves space for the neighbors of each node. Must be called after all degrees are set.
+    void allocateNbrs() {
+        csrOffsets[0] = 0;
+        for (auto i = 0u; i < numNodes; ++i) {
+            csrOffsets[i + 1] = csrOffsets[i] + degrees[i];
+        }
+        nbrsBuffer = mm->allocateBuffer(false, csrOffsets[numNodes] * sizeof(offset_t));
+        nbrs = reinterpret_cast<offset_t*>(nbrsBuffer->getData());
+    }
+
+    // Whether the edge between u and v is kept in the neighbors of u.
+    bool isOriented(offset_t u, offset_t v) const {
+        return degrees[u] < degrees[v] || (degrees[u] == degrees[v] && u < v);
+    }
+
+    // nbrs should be sorted and only contain nodes that u is oriented to.
+    void setNbrs(offset_t u, std::span<const offset_t> uNbrs) {
+        KU_ASSERT(uNbrs.size() <= degrees[u]);
+        std::copy(uNbrs.begin(), uNbrs.end(), nbrs + csrOffsets[u]);
+        numNbrs[u] = uNbrs.size();
+    }
+
+    std::span<const offset_t> getNbrs(offset_t u) const {
+        return std::span(nbrs + csrOffsets[u], numNbrs[u]);
+    }
+
+private:
+    MemoryManager* mm;
+    offset_t numNodes;
+    table_id_map_t<offset_t> firstNodeIdx;
+    // Number of distinct neighbors in the undirected graph.
+    std::unique_ptr<MemoryBuffer> degreesBuffer;
+    offset_t* degrees;
+    // Number of neighbors kept in the oriented adjacency lists.
+    std::unique_ptr<MemoryBuffer> numNbrsBuffer;
+    offset_t* numNbrs;
+    std::unique_ptr<MemoryBuffer> csrOffsetsBuffer;
+    offset_t* csrOffsets;
+    std::unique_ptr<MemoryBuffer> nbrsBuffer;
+    offset_t* nbrs = nullptr;
+};
+
+// Base class of the vertex computes that collect the distinct undirected neighbors of a node.
+class UndirectedNbrsVC : public VertexCompute {
+public:
+    UndirectedNbrsVC(Graph* graph, OrientedAdjacency& adjacency)
+        : graph{graph}, adjacency{adjacency} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        fwdScanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+        bwdScanState = graph->prepareMultiTableScanBwd(nodeTableIDs);
+    }
+
+protected:
+    // Collects the neighbors of nodeID into nbrs, sorted and without duplicates or nodeID itself.
+    void collectNbrs(nodeID_t nodeID) {
+        auto nodeIdx = adjacency.getNodeIdx(nodeID);
+        nbrs.clear();
+        auto collect = [&](const GraphScanState::Chunk& chunk) {
+            chunk.selVector.forEach([&](auto i) {
+                auto nbrIdx = adjacency.getNodeIdx(chunk.nbrNodes[i]);
+                if (nbrIdx != nodeIdx) {
+                    nbrs.push_back(nbrIdx);
+                }
+            });
+        };
+        for (const auto chunk : graph->scanFwd(nodeID, *fwdScanState)) {
+            collect(chunk);
+        }
+        for (const auto chunk : graph->scanBwd(nodeID, *bwdScanState)) {
+            collect(chunk);
+        }
+        std::sort(nbrs.begin(), nbrs.end());
+        nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+    }
+
+protected:
+    Graph* graph;
+    OrientedAdjacency& adjacency;
+    std::unique_ptr<GraphScanState> fwdScanState;
+    std::unique_ptr<GraphScanState> bwdScanState;
+    std::vector<offset_t> nbrs;
+};
+
+class TriangleCountDegreeVC final : public UndirectedNbrsVC {
+public:
+    using UndirectedNbrsVC::UndirectedNbrsVC;
+
+    void vertexCompute(nodeID_t nodeID) override {
+        collectNbrs(nodeID);
+        adjacency.setDegree(adjacency.getNodeIdx(nodeID), nbrs.size());
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountDegreeVC>(graph, adjacency);
+    }
+};
+
+class TriangleCountOrientVC final : public UndirectedNbrsVC {
+public:
+    using UndirectedNbrsVC::UndirectedNbrsVC;
+
+    void vertexCompute(nodeID_t nodeID) override {
+        collectNbrs(nodeID);
+        auto nodeIdx = adjacency.getNodeIdx(nodeID);
+        std::erase_if(nbrs, [&](auto nbrIdx) { return !adjacency.isOriented(nodeIdx, nbrIdx); });
+        adjacency.setNbrs(nodeIdx, nbrs);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountOrientVC>(graph, adjacency);
+    }
+};
+
+// Counts, for each node u and each neighbor v in the oriented adjacency lists, the common
+// neighbors w of u and v. Each (u, v, w) is a distinct triangle, which is counted for all three of
+// its nodes.
+class TriangleCountIntersectVC final : public VertexCompute {
+public:
+    TriangleCountIntersectVC(const OrientedAdjacency& adjacency,
+        std::atomic<uint64_t>* triangleCounts)
+        : adjacency{adjacency}, triangleCounts{triangleCounts} {}
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto u = adjacency.getNodeIdx(nodeID);
+        auto uNbrs = adjacency.getNbrs(u);
+        uint64_t uCount = 0;
+        for (auto v : uNbrs) {
+            uint64_t vCount = 0;
+            intersectSortedLists(uNbrs, adjacency.getNbrs(v), [&](offset_t w) {
+                triangleCounts[w].fetch_add(1, std::memory_order_relaxed);
+                vCount++;
+            });
+            if (vCount > 0) {
+                triangleCounts[v].fetch_add(vCount, std::memory_order_relaxed);
+                uCount += vCount;
+            }
+        }
+        if (uCount > 0) {
+            triangleCounts[u].fetch_add(uCount, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountIntersectVC>(adjacency, triangleCounts);
+    }
+
+private:
+    const OrientedAdjacency& adjacency;
+    std::atomic<uint64_t>* triangleCounts;
+};
+
+class TriangleCountOutputWriterVC final : public VertexCompute {
+public:
+    TriangleCountOutputWriterVC(main::ClientContext* context, const OrientedAdjacency& adjacency,
+        const std::atomic<uint64_t>* triangleCounts, bool writeCoefficient,
+        FactorizedTable& globalFT, std::mutex& mtx)
+        : context{context}, adjacency{adjacency}, triangleCounts{triangleCounts},
+          writeCoefficient{writeCoefficient}, globalFT{globalFT}, mtx{mtx} {
+        auto mm = context->getMemoryManager();
+        localFT = std::make_unique<FactorizedTable>(mm, globalFT.getTableSchema()->copy());
+        nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+        valueVector = std::make_unique<ValueVector>(
+            writeCoefficient ? LogicalType::DOUBLE() : LogicalType::INT64(), mm);
+        nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
+        valueVector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(nodeIDVector.get());
+        vectors.push_back(valueVector.get());
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto nodeIdx = adjacency.getNodeIdx(nodeID);
+        auto numTriangles = triangleCounts[nodeIdx].load(std::memory_order_relaxed);
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        if (writeCoefficient) {
+            // The fraction of the pairs of neighbors that are connected.
+            auto degree = adjacency.getDegree(nodeIdx);
+            auto coefficient = degree < 2 ? 0.0 :
+                                            2.0 * numTriangles /
+                                                (static_cast<double>(degree) * (degree - 1));
+            valueVector->setValue<double>(0, coefficient);
+        } else {
+            valueVector->setValue<int64_t>(0, numTriangles);
+        }
+        localFT->append(vectors);
+    }
+
+    void finalizeWorkerThread() override {
+        std::unique_lock lck{mtx};
+        globalFT.merge(*localFT);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountOutputWriterVC>(context, adjacency, triangleCounts,
+            writeCoefficient, globalFT, mtx);
+    }
+
+private:
+    main::ClientContext* context;
+    const OrientedAdjacency& adjacency;
+    const std::atomic<uint64_t>* triangleCounts;
+    bool writeCoefficient;
+    FactorizedTable& globalFT;
+    std::mutex& mtx;
+    std::unique_ptr<FactorizedTable> localFT;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> valueVector;
+    std::vector<ValueVector*> vectors;
+};
+
+// Counts the triangles of each node in the graph viewed as an undirected simple graph, and
+// optionally turns them into local clustering coefficients.
+class TriangleCount final : public GDSAlgorithm {
+    static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+    static constexpr char COEFFICIENT_COLUMN_NAME[] = "coefficient";
+
+public:
+    explicit TriangleCount(bool writeCoefficient) : writeCoefficient{writeCoefficient} {}
+    TriangleCount(const TriangleCount& other)
+        : GDSAlgorithm{other}, writeCoefficient{other.writeCoefficient} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     */
+    std::vector<common::LogicalTypeID> getParameterTypeIDs() const override {
+        return std::vector<LogicalTypeID>{LogicalTypeID::ANY};
+    }
+
+    /*
+     * Outputs are
+     *
+     * _node._id::INTERNAL_ID
+     * triangle_count::INT64 or coefficient::DOUBLE
+     */
+    binder::expression_vector getResultColumns(binder::Binder* binder) const override {
+        expression_vector columns;
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        if (writeCoefficient) {
+            columns.push_back(
+                binder->createVariable(COEFFICIENT_COLUMN_NAME, LogicalType::DOUBLE()));
+        } else {
+            columns.push_back(
+                binder->createVariable(TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+        }
+        return columns;
+    }
+
+    void bind(const expression_vector&, Binder* binder, GraphEntry& graphEntry) override {
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        bindData = std::make_unique<GDSBindData>(nodeOutput);
+    }
+
+    void exec(processor::ExecutionContext* context) override {
+        auto graph = sharedState->graph.get();
+        if (graph->getNumNodes() == 0) {
+            return;
+        }
+        auto mm = context->clientContext->getMemoryManager();
+        OrientedAdjacency adjacency{graph, mm};
+        TriangleCountDegreeVC degreeVC{graph, adjacency};
+        GDSUtils::runVertexComputeIteration(context, graph, degreeVC);
+        adjacency.allocateNbrs();
+        TriangleCountOrientVC orientVC{graph, adjacency};
+        GDSUtils::runVertexComputeIteration(context, graph, orientVC);
+        auto numNodes = adjacency.getNumNodes();
+        auto countsBuffer = mm->allocateBuffer(false, numNodes * sizeof(std::atomic<uint64_t>));
+        auto counts = reinterpret_cast<std::atomic<uint64_t>*>(countsBuffer->getData());
+        for (auto i = 0u; i < numNodes; ++i) {
+            counts[i].store(0, std::memory_order_relaxed);
+        }
+        TriangleCountIntersectVC intersectVC{adjacency, counts};
+        GDSUtils::runVertexComputeIteration(context, graph, intersectVC);
+        std::mutex mtx;
+        TriangleCountOutputWriterVC writerVC{context->clientContext, adjacency, counts,
+            writeCoefficient, *sharedState->fTable, mtx};
+        GDSUtils::runVertexComputeIteration(context, graph, writerVC);
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<TriangleCount>(*this);
+    }
+
+private:
+    bool writeCoefficient;
+};
+
+static function_set getTriangleCountFunctionSet(const char* name, bool writeCoefficient) {
+    function_set result;
+    auto algo = std::make_unique<TriangleCount>(writeCoefficient);
+    auto function =
+        std::make_unique<GDSFunction>(name, algo->getParameterTypeIDs(), std::move(algo));
+    result.push_back(std::move(function));
+    return result;
+}
+
+function_set TriangleCountFunction::getFunctionSet() {
+    return getTriangleCountFunctionSet(name, false /* writeCoefficient */);
+}
+
+function_set LocalClusteringCoefficientFunction::getFunctionSet() {
+    return getTriangleCountFunctionSet(name, true /* writeCoefficient */);
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,12 +1,16 @@
+#include <mutex>
+
 #include "binder/binder.h"
-#include "common/types/internal_id_util.h"
 #include "common/types/types.h"
+#include "function/gds/gds_frontier.h"
 #include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
 #include "function/gds_function.h"
 #include "graph/graph.h"
 #include "main/client_context.h"
 #include "processor/execution_context.h"
 #include "processor/result/factorized_table.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -17,10 +21,132 @@ using namespace kuzu::graph;
 namespace kuzu {
 namespace function {
 
-class WeaklyConnectedComponentOutputWriter {
+// Disjoint set forest over all nodes of the graph. Nodes are numbered consecutively across node
+// tables, in the order of Graph::getNodeTableIDs(). Sets are linked concurrently without locks by
+// always pointing the root with the larger number to the one with the smaller number, so the root
+// of each set is its smallest node (Shiloach-Vishkin style hooking as in Afforest).
+class ComponentForest {
+public:
+    ComponentForest(Graph* graph, MemoryManager* mm) : numNodes{0} {
+        for (auto tableID : graph->getNodeTableIDs()) {
+            firstNodeIdx.insert({tableID, numNodes});
+            numNodes += graph->getNumNodes(tableID);
+        }
+        parentsBuffer = mm->allocateBuffer(false, numNodes * sizeof(std::atomic<offset_t>));
+        parents = reinterpret_cast<std::atomic<offset_t>*>(parentsBuffer->getData());
+        groupIDsBuffer = mm->allocateBuffer(false, numNodes * sizeof(int64_t));
+        groupIDs = reinterpret_cast<int64_t*>(groupIDsBuffer->getData());
+        for (auto i = 0u; i < numNodes; ++i) {
+            parents[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    offset_t getNodeIdx(nodeID_t nodeID) const {
+        return firstNodeIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    void link(offset_t u, offset_t v) {
+        auto uParent = parents[u].load(std::memory_order_relaxed);
+        auto vParent = parents[v].load(std::memory_order_relaxed);
+        while (uParent != vParent) {
+            auto high = std::max(uParent, vParent);
+            auto low = std::min(uParent, vParent);
+            auto highParent = parents[high].load(std::memory_order_relaxed);
+            if (highParent == low) {
+                return;
+            }
+            // Only roots are hooked, otherwise the subtree of high would be detached from its set.
+            if (highParent == high &&
+                parents[high].compare_exchange_strong(highParent, low, std::memory_order_relaxed)) {
+                return;
+            }
+            uParent = parents[parents[high].load(std::memory_order_relaxed)].load(
+                std::memory_order_relaxed);
+            vParent = parents[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Points the node directly to the root of its set. Must only be called after all links.
+    void compress(offset_t u) {
+        auto parent = parents[u].load(std::memory_order_relaxed);
+        while (parent != parents[parent].load(std::memory_order_relaxed)) {
+            parent = parents[parent].load(std::memory_order_relaxed);
+        }
+        parents[u].store(parent, std::memory_order_relaxed);
+    }
+
+    // Numbers the sets consecutively in the order of their smallest nodes, which is the order in
+    // which a sequential traversal of the node tables discovers them.
+    void assignGroupIDs() {
+        int64_t groupID = 0;
+        for (auto i = 0u; i < numNodes; ++i) {
+            if (parents[i].load(std::memory_order_relaxed) == i) {
+                groupIDs[i] = groupID++;
+            }
+        }
+    }
+
+    int64_t getGroupID(offset_t u) const {
+        return groupIDs[parents[u].load(std::memory_order_relaxed)];
+    }
+
+private:
+    offset_t numNodes;
+    table_id_map_t<offset_t> firstNodeIdx;
+    std::unique_ptr<MemoryBuffer> parentsBuffer;
+    std::atomic<offset_t>* parents;
+    std::unique_ptr<MemoryBuffer> groupIDsBuffer;
+    int64_t* groupIDs;
+};
+
+// Links every node to the set of each of its forward neighbours. Since every edge is the forward
+// edge of its source node, a single pass over all nodes visits every edge once.
+class WCCLinkVC final : public VertexCompute {
+public:
+    WCCLinkVC(Graph* graph, ComponentForest& forest) : graph{graph}, forest{forest} {
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto nodeIdx = forest.getNodeIdx(nodeID);
+        for (const auto chunk : graph->scanFwd(nodeID, *scanState)) {
+            chunk.selVector.forEach(
+                [&](auto i) { forest.link(nodeIdx, forest.getNodeIdx(chunk.nbrNodes[i])); });
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WCCLinkVC>(graph, forest);
+    }
+
+private:
+    Graph* graph;
+    ComponentForest& forest;
+    std::unique_ptr<GraphScanState> scanState;
+};
+
+class WCCCompressVC final : public VertexCompute {
+public:
+    explicit WCCCompressVC(ComponentForest& forest) : forest{forest} {}
+
+    void vertexCompute(nodeID_t nodeID) override { forest.compress(forest.getNodeIdx(nodeID)); }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WCCCompressVC>(forest);
+    }
+
+private:
+    ComponentForest& forest;
+};
+
+class WCCOutputWriterVC final : public VertexCompute {
 public:
-    explicit WeaklyConnectedComponentOutputWriter(main::ClientContext* context) {
+    WCCOutputWriterVC(main::ClientContext* context, ComponentForest& forest,
+        FactorizedTable& globalFT, std::mutex& mtx)
+        : context{context}, forest{forest}, globalFT{globalFT}, mtx{mtx} {
         auto mm = context->getMemoryManager();
+        localFT = std::make_unique<FactorizedTable>(mm, globalFT.getTableSchema()->copy());
         nodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
         groupVector = std::make_unique<ValueVector>(LogicalType::INT64(), mm);
         nodeIDVector->state = DataChunkState::getSingleValueDataChunkState();
@@ -29,19 +155,27 @@ public:
         vectors.push_back(groupVector.get());
     }
 
-    void materialize(graph::Graph* graph, const common::node_id_map_t<int64_t>& visitedMap,
-        FactorizedTable& table) const {
-        for (auto tableID : graph->getNodeTableIDs()) {
-            for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
-                auto nodeID = nodeID_t{offset, tableID};
-                nodeIDVector->setValue<nodeID_t>(0, nodeID);
-                groupVector->setValue<int64_t>(0, visitedMap.at(nodeID));
-                table.append(vectors);
-            }
-        }
+    void vertexCompute(nodeID_t nodeID) override {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        groupVector->setValue<int64_t>(0, forest.getGroupID(forest.getNodeIdx(nodeID)));
+        localFT->append(vectors);
+    }
+
+    void finalizeWorkerThread() override {
+        std::unique_lock lck{mtx};
+        globalFT.merge(*localFT);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WCCOutputWriterVC>(context, forest, globalFT, mtx);
     }
 
 private:
+    main::ClientContext* context;
+    ComponentForest& forest;
+    FactorizedTable& globalFT;
+    std::mutex& mtx;
+    std::unique_ptr<FactorizedTable> localFT;
     std::unique_ptr<ValueVector> nodeIDVector;
     std::unique_ptr<ValueVector> groupVector;
     std::vector<ValueVector*> vectors;
@@ -82,49 +216,25 @@ public:
         bindData = std::make_unique<GDSBindData>(nodeOutput);
     }
 
-    void initLocalState(main::ClientContext* context) override {
-        localState = std::make_unique<WeaklyConnectedComponentOutputWriter>(context);
-    }
-
     void exec(processor::ExecutionContext* context) override {
         auto graph = sharedState->graph.get();
-        localState = std::make_unique<WeaklyConnectedComponentOutputWriter>(context->clientContext);
-        visitedMap.clear();
-        auto groupID = 0;
-        auto nodeTableIDs = graph->getNodeTableIDs();
-        auto scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
-        for (auto tableID : nodeTableIDs) {
-            for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
-                auto nodeID = nodeID_t{offset, tableID};
-                if (visitedMap.contains(nodeID)) {
-                    continue;
-                }
-                findConnectedComponent(nodeID, groupID++, *scanState);
-            }
+        if (graph->getNumNodes() == 0) {
+            return;
         }
-        localState->materialize(graph, visitedMap, *sharedState->fTable);
+        ComponentForest forest{graph, context->clientContext->getMemoryManager()};
+        WCCLinkVC linkVC{graph, forest};
+        GDSUtils::runVertexComputeIteration(context, graph, linkVC);
+        WCCCompressVC compressVC{forest};
+        GDSUtils::runVertexComputeIteration(context, graph, compressVC);
+        forest.assignGroupIDs();
+        std::mutex mtx;
+        WCCOutputWriterVC writerVC{context->clientContext, forest, *sharedState->fTable, mtx};
+        GDSUtils::runVertexComputeIteration(context, graph, writerVC);
     }
 
     std::unique_ptr<GDSAlgorithm> copy() const override {
         return std::make_unique<WeaklyConnectedComponent>(*this);
     }
-
-private:
-    void findConnectedComponent(common::nodeID_t nodeID, int64_t groupID,
-        GraphScanState& scanState) {
-        KU_ASSERT(!visitedMap.contains(nodeID));
-        visitedMap.insert({nodeID, groupID});
-        // Collect the nodes so that the recursive scan doesn't begin until this scan is done
-        for (auto& nbr : sharedState->graph->scanFwd(nodeID, scanState).collectNbrNodes()) {
-            if (!visitedMap.contains(nbr)) {
-                findConnectedComponent(nbr, groupID, scanState);
-            }
-        }
-    }
-
-private:
-    common::node_id_map_t<int64_t> visitedMap;
-    std::unique_ptr<WeaklyConnectedComponentOutputWriter> localState;
 };
 
 function_set WeaklyConnectedComponentsFunction::getFunctionSet() {
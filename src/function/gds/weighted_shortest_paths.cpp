@@ -0,0 +1,545 @@
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
+
+#include "binder/binder.h"
+#include "binder/expression/expression_util.h"
+#include "common/enums/extend_direction.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/task_system/task_scheduler.h"
+#include "function/gds/gds_frontier.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds_function.h"
+#include "graph/graph.h"
+#include "main/client_context.h"
+#include "main/settings.h"
+#include "processor/execution_context.h"
+#include "processor/result/factorized_table.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+struct WeightedSPBindData final : public GDSBindData {
+    static constexpr double DEFAULT_DELTA = 1.0;
+
+    std::shared_ptr<binder::Expression> nodeInput;
+    ExtendDirection extendDirection;
+    // Width of the distance ranges of the buckets of delta-stepping.
+    double delta;
+
+    WeightedSPBindData(std::shared_ptr<binder::Expression> nodeInput,
+        std::shared_ptr<binder::Expression> nodeOutput, ExtendDirection extendDirection,
+        double delta)
+        : GDSBindData{std::move(nodeOutput)}, nodeInput{std::move(nodeInput)},
+          extendDirection{extendDirection}, delta{delta} {}
+    WeightedSPBindData(const WeightedSPBindData& other)
+        : GDSBindData{other}, nodeInput{other.nodeInput}, extendDirection{other.extendDirection},
+          delta{other.delta} {}
+
+    bool hasNodeInput() const override { return true; }
+    std::shared_ptr<binder::Expression> getNodeInput() const override { return nodeInput; }
+
+    std::unique_ptr<GDSBindData> copy() const override {
+        return std::make_unique<WeightedSPBindData>(*this);
+    }
+};
+
+// Edge through which a node was reached with its current distance.
+struct WeightedSPParent {
+    nodeID_t nodeID;
+    relID_t edgeID;
+    bool isFwd;
+};
+
+// Distances, and optionally parents, of all nodes of the graph from a single source, stored in
+// dense arrays. Nodes are numbered consecutively across node tables, in the order of
+// Graph::getNodeTableIDs(). Distances are read without locking, but only lowered while holding the
+// lock of the node's stripe, so that a node's distance and parent are always updated together.
+class WeightedSPState {
+    static constexpr uint64_t NUM_LOCK_STRIPES = 1024;
+
+public:
+    static constexpr double INFINITE_DISTANCE = std::numeric_limits<double>::infinity();
+
+    WeightedSPState(Graph* graph, MemoryManager* mm, bool trackPaths)
+        : numNodes{0}, parents{nullptr} {
+        for (auto tableID : graph->getNodeTableIDs()) {
+            firstNodeIdx.insert({tableID, numNodes});
+            numNodes += graph->getNumNodes(tableID);
+        }
+        distancesBuffer = mm->allocateBuffer(false, numNodes * sizeof(std::atomic<double>));
+        distances = reinterpret_cast<std::atomic<double>*>(distancesBuffer->getData());
+        if (trackPaths) {
+            parentsBuffer = mm->allocateBuffer(false, numNodes * sizeof(WeightedSPParent));
+            parents = reinterpret_cast<WeightedSPParent*>(parentsBuffer->getData());
+        }
+    }
+
+    // Returns false if the node is not in a table of the graph, which happens when scanning a
+    // relationship table whose other end is not part of the projection.
+    bool tryGetNodeIdx(nodeID_t nodeID, offset_t& nodeIdx) const {
+        auto it = firstNodeIdx.find(nodeID.tableID);
+        if (it == firstNodeIdx.end()) {
+            return false;
+        }
+        nodeIdx = it->second + nodeID.offset;
+        return true;
+    }
+    offset_t getNodeIdx(nodeID_t nodeID) const {
+        return firstNodeIdx.at(nodeID.tableID) + nodeID.offset;
+    }
+
+    void initSource(nodeID_t sourceNodeID) {
+        for (auto i = 0u; i < numNodes; ++i) {
+            distances[i].store(INFINITE_DISTANCE, std::memory_order_relaxed);
+        }
+        distances[getNodeIdx(sourceNodeID)].store(0, std::memory_order_relaxed);
+    }
+
+    double getDistance(offset_t nodeIdx) const {
+        return distances[nodeIdx].load(std::memory_order_relaxed);
+    }
+    const WeightedSPParent& getParent(offset_t nodeIdx) const {
+        KU_ASSERT(parents != nullptr);
+        return parents[nodeIdx];
+    }
+
+    // Lowers the distance of the node to `distance` if it is shorter, and returns true if it was.
+    bool tryLowerDistance(offset_t nodeIdx, double distance, const WeightedSPParent& parent) {
+        if (distance >= getDistance(nodeIdx)) {
+            return false;
+        }
+        std::unique_lock lck{locks[nodeIdx % NUM_LOCK_STRIPES]};
+        if (distance >= getDistance(nodeIdx)) {
+            return false;
+        }
+        distances[nodeIdx].store(distance, std::memory_order_relaxed);
+        if (parents != nullptr) {
+            parents[nodeIdx] = parent;
+        }
+        return true;
+    }
+
+private:
+    offset_t numNodes;
+    table_id_map_t<offset_t> firstNodeIdx;
+    std::unique_ptr<MemoryBuffer> distancesBuffer;
+    std::atomic<double>* distances;
+    std::unique_ptr<MemoryBuffer> parentsBuffer;
+    WeightedSPParent* parents;
+    std::array<std::mutex, NUM_LOCK_STRIPES> locks;
+};
+
+// Nodes whose distance was lowered, grouped by the index of the bucket of their new distance.
+using WeightedSPBuckets = std::map<uint64_t, std::vector<nodeID_t>>;
+
+struct DeltaSteppingSharedState {
+    static constexpr uint64_t MORSEL_SIZE = 64;
+
+    Graph* graph;
+    ExtendDirection direction;
+    double delta;
+    WeightedSPState& state;
+    uint64_t bucketIdx;
+    std::vector<nodeID_t> frontier;
+    std::atomic<uint64_t> nextFrontierIdx;
+    std::mutex mtx;
+    WeightedSPBuckets buckets;
+
+    DeltaSteppingSharedState(Graph* graph, ExtendDirection direction, double delta,
+        WeightedSPState& state)
+        : graph{graph}, direction{direction}, delta{delta}, state{state}, bucketIdx{0},
+          nextFrontierIdx{0} {}
+    DELETE_COPY_AND_MOVE(DeltaSteppingSharedState);
+
+    uint64_t getBucketIdx(double distance) const {
+        return static_cast<uint64_t>(std::floor(distance / delta));
+    }
+};
+
+// Relaxes the edges of the nodes in the frontier, i.e. the bucket being processed. Nodes whose
+// distance is lowered are collected in thread-local buckets, which are merged into the shared ones
+// when the thread finishes.
+class DeltaSteppingTask : public Task {
+public:
+    DeltaSteppingTask(uint64_t maxNumThreads, std::shared_ptr<DeltaSteppingSharedState> sharedState)
+        : Task{maxNumThreads}, sharedState{std::move(sharedState)} {}
+
+    void run() override {
+        auto graph = sharedState->graph;
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        std::unique_ptr<GraphScanState> fwdScanState;
+        std::unique_ptr<GraphScanState> bwdScanState;
+        if (sharedState->direction != ExtendDirection::BWD) {
+            fwdScanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+        }
+        if (sharedState->direction != ExtendDirection::FWD) {
+            bwdScanState = graph->prepareMultiTableScanBwd(nodeTableIDs);
+        }
+        auto& state = sharedState->state;
+        auto& frontier = sharedState->frontier;
+        const auto minDistance = sharedState->bucketIdx * sharedState->delta;
+        while (true) {
+            auto begin = sharedState->nextFrontierIdx.fetch_add(
+                DeltaSteppingSharedState::MORSEL_SIZE, std::memory_order_relaxed);
+            if (begin >= frontier.size()) {
+                break;
+            }
+            auto end = std::min<uint64_t>(begin + DeltaSteppingSharedState::MORSEL_SIZE,
+                frontier.size());
+            for (auto i = begin; i < end; ++i) {
+                auto nodeID = frontier[i];
+                auto distance = state.getDistance(state.getNodeIdx(nodeID));
+                // The node has been lowered to, and relaxed in, an earlier bucket.
+                if (distance < minDistance) {
+                    continue;
+                }
+                if (fwdScanState != nullptr) {
+                    relaxEdges(nodeID, distance, graph->scanFwd(nodeID, *fwdScanState),
+                        true /* isFwd */);
+                }
+                if (bwdScanState != nullptr) {
+                    relaxEdges(nodeID, distance, graph->scanBwd(nodeID, *bwdScanState),
+                        false /* isFwd */);
+                }
+            }
+        }
+        std::unique_lock lck{sharedState->mtx};
+        for (auto& [bucketIdx, nodeIDs] : localBuckets) {
+            auto& bucket = sharedState->buckets[bucketIdx];
+            bucket.insert(bucket.end(), nodeIDs.begin(), nodeIDs.end());
+        }
+    }
+
+private:
+    void relaxEdges(nodeID_t boundNodeID, double boundDistance, Graph::Iterator iterator,
+        bool isFwd) {
+        auto& state = sharedState->state;
+        for (const auto chunk : iterator) {
+            KU_ASSERT(chunk.selVector.getSelSize() == 0 || !chunk.weights.empty());
+            chunk.selVector.forEach([&](auto i) {
+                auto weight = chunk.weights[i];
+                if (std::isnan(weight)) {
+                    return;
+                }
+                if (weight < 0) {
+                    throw RuntimeException(
+                        "Weighted shortest path operations only work for non-negative weights.");
+                }
+                offset_t nbrIdx = 0;
+                if (!state.tryGetNodeIdx(chunk.nbrNodes[i], nbrIdx)) {
+                    return;
+                }
+                auto distance = boundDistance + weight;
+                if (state.tryLowerDistance(nbrIdx, distance,
+                        WeightedSPParent{boundNodeID, chunk.edges[i], isFwd})) {
+                    localBuckets[sharedState->getBucketIdx(distance)].push_back(
+                        chunk.nbrNodes[i]);
+                }
+            });
+        }
+    }
+
+private:
+    std::shared_ptr<DeltaSteppingSharedState> sharedState;
+    WeightedSPBuckets localBuckets;
+};
+
+class WeightedSPOutputWriterVC final : public VertexCompute {
+public:
+    WeightedSPOutputWriterVC(main::ClientContext* context, const WeightedSPState& state,
+        nodeID_t sourceNodeID, bool writeLength, bool writePath, bool writeEdgeDirection,
+        FactorizedTable& globalFT, std::mutex& mtx)
+        : context{context}, state{state}, sourceNodeID{sourceNodeID}, writeLength{writeLength},
+          writePath{writePath}, writeEdgeDirection{writeEdgeDirection}, globalFT{globalFT},
+          mtx{mtx} {
+        auto mm = context->getMemoryManager();
+        localFT = std::make_unique<FactorizedTable>(mm, globalFT.getTableSchema()->copy());
+        srcNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        dstNodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        srcNodeIDVector->setValue<nodeID_t>(0, sourceNodeID);
+        if (writeEdgeDirection) {
+            directionVector = createVector(LogicalType::LIST(LogicalType::BOOL()));
+        }
+        if (writeLength) {
+            lengthVector = createVector(LogicalType::DOUBLE());
+        }
+        if (writePath) {
+            pathNodeIDsVector = createVector(LogicalType::LIST(LogicalType::INTERNAL_ID()));
+            pathEdgeIDsVector = createVector(LogicalType::LIST(LogicalType::INTERNAL_ID()));
+        }
+    }
+
+    void vertexCompute(nodeID_t nodeID) override {
+        auto nodeIdx = state.getNodeIdx(nodeID);
+        auto distance = state.getDistance(nodeIdx);
+        if (nodeID == sourceNodeID || distance == WeightedSPState::INFINITE_DISTANCE) {
+            return;
+        }
+        dstNodeIDVector->setValue<nodeID_t>(0, nodeID);
+        if (writeLength) {
+            lengthVector->setValue<double>(0, distance);
+        }
+        if (writePath) {
+            writePathToSource(nodeIdx);
+        }
+        localFT->append(vectors);
+    }
+
+    void finalizeWorkerThread() override {
+        std::unique_lock lck{mtx};
+        globalFT.merge(*localFT);
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WeightedSPOutputWriterVC>(context, state, sourceNodeID,
+            writeLength, writePath, writeEdgeDirection, globalFT, mtx);
+    }
+
+private:
+    std::unique_ptr<ValueVector> createVector(const LogicalType& type) {
+        auto vector = std::make_unique<ValueVector>(type.copy(), context->getMemoryManager());
+        vector->state = DataChunkState::getSingleValueDataChunkState();
+        vectors.push_back(vector.get());
+        return vector;
+    }
+
+    static ValueVector* addListEntry(ValueVector* vector, uint64_t length) {
+        vector->resetAuxiliaryBuffer();
+        auto entry = ListVector::addList(vector, length);
+        KU_ASSERT(entry.offset == 0);
+        vector->setValue(0, entry);
+        return ListVector::getDataVector(vector);
+    }
+
+    // Follows the parents from the destination back to the source and writes the path in
+    // source-to-destination order.
+    void writePathToSource(offset_t nodeIdx) {
+        path.clear();
+        while (true) {
+            auto& parent = state.getParent(nodeIdx);
+            path.push_back(&parent);
+            if (parent.nodeID == sourceNodeID) {
+                break;
+            }
+            nodeIdx = state.getNodeIdx(parent.nodeID);
+        }
+        auto nodeIDs = addListEntry(pathNodeIDsVector.get(), path.size() - 1);
+        auto edgeIDs = addListEntry(pathEdgeIDsVector.get(), path.size());
+        auto directions =
+            writeEdgeDirection ? addListEntry(directionVector.get(), path.size()) : nullptr;
+        for (auto i = 0u; i < path.size(); ++i) {
+            auto parent = path[path.size() - 1 - i];
+            if (i > 0) {
+                nodeIDs->setValue<nodeID_t>(i - 1, parent->nodeID);
+            }
+            edgeIDs->setValue<relID_t>(i, parent->edgeID);
+            if (directions != nullptr) {
+                directions->setValue<bool>(i, parent->isFwd);
+            }
+        }
+    }
+
+private:
+    main::ClientContext* context;
+    const WeightedSPState& state;
+    nodeID_t sourceNodeID;
+    bool writeLength;
+    bool writePath;
+    bool writeEdgeDirection;
+    FactorizedTable& globalFT;
+    std::mutex& mtx;
+    std::unique_ptr<FactorizedTable> localFT;
+    std::unique_ptr<ValueVector> srcNodeIDVector;
+    std::unique_ptr<ValueVector> dstNodeIDVector;
+    std::unique_ptr<ValueVector> directionVector;
+    std::unique_ptr<ValueVector> lengthVector;
+    std::unique_ptr<ValueVector> pathNodeIDsVector;
+    std::unique_ptr<ValueVector> pathEdgeIDsVector;
+    std::vector<ValueVector*> vectors;
+    std::vector<const WeightedSPParent*> path;
+};
+
+/**
+ * Single source shortest paths over the weights of a numeric rel property, computed with the
+ * parallel delta-stepping algorithm (Meyer and Sanders). Nodes are kept in buckets of distance
+ * ranges of width delta. Buckets are processed in increasing order, and all nodes of a bucket
+ * relax their edges in parallel, until no node is lowered into the bucket anymore. As in the GAP
+ * benchmark suite, light and heavy edges are not relaxed separately.
+ *
+ * A small delta processes few nodes more than once but needs many rounds, while a large delta
+ * needs few rounds but re-relaxes nodes whose distance is lowered within a bucket, like
+ * Bellman-Ford. Relationships with a null weight are ignored and negative weights are rejected.
+ * One arbitrary shortest path is returned for each destination.
+ */
+class WeightedSPAlgorithm : public GDSAlgorithm {
+    static constexpr char DIRECTION_COLUMN_NAME[] = "direction";
+    static constexpr char LENGTH_COLUMN_NAME[] = "length";
+    static constexpr char PATH_NODE_IDS_COLUMN_NAME[] = "pathNodeIDs";
+    static constexpr char PATH_EDGE_IDS_COLUMN_NAME[] = "pathEdgeIDs";
+
+public:
+    WeightedSPAlgorithm(bool writeLength, bool writePath)
+        : writeLength{writeLength}, writePath{writePath} {}
+    WeightedSPAlgorithm(const WeightedSPAlgorithm& other)
+        : GDSAlgorithm{other}, writeLength{other.writeLength}, writePath{other.writePath} {}
+
+    /*
+     * Inputs are
+     *
+     * graph::ANY
+     * srcNode::NODE
+     * weightProperty::STRING
+     * direction::STRING
+     */
+    std::vector<LogicalTypeID> getParameterTypeIDs() const override {
+        return {LogicalTypeID::ANY, LogicalTypeID::NODE, LogicalTypeID::STRING,
+            LogicalTypeID::STRING};
+    }
+
+    /*
+     * Outputs are
+     *
+     * srcNode._id::INTERNAL_ID
+     * _node._id::INTERNAL_ID
+     * direction::LIST(BOOL) (for paths in both directions)
+     * length::DOUBLE (for lengths and paths)
+     * pathNodeIDs::LIST(INTERNAL_ID) (for paths)
+     * pathEdgeIDs::LIST(INTERNAL_ID) (for paths)
+     */
+    expression_vector getResultColumns(Binder* binder) const override {
+        expression_vector columns;
+        auto& inputNode = bindData->getNodeInput()->constCast<NodeExpression>();
+        columns.push_back(inputNode.getInternalID());
+        auto& outputNode = bindData->getNodeOutput()->constCast<NodeExpression>();
+        columns.push_back(outputNode.getInternalID());
+        if (writeEdgeDirection()) {
+            columns.push_back(binder->createVariable(DIRECTION_COLUMN_NAME,
+                LogicalType::LIST(LogicalType::BOOL())));
+        }
+        if (writeLength) {
+            columns.push_back(binder->createVariable(LENGTH_COLUMN_NAME, LogicalType::DOUBLE()));
+        }
+        if (writePath) {
+            columns.push_back(binder->createVariable(PATH_NODE_IDS_COLUMN_NAME,
+                LogicalType::LIST(LogicalType::INTERNAL_ID())));
+            columns.push_back(binder->createVariable(PATH_EDGE_IDS_COLUMN_NAME,
+                LogicalType::LIST(LogicalType::INTERNAL_ID())));
+        }
+        return columns;
+    }
+
+    void bind(const expression_vector& params, Binder* binder, GraphEntry& graphEntry) override {
+        KU_ASSERT(params.size() == 4 || params.size() == 5);
+        auto nodeInput = params[1];
+        auto nodeOutput = bindNodeOutput(binder, graphEntry);
+        auto propertyName = ExpressionUtil::getLiteralValue<std::string>(*params[2]);
+        graphEntry.setRelWeightProperty(bindRelWeightProperty(propertyName, binder, graphEntry));
+        auto extendDirection = ExtendDirectionUtil::fromString(
+            ExpressionUtil::getLiteralValue<std::string>(*params[3]));
+        auto delta = WeightedSPBindData::DEFAULT_DELTA;
+        if (params.size() == 5) {
+            delta = ExpressionUtil::getLiteralValue<double>(*params[4]);
+            if (!(delta > 0)) {
+                throw BinderException("Delta of weighted shortest path operations must be "
+                                      "positive.");
+            }
+        }
+        bindData =
+            std::make_unique<WeightedSPBindData>(nodeInput, nodeOutput, extendDirection, delta);
+    }
+
+    void exec(ExecutionContext* context) override {
+        auto clientContext = context->clientContext;
+        auto graph = sharedState->graph.get();
+        auto weightedSPBindData = bindData->ptrCast<WeightedSPBindData>();
+        auto maxThreads =
+            clientContext->getCurrentSetting(main::ThreadsSetting::name).getValue<uint64_t>();
+        WeightedSPState state{graph, clientContext->getMemoryManager(), writePath};
+        for (auto& tableID : graph->getNodeTableIDs()) {
+            if (!sharedState->inputNodeOffsetMasks.contains(tableID)) {
+                continue;
+            }
+            auto mask = sharedState->inputNodeOffsetMasks.at(tableID).get();
+            for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
+                if (!mask->isMasked(offset)) {
+                    continue;
+                }
+                auto sourceNodeID = nodeID_t{offset, tableID};
+                state.initSource(sourceNodeID);
+                auto deltaSteppingSharedState = std::make_shared<DeltaSteppingSharedState>(graph,
+                    weightedSPBindData->extendDirection, weightedSPBindData->delta, state);
+                deltaSteppingSharedState->buckets[0].push_back(sourceNodeID);
+                while (!deltaSteppingSharedState->buckets.empty()) {
+                    auto bucket = deltaSteppingSharedState->buckets.begin();
+                    deltaSteppingSharedState->bucketIdx = bucket->first;
+                    deltaSteppingSharedState->frontier = std::move(bucket->second);
+                    deltaSteppingSharedState->buckets.erase(bucket);
+                    deltaSteppingSharedState->nextFrontierIdx.store(0, std::memory_order_relaxed);
+                    auto task =
+                        std::make_shared<DeltaSteppingTask>(maxThreads, deltaSteppingSharedState);
+                    // See GDSUtils::runFrontiersUntilConvergence for why a new worker thread is
+                    // launched.
+                    clientContext->getTaskScheduler()->scheduleTaskAndWaitOrError(task, context,
+                        true /* launchNewWorkerThread */);
+                }
+                std::mutex mtx;
+                WeightedSPOutputWriterVC writerVC{clientContext, state, sourceNodeID, writeLength,
+                    writePath, writeEdgeDirection(), *sharedState->fTable, mtx};
+                GDSUtils::runVertexComputeIteration(context, graph, writerVC);
+            }
+        }
+    }
+
+    std::unique_ptr<GDSAlgorithm> copy() const override {
+        return std::make_unique<WeightedSPAlgorithm>(*this);
+    }
+
+private:
+    bool writeEdgeDirection() const {
+        return writePath &&
+               bindData->ptrCast<WeightedSPBindData>()->extendDirection == ExtendDirection::BOTH;
+    }
+
+private:
+    bool writeLength;
+    bool writePath;
+};
+
+static function_set getWeightedSPFunctionSet(const std::string& name, bool writeLength,
+    bool writePath) {
+    function_set result;
+    auto algo = std::make_unique<WeightedSPAlgorithm>(writeLength, writePath);
+    auto parameterTypeIDs = algo->getParameterTypeIDs();
+    result.push_back(std::make_unique<GDSFunction>(name, parameterTypeIDs, algo->copy()));
+    // Overload with the delta of delta-stepping as last parameter.
+    parameterTypeIDs.push_back(LogicalTypeID::DOUBLE);
+    result.push_back(std::make_unique<GDSFunction>(name, parameterTypeIDs, std::move(algo)));
+    return result;
+}
+
+function_set WeightedSPDestinationsFunction::getFunctionSet() {
+    return getWeightedSPFunctionSet(name, false /* writeLength */, false /* writePath */);
+}
+
+function_set WeightedSPLengthsFunction::getFunctionSet() {
+    return getWeightedSPFunctionSet(name, true /* writeLength */, false /* writePath */);
+}
+
+function_set WeightedSPPathsFunction::getFunctionSet() {
+    return getWeightedSPFunctionSet(name, true /* writeLength */, true /* writePath */);
+}
+
+} // namespace function
+} // namespace kuzu
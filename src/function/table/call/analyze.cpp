@@ -0,0 +1,100 @@
+#include "binder/ddl/bound_alter_info.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/stats/table_statistics_collector.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct AnalyzeBindData final : public CallTableFuncBindData {
+    std::vector<std::string> tableNames;
+    ClientContext* context;
+
+    AnalyzeBindData(std::vector<LogicalType> columnTypes, std::vector<std::string> columnNames,
+        std::vector<std::string> tableNames, ClientContext* context)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), tableNames.size()},
+          tableNames{std::move(tableNames)}, context{context} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AnalyzeBindData>(LogicalType::copy(columnTypes), columnNames,
+            tableNames, context);
+    }
+};
+
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    const auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    const auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    const auto bindData = input.bindData->constPtrCast<AnalyzeBindData>();
+    const auto context = bindData->context;
+    const auto catalog = context->getCatalog();
+    for (auto i = morsel.startOffset; i < morsel.endOffset; i++) {
+        const auto& tableName = bindData->tableNames[i];
+        const auto entry = catalog->getTableCatalogEntry(context->getTx(), tableName);
+        auto statistics = TableStatisticsCollector::collect(context->getTx(),
+            context->getMemoryManager(), *context->getStorageManager(), *entry);
+        catalog->alterTableEntry(context->getTx(),
+            BoundAlterInfo{AlterType::UPDATE_STATISTICS, tableName,
+                std::make_unique<BoundExtraStatisticsInfo>(std::move(statistics))});
+        output.dataChunk.getValueVectorMutable(0).setValue(i - morsel.startOffset,
+            stringFormat("Table {} analyzed.", tableName));
+    }
+    return morsel.endOffset - morsel.startOffset;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput* input) {
+    const auto catalog = context->getCatalog();
+    std::vector<std::string> tableNames;
+    if (input->inputs.empty()) {
+        for (auto& entry : catalog->getNodeTableEntries(context->getTx())) {
+            tableNames.push_back(entry->getName());
+        }
+        for (auto& entry : catalog->getRelTableEntries(context->getTx())) {
+            tableNames.push_back(entry->getName());
+        }
+    } else {
+        const auto tableName = input->inputs[0].getValue<std::string>();
+        if (!catalog->containsTable(context->getTx(), tableName)) {
+            throw BinderException{"Table " + tableName + " does not exist!"};
+        }
+        const auto tableType =
+            catalog->getTableCatalogEntry(context->getTx(), tableName)->getTableType();
+        if (tableType != TableType::NODE && tableType != TableType::REL) {
+            throw BinderException{stringFormat(
+                "Cannot analyze {}. Only node and rel tables can be analyzed.", tableName)};
+        }
+        tableNames.push_back(tableName);
+    }
+    std::vector<std::string> columnNames{"result"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    return std::make_unique<AnalyzeBindData>(std::move(columnTypes), std::move(columnNames),
+        std::move(tableNames), context);
+}
+
+function_set AnalyzeFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
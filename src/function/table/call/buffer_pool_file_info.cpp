@@ -0,0 +1,71 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct BufferPoolFileInfoBindData final : public CallTableFuncBindData {
+    std::vector<FileHandleInfo> infos;
+
+    BufferPoolFileInfoBindData(std::vector<FileHandleInfo> infos,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames,
+        offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          infos{std::move(infos)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BufferPoolFileInfoBindData>(infos, LogicalType::copy(columnTypes),
+            columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& infos = input.bindData->constPtrCast<BufferPoolFileInfoBindData>()->infos;
+    auto numFilesToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numFilesToOutput; i++) {
+        auto& info = infos[morsel.startOffset + i];
+        dataChunk.getValueVectorMutable(0).setValue(i, info.filePath);
+        dataChunk.getValueVectorMutable(1).setValue(i, info.numPages);
+        dataChunk.getValueVectorMutable(2).setValue(i, info.numCachedPages);
+        dataChunk.getValueVectorMutable(3).setValue(i, info.numBytesRead);
+        dataChunk.getValueVectorMutable(4).setValue(i, info.numBytesWritten);
+    }
+    return numFilesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput*) {
+    std::vector<std::string> columnNames{"file_path", "num_pages", "num_cached_pages",
+        "bytes_read", "bytes_written"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    for (auto i = 1u; i < columnNames.size(); i++) {
+        columnTypes.push_back(LogicalType::UINT64());
+    }
+    auto infos = context->getMemoryManager()->getBufferManager()->getFileHandleInfos();
+    auto numFiles = infos.size();
+    return std::make_unique<BufferPoolFileInfoBindData>(std::move(infos), std::move(columnTypes),
+        std::move(columnNames), numFiles);
+}
+
+function_set BufferPoolFileInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,68 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct BufferPoolInfoBindData final : public CallTableFuncBindData {
+    BufferPoolInfo info;
+
+    BufferPoolInfoBindData(BufferPoolInfo info, std::vector<LogicalType> returnTypes,
+        std::vector<std::string> returnColumnNames)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames),
+              1 /* one row result */},
+          info{info} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BufferPoolInfoBindData>(info, LogicalType::copy(columnTypes),
+            columnNames);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto& info = input.bindData->constPtrCast<BufferPoolInfoBindData>()->info;
+    auto pos = dataChunk.state->getSelVector()[0];
+    const uint64_t values[] = {info.bufferPoolSize, info.usedMemory, info.numCacheHits,
+        info.numCacheMisses, info.numEvictions, info.numFailedEvictions,
+        info.numOptimisticReadRetries, info.numTempPageAllocations, info.numTempPagesInUse,
+        info.numBytesRead, info.numBytesWritten};
+    for (auto i = 0u; i < std::size(values); i++) {
+        dataChunk.getValueVectorMutable(i).setValue(pos, values[i]);
+    }
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput*) {
+    std::vector<std::string> columnNames{"buffer_pool_size", "used_memory", "cache_hits",
+        "cache_misses", "evictions", "failed_evictions", "optimistic_read_retries",
+        "temp_page_allocations", "temp_pages_in_use", "bytes_read", "bytes_written"};
+    std::vector<LogicalType> columnTypes;
+    for (auto i = 0u; i < columnNames.size(); i++) {
+        columnTypes.push_back(LogicalType::UINT64());
+    }
+    auto info = context->getMemoryManager()->getBufferManager()->getBufferPoolInfo();
+    return std::make_unique<BufferPoolInfoBindData>(info, std::move(columnTypes),
+        std::move(columnNames));
+}
+
+function_set BufferPoolInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,133 @@
+#include "binder/ddl/bound_alter_info.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/index/hnsw_index.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace function {
+
+struct CreateVectorIndexBindData final : public CallTableFuncBindData {
+    std::string tableName;
+    std::string propertyName;
+    VectorDistanceMetric metric;
+    ClientContext* context;
+
+    CreateVectorIndexBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, std::string tableName, std::string propertyName,
+        VectorDistanceMetric metric, ClientContext* context)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), 1 /*maxOffset*/},
+          tableName{std::move(tableName)}, propertyName{std::move(propertyName)}, metric{metric},
+          context{context} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateVectorIndexBindData>(LogicalType::copy(columnTypes),
+            columnNames, tableName, propertyName, metric, context);
+    }
+};
+
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    const auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    const auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    const auto bindData = input.bindData->constPtrCast<CreateVectorIndexBindData>();
+    const auto context = bindData->context;
+    const auto transaction = context->getTx();
+    // See CREATE_INDEX.
+    if (context->getTransactionManagerUnsafe()->getNumActiveWriteTransactions() > 1) {
+        throw RuntimeException(
+            "Cannot create an index while other write transactions are active.");
+    }
+    const auto catalog = context->getCatalog();
+    catalog->alterTableEntry(transaction,
+        BoundAlterInfo{AlterType::CREATE_VECTOR_INDEX, bindData->tableName,
+            std::make_unique<BoundExtraVectorIndexInfo>(bindData->propertyName,
+                bindData->metric)});
+    const auto tableEntry = catalog->getTableCatalogEntry(transaction, bindData->tableName);
+    const auto table = context->getStorageManager()->getTable(tableEntry->getTableID());
+    Transaction buildTransaction{TransactionType::WRITE, transaction->getID(),
+        Transaction::START_TRANSACTION_ID - 1};
+    table->cast<storage::NodeTable>().buildVectorIndex(&buildTransaction,
+        tableEntry->getColumnID(bindData->propertyName), bindData->metric);
+    output.dataChunk.getValueVectorMutable(0).setValue(0,
+        stringFormat("Vector index on {}({}) created.", bindData->tableName,
+            bindData->propertyName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput* input) {
+    const auto tableName = input->inputs[0].getValue<std::string>();
+    const auto propertyName = input->inputs[1].getValue<std::string>();
+    auto metric = VectorDistanceMetric::COSINE;
+    if (input->inputs.size() > 2) {
+        const auto metricName = input->inputs[2].getValue<std::string>();
+        try {
+            metric = VectorDistanceMetricUtil::fromString(metricName);
+        } catch (RuntimeException&) {
+            throw BinderException{stringFormat(
+                "Unknown distance metric {}. Supported metrics are l2, cosine and inner_product.",
+                metricName)};
+        }
+    }
+    const auto catalog = context->getCatalog();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{"Table " + tableName + " does not exist!"};
+    }
+    const auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableName);
+    if (tableEntry->getTableType() != TableType::NODE) {
+        throw BinderException{
+            stringFormat("Cannot create an index on {}. Only node tables can be indexed.",
+                tableName)};
+    }
+    const auto nodeTableEntry = tableEntry->constPtrCast<NodeTableCatalogEntry>();
+    if (!nodeTableEntry->containsProperty(propertyName)) {
+        throw BinderException{
+            stringFormat("Table {} does not have property {}.", tableName, propertyName)};
+    }
+    if (nodeTableEntry->hasAnyIndex(propertyName)) {
+        throw BinderException{
+            stringFormat("Property {} of table {} is already indexed.", propertyName, tableName)};
+    }
+    const auto& type = nodeTableEntry->getProperty(propertyName).getType();
+    if (!storage::HNSWIndex::isSupportedType(type)) {
+        throw BinderException{stringFormat("Cannot create a vector index on property {} of type "
+                                           "{}. Only FLOAT and DOUBLE arrays can be indexed.",
+            propertyName, type.toString())};
+    }
+    std::vector<std::string> columnNames{"result"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    return std::make_unique<CreateVectorIndexBindData>(std::move(columnTypes),
+        std::move(columnNames), tableName, propertyName, metric, context);
+}
+
+function_set CreateVectorIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
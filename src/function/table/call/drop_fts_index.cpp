@@ -0,0 +1,84 @@
+#include "binder/ddl/bound_alter_info.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct DropFTSIndexBindData final : public CallTableFuncBindData {
+    std::string tableName;
+    std::string propertyName;
+    ClientContext* context;
+
+    DropFTSIndexBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, std::string tableName, std::string propertyName,
+        ClientContext* context)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), 1 /*maxOffset*/},
+          tableName{std::move(tableName)}, propertyName{std::move(propertyName)},
+          context{context} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DropFTSIndexBindData>(LogicalType::copy(columnTypes),
+            columnNames, tableName, propertyName, context);
+    }
+};
+
+static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    const auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    const auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    const auto bindData = input.bindData->constPtrCast<DropFTSIndexBindData>();
+    // Only the catalog is altered. The in-memory index is released by the next checkpoint, as
+    // transactions started before this one may still be using it.
+    bindData->context->getCatalog()->alterTableEntry(bindData->context->getTx(),
+        BoundAlterInfo{AlterType::DROP_FTS_INDEX, bindData->tableName,
+            std::make_unique<BoundExtraIndexInfo>(bindData->propertyName)});
+    output.dataChunk.getValueVectorMutable(0).setValue(0,
+        stringFormat("Full-text index on {}({}) dropped.", bindData->tableName,
+            bindData->propertyName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput* input) {
+    const auto tableName = input->inputs[0].getValue<std::string>();
+    const auto propertyName = input->inputs[1].getValue<std::string>();
+    const auto catalog = context->getCatalog();
+    if (!catalog->containsTable(context->getTx(), tableName)) {
+        throw BinderException{"Table " + tableName + " does not exist!"};
+    }
+    const auto tableEntry = catalog->getTableCatalogEntry(context->getTx(), tableName);
+    if (tableEntry->getTableType() != TableType::NODE ||
+        !tableEntry->constPtrCast<NodeTableCatalogEntry>()->hasFTSIndex(propertyName)) {
+        throw BinderException{
+            stringFormat("Property {} of table {} does not have a full-text index.", propertyName,
+                tableName)};
+    }
+    std::vector<std::string> columnNames{"result"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    return std::make_unique<DropFTSIndexBindData>(std::move(columnTypes),
+        std::move(columnNames), tableName, propertyName, context);
+}
+
+function_set DropFTSIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,55 @@
+#include "graph/graph_cache.h"
+
+#include "binder/expression/expression.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace graph {
+
+std::string GraphCache::getKey(const GraphEntry& entry) {
+    std::string key = "nodes:";
+    for (auto& nodeEntry : entry.nodeEntries) {
+        key += std::to_string(nodeEntry->getTableID()) + ",";
+    }
+    key += "rels:";
+    for (auto& relEntry : entry.relEntries) {
+        key += std::to_string(relEntry->getTableID()) + ",";
+    }
+    if (entry.hasRelPredicate()) {
+        key += "predicate:" + entry.getRelPredicate()->toString();
+    }
+    if (entry.hasRelWeightProperty()) {
+        key += "weight:" + entry.getRelWeightProperty()->toString();
+    }
+    return key;
+}
+
+std::shared_ptr<const InMemoryGraphData> GraphCache::get(const std::string& key,
+    transaction_t version) {
+    std::unique_lock lck{mtx};
+    const auto it = graphs.find(key);
+    if (it == graphs.end() || it->second.version != version) {
+        return nullptr;
+    }
+    return it->second.data;
+}
+
+void GraphCache::put(const std::string& key, transaction_t version,
+    std::shared_ptr<const InMemoryGraphData> data) {
+    std::unique_lock lck{mtx};
+    const auto it = graphs.find(key);
+    if (it != graphs.end() && it->second.version > version) {
+        // A transaction reading a newer snapshot has already cached this projection.
+        return;
+    }
+    graphs[key] = CachedGraph{version, std::move(data)};
+}
+
+void GraphCache::clear() {
+    std::unique_lock lck{mtx};
+    graphs.clear();
+}
+
+} // namespace graph
+} // namespace kuzu
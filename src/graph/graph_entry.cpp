@@ -21,9 +21,24 @@ const catalog::TableCatalogEntry* GraphEntry::getRelEntry(common::table_id_t tab
 
 void GraphEntry::setRelPredicate(std::shared_ptr<binder::Expression> predicate) {
     relPredicate = predicate;
+    populateRelProperties();
+}
+
+void GraphEntry::setRelWeightProperty(std::shared_ptr<binder::Expression> property) {
+    relWeightProperty = property;
+    populateRelProperties();
+}
+
+void GraphEntry::populateRelProperties() {
     auto collector = PropertyExprCollector();
-    collector.visit(relPredicate);
-    relProperties = ExpressionUtil::removeDuplication(collector.getPropertyExprs());
+    if (relPredicate != nullptr) {
+        collector.visit(relPredicate);
+    }
+    auto properties = collector.getPropertyExprs();
+    if (relWeightProperty != nullptr) {
+        properties.push_back(relWeightProperty);
+    }
+    relProperties = ExpressionUtil::removeDuplication(properties);
 }
 
 Schema GraphEntry::getRelPropertiesSchema() const {
@@ -0,0 +1,197 @@
+#include "graph/in_memory_graph.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "common/assert.h"
+#include "common/cast.h"
+#include "common/constants.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace graph {
+
+static void materializeCSR(Graph& graph, GraphScanState& scanState, table_id_t boundNodeTableID,
+    RelDataDirection direction, InMemoryCSR& csr) {
+    csr.boundNodeTableID = boundNodeTableID;
+    const auto numNodes = graph.getNumNodes(boundNodeTableID);
+    csr.offsets.resize(numNodes + 1);
+    for (auto offset = 0u; offset < numNodes; ++offset) {
+        csr.offsets[offset] = csr.nbrNodes.size();
+        const auto nodeID = nodeID_t{offset, boundNodeTableID};
+        auto iter = direction == RelDataDirection::FWD ? graph.scanFwd(nodeID, scanState) :
+                                                         graph.scanBwd(nodeID, scanState);
+        for (const auto chunk : iter) {
+            chunk.selVector.forEach([&](auto i) {
+                csr.nbrNodes.push_back(chunk.nbrNodes[i]);
+                csr.edges.push_back(chunk.edges[i]);
+                if (!chunk.weights.empty()) {
+                    csr.weights.push_back(chunk.weights[i]);
+                }
+            });
+        }
+    }
+    csr.offsets[numNodes] = csr.nbrNodes.size();
+    csr.nbrNodes.shrink_to_fit();
+    csr.edges.shrink_to_fit();
+    csr.weights.shrink_to_fit();
+}
+
+std::shared_ptr<const InMemoryGraphData> InMemoryGraphData::materialize(Graph& graph) {
+    auto data = std::make_shared<InMemoryGraphData>();
+    data->nodeTableIDs = graph.getNodeTableIDs();
+    for (auto tableID : data->nodeTableIDs) {
+        data->numNodes.insert({tableID, graph.getNumNodes(tableID)});
+    }
+    for (auto& info : graph.getRelTableIDInfos()) {
+        InMemoryRelTable relTable;
+        relTable.info = info;
+        auto scanState = graph.prepareScan(info.relTableID);
+        materializeCSR(graph, *scanState, info.fromNodeTableID, RelDataDirection::FWD,
+            relTable.fwdCSR);
+        // Backward adjacencies can only be scanned from nodes of the projected graph.
+        if (data->numNodes.contains(info.toNodeTableID)) {
+            materializeCSR(graph, *scanState, info.toNodeTableID, RelDataDirection::BWD,
+                relTable.bwdCSR);
+        }
+        data->relTables.push_back(std::move(relTable));
+    }
+    return data;
+}
+
+InMemoryGraphScanState::InMemoryGraphScanState(std::vector<const InMemoryRelTable*> relTables)
+    : relTables{std::move(relTables)}, direction{RelDataDirection::INVALID}, relTableIdx{0},
+      csr{nullptr}, nextPos{0}, endPos{0}, chunkStartPos{0}, chunkSize{0} {}
+
+GraphScanState::Chunk InMemoryGraphScanState::getChunk() {
+    if (chunkSize == 0) {
+        return Chunk{std::span<const nodeID_t>{}, std::span<const relID_t>{},
+            std::span<const double>{}, selVector};
+    }
+    auto weights = csr->weights.empty() ?
+                       std::span<const double>{} :
+                       std::span<const double>(csr->weights.data() + chunkStartPos, chunkSize);
+    return Chunk{std::span(csr->nbrNodes.data() + chunkStartPos, chunkSize),
+        std::span(csr->edges.data() + chunkStartPos, chunkSize), weights, selVector};
+}
+
+bool InMemoryGraphScanState::next() {
+    while (true) {
+        if (csr != nullptr && nextPos < endPos) {
+            chunkStartPos = nextPos;
+            chunkSize = std::min<uint64_t>(endPos - nextPos, DEFAULT_VECTOR_CAPACITY);
+            nextPos += chunkSize;
+            selVector.setToUnfiltered(chunkSize);
+            return true;
+        }
+        if (relTableIdx >= relTables.size()) {
+            chunkSize = 0;
+            selVector.setToUnfiltered(0);
+            return false;
+        }
+        csr = &relTables[relTableIdx++]->getCSR(direction);
+        if (csr->isEmpty() || csr->boundNodeTableID != boundNodeID.tableID) {
+            csr = nullptr;
+            continue;
+        }
+        KU_ASSERT(boundNodeID.offset + 1 < csr->offsets.size());
+        nextPos = csr->offsets[boundNodeID.offset];
+        endPos = csr->offsets[boundNodeID.offset + 1];
+    }
+}
+
+void InMemoryGraphScanState::startScan(nodeID_t nodeID, RelDataDirection direction_) {
+    boundNodeID = nodeID;
+    direction = direction_;
+    relTableIdx = 0;
+    csr = nullptr;
+    // Position the scan on the first chunk, which is empty if the node has no neighbours.
+    next();
+}
+
+std::vector<table_id_t> InMemoryGraph::getRelTableIDs() {
+    std::vector<table_id_t> result;
+    for (auto& relTable : data->relTables) {
+        if (std::find(result.begin(), result.end(), relTable.info.relTableID) == result.end()) {
+            result.push_back(relTable.info.relTableID);
+        }
+    }
+    return result;
+}
+
+std::unordered_map<table_id_t, uint64_t> InMemoryGraph::getNodeTableIDAndNumNodes() {
+    std::unordered_map<table_id_t, uint64_t> result;
+    for (auto& [tableID, numNodes] : data->numNodes) {
+        result[tableID] = numNodes;
+    }
+    return result;
+}
+
+offset_t InMemoryGraph::getNumNodes() {
+    offset_t result = 0;
+    for (auto& [_, numNodes] : data->numNodes) {
+        result += numNodes;
+    }
+    return result;
+}
+
+offset_t InMemoryGraph::getNumNodes(table_id_t id) {
+    KU_ASSERT(data->numNodes.contains(id));
+    return data->numNodes.at(id);
+}
+
+std::vector<RelTableIDInfo> InMemoryGraph::getRelTableIDInfos() {
+    std::vector<RelTableIDInfo> result;
+    for (auto& relTable : data->relTables) {
+        result.push_back(relTable.info);
+    }
+    return result;
+}
+
+std::unique_ptr<GraphScanState> InMemoryGraph::prepareScan(table_id_t relTableID) {
+    std::vector<const InMemoryRelTable*> relTables;
+    for (auto& relTable : data->relTables) {
+        if (relTable.info.relTableID == relTableID) {
+            relTables.push_back(&relTable);
+        }
+    }
+    return std::make_unique<InMemoryGraphScanState>(std::move(relTables));
+}
+
+std::unique_ptr<GraphScanState> InMemoryGraph::prepareMultiTableScan(
+    std::span<table_id_t> nodeTableIDs, RelDataDirection direction) {
+    std::unordered_set<table_id_t> boundNodeTableIDs{nodeTableIDs.begin(), nodeTableIDs.end()};
+    std::vector<const InMemoryRelTable*> relTables;
+    for (auto& relTable : data->relTables) {
+        if (boundNodeTableIDs.contains(relTable.getCSR(direction).boundNodeTableID)) {
+            relTables.push_back(&relTable);
+        }
+    }
+    return std::make_unique<InMemoryGraphScanState>(std::move(relTables));
+}
+
+std::unique_ptr<GraphScanState> InMemoryGraph::prepareMultiTableScanFwd(
+    std::span<table_id_t> nodeTableIDs) {
+    return prepareMultiTableScan(nodeTableIDs, RelDataDirection::FWD);
+}
+
+std::unique_ptr<GraphScanState> InMemoryGraph::prepareMultiTableScanBwd(
+    std::span<table_id_t> nodeTableIDs) {
+    return prepareMultiTableScan(nodeTableIDs, RelDataDirection::BWD);
+}
+
+Graph::Iterator InMemoryGraph::scanFwd(nodeID_t nodeID, GraphScanState& state) {
+    auto& inMemoryScanState = ku_dynamic_cast<InMemoryGraphScanState&>(state);
+    inMemoryScanState.startScan(nodeID, RelDataDirection::FWD);
+    return Graph::Iterator(&inMemoryScanState);
+}
+
+Graph::Iterator InMemoryGraph::scanBwd(nodeID_t nodeID, GraphScanState& state) {
+    auto& inMemoryScanState = ku_dynamic_cast<InMemoryGraphScanState&>(state);
+    inMemoryScanState.startScan(nodeID, RelDataDirection::BWD);
+    return Graph::Iterator(&inMemoryScanState);
+}
+
+} // namespace graph
+} // namespace kuzu
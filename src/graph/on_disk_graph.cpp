@@ -1,10 +1,12 @@
 #include "graph/on_disk_graph.h"
 
+#include <limits>
 #include <memory>
 
 #include "binder/expression/property_expression.h"
 #include "common/assert.h"
 #include "common/enums/rel_direction.h"
+#include "common/type_utils.h"
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "expression_evaluator/expression_evaluator.h"
@@ -75,6 +77,11 @@ OnDiskGraphScanStates::OnDiskGraphScanStates(ClientContext* context, std::span<R
         relPredicateEvaluator = mapper.getEvaluator(graphEntry.getRelPredicate());
         relPredicateEvaluator->init(resultSet, context);
     }
+    if (graphEntry.hasRelWeightProperty()) {
+        auto pos = DataPos(schema.getExpressionPos(*graphEntry.getRelWeightProperty()));
+        weightVector = resultSet.getValueVector(pos);
+        weights.resize(DEFAULT_VECTOR_CAPACITY);
+    }
     scanStates.reserve(tables.size());
     for (auto table : tables) {
         auto relEntry = graphEntry.getRelEntry(table->getTableID());
@@ -264,6 +271,9 @@ void OnDiskGraphScanState::InnerIterator::initScan() {
 bool OnDiskGraphScanStates::next() {
     while (iteratorIndex < scanStates.size()) {
         if (getInnerIterator().next(relPredicateEvaluator.get())) {
+            if (weightVector != nullptr) {
+                readWeights();
+            }
             return true;
         }
         iteratorIndex++;
@@ -271,5 +281,24 @@ bool OnDiskGraphScanStates::next() {
     return false;
 };
 
+template<typename T>
+static void readWeightsInternal(const ValueVector& vector, const SelectionVector& selVector,
+    double* weights) {
+    selVector.forEach([&](auto i) {
+        weights[i] = vector.isNull(i) ? std::numeric_limits<double>::quiet_NaN() :
+                                        static_cast<double>(vector.getValue<T>(i));
+    });
+}
+
+void OnDiskGraphScanStates::readWeights() {
+    auto& selVector = getInnerIterator().getSelVector();
+    auto data = weights.data();
+    TypeUtils::visit(
+        weightVector->dataType,
+        [&]<std::integral T>(T) { readWeightsInternal<T>(*weightVector, selVector, data); },
+        [&]<std::floating_point T>(T) { readWeightsInternal<T>(*weightVector, selVector, data); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 } // namespace graph
 } // namespace kuzu
@@ -116,6 +116,8 @@ public:
     std::unique_ptr<BoundStatement> bindDropProperty(const parser::Statement& statement);
     std::unique_ptr<BoundStatement> bindRenameProperty(const parser::Statement& statement);
     std::unique_ptr<BoundStatement> bindCommentOn(const parser::Statement& statement);
+    std::unique_ptr<BoundStatement> bindCreateIndex(const parser::Statement& statement);
+    std::unique_ptr<BoundStatement> bindDropIndex(const parser::Statement& statement);
 
     std::vector<PropertyDefinition> bindPropertyDefinitions(
         const std::vector<parser::ParsedPropertyDefinition>& parsedDefinitions,
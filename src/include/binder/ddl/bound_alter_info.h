@@ -2,7 +2,9 @@
 
 #include "binder/ddl/property_definition.h"
 #include "binder/expression/expression.h"
+#include "catalog/table_statistics.h"
 #include "common/enums/alter_type.h"
+#include "common/enums/vector_distance_metric.h"
 
 namespace kuzu {
 namespace binder {
@@ -91,6 +93,42 @@ struct BoundExtraRenamePropertyInfo : public BoundExtraAlterInfo {
     }
 };
 
+struct BoundExtraIndexInfo : public BoundExtraAlterInfo {
+    std::string propertyName;
+
+    explicit BoundExtraIndexInfo(std::string propertyName)
+        : propertyName{std::move(propertyName)} {}
+    BoundExtraIndexInfo(const BoundExtraIndexInfo& other) : propertyName{other.propertyName} {}
+    std::unique_ptr<BoundExtraAlterInfo> copy() const final {
+        return std::make_unique<BoundExtraIndexInfo>(*this);
+    }
+};
+
+struct BoundExtraVectorIndexInfo : public BoundExtraAlterInfo {
+    std::string propertyName;
+    common::VectorDistanceMetric metric;
+
+    BoundExtraVectorIndexInfo(std::string propertyName, common::VectorDistanceMetric metric)
+        : propertyName{std::move(propertyName)}, metric{metric} {}
+    BoundExtraVectorIndexInfo(const BoundExtraVectorIndexInfo& other)
+        : propertyName{other.propertyName}, metric{other.metric} {}
+    std::unique_ptr<BoundExtraAlterInfo> copy() const final {
+        return std::make_unique<BoundExtraVectorIndexInfo>(*this);
+    }
+};
+
+struct BoundExtraStatisticsInfo : public BoundExtraAlterInfo {
+    catalog::TableStatistics statistics;
+
+    explicit BoundExtraStatisticsInfo(catalog::TableStatistics statistics)
+        : statistics{std::move(statistics)} {}
+    BoundExtraStatisticsInfo(const BoundExtraStatisticsInfo& other)
+        : statistics{other.statistics.copy()} {}
+    std::unique_ptr<BoundExtraAlterInfo> copy() const final {
+        return std::make_unique<BoundExtraStatisticsInfo>(*this);
+    }
+};
+
 struct BoundExtraCommentInfo : public BoundExtraAlterInfo {
     std::string comment;
 
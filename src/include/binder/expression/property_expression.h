@@ -54,6 +54,8 @@ public:
 
     // If this property exists for given table.
     bool hasProperty(common::table_id_t tableID) const;
+    // Tables of the pattern, including the ones on which this property does not exist.
+    std::vector<common::table_id_t> getTableIDs() const;
 
     common::column_id_t getColumnID(const catalog::TableCatalogEntry& entry) const;
 
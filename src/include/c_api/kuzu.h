@@ -267,6 +267,33 @@ typedef struct {
     int64_t high;
 } kuzu_int128_t;
 
+/**
+ * @brief kuzu_buffer_pool_info is a snapshot of the counters of the buffer pool of a database.
+ * Counters are accumulated since the database was opened.
+ */
+typedef struct {
+    // Max size of the buffer pool in bytes.
+    uint64_t buffer_pool_size;
+    // Memory currently used by the buffer pool in bytes.
+    uint64_t used_memory;
+    // Reads of pages that were already cached.
+    uint64_t cache_hits;
+    // Pages read from disk into the buffer pool.
+    uint64_t cache_misses;
+    uint64_t evictions;
+    // Eviction candidates which could not be evicted, since their pages were accessed after they
+    // were picked.
+    uint64_t failed_evictions;
+    // Optimistic reads repeated since their pages changed during the read.
+    uint64_t optimistic_read_retries;
+    // Pages allocated for intermediate results, in total and currently.
+    uint64_t temp_page_allocations;
+    uint64_t temp_pages_in_use;
+    // Bytes read from and written to the files managed by the buffer pool.
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+} kuzu_buffer_pool_info;
+
 /**
  * @brief enum class for kuzu internal dataTypes.
  */
@@ -338,6 +365,15 @@ KUZU_C_API void kuzu_database_destroy(kuzu_database* database);
 
 KUZU_C_API kuzu_system_config kuzu_default_system_config();
 
+/**
+ * @brief Returns the counters of the buffer pool of the database.
+ * @param database The database instance.
+ * @param[out] out_info The output parameter that will hold the counters.
+ * @return The state indicating the success or failure of the operation.
+ */
+KUZU_C_API kuzu_state kuzu_database_get_buffer_pool_info(kuzu_database* database,
+    kuzu_buffer_pool_info* out_info);
+
 // Connection
 /**
  * @brief Allocates memory and creates a connection to the database. Caller is responsible for
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/enums/vector_distance_metric.h"
 #include "table_catalog_entry.h"
 
 namespace kuzu {
@@ -9,6 +10,14 @@ class Transaction;
 
 namespace catalog {
 
+struct VectorIndexDefinition {
+    std::string propertyName;
+    common::VectorDistanceMetric metric;
+
+    void serialize(common::Serializer& serializer) const;
+    static VectorIndexDefinition deserialize(common::Deserializer& deserializer);
+};
+
 class CatalogSet;
 class NodeTableCatalogEntry final : public TableCatalogEntry {
     static constexpr CatalogEntryType entryType_ = CatalogEntryType::NODE_TABLE_ENTRY;
@@ -28,6 +37,36 @@ public:
         return getProperty(primaryKeyName);
     }
 
+    // Secondary indexes on non-primary-key properties.
+    const std::vector<std::string>& getIndexedProperties() const { return indexedProperties; }
+    bool hasIndex(const std::string& propertyName) const;
+    void addIndex(const std::string& propertyName);
+    void dropIndex(const std::string& propertyName);
+
+    // Vector indexes on FLOAT[n] or DOUBLE[n] properties.
+    const std::vector<VectorIndexDefinition>& getVectorIndexes() const { return vectorIndexes; }
+    bool hasVectorIndex(const std::string& propertyName) const;
+    const VectorIndexDefinition& getVectorIndex(const std::string& propertyName) const;
+    void addVectorIndex(VectorIndexDefinition definition);
+    void dropVectorIndex(const std::string& propertyName);
+
+    // Full-text indexes on STRING properties.
+    const std::vector<std::string>& getFTSIndexedProperties() const {
+        return ftsIndexedProperties;
+    }
+    bool hasFTSIndex(const std::string& propertyName) const;
+    void addFTSIndex(const std::string& propertyName);
+    void dropFTSIndex(const std::string& propertyName);
+
+    // A property has at most one secondary index of any kind.
+    bool hasAnyIndex(const std::string& propertyName) const {
+        return hasIndex(propertyName) || hasVectorIndex(propertyName) ||
+               hasFTSIndex(propertyName);
+    }
+
+    void dropProperty(const std::string& propertyName) override;
+    void renameProperty(const std::string& propertyName, const std::string& newName) override;
+
     void serialize(common::Serializer& serializer) const override;
     static std::unique_ptr<NodeTableCatalogEntry> deserialize(common::Deserializer& deserializer);
 
@@ -40,6 +79,9 @@ private:
 
 private:
     std::string primaryKeyName;
+    std::vector<std::string> indexedProperties;
+    std::vector<VectorIndexDefinition> vectorIndexes;
+    std::vector<std::string> ftsIndexedProperties;
 };
 
 } // namespace catalog
@@ -6,6 +6,7 @@
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog_entry/catalog_entry.h"
 #include "catalog/property_definition_collection.h"
+#include "catalog/table_statistics.h"
 #include "common/enums/table_type.h"
 #include "function/table_functions.h"
 
@@ -38,6 +39,12 @@ public:
     std::string getComment() const { return comment; }
     void setComment(std::string newComment) { comment = std::move(newComment); }
 
+    // Null if the table has never been analyzed.
+    const TableStatistics* getStatistics() const { return statistics.get(); }
+    void setStatistics(const TableStatistics& newStatistics) {
+        statistics = std::make_unique<TableStatistics>(newStatistics.copy());
+    }
+
     virtual function::TableFunction getScanFunction() { KU_UNREACHABLE; }
 
     binder::BoundAlterInfo* getAlterInfo() const { return alterInfo.get(); }
@@ -59,8 +66,8 @@ public:
     const binder::PropertyDefinition& getProperty(common::idx_t idx) const;
     virtual common::column_id_t getColumnID(const std::string& propertyName) const;
     void addProperty(const binder::PropertyDefinition& propertyDefinition);
-    void dropProperty(const std::string& propertyName);
-    void renameProperty(const std::string& propertyName, const std::string& newName);
+    virtual void dropProperty(const std::string& propertyName);
+    virtual void renameProperty(const std::string& propertyName, const std::string& newName);
 
     void serialize(common::Serializer& serializer) const override;
     static std::unique_ptr<TableCatalogEntry> deserialize(common::Deserializer& deserializer,
@@ -79,6 +86,7 @@ protected:
     CatalogSet* set;
     std::string comment;
     PropertyDefinitionCollection propertyCollection;
+    std::unique_ptr<TableStatistics> statistics;
     std::unique_ptr<binder::BoundAlterInfo> alterInfo;
 };
 
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "common/assert.h"
+#include "common/case_insensitive_map.h"
+#include "common/copy_constructors.h"
+#include "common/enums/expression_type.h"
+#include "common/enums/rel_direction.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace catalog {
+
+// Summary of the values of a property, collected by ANALYZE.
+struct ColumnStatistics {
+    uint64_t numNonNulls = 0;
+    uint64_t numNulls = 0;
+    // Estimated with a HyperLogLog sketch.
+    uint64_t numDistinctValues = 0;
+    // Boundaries of an equi-depth histogram over the non-null values. Only properties with a
+    // numeric or temporal physical type have one. The first and the last boundaries are the
+    // minimum and the maximum values, and each of the buckets in between holds about the same
+    // number of values.
+    std::vector<double> histogramBounds;
+
+    bool hasHistogram() const { return histogramBounds.size() > 1; }
+    double getMin() const { return histogramBounds.front(); }
+    double getMax() const { return histogramBounds.back(); }
+    uint64_t getNumHistogramBuckets() const {
+        return hasHistogram() ? histogramBounds.size() - 1 : 0;
+    }
+
+    // The selectivities below are fractions of all rows, including the ones with null values.
+    double getNullFraction() const;
+    double getEqualitySelectivity() const;
+    // Selectivity of `property <comparison> value` for a range comparison.
+    double getRangeSelectivity(common::ExpressionType comparison, double value) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static ColumnStatistics deserialize(common::Deserializer& deserializer);
+
+private:
+    // Fraction of the non-null values that are smaller than `value`.
+    double getFractionBelow(double value) const;
+};
+
+// Distribution of the number of rels per bound node in one direction of a rel table.
+struct DegreeStatistics {
+    uint64_t numRels = 0;
+    // Number of bound nodes with at least one rel.
+    uint64_t numNodesWithRels = 0;
+    uint64_t maxDegree = 0;
+    // Sum of the squared degrees of all bound nodes.
+    double sumSquaredDegrees = 0;
+
+    // Expected number of rels of a node reached by following a rel, i.e. E[d^2] / E[d] over the
+    // bound nodes. On skewed graphs, high degree nodes are reached much more often than others,
+    // so this is much larger than the average degree.
+    double getExcessDegree() const;
+
+    void serialize(common::Serializer& serializer) const;
+    static DegreeStatistics deserialize(common::Deserializer& deserializer);
+};
+
+// Statistics of a node or rel table, collected by ANALYZE and kept in its catalog entry. They are
+// a snapshot: the cardinality estimator scales them by the current number of rows.
+class TableStatistics {
+public:
+    TableStatistics() : numRows{0} {}
+    explicit TableStatistics(uint64_t numRows) : numRows{numRows} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(TableStatistics);
+
+    uint64_t getNumRows() const { return numRows; }
+
+    bool hasColumnStatistics(const std::string& propertyName) const {
+        return columnStatistics.contains(propertyName);
+    }
+    const ColumnStatistics& getColumnStatistics(const std::string& propertyName) const {
+        KU_ASSERT(hasColumnStatistics(propertyName));
+        return columnStatistics.at(propertyName);
+    }
+    void setColumnStatistics(const std::string& propertyName, ColumnStatistics statistics) {
+        columnStatistics[propertyName] = std::move(statistics);
+    }
+    void renameProperty(const std::string& propertyName, const std::string& newName);
+    void dropProperty(const std::string& propertyName);
+
+    // Only set for rel tables.
+    const DegreeStatistics& getDegreeStatistics(common::RelDataDirection direction) const {
+        return direction == common::RelDataDirection::FWD ? fwdDegrees : bwdDegrees;
+    }
+    void setDegreeStatistics(common::RelDataDirection direction, DegreeStatistics statistics) {
+        (direction == common::RelDataDirection::FWD ? fwdDegrees : bwdDegrees) = statistics;
+    }
+
+    void serialize(common::Serializer& serializer) const;
+    static TableStatistics deserialize(common::Deserializer& deserializer);
+
+private:
+    TableStatistics(const TableStatistics& other)
+        : numRows{other.numRows}, columnStatistics{other.columnStatistics},
+          fwdDegrees{other.fwdDegrees}, bwdDegrees{other.bwdDegrees} {}
+
+private:
+    uint64_t numRows;
+    common::case_insensitive_map_t<ColumnStatistics> columnStatistics;
+    DegreeStatistics fwdDegrees;
+    DegreeStatistics bwdDegrees;
+};
+
+} // namespace catalog
+} // namespace kuzu
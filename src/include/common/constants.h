@@ -30,6 +30,12 @@ constexpr double DEFAULT_HT_LOAD_FACTOR = 1.5;
 constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS = 5000000;
+// How long the background checkpointer waits before checking again whether all transactions have
+// left the system.
+constexpr uint64_t BACKGROUND_CHECKPOINT_RETRY_INTERVAL_IN_MICROS = 10000;
+// How long a requested checkpoint waits for the system to become idle. After that, the background
+// checkpointer stops new transactions from starting and waits for the active ones to leave.
+constexpr uint64_t BACKGROUND_CHECKPOINT_MAX_DELAY_IN_MICROS = 1000000;
 
 // Note that some places use std::bit_ceil to calculate resizes,
 // which won't work for values other than 2. If this is changed, those will need to be updated
@@ -201,6 +207,9 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Scan a node table through a secondary index only if the predicates on the indexed property
+    // are estimated to select at most this fraction of the table.
+    static constexpr double PROPERTY_INDEX_SCAN_SELECTIVITY = 0.1;
 };
 
 struct OrderByConstants {
@@ -11,6 +11,16 @@ enum class AlterType : uint8_t {
     ADD_PROPERTY = 10,
     DROP_PROPERTY = 11,
     RENAME_PROPERTY = 12,
+
+    CREATE_INDEX = 20,
+    DROP_INDEX = 21,
+    CREATE_VECTOR_INDEX = 22,
+    DROP_VECTOR_INDEX = 23,
+    CREATE_FTS_INDEX = 24,
+    DROP_FTS_INDEX = 25,
+
+    UPDATE_STATISTICS = 30,
+
     COMMENT = 201,
     INVALID = 255
 };
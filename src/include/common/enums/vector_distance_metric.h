@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace common {
+
+enum class VectorDistanceMetric : uint8_t { L2 = 0, COSINE = 1, INNER_PRODUCT = 2 };
+
+struct VectorDistanceMetricUtil {
+    static VectorDistanceMetric fromString(const std::string& str);
+    static std::string toString(VectorDistanceMetric metric);
+};
+
+} // namespace common
+} // namespace kuzu
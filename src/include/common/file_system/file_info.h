@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 
 #include "common/api.h"
@@ -11,6 +12,18 @@ namespace common {
 
 class FileSystem;
 
+struct FileReadRequest {
+    void* buffer;
+    uint64_t numBytes;
+    uint64_t position;
+};
+
+struct FileWriteRequest {
+    const uint8_t* buffer;
+    uint64_t numBytes;
+    uint64_t offset;
+};
+
 struct KUZU_API FileInfo {
     FileInfo(std::string path, FileSystem* fileSystem)
         : path{std::move(path)}, fileSystem{fileSystem} {}
@@ -25,6 +38,12 @@ struct KUZU_API FileInfo {
 
     void writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset);
 
+    // Batched variants of readFromFile and writeFile. The file system may submit the requests
+    // together and complete them in any order, so requests of a batch must not overlap.
+    void readFromFileBatch(std::span<const FileReadRequest> requests);
+
+    void writeFileBatch(std::span<const FileWriteRequest> requests);
+
     void syncFile() const;
 
     int64_t seek(uint64_t offset, int whence);
@@ -87,6 +87,13 @@ protected:
     virtual void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const;
 
+    // By default, the requests of a batch are issued one by one.
+    virtual void readFromFileBatch(FileInfo& fileInfo,
+        std::span<const FileReadRequest> requests) const;
+
+    virtual void writeFileBatch(FileInfo& fileInfo,
+        std::span<const FileWriteRequest> requests) const;
+
     virtual int64_t seek(FileInfo& fileInfo, uint64_t offset, int whence) const = 0;
 
     virtual void truncate(FileInfo& fileInfo, uint64_t size) const;
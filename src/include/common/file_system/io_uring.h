@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace kuzu {
+namespace common {
+
+struct IOUringRequest {
+    bool isWrite;
+    int fd;
+    void* buffer;
+    uint64_t numBytes;
+    uint64_t offset;
+    // Number of bytes read or written, or the negated errno if the request failed.
+    int64_t result = 0;
+};
+
+// Batched positioned reads and writes through Linux io_uring. Each thread lazily sets up its own
+// ring, so batches from different threads never contend on a submission queue.
+struct IOUring {
+    // io_uring is unavailable on other platforms, and on Linux if the kernel does not support it or
+    // it has been disabled (e.g., by seccomp in containers). Once setting up a ring failed, no
+    // further attempts are made.
+    static bool isAvailable();
+    // Makes batched I/O fall back to synchronous requests, so that tests can cover both paths.
+    static void setDisabled(bool disabled);
+
+    // Submits all requests and waits for all of them to complete. Requests that fail or complete
+    // partially are not retried, and callers are expected to check their results.
+    static void submitAndWait(std::span<IOUringRequest> requests);
+};
+
+} // namespace common
+} // namespace kuzu
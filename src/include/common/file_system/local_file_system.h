@@ -59,6 +59,14 @@ protected:
     void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const override;
 
+    // On Linux, batches are submitted through io_uring if the kernel supports it. Otherwise,
+    // they fall back to synchronous reads and writes.
+    void readFromFileBatch(FileInfo& fileInfo,
+        std::span<const FileReadRequest> requests) const override;
+
+    void writeFileBatch(FileInfo& fileInfo,
+        std::span<const FileWriteRequest> requests) const override;
+
     int64_t seek(FileInfo& fileInfo, uint64_t offset, int whence) const override;
 
     void truncate(FileInfo& fileInfo, uint64_t size) const override;
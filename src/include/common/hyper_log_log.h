@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+
+// HyperLogLog sketch (Flajolet et al.) estimating the number of distinct values from their
+// 64-bit hashes. With 2^PRECISION registers, the standard error of the estimate is about 1.6%.
+class HyperLogLog {
+public:
+    static constexpr uint8_t PRECISION = 12;
+    static constexpr uint64_t NUM_REGISTERS = (uint64_t)1 << PRECISION;
+
+    HyperLogLog() { registers.fill(0); }
+
+    void insert(hash_t hash);
+    // Afterwards, the sketch estimates the number of distinct values inserted into either sketch.
+    void merge(const HyperLogLog& other);
+    uint64_t estimate() const;
+
+private:
+    std::array<uint8_t, NUM_REGISTERS> registers;
+};
+
+} // namespace common
+} // namespace kuzu
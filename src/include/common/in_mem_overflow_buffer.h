@@ -50,6 +50,8 @@ public:
     // they will error.
     void resetBuffer();
 
+    uint64_t getMemoryUsage() const;
+
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
         return currentBlock == nullptr ||
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
@@ -55,6 +56,11 @@ public:
     bool isMasked(common::offset_t offset) const { return maskData->isMasked(offset, numMasks); }
     // Return true if any offset between [startOffset, endOffset] is masked. Otherwise return false.
     bool isAnyMasked(common::offset_t startOffset, common::offset_t endOffset) const {
+        // Offsets appended after the mask is created are not visible to its query.
+        if (startOffset >= maskData->getSize()) [[unlikely]] {
+            return false;
+        }
+        endOffset = std::min(endOffset, maskData->getSize() - 1);
         auto offset = startOffset;
         auto numMasked = 0u;
         while (offset <= endOffset) {
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstring>
+
+#include "common/assert.h"
+#include "common/serializer/reader.h"
+
+namespace kuzu {
+namespace common {
+
+// Reads from an in-memory buffer. The buffer is owned by the caller and must outlive the reader.
+class BufferReader final : public Reader {
+public:
+    BufferReader(const uint8_t* data, uint64_t dataSize)
+        : data{data}, dataSize{dataSize}, readSize{0} {}
+
+    void read(uint8_t* outputData, uint64_t size) override {
+        KU_ASSERT(readSize + size <= dataSize);
+        memcpy(outputData, data + readSize, size);
+        readSize += size;
+    }
+
+    bool finished() override { return readSize >= dataSize; }
+
+private:
+    const uint8_t* data;
+    uint64_t dataSize;
+    uint64_t readSize;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -49,7 +49,16 @@ public:
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
+    // Same as scheduleTaskAndWaitOrError, except that the given task itself (not its dependencies)
+    // is executed by numThreads dedicated threads instead of the worker threads. This is used when
+    // the task may block for an unbounded time, e.g., streaming results to a slow client, so that
+    // it cannot starve other queries of worker threads.
+    void runTaskOnDedicatedThreadsAndWaitOrError(const std::shared_ptr<Task>& task,
+        processor::ExecutionContext* context, uint64_t numThreads);
+
 private:
+    void waitForTaskCompletion(Task* task, processor::ExecutionContext* context);
+
     std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
 
     void removeErroringTask(uint64_t scheduledTaskID);
@@ -98,6 +98,10 @@ protected:
 protected:
     std::shared_ptr<binder::Expression> bindNodeOutput(binder::Binder* binder,
         const graph::GraphEntry& graphEntry);
+    // Binds a numeric property that all relationship tables of the graph have, to be used as
+    // edge weights (see GraphEntry::setRelWeightProperty).
+    std::shared_ptr<binder::Expression> bindRelWeightProperty(const std::string& propertyName,
+        binder::Binder* binder, const graph::GraphEntry& graphEntry);
 
 protected:
     std::unique_ptr<GDSBindData> bindData;
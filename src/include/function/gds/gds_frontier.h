@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <bit>
 #include <mutex>
 
 #include "common/data_chunk/sel_vector.h"
@@ -28,6 +29,11 @@ public:
         std::span<const common::nodeID_t> nbrNodeID, std::span<const common::relID_t> edgeID,
         common::SelectionVector& mask, bool fwdEdge) = 0;
 
+    // Whether edgeCompute should be called on every edge between a node and the current frontier
+    // when the frontier is pulled into the node. Otherwise the node is skipped after its first
+    // edge that sets it active, which suffices for algorithms that record a single parent.
+    virtual bool requiresAllFrontierNbrs() const { return false; }
+
     virtual std::unique_ptr<EdgeCompute> copy() = 0;
 };
 
@@ -57,15 +63,102 @@ public:
     virtual std::unique_ptr<VertexCompute> copy() = 0;
 };
 
+/**
+ * The set of active node offsets of a single node table in a frontier, which lets the frontier be
+ * dispatched without scanning the offsets of inactive nodes. Active offsets are marked in a dense
+ * bitmap and also appended to a sparse list of offsets as long as the list takes no more memory
+ * than the bitmap. Small frontiers are therefore dispatched from the sparse list, and large ones
+ * from the bitmap, skipping words without active offsets.
+ *
+ * setActive() is thread-safe. The other functions should only be called by the master GDS thread,
+ * or by worker threads while no offsets are set active.
+ */
+class ActiveOffsets {
+public:
+    static constexpr uint64_t NUM_OFFSETS_PER_WORD = 64;
+    // Tables with few nodes keep a sparse list of at least this many offsets.
+    static constexpr uint64_t MIN_SPARSE_CAPACITY = 64;
+
+    ActiveOffsets(common::offset_t numOffsets, storage::MemoryManager* mm);
+
+    void setActive(common::offset_t offset) {
+        auto& word = words[offset / NUM_OFFSETS_PER_WORD];
+        auto bit = static_cast<uint64_t>(1) << (offset % NUM_OFFSETS_PER_WORD);
+        // Only the thread that sets the bit appends the offset to the sparse list.
+        if ((word.load(std::memory_order_relaxed) & bit) ||
+            (word.fetch_or(bit, std::memory_order_relaxed) & bit)) {
+            return;
+        }
+        auto idx = numActiveOffsets.fetch_add(1, std::memory_order_relaxed);
+        if (idx < sparseCapacity) {
+            sparseOffsets[idx] = offset;
+        }
+    }
+
+    bool isSparse() const {
+        return numActiveOffsets.load(std::memory_order_relaxed) <= sparseCapacity;
+    }
+
+    std::span<const common::offset_t> getSparseOffsets() const {
+        KU_ASSERT(isSparse());
+        return std::span(sparseOffsets, numActiveOffsets.load(std::memory_order_relaxed));
+    }
+
+    const std::atomic<uint64_t>* getWords() const { return words; }
+
+    common::offset_t getNumOffsets() const { return numOffsets; }
+
+    void clear();
+
+private:
+    common::offset_t numOffsets;
+    uint64_t numWords;
+    uint64_t sparseCapacity;
+    std::unique_ptr<storage::MemoryBuffer> wordsBuffer;
+    std::unique_ptr<storage::MemoryBuffer> sparseOffsetsBuffer;
+    std::atomic<uint64_t>* words;
+    common::offset_t* sparseOffsets;
+    std::atomic<uint64_t> numActiveOffsets;
+};
+
+/**
+ * A morsel of node offsets of a single node table. Depending on how it was dispatched, a morsel
+ * visits a range of offsets, a range of the sparse list of an ActiveOffsets, or the set bits in a
+ * range of the bitmap of an ActiveOffsets.
+ */
 class FrontierMorsel {
     friend class FrontierMorselDispatcher;
 
 public:
     FrontierMorsel() {}
 
-    bool hasNextOffset() const { return nextOffset < endOffsetExclusive; }
+    bool hasNextOffset() {
+        if (activeOffsetWords == nullptr) {
+            return nextOffset < endOffsetExclusive;
+        }
+        // nextOffset is the first offset of the bitmap word whose unvisited bits are in curWord.
+        while (curWord == 0) {
+            nextOffset += ActiveOffsets::NUM_OFFSETS_PER_WORD;
+            if (nextOffset >= endOffsetExclusive) {
+                return false;
+            }
+            curWord = activeOffsetWords[nextOffset / ActiveOffsets::NUM_OFFSETS_PER_WORD].load(
+                std::memory_order_relaxed);
+        }
+        return true;
+    }
 
-    common::nodeID_t getNextNodeID() { return {nextOffset++, tableID}; }
+    common::nodeID_t getNextNodeID() {
+        if (activeOffsetWords != nullptr) {
+            auto offset = nextOffset + std::countr_zero(curWord);
+            curWord &= curWord - 1;
+            return {offset, tableID};
+        }
+        if (sparseOffsets != nullptr) {
+            return {sparseOffsets[nextOffset++], tableID};
+        }
+        return {nextOffset++, tableID};
+    }
 
 protected:
     void initMorsel(common::table_id_t _tableID, common::offset_t _beginOffset,
@@ -74,6 +167,27 @@ protected:
         beginOffset = _beginOffset;
         endOffsetExclusive = _endOffsetExclusive;
         nextOffset = beginOffset;
+        sparseOffsets = nullptr;
+        activeOffsetWords = nullptr;
+    }
+
+    // Visits sparseOffsets[beginIdx, endIdxExclusive).
+    void initSparseMorsel(common::table_id_t _tableID, const common::offset_t* _sparseOffsets,
+        uint64_t beginIdx, uint64_t endIdxExclusive) {
+        initMorsel(_tableID, beginIdx, endIdxExclusive);
+        sparseOffsets = _sparseOffsets;
+    }
+
+    // Visits the set bits of the offsets in [_beginOffset, _endOffsetExclusive). _beginOffset
+    // should be the first offset of a bitmap word.
+    void initDenseMorsel(common::table_id_t _tableID, const std::atomic<uint64_t>* words,
+        common::offset_t _beginOffset, common::offset_t _endOffsetExclusive) {
+        KU_ASSERT(_beginOffset % ActiveOffsets::NUM_OFFSETS_PER_WORD == 0 &&
+                  _beginOffset < _endOffsetExclusive);
+        initMorsel(_tableID, _beginOffset, _endOffsetExclusive);
+        activeOffsetWords = words;
+        curWord = words[_beginOffset / ActiveOffsets::NUM_OFFSETS_PER_WORD].load(
+            std::memory_order_relaxed);
     }
 
 private:
@@ -81,6 +195,10 @@ private:
     common::offset_t beginOffset = common::INVALID_OFFSET;
     common::offset_t endOffsetExclusive = common::INVALID_OFFSET;
     common::offset_t nextOffset = common::INVALID_OFFSET;
+    const common::offset_t* sparseOffsets = nullptr;
+    const std::atomic<uint64_t>* activeOffsetWords = nullptr;
+    // Bits of the current bitmap word that have not been visited yet.
+    uint64_t curWord = 0;
 };
 
 class FrontierMorselDispatcher {
@@ -93,16 +211,27 @@ class FrontierMorselDispatcher {
 public:
     explicit FrontierMorselDispatcher(uint64_t _maxThreadsForExec);
 
+    // Dispatches all offsets in [0, _numOffsets).
     void init(common::table_id_t _tableID, common::offset_t _numOffsets);
+    // Dispatches only the offsets that are active in _activeOffsets, which should not change until
+    // the dispatcher is initialized again.
+    void init(common::table_id_t _tableID, const ActiveOffsets& _activeOffsets);
 
     bool getNextRangeMorsel(FrontierMorsel& frontierMorsel);
 
+private:
+    void initMorselSize();
+
 private:
     std::atomic<uint64_t> maxThreadsForExec;
     std::atomic<common::table_id_t> tableID;
     std::atomic<common::offset_t> numOffsets;
     std::atomic<common::offset_t> nextOffset;
     uint64_t morselSize;
+    // Null if all offsets are dispatched. Otherwise, the offsets above are indices into the sparse
+    // list of activeOffsets if activeOffsetsSparse is true, and node offsets otherwise.
+    const ActiveOffsets* activeOffsets;
+    bool activeOffsetsSparse;
 };
 
 /**
@@ -144,6 +273,10 @@ public:
  * frontierPair.
  *
  * However, this is not necessary and the caller can also use this to represent a single frontier.
+ *
+ * Nodes that are set active are also added to the next ActiveOffsets of their table, which become
+ * the current ActiveOffsets when the iteration is incremented. These let frontier pairs dispatch
+ * only the nodes in the current frontier.
  */
 class PathLengths : public GDSFrontier {
     friend class SinglePathLengthsFrontierPair;
@@ -170,18 +303,23 @@ public:
     void setActive(const common::SelectionVector& mask,
         std::span<const common::nodeID_t> nodeIDs) override {
         auto frontierMask = getNextFrontierFixedMask();
+        auto activeOffsets = getNextFrontierFixedActiveOffsets();
         mask.forEach([&](auto i) {
             frontierMask[nodeIDs[i].offset].store(curIter.load(std::memory_order_relaxed),
                 std::memory_order_relaxed);
+            activeOffsets->setActive(nodeIDs[i].offset);
         });
     }
 
     void setActive(common::nodeID_t nodeID) override {
         getNextFrontierFixedMask()[nodeID.offset].store(curIter.load(std::memory_order_relaxed),
             std::memory_order_relaxed);
+        getNextFrontierFixedActiveOffsets()->setActive(nodeID.offset);
     }
 
-    void incrementCurIter() { curIter.fetch_add(1, std::memory_order_relaxed); }
+    // Also makes the nodes that have been set active the current ActiveOffsets and clears the next
+    // ActiveOffsets. Tables need to be fixed again after calling this function.
+    void incrementCurIter();
 
     void fixCurFrontierNodeTable(common::table_id_t tableID);
 
@@ -194,6 +332,14 @@ public:
 
     uint16_t getCurIter() { return curIter.load(std::memory_order_relaxed); }
 
+    uint64_t getTotalNumNodes() const { return totalNumNodes; }
+
+    const ActiveOffsets& getCurFrontierFixedActiveOffsets() {
+        auto retVal = curFrontierFixedActiveOffsets.load(std::memory_order_relaxed);
+        KU_ASSERT(retVal != nullptr);
+        return *retVal;
+    }
+
 private:
     std::atomic<uint16_t>* getCurFrontierFixedMask() {
         auto retVal = curFrontierFixedMask.load(std::memory_order_relaxed);
@@ -207,12 +353,21 @@ private:
         return retVal;
     }
 
+    ActiveOffsets* getNextFrontierFixedActiveOffsets() {
+        auto retVal = nextFrontierFixedActiveOffsets.load(std::memory_order_relaxed);
+        KU_ASSERT(retVal != nullptr);
+        return retVal;
+    }
+
 private:
     // We do not need to make nodeTableIDAndNumNodesMap and masks atomic because they should only
     // be accessed by functions that are called by the "master GDS thread" (so not accessed inside
     // the parallel functions in GDSUtils, which are called by other "worker threads").
     std::unordered_map<common::table_id_t, uint64_t> nodeTableIDAndNumNodesMap;
     common::table_id_map_t<std::unique_ptr<storage::MemoryBuffer>> masks;
+    common::table_id_map_t<std::unique_ptr<ActiveOffsets>> curActiveOffsets;
+    common::table_id_map_t<std::unique_ptr<ActiveOffsets>> nextActiveOffsets;
+    uint64_t totalNumNodes;
     // See FrontierPair::curIter. We keep a copy of curIter here because PathLengths stores
     // iteration numbers for vertices and uses them to identify which vertex is in the frontier.
     std::atomic<uint16_t> curIter;
@@ -220,6 +375,8 @@ private:
     std::atomic<uint64_t> maxNodesInCurFrontierFixedMask;
     std::atomic<std::atomic<uint16_t>*> curFrontierFixedMask;
     std::atomic<std::atomic<uint16_t>*> nextFrontierFixedMask;
+    std::atomic<ActiveOffsets*> curFrontierFixedActiveOffsets;
+    std::atomic<ActiveOffsets*> nextFrontierFixedActiveOffsets;
 };
 
 /**
@@ -228,10 +385,18 @@ private:
  * active nodes that have been set for the next iteration. This information can be used
  * to determine if the algorithm has converged or not.
  *
+ * An iteration either pushes the current frontier to its neighbors, or, if isPullIteration() is
+ * true, lets each node that can still be reached pull from its neighbors in the current frontier.
+ * Pulling is cheaper once the frontier covers a large share of the graph because a node stops
+ * scanning its edges as soon as it finds a frontier neighbor (see Beamer et al.,
+ * "Direction-Optimizing Breadth-First Search"). Implementing classes decide the direction in
+ * beginNewIterationInternalNoLock().
+ *
  * All functions supported in this base interface are thread-safe.
  */
 class FrontierPair {
     friend class FrontierTask;
+    friend class FrontierPullTask;
 
 public:
     FrontierPair(std::shared_ptr<GDSFrontier> curFrontier,
@@ -259,6 +424,12 @@ public:
 
     bool hasActiveNodesForNextLevel() { return numApproxActiveNodesForNextIter.load() > 0; }
 
+    bool isPullIteration() const { return pullIteration; }
+
+    // Whether nodeID of the next frontier's fixed node table can still be set active in the
+    // current iteration. Only called in pull iterations.
+    virtual bool isReachableInCurIter(common::nodeID_t) { KU_UNREACHABLE; }
+
     // Note: If the implementing class stores 2 frontierPair, this function should swap them.
     virtual void beginNewIterationInternalNoLock() {}
 
@@ -277,9 +448,20 @@ protected:
     std::shared_ptr<GDSFrontier> curFrontier;
     std::shared_ptr<GDSFrontier> nextFrontier;
     uint64_t maxThreadsForExec;
+    // Only written by beginNewIterationInternalNoLock(), so it is constant during an iteration.
+    bool pullIteration = false;
 };
 
 class SinglePathLengthsFrontierPair : public FrontierPair {
+    // Pull when the frontier has more than 1/PUSH_TO_PULL_FACTOR as many nodes as the unvisited
+    // part of the graph, and go back to pushing when the frontier has shrunk below
+    // 1/PULL_TO_PUSH_FACTOR of the graph. These are the node count heuristics of Beamer et al.
+    static constexpr uint64_t PUSH_TO_PULL_FACTOR = 14;
+    static constexpr uint64_t PULL_TO_PUSH_FACTOR = 24;
+    // Pulling scans every unvisited node of a table, which only pays off on graphs of at least a
+    // few frontier morsels.
+    static constexpr uint64_t MIN_NUM_NODES_TO_PULL = 2048;
+
     friend class AllSPLengthsEdgeCompute;
     friend class AllSPPathsEdgeCompute;
     friend class SingleSPLengthsEdgeCompute;
@@ -290,7 +472,8 @@ public:
         uint64_t maxThreadsForExec)
         : FrontierPair(pathLengths /* curFrontier */, pathLengths /* nextFrontier */,
               1 /* initial num active nodes */, maxThreadsForExec),
-          pathLengths{pathLengths}, morselDispatcher(maxThreadsForExec) {}
+          pathLengths{pathLengths}, morselDispatcher(maxThreadsForExec),
+          numApproxVisitedNodes{0} {}
 
     bool getNextRangeMorsel(FrontierMorsel& frontierMorsel) override;
 
@@ -299,11 +482,21 @@ public:
     void beginFrontierComputeBetweenTables(common::table_id_t curFrontierTableID,
         common::table_id_t nextFrontierTableID) override;
 
-    void beginNewIterationInternalNoLock() override { pathLengths->incrementCurIter(); }
+    // Nodes set active in the current iteration stay reachable so that algorithms that require
+    // all frontier neighbors can see the edges of other relationship tables.
+    bool isReachableInCurIter(common::nodeID_t nodeID) override {
+        auto val = pathLengths->getMaskValueFromNextFrontierFixedMask(nodeID.offset);
+        return val == PathLengths::UNVISITED || val == pathLengths->getCurIter();
+    }
+
+    void beginNewIterationInternalNoLock() override;
 
 private:
     std::shared_ptr<PathLengths> pathLengths;
     FrontierMorselDispatcher morselDispatcher;
+    // Number of nodes visited before the current iteration, including the current frontier.
+    // Approximate for the same reasons as numApproxActiveNodesForNextIter.
+    uint64_t numApproxVisitedNodes;
 };
 
 class DoublePathLengthsFrontierPair : public FrontierPair {
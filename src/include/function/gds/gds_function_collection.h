@@ -11,6 +11,18 @@ struct WeaklyConnectedComponentsFunction {
     static function_set getFunctionSet();
 };
 
+struct StronglyConnectedComponentsFunction {
+    static constexpr const char* name = "STRONGLY_CONNECTED_COMPONENT";
+
+    static function_set getFunctionSet();
+};
+
+struct KCoreDecompositionFunction {
+    static constexpr const char* name = "K_CORE_DECOMPOSITION";
+
+    static function_set getFunctionSet();
+};
+
 struct VarLenJoinsFunction {
     static constexpr const char* name = "VAR_LEN_JOINS";
 
@@ -53,11 +65,59 @@ struct SingleSPPathsFunction {
     static function_set getFunctionSet();
 };
 
+struct WeightedSPDestinationsFunction {
+    static constexpr const char* name = "WEIGHTED_SP_DESTINATIONS";
+
+    static function_set getFunctionSet();
+};
+
+struct WeightedSPLengthsFunction {
+    static constexpr const char* name = "WEIGHTED_SP_LENGTHS";
+
+    static function_set getFunctionSet();
+};
+
+struct WeightedSPPathsFunction {
+    static constexpr const char* name = "WEIGHTED_SP_PATHS";
+
+    static function_set getFunctionSet();
+};
+
 struct PageRankFunction {
     static constexpr const char* name = "PAGE_RANK";
 
     static function_set getFunctionSet();
 };
 
+struct TriangleCountFunction {
+    static constexpr const char* name = "TRIANGLE_COUNT";
+
+    static function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientFunction {
+    static constexpr const char* name = "LOCAL_CLUSTERING_COEFFICIENT";
+
+    static function_set getFunctionSet();
+};
+
+struct LouvainFunction {
+    static constexpr const char* name = "LOUVAIN";
+
+    static function_set getFunctionSet();
+};
+
+struct QueryVectorIndexFunction {
+    static constexpr const char* name = "QUERY_VECTOR_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct QueryFTSIndexFunction {
+    static constexpr const char* name = "QUERY_FTS_INDEX";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
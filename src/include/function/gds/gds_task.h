@@ -42,6 +42,28 @@ private:
     std::shared_ptr<FrontierTaskSharedState> sharedState;
 };
 
+// Runs a pull iteration of a FrontierPair on a relationship table whose source and destination
+// node tables are the same: each node that is reachable in the current iteration scans its edges
+// in the opposite of the extend direction and calls edgeCompute on those leading to the current
+// frontier, as if the frontier had pushed along them.
+class FrontierPullTask : public common::Task {
+public:
+    FrontierPullTask(uint64_t maxNumThreads, const FrontierTaskInfo& info,
+        std::shared_ptr<FrontierTaskSharedState> sharedState)
+        : common::Task{maxNumThreads}, info{info}, sharedState{std::move(sharedState)} {}
+
+    void run() override;
+
+private:
+    // Returns true if nodeID has been set active for the next iteration.
+    bool pullFromFrontier(common::nodeID_t nodeID, graph::Graph::Iterator iterator,
+        EdgeCompute& ec, common::SelectionVector& mask, bool isFwd);
+
+private:
+    FrontierTaskInfo info;
+    std::shared_ptr<FrontierTaskSharedState> sharedState;
+};
+
 class VertexComputeTaskSharedState {
 public:
     VertexComputeTaskSharedState(graph::Graph* graph, VertexCompute& vc,
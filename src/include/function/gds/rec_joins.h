@@ -105,6 +105,8 @@ protected:
     void validateLowerUpperBound(int64_t lowerBound, int64_t upperBound);
 
     binder::expression_vector getBaseResultColumns(binder::Binder* binder) const;
+    // Base result columns followed by the direction column if paths can extend in both directions.
+    binder::expression_vector getPathsBaseResultColumns(binder::Binder* binder) const;
     std::shared_ptr<binder::Expression> getLengthColumn(binder::Binder* binder) const;
     std::shared_ptr<binder::Expression> getPathNodeIDsColumn(binder::Binder* binder) const;
     std::shared_ptr<binder::Expression> getPathEdgeIDsColumn(binder::Binder* binder) const;
@@ -105,6 +105,19 @@ struct StorageInfoFunction final : CallFunction {
     static function_set getFunctionSet();
 };
 
+// Counters of the buffer manager, and the pages and I/O of each file it manages.
+struct BufferPoolInfoFunction final : CallFunction {
+    static constexpr const char* name = "BUFFER_POOL_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct BufferPoolFileInfoFunction final : CallFunction {
+    static constexpr const char* name = "BUFFER_POOL_FILE_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct ShowAttachedDatabasesFunction final : CallFunction {
     static constexpr const char* name = "SHOW_ATTACHED_DATABASES";
 
@@ -117,5 +130,38 @@ struct ShowFunctionsFunction : public CallFunction {
     static function_set getFunctionSet();
 };
 
+// Vector index DDL, with the distance metric as an optional third argument of CREATE_VECTOR_INDEX.
+struct CreateVectorIndexFunction final : CallFunction {
+    static constexpr const char* name = "CREATE_VECTOR_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropVectorIndexFunction final : CallFunction {
+    static constexpr const char* name = "DROP_VECTOR_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct CreateFTSIndexFunction final : CallFunction {
+    static constexpr const char* name = "CREATE_FTS_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropFTSIndexFunction final : CallFunction {
+    static constexpr const char* name = "DROP_FTS_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+// Collects the statistics used by the cardinality estimator and stores them in the catalog entry
+// of the given table, or of all node and rel tables if none is given.
+struct AnalyzeFunction final : CallFunction {
+    static constexpr const char* name = "ANALYZE";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -23,6 +23,9 @@ public:
     struct Chunk {
         std::span<const common::nodeID_t> nbrNodes;
         std::span<const common::relID_t> edges;
+        // Weights of the edges if the graph has a weight property (see GraphEntry), empty
+        // otherwise. Null weights are NaN.
+        std::span<const double> weights;
         // this reference can be modified, but the underlying data will be reset the next time next
         // is called
         common::SelectionVector& selVector;
@@ -126,9 +129,8 @@ public:
     // Get dst nodeIDs for given src nodeID using forward adjList.
     virtual Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
 
-    // We don't use scanBwd currently. I'm adding them because they are the mirroring to scanFwd.
-    // Also, algorithm may only need adjList index in single direction so we should make double
-    // indexing optional.
+    // scanBwd is used by pull iterations of direction-optimizing BFS (see FrontierPair). Algorithms
+    // may only need adjList index in single direction so we should make double indexing optional.
 
     // Prepares scan on all connected relationship tables using backward adjList.
     virtual std::unique_ptr<GraphScanState> prepareMultiTableScanBwd(
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "graph_entry.h"
+#include "in_memory_graph.h"
+
+namespace kuzu {
+namespace graph {
+
+// Caches in-memory copies of projected graphs across queries. A copy reflects the snapshot of the
+// transaction that materialized it and is versioned by that transaction's start timestamp. Since
+// every committed write transaction advances the timestamp, a copy is only returned to
+// transactions with the same start timestamp, and is replaced once a transaction reading a newer
+// snapshot caches the same projection. Copies of other projections are left alone, since
+// transactions still reading their snapshot may use them.
+class GraphCache {
+public:
+    // Identifies a projection by its tables, relationship predicate and weight property, so that
+    // projections with different names but the same content share a cache entry.
+    static std::string getKey(const GraphEntry& entry);
+
+    std::shared_ptr<const InMemoryGraphData> get(const std::string& key,
+        common::transaction_t version);
+    void put(const std::string& key, common::transaction_t version,
+        std::shared_ptr<const InMemoryGraphData> data);
+    void clear();
+
+private:
+    struct CachedGraph {
+        common::transaction_t version;
+        std::shared_ptr<const InMemoryGraphData> data;
+    };
+
+    std::mutex mtx;
+    std::unordered_map<std::string, CachedGraph> graphs;
+};
+
+} // namespace graph
+} // namespace kuzu
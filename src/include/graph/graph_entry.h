@@ -31,6 +31,10 @@ struct GraphEntry {
     bool hasRelPredicate() const { return relPredicate != nullptr; }
     std::shared_ptr<binder::Expression> getRelPredicate() const { return relPredicate; }
     void setRelPredicate(std::shared_ptr<binder::Expression> predicate);
+    // Numeric rel property that scans of the graph return as edge weights.
+    bool hasRelWeightProperty() const { return relWeightProperty != nullptr; }
+    std::shared_ptr<binder::Expression> getRelWeightProperty() const { return relWeightProperty; }
+    void setRelWeightProperty(std::shared_ptr<binder::Expression> property);
     binder::expression_vector getRelProperties() const { return relProperties; }
 
     planner::Schema getRelPropertiesSchema() const;
@@ -38,11 +42,15 @@ struct GraphEntry {
 private:
     GraphEntry(const GraphEntry& other)
         : nodeEntries{other.nodeEntries}, relEntries{other.relEntries},
-          relProperties{other.relProperties}, relPredicate{other.relPredicate} {}
+          relProperties{other.relProperties}, relPredicate{other.relPredicate},
+          relWeightProperty{other.relWeightProperty} {}
+
+    void populateRelProperties();
 
 private:
     binder::expression_vector relProperties;
     std::shared_ptr<binder::Expression> relPredicate;
+    std::shared_ptr<binder::Expression> relWeightProperty;
 };
 
 class GraphEntrySet {
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/enums/rel_direction.h"
+#include "graph.h"
+
+namespace kuzu {
+namespace graph {
+
+// Compressed sparse row adjacency of a relationship table in one direction. The neighbours of the
+// bound node at offset i, and the edges leading to them, are stored at positions
+// [offsets[i], offsets[i + 1]).
+struct InMemoryCSR {
+    common::table_id_t boundNodeTableID = common::INVALID_TABLE_ID;
+    std::vector<uint64_t> offsets;
+    std::vector<common::nodeID_t> nbrNodes;
+    std::vector<common::relID_t> edges;
+    // Empty if the graph has no weight property.
+    std::vector<double> weights;
+
+    bool isEmpty() const { return offsets.empty(); }
+};
+
+struct InMemoryRelTable {
+    RelTableIDInfo info;
+    InMemoryCSR fwdCSR;
+    InMemoryCSR bwdCSR;
+
+    const InMemoryCSR& getCSR(common::RelDataDirection direction) const {
+        return direction == common::RelDataDirection::FWD ? fwdCSR : bwdCSR;
+    }
+};
+
+// Immutable copy of the topology of a projected graph as seen by one transaction. It is shared by
+// all InMemoryGraph instances created from it, possibly across queries (see GraphCache).
+struct InMemoryGraphData {
+    std::vector<common::table_id_t> nodeTableIDs;
+    common::table_id_map_t<common::offset_t> numNodes;
+    std::vector<InMemoryRelTable> relTables;
+
+    // Scans every relationship of `graph` in both directions.
+    static std::shared_ptr<const InMemoryGraphData> materialize(Graph& graph);
+};
+
+class InMemoryGraphScanState final : public GraphScanState {
+    friend class InMemoryGraph;
+
+public:
+    explicit InMemoryGraphScanState(std::vector<const InMemoryRelTable*> relTables);
+
+    Chunk getChunk() override;
+    bool next() override;
+
+private:
+    void startScan(common::nodeID_t nodeID, common::RelDataDirection direction_);
+
+private:
+    std::vector<const InMemoryRelTable*> relTables;
+    common::nodeID_t boundNodeID;
+    common::RelDataDirection direction;
+    uint64_t relTableIdx;
+    const InMemoryCSR* csr;
+    // Remaining range of the bound node's adjacency in csr.
+    uint64_t nextPos;
+    uint64_t endPos;
+    uint64_t chunkStartPos;
+    uint64_t chunkSize;
+    common::SelectionVector selVector;
+};
+
+// Graph backed by an InMemoryGraphData. Scans return spans over the CSR arrays, so they don't copy
+// neighbours and don't go through the buffer manager or version checks.
+class InMemoryGraph final : public Graph {
+public:
+    explicit InMemoryGraph(std::shared_ptr<const InMemoryGraphData> data) : data{std::move(data)} {}
+
+    std::vector<common::table_id_t> getNodeTableIDs() override { return data->nodeTableIDs; }
+    std::vector<common::table_id_t> getRelTableIDs() override;
+
+    std::unordered_map<common::table_id_t, uint64_t> getNodeTableIDAndNumNodes() override;
+
+    common::offset_t getNumNodes() override;
+    common::offset_t getNumNodes(common::table_id_t id) override;
+
+    std::vector<RelTableIDInfo> getRelTableIDInfos() override;
+
+    std::unique_ptr<GraphScanState> prepareScan(common::table_id_t relTableID) override;
+    std::unique_ptr<GraphScanState> prepareMultiTableScanFwd(
+        std::span<common::table_id_t> nodeTableIDs) override;
+    std::unique_ptr<GraphScanState> prepareMultiTableScanBwd(
+        std::span<common::table_id_t> nodeTableIDs) override;
+
+    Graph::Iterator scanFwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    Graph::Iterator scanBwd(common::nodeID_t nodeID, GraphScanState& state) override;
+
+private:
+    std::unique_ptr<GraphScanState> prepareMultiTableScan(
+        std::span<common::table_id_t> nodeTableIDs, common::RelDataDirection direction);
+
+private:
+    std::shared_ptr<const InMemoryGraphData> data;
+};
+
+} // namespace graph
+} // namespace kuzu
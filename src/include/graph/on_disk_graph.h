@@ -82,7 +82,8 @@ class OnDiskGraphScanStates : public GraphScanState {
 public:
     GraphScanState::Chunk getChunk() override {
         auto& iter = getInnerIterator();
-        return Chunk{iter.getNbrNodes(), iter.getEdges(), iter.getSelVectorUnsafe()};
+        return Chunk{iter.getNbrNodes(), iter.getEdges(), std::span<const double>(weights),
+            iter.getSelVectorUnsafe()};
     }
     bool next() override;
 
@@ -106,6 +107,9 @@ private:
             const_cast<const OnDiskGraphScanStates*>(this)->getInnerIterator());
     }
 
+    // Converts the weights of the selected edges of the current chunk to doubles.
+    void readWeights();
+
 private:
     std::unique_ptr<common::ValueVector> srcNodeIDVector;
     std::unique_ptr<common::ValueVector> dstNodeIDVector;
@@ -114,6 +118,10 @@ private:
     common::RelDataDirection direction;
 
     std::unique_ptr<evaluator::ExpressionEvaluator> relPredicateEvaluator;
+    // Scanned weight property and its values as doubles. Both are empty if the graph has no weight
+    // property.
+    std::shared_ptr<common::ValueVector> weightVector;
+    std::vector<double> weights;
 
     explicit OnDiskGraphScanStates(main::ClientContext* context,
         std::span<storage::RelTable*> tableIDs, const GraphEntry& graphEntry);
@@ -15,12 +15,16 @@ struct ClientConfigDefault {
     static constexpr bool ENABLE_SEMI_MASK = true;
     static constexpr bool ENABLE_ZONE_MAP = false;
     static constexpr bool ENABLE_GDS = false;
+    static constexpr bool ENABLE_GRAPH_CACHE = false;
     static constexpr bool ENABLE_PROGRESS_BAR = false;
     static constexpr uint64_t SHOW_PROGRESS_AFTER = 1000;
     static constexpr common::PathSemantic RECURSIVE_PATTERN_SEMANTIC = common::PathSemantic::WALK;
     static constexpr uint32_t RECURSIVE_PATTERN_FACTOR = 1;
     static constexpr bool DISABLE_MAP_KEY_CHECK = true;
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
+    static constexpr bool ENABLE_STREAMING_RESULT = false;
+    // Maximum number of result batches buffered for a streaming query result.
+    static constexpr uint64_t STREAMING_RESULT_QUEUE_CAPACITY = 16;
 };
 
 struct ClientConfig {
@@ -34,6 +38,8 @@ struct ClientConfig {
     bool enableZoneMap = ClientConfigDefault::ENABLE_ZONE_MAP;
     // If compiling recursive pattern as GDS.
     bool enableGDS = ClientConfigDefault::ENABLE_GDS;
+    // If GDS algorithms run on cached in-memory copies of projected graphs.
+    bool enableGraphCache = ClientConfigDefault::ENABLE_GRAPH_CACHE;
     // Number of threads for execution.
     uint64_t numThreads = 1;
     // Timeout (milliseconds).
@@ -51,6 +57,8 @@ struct ClientConfig {
     // maximum number of cached warnings
     uint64_t warningLimit = ClientConfigDefault::WARNING_LIMIT;
     bool disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
+    // If returning read-only query results while they are being computed.
+    bool enableStreamingResult = ClientConfigDefault::ENABLE_STREAMING_RESULT;
 };
 
 } // namespace main
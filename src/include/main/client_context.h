@@ -27,6 +27,10 @@ class RandomEngine;
 class TaskScheduler;
 } // namespace common
 
+namespace graph {
+class GraphCache;
+} // namespace graph
+
 namespace extension {
 struct ExtensionOptions;
 }
@@ -36,6 +40,7 @@ struct DBConfig;
 class Database;
 class DatabaseManager;
 class AttachedKuzuDatabase;
+class StreamingQuery;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -108,6 +113,8 @@ public:
     catalog::Catalog* getCatalog() const;
     transaction::TransactionManager* getTransactionManagerUnsafe() const;
     common::VirtualFileSystem* getVFSUnsafe() const;
+    // Returns nullptr when querying an attached database.
+    graph::GraphCache* getGraphCache() const;
     common::RandomEngine* getRandomEngine();
 
     // Query.
@@ -118,6 +125,9 @@ public:
     std::unique_ptr<QueryResult> query(std::string_view queryStatement,
         std::optional<uint64_t> queryID = std::nullopt);
     void runQuery(std::string query);
+    // Finishes a streaming query while holding the context lock, so that ending its transaction
+    // cannot race with another statement on this context.
+    void finishStreamingQuery(StreamingQuery& streamingQuery);
 
     // only use for test framework
     std::vector<std::shared_ptr<parser::Statement>> parseQuery(std::string_view query);
@@ -165,7 +175,14 @@ private:
         const std::unordered_map<std::string, std::unique_ptr<common::Value>>& inputParams);
 
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
-        uint32_t planIdx = 0u, std::optional<uint64_t> queryID = std::nullopt);
+        uint32_t planIdx = 0u, std::optional<uint64_t> queryID = std::nullopt,
+        bool allowStreaming = false);
+
+    bool canStreamResult(PreparedStatement* preparedStatement,
+        processor::PhysicalPlan* physicalPlan) const;
+    // A streaming query keeps running after its result is returned. It must be finished before the
+    // next statement can use the transaction context.
+    void finishStreamingQueryNoLock();
 
     bool canExecuteWriteQuery();
 
@@ -193,6 +210,8 @@ private:
     std::unique_ptr<common::ProgressBar> progressBar;
     // Warning information
     processor::WarningContext warningContext;
+    // Streaming query whose result is still being read, if any.
+    std::weak_ptr<StreamingQuery> activeStreamingQuery;
     std::mutex mtx;
 };
 
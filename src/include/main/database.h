@@ -32,6 +32,10 @@ namespace storage {
 class StorageExtension;
 } // namespace storage
 
+namespace graph {
+class GraphCache;
+} // namespace graph
+
 namespace main {
 struct ExtensionOption;
 class DatabaseManager;
@@ -117,6 +121,8 @@ public:
 
     KUZU_API catalog::Catalog* getCatalog() { return catalog.get(); }
 
+    storage::BufferManager* getBufferManager() const { return bufferManager.get(); }
+
     ExtensionOption* getExtensionOption(std::string name) const;
 
     const DBConfig& getConfig() const { return dbConfig; }
@@ -148,6 +154,7 @@ private:
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<extension::ExtensionOptions> extensionOptions;
     std::unique_ptr<DatabaseManager> databaseManager;
+    std::unique_ptr<graph::GraphCache> graphCache;
     common::case_insensitive_map_t<std::unique_ptr<storage::StorageExtension>> storageExtensions;
     QueryIDGenerator queryIDGenerator;
 };
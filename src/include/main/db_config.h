@@ -59,6 +59,10 @@ struct DBConfig {
     uint64_t maxDBSize;
     bool enableMultiWrites;
     bool autoCheckpoint;
+    // If true, checkpoints triggered by `checkpointThreshold` always run on a background thread,
+    // instead of on the committing thread. Otherwise, only checkpoints triggered while other
+    // transactions are active do.
+    bool backgroundCheckpoint;
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
     std::optional<std::string> spillToDiskTmpFile;
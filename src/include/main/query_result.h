@@ -12,6 +12,8 @@
 namespace kuzu {
 namespace main {
 
+class StreamingQuery;
+
 /**
  * @brief QueryResult stores the result of a query execution.
  */
@@ -72,7 +74,8 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. For a streaming result (see the
+     * enable_streaming_result option), only the tuples received so far are counted.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -104,7 +107,8 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. A streaming result can only be reset as long as its
+     * first batch of tuples has not been exhausted.
      */
     KUZU_API void resetIterator();
 
@@ -137,6 +141,10 @@ private:
         std::vector<common::LogicalType> columnTypes);
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_);
     void validateQuerySucceed() const;
+    // Replaces the exhausted batch of a streaming result with the next non-empty one. Returns false
+    // at the end of the result.
+    bool fetchNextStreamingBatch() const;
+    void finishStreamingQuery() const;
 
 private:
     // execution status
@@ -147,9 +155,14 @@ private:
     std::vector<std::string> columnNames;
     std::vector<common::LogicalType> columnDataTypes;
     // data
-    std::shared_ptr<processor::FactorizedTable> factorizedTable;
-    std::unique_ptr<processor::FlatTupleIterator> iterator;
+    // For a streaming result, the table only holds the current batch and is replaced by the next
+    // one once it has been iterated, hence they are mutable.
+    mutable std::shared_ptr<processor::FactorizedTable> factorizedTable;
+    mutable std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    // streaming
+    std::shared_ptr<StreamingQuery> streamingQuery;
+    mutable uint64_t numTuplesInPreviousBatches = 0;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
@@ -132,6 +132,27 @@ struct EnableGDSSetting {
     }
 };
 
+struct EnableGraphCacheSetting {
+    static constexpr auto name = "enable_graph_cache";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableGraphCache);
+    }
+};
+
+struct EnableStreamingResultSetting {
+    static constexpr auto name = "enable_streaming_result";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableStreamingResult = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableStreamingResult);
+    }
+};
+
 struct HomeDirectorySetting {
     static constexpr auto name = "home_directory";
     static constexpr auto inputType = common::LogicalTypeID::STRING;
@@ -191,7 +212,8 @@ struct EnableMVCCSetting {
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
     static void setContext(ClientContext* context, const common::Value& parameter) {
         KU_ASSERT(parameter.getDataType().getLogicalTypeID() == common::LogicalTypeID::BOOL);
-        // TODO: This is a temporary solution to make tests of multiple write transactions easier.
+        // Only a single write transaction is allowed by default. Setting this to true allows
+        // concurrent write transactions, which abort on write-write conflicts.
         context->getDBConfigUnsafe()->enableMultiWrites = parameter.getValue<bool>();
     }
     static common::Value getSetting(const ClientContext* context) {
@@ -223,6 +245,18 @@ struct AutoCheckpointSetting {
     }
 };
 
+struct BackgroundCheckpointSetting {
+    static constexpr auto name = "background_checkpoint";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getDBConfigUnsafe()->backgroundCheckpoint = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->backgroundCheckpoint);
+    }
+};
+
 struct ForceCheckpointClosingDBSetting {
     static constexpr auto name = "force_checkpoint_on_close";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+
+#include "common/profiler.h"
+#include "processor/execution_context.h"
+#include "processor/physical_plan.h"
+#include "processor/result/streaming_result_queue.h"
+
+namespace kuzu {
+namespace main {
+
+class ClientContext;
+
+/**
+ * StreamingQuery executes a read-only query in the background and hands its result to the
+ * QueryResult batch by batch. It owns everything the running pipelines need (plan, profiler and
+ * execution context) and the auto transaction the query runs in, which is committed when the query
+ * is finished.
+ */
+class StreamingQuery {
+public:
+    StreamingQuery(ClientContext* clientContext, std::unique_ptr<processor::PhysicalPlan> plan,
+        std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::ExecutionContext> executionContext, uint64_t queueCapacity);
+    ~StreamingQuery();
+
+    // Starts executing the plan on a background thread.
+    void start(processor::QueryProcessor* queryProcessor);
+
+    // Returns the next batch of the result, or nullptr if the result is exhausted. Blocks while the
+    // pipelines have not produced the next batch yet, and rethrows any execution error.
+    std::unique_ptr<processor::FactorizedTable> getNextBatch();
+
+    // Cancels the query if it is still running, waits for its pipelines to stop and ends its
+    // transaction. Safe to call multiple times. Callers other than the client context itself must
+    // go through ClientContext::finishStreamingQuery(), which holds the context lock.
+    void finish();
+    bool isFinished();
+
+    ClientContext* getClientContext() const { return clientContext; }
+
+private:
+    ClientContext* clientContext;
+    std::unique_ptr<processor::PhysicalPlan> plan;
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<processor::ExecutionContext> executionContext;
+    std::shared_ptr<processor::StreamingResultQueue> queue;
+    std::thread driverThread;
+    // Set by the driver thread, read after joining it.
+    bool executionFailed;
+    std::mutex mtx;
+    bool finished;
+};
+
+} // namespace main
+} // namespace kuzu
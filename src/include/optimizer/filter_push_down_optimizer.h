@@ -6,6 +6,9 @@ namespace kuzu {
 namespace main {
 class ClientContext;
 }
+namespace planner {
+class LogicalScanNodeTable;
+}
 namespace optimizer {
 
 struct PredicateSet {
@@ -59,6 +62,8 @@ private:
     // Push FILTER into SCAN_NODE_TABLE, and turn index lookup into INDEX_SCAN.
     std::shared_ptr<planner::LogicalOperator> visitScanNodeTableReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
+    // Restrict SCAN_NODE_TABLE with a secondary index if the indexed predicates are selective.
+    void tryApplyPropertyIndexScan(planner::LogicalScanNodeTable& scan);
     // Push Filter into EXTEND.
     std::shared_ptr<planner::LogicalOperator> visitExtendReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
@@ -65,6 +65,12 @@ struct ExtraRenamePropertyInfo : public ExtraAlterInfo {
         : propertyName{std::move(propertyName)}, newName{std::move(newName)} {}
 };
 
+struct ExtraIndexInfo : public ExtraAlterInfo {
+    std::string propertyName;
+
+    explicit ExtraIndexInfo(std::string propertyName) : propertyName{std::move(propertyName)} {}
+};
+
 struct ExtraCommentInfo : public ExtraAlterInfo {
     std::string comment;
 
@@ -4,6 +4,14 @@
 #include "planner/operator/logical_plan.h"
 
 namespace kuzu {
+namespace binder {
+class PropertyExpression;
+} // namespace binder
+
+namespace catalog {
+class TableStatistics;
+} // namespace catalog
+
 namespace main {
 class ClientContext;
 } // namespace main
@@ -33,12 +41,22 @@ public:
         const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
     uint64_t estimateFlatten(const LogicalPlan& childPlan, f_group_pos groupPosToFlatten);
     uint64_t estimateFilter(const LogicalPlan& childPlan, const binder::Expression& predicate);
+    // Estimated fraction of tuples that pass a predicate. Comparisons between a property and a
+    // literal use the statistics collected by ANALYZE when there are any.
+    double getPredicateSelectivity(const binder::Expression& predicate);
 
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode);
 
 private:
     uint64_t atLeastOne(uint64_t x) { return x == 0 ? 1 : x; }
+    // Converts an estimate computed in floating point, clamping it to [1, UINT64_MAX].
+    static uint64_t toCardinality(double x) {
+        if (!(x >= 1)) {
+            return 1;
+        }
+        return x >= (double)UINT64_MAX ? UINT64_MAX : (uint64_t)x;
+    }
 
     uint64_t getNodeIDDom(const std::string& nodeIDName) {
         KU_ASSERT(nodeIDName2dom.contains(nodeIDName));
@@ -48,6 +66,13 @@ private:
 
     uint64_t getNumRels(const std::vector<common::table_id_t>& tableIDs);
 
+    const catalog::TableStatistics* getStatistics(common::table_id_t tableID) const;
+    // Returns 0 if some table of the property has not been analyzed.
+    uint64_t getNumDistinctValues(const binder::PropertyExpression& property);
+    // Returns 0 if some table of the rel has not been analyzed.
+    double getExcessDegree(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode) const;
+
 private:
     main::ClientContext* context;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
@@ -29,15 +29,29 @@ public:
     RecursiveJoinType getJoinType() const { return joinType; }
     std::shared_ptr<LogicalOperator> getRecursiveChild() const { return recursiveChild; }
 
+    void setReverseRecursiveChild(std::shared_ptr<LogicalOperator> child) {
+        reverseRecursiveChild = std::move(child);
+    }
+    std::shared_ptr<LogicalOperator> getReverseRecursiveChild() const {
+        return reverseRecursiveChild;
+    }
+
     std::unique_ptr<LogicalOperator> copy() override {
-        return std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
+        auto result = std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
             extendFromSource_, joinType, children[0]->copy(), recursiveChild->copy(),
             printInfo->copy());
+        if (reverseRecursiveChild != nullptr) {
+            result->reverseRecursiveChild = reverseRecursiveChild->copy();
+        }
+        return result;
     }
 
 private:
     RecursiveJoinType joinType;
     std::shared_ptr<LogicalOperator> recursiveChild;
+    // Recursive plan extending in the opposite direction, from nbr towards bound nodes. Only
+    // planned for shortest path joins, which can then search from both ends of a path.
+    std::shared_ptr<LogicalOperator> reverseRecursiveChild;
 };
 
 class LogicalPathPropertyProbe : public LogicalOperator {
@@ -3,6 +3,7 @@
 #include "binder/expression/expression_util.h"
 #include "planner/operator/logical_operator.h"
 #include "storage/predicate/column_predicate.h"
+#include "storage/predicate/constant_predicate.h"
 
 namespace kuzu {
 namespace planner {
@@ -47,6 +48,21 @@ struct PrimaryKeyScanInfo final : ExtraScanNodeTableInfo {
     }
 };
 
+// Restricts a SCAN to the nodes whose indexed property may satisfy `predicates`. The predicates are
+// still evaluated by the filter above the scan.
+struct PropertyIndexScanInfo final : ExtraScanNodeTableInfo {
+    std::string propertyName;
+    std::vector<storage::ColumnConstantPredicate> predicates;
+
+    PropertyIndexScanInfo(std::string propertyName,
+        std::vector<storage::ColumnConstantPredicate> predicates)
+        : propertyName{std::move(propertyName)}, predicates{std::move(predicates)} {}
+
+    std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
+        return std::make_unique<PropertyIndexScanInfo>(propertyName, predicates);
+    }
+};
+
 class LogicalScanNodeTable final : public LogicalOperator {
     static constexpr LogicalOperatorType type_ = LogicalOperatorType::SCAN_NODE_TABLE;
     static constexpr LogicalScanNodeTableType defaultScanType = LogicalScanNodeTableType::SCAN;
@@ -82,6 +82,21 @@ public:
 
     //! merge aggregate hash table by combining aggregate states under the same key
     void merge(AggregateHashTable& other);
+    //! merge only the given entries of the other hash table
+    void merge(AggregateHashTable& other, std::vector<uint8_t*>& tuples);
+
+    uint64_t getNumTupleBlocks() const { return factorizedTable->getTupleDataBlocks().size(); }
+    //! group pointers to the entries in a block of tuples by the spilled partition their hash falls
+    //! into
+    std::vector<std::vector<uint8_t*>> partitionEntries(ft_block_idx_t blockIdx) const;
+    //! free the hash slots and a block of tuples once its entries have been merged into other
+    //! tables. The table can only be merged from afterwards.
+    void releaseTupleBlock(ft_block_idx_t blockIdx);
+
+    //! create an empty hash table with the same keys, payloads and aggregate functions
+    std::unique_ptr<AggregateHashTable> createEmptyCopy(uint64_t numEntriesToAllocate) const;
+
+    uint64_t getMemoryUsage() const;
 
     void finalizeAggregateStates();
 
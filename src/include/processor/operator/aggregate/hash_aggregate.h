@@ -2,35 +2,90 @@
 
 #include "aggregate_hash_table.h"
 #include "processor/operator/aggregate/base_aggregate.h"
+#include "processor/result/spilled_partitions.h"
 
 namespace kuzu {
 namespace processor {
 
+// Order of the input vectors in the batches spilled by HashAggregate: flat keys, unflat keys and
+// dependent keys, followed for each aggregate by its input vector (if any) and by one vector per
+// multiplicity chunk of the aggregate, which only carries the size of that chunk.
+struct HashAggregateSpillLayout {
+    uint32_t numFlatKeys = 0;
+    uint32_t numUnFlatKeys = 0;
+    uint32_t numDependentKeys = 0;
+    std::vector<bool> hasAggregateVector;
+    std::vector<uint32_t> numMultiplicityChunks;
+};
+
+// Each HashAggregate thread aggregates its input into a local hash table. Once its input is
+// exhausted, the thread radix partitions the groups of its table by the top bits of their hash
+// and merges them into one shared table per partition, releasing its local table a block of tuples
+// at a time. Each partition is then finalized by the HashAggregateScan thread claiming it, so that
+// finalization runs in parallel.
+// If spilling is enabled and the local tables outgrow their memory limit, the remaining input is
+// no longer aggregated in memory but partitioned into the spill file instead, and replayed into
+// the matching partition when it is finalized.
+// Aggregates with DISTINCT never spill: replayed input would be counted again by the partition,
+// which does not know the distinct values seen by the local table. Their input is aggregated in
+// memory by a single thread instead.
 // NOLINTNEXTLINE(cppcoreguidelines-virtual-class-destructor): This is a final class.
 class HashAggregateSharedState final : public BaseAggregateSharedState {
 
 public:
     explicit HashAggregateSharedState(
         const std::vector<function::AggregateFunction>& aggregateFunctions)
-        : BaseAggregateSharedState{aggregateFunctions} {}
+        : BaseAggregateSharedState{aggregateFunctions},
+          partitionHashTables(SpilledPartitions::NUM_PARTITIONS),
+          partitionMtxes(SpilledPartitions::NUM_PARTITIONS), numEntries{0}, nextPartitionIdx{0},
+          spiller{nullptr}, memoryLimit{UINT64_MAX}, memoryUsage{0}, spilled{false} {}
+    ~HashAggregateSharedState();
 
     void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable);
 
-    void combineAggregateHashTable(storage::MemoryManager& memoryManager);
+    // Finalizes the next unclaimed partition. Returns nullptr once all partitions have been
+    // claimed.
+    std::unique_ptr<AggregateHashTable> getNextPartition(storage::MemoryManager* memoryManager);
 
-    void finalizeAggregateHashTable();
+    // Number of groups in all local hash tables. Groups appended by several threads are counted
+    // once per thread, and spilled groups are not counted.
+    uint64_t getNumEntries() const { return numEntries; }
 
-    std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
+    double getProgress() const;
 
-    inline uint8_t* getRow(uint64_t idx) { return globalAggregateHashTable->getEntry(idx); }
-
-    FactorizedTable* getFactorizedTable() { return globalAggregateHashTable->getFactorizedTable(); }
+    void enableSpilling(storage::Spiller* spiller_, uint64_t memoryLimit_) {
+        spiller = spiller_;
+        memoryLimit = memoryLimit_;
+    }
+    storage::Spiller* getSpiller() const { return spiller; }
+    bool canSpill() const { return spiller != nullptr; }
+    // Threads report the growth of their local hash tables, so that spilling starts once all
+    // tables together exceed the memory limit.
+    void increaseMemoryUsage(uint64_t numBytes) { memoryUsage += numBytes; }
+    bool exceedsMemoryLimit() const { return memoryUsage.load() > memoryLimit; }
+    void startSpilling(HashAggregateSpillLayout layout);
+    bool isSpilled() const { return spilled.load(); }
+    SpilledPartitions* getSpilledPartitions() { return &spilledPartitions; }
 
-    uint64_t getCurrentOffset() const { return currentOffset; }
+private:
+    void appendSpilledPartition(AggregateHashTable& hashTable, uint64_t partitionIdx,
+        storage::MemoryManager* memoryManager);
 
 private:
-    std::vector<std::unique_ptr<AggregateHashTable>> localAggregateHashTables;
-    std::unique_ptr<AggregateHashTable> globalAggregateHashTable;
+    // Groups merged from all local hash tables, by partition. Created on first use.
+    std::vector<std::unique_ptr<AggregateHashTable>> partitionHashTables;
+    std::vector<std::mutex> partitionMtxes;
+    // Empty table to create partition tables from.
+    std::unique_ptr<AggregateHashTable> emptyHashTable;
+    uint64_t numEntries;
+    std::atomic<uint64_t> nextPartitionIdx;
+
+    storage::Spiller* spiller;
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> memoryUsage;
+    std::atomic<bool> spilled;
+    HashAggregateSpillLayout spillLayout;
+    SpilledPartitions spilledPartitions;
 };
 
 struct HashAggregateInfo {
@@ -50,12 +105,26 @@ struct HashAggregateLocalState {
     std::vector<common::ValueVector*> dependentKeyVectors;
     common::DataChunkState* leadingState = nullptr;
     std::unique_ptr<AggregateHashTable> aggregateHashTable;
+    uint64_t memoryUsage = 0;
+
+    std::unique_ptr<SpilledPartitionWriter> spillWriter;
+    // Keys the input is partitioned by (flat keys followed by unflat keys) and vectors which are
+    // spilled, in the order described by HashAggregateSpillLayout.
+    std::vector<common::ValueVector*> spillKeyVectors;
+    std::vector<common::ValueVector*> spillVectors;
+    std::vector<std::unique_ptr<common::ValueVector>> multiplicityVectors;
 
     void init(ResultSet& resultSet, main::ClientContext* context, HashAggregateInfo& info,
         std::vector<function::AggregateFunction>& aggregateFunctions,
         std::vector<common::LogicalType> types);
     uint64_t append(const std::vector<AggregateInput>& aggregateInputs,
         uint64_t multiplicity) const;
+
+    HashAggregateSpillLayout getSpillLayout(
+        const std::vector<AggregateInput>& aggregateInputs) const;
+    void initSpillWriter(storage::Spiller* spiller, SpilledPartitions* partitions,
+        storage::MemoryManager* memoryManager, const std::vector<AggregateInput>& aggregateInputs);
+    uint64_t spill(uint64_t multiplicity) const;
 };
 
 struct HashAggregatePrintInfo final : OPPrintInfo {
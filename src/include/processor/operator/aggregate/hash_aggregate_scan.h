@@ -41,6 +41,9 @@ private:
     std::vector<common::ValueVector*> groupByKeyVectors;
     std::shared_ptr<HashAggregateSharedState> sharedState;
     std::vector<uint32_t> groupByKeyVectorsColIdxes;
+    // Partition of the hash table claimed by this thread, and the next entry to scan from it.
+    std::unique_ptr<AggregateHashTable> partition;
+    uint64_t currentOffset = 0;
 };
 
 } // namespace processor
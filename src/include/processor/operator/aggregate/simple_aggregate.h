@@ -18,7 +18,7 @@ public:
 
     void finalizeAggregateStates();
 
-    std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
+    std::pair<uint64_t, uint64_t> getNextRangeToRead();
 
     function::AggregateState* getAggregateState(uint64_t idx) {
         return globalAggregateStates[idx].get();
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <condition_variable>
+
 #include "join_hash_table.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/result_set.h"
+#include "processor/result/spilled_partitions.h"
 
 namespace kuzu {
 namespace processor {
@@ -29,31 +32,122 @@ private:
 
 class HashJoinBuild;
 
+// A run of spilled probe tuples handed to a probe thread, together with the hash table of the
+// build partition it joins with.
+struct SpilledProbeRun {
+    std::shared_ptr<JoinHashTable> hashTable;
+    SpilledRun run;
+};
+
 // This is a shared state between HashJoinBuild and HashJoinProbe operators.
 // Each clone of these two operators will share the same state.
 // Inside the state, we keep the materialized tuples in factorizedTable, which are merged by each
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+// If spilling is enabled and the build side outgrows its memory limit, the join turns into a grace
+// hash join: all build tuples are partitioned by hash into the spill file instead, and the probe
+// side joins one partition at a time (see HashJoinProbe). The hash table of each partition is built
+// once here and probed by all probe threads, so that memory usage does not grow with the number of
+// threads. Partitions which do not fit into the memory limit are partitioned again.
 class HashJoinSharedState {
 public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
-        : hashTable{std::move(hashTable)} {};
+        : hashTable{std::move(hashTable)}, spiller{nullptr}, memoryLimit{UINT64_MAX},
+          memoryUsage{0}, spilled{false} {};
 
-    virtual ~HashJoinSharedState() = default;
+    virtual ~HashJoinSharedState();
 
-    void mergeLocalHashTable(JoinHashTable& localHashTable);
+    // Returns false if the build side has been spilled, in which case the local hash table must be
+    // spilled by the caller instead.
+    bool mergeLocalHashTable(JoinHashTable& localHashTable);
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void enableSpilling(storage::Spiller* spiller_, uint64_t memoryLimit_) {
+        spiller = spiller_;
+        memoryLimit = memoryLimit_;
+    }
+    storage::Spiller* getSpiller() const { return spiller; }
+    bool canSpill() const { return spiller != nullptr; }
+    // Build threads report the growth of their local hash tables, so that spilling starts once
+    // all tables built so far exceed the memory limit.
+    void increaseMemoryUsage(uint64_t numBytes) { memoryUsage += numBytes; }
+    bool exceedsMemoryLimit() const { return memoryUsage.load() > memoryLimit; }
+    void startSpilling();
+    bool isSpilled() const { return spilled.load(); }
+    SpilledPartitions* getSpilledPartitions() { return &spilledPartitions; }
+    SpilledPartitions* getSpilledProbePartitions() { return &spilledProbePartitions; }
+
+    // Probe threads partition all of their input before any partition is joined.
+    void startPartitioningProbeSide();
+    void finishPartitioningProbeSide();
+    // Blocks until all probe threads which started partitioning have finished.
+    void waitForProbePartitioners();
+    // Hands out the next run of probe tuples of the current partition, and moves on to the next
+    // partition once all runs of the current one have been handed out. `probeKeyIdxes` are the
+    // positions of the keys among the spilled probe vectors. Returns false once all partitions
+    // have been joined.
+    bool getNextSpilledProbeRun(SpilledProbeRun& probeRun,
+        const std::vector<common::idx_t>& probeKeyIdxes, storage::MemoryManager* memoryManager);
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+
+private:
+    // Partitions of one level which are joined, or partitioned further, one after another.
+    struct SpilledPartitionLevel {
+        SpilledPartitionLevel(SpilledPartitions* buildPartitions,
+            SpilledPartitions* probePartitions, uint64_t parentNumBytes)
+            : buildPartitions{buildPartitions}, probePartitions{probePartitions},
+              parentNumBytes{parentNumBytes} {}
+
+        SpilledPartitions* buildPartitions;
+        SpilledPartitions* probePartitions;
+        // Size of the partition split into this level. A partition is only split further if the
+        // split made progress, as tuples sharing a key can never be split.
+        uint64_t parentNumBytes;
+        uint64_t nextPartitionIdx = 0;
+        std::unique_ptr<SpilledPartitions> ownedBuildPartitions;
+        std::unique_ptr<SpilledPartitions> ownedProbePartitions;
+    };
+
+    bool loadNextSpilledPartition(const std::vector<common::idx_t>& probeKeyIdxes,
+        storage::MemoryManager* memoryManager);
+    void repartition(const SpilledPartitionLevel& level, uint64_t partitionIdx,
+        const std::vector<common::idx_t>& probeKeyIdxes, storage::MemoryManager* memoryManager);
+    void buildPartitionHashTable(const std::vector<SpilledRun>& runs,
+        storage::MemoryManager* memoryManager);
+
+private:
+    storage::Spiller* spiller;
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> memoryUsage;
+    std::atomic<bool> spilled;
+    SpilledPartitions spilledPartitions;
+    SpilledPartitions spilledProbePartitions;
+
+    std::condition_variable cv;
+    uint64_t numProbePartitioners = 0;
+    bool spilledJoinStarted = false;
+    std::vector<SpilledPartitionLevel> spilledLevels;
+    // Threads still probing runs of a previous partition keep its hash table alive.
+    std::shared_ptr<JoinHashTable> partitionHashTable;
+    const std::vector<SpilledRun>* partitionProbeRuns = nullptr;
+    uint64_t nextProbeRunIdx = 0;
 };
 
 class HashJoinBuildInfo {
     friend class HashJoinBuild;
 
+// A run of spilled probe tuples handed to a probe thread, together with the hash table of the
+// build partition it joins with.
+struct SpilledProbeRun {
+    std::shared_ptr<JoinHashTable> hashTable;
+    SpilledRun run;
+};
+
 public:
     HashJoinBuildInfo(std::vector<DataPos> keysPos, std::vector<common::FStateType> fStateTypes,
         std::vector<DataPos> payloadsPos, FactorizedTableSchema tableSchema)
@@ -108,6 +202,11 @@ protected:
 private:
     void setKeyState(common::DataChunkState* state);
 
+    uint64_t spillVectors();
+    // Moves the tuples of a hash table into the spilled partitions.
+    void spillHashTable(JoinHashTable& table);
+    void initSpillState(ExecutionContext* context);
+
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
     std::unique_ptr<HashJoinBuildInfo> info;
@@ -118,6 +217,15 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+
+private:
+    uint64_t localMemoryUsage = 0;
+    std::unique_ptr<SpilledPartitionWriter> spillWriter;
+    // Vectors hash tables are scanned into when they are spilled. Flat columns share one state,
+    // unflat columns share a state per data chunk they were appended from.
+    std::vector<std::unique_ptr<common::ValueVector>> spillScanVectors;
+    std::vector<ft_col_idx_t> spillScanColIdxes;
+    uint64_t numTuplesPerSpillScan = 0;
 };
 
 } // namespace processor
@@ -35,6 +35,7 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        probeSideDataPos = other.probeSideDataPos;
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -43,6 +44,19 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // All vectors produced by the probe side. They are spilled together with the probe keys if the
+    // build side has been spilled.
+    std::vector<DataPos> probeSideDataPos;
+};
+
+// Thread-local state of a probe whose build side has been spilled. The probe side is partitioned
+// the same way first, then runs of each partition are joined with the shared hash table of its
+// build partition.
+struct SpilledProbeState {
+    bool partitioned = false;
+    SpilledProbeRun probeRun;
+    std::vector<SpilledRun> runs;
+    std::unique_ptr<SpilledPartitionReader> reader;
 };
 
 struct HashJoinProbePrintInfo final : OPPrintInfo {
@@ -94,6 +108,14 @@ public:
     }
 
 private:
+    bool getNextProbeTuple(ExecutionContext* context) {
+        return sharedState->isSpilled() ? getNextSpilledProbeTuple(context) :
+                                          children[0]->getNextTuple(context);
+    }
+    bool getNextSpilledProbeTuple(ExecutionContext* context);
+    void partitionProbeSide(ExecutionContext* context);
+    bool loadNextSpilledRun(ExecutionContext* context);
+
     inline bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
@@ -127,6 +149,14 @@ private:
     std::unique_ptr<common::ValueVector> hashVector;
     std::unique_ptr<common::ValueVector> tmpHashVector;
     common::SelectionVector hashSelVec;
+
+    // The hash table being probed. Points to the hash table of the current partition if the build
+    // side has been spilled.
+    JoinHashTable* hashTable = nullptr;
+    std::vector<common::ValueVector*> probeSideVectors;
+    // Positions of the keys among the probe side vectors.
+    std::vector<common::idx_t> probeSideKeyIdxes;
+    std::unique_ptr<SpilledProbeState> spilledProbeState;
 };
 
 } // namespace processor
@@ -6,7 +6,15 @@
 namespace kuzu {
 namespace processor {
 
+// Hash slots hold the head of a chain of tuples linked through their prev pointer column. Each slot
+// entry is a tagged pointer: the upper 16 bits, which are unused by user-space addresses, form a
+// bloom filter of the hashes chained from the slot. Most probes for keys that are not in the table
+// are rejected by the tag without touching any tuple.
 class JoinHashTable : public BaseHashTable {
+    using slot_entry_t = uint64_t;
+    static constexpr uint64_t NUM_POINTER_BITS = 48;
+    static constexpr slot_entry_t POINTER_MASK = ((slot_entry_t)1 << NUM_POINTER_BITS) - 1;
+
 public:
     JoinHashTable(storage::MemoryManager& memoryManager, common::logical_type_vec_t keyTypes,
         FactorizedTableSchema tableSchema);
@@ -22,7 +30,13 @@ public:
 
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
+    // Must be called before the hash slots are built. buildHashSlots only disables tags if tuples
+    // live above the addresses covered by POINTER_MASK, which user-space addresses don't reach on
+    // common platforms, so tests use this to cover untagged slots.
+    void disableTags() { useTags = false; }
 
+    // Sets `probedTuples` to the head of the chain of each key. Slots and chain heads of the whole
+    // selection are prefetched before they are read.
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
         common::SelectionVector& hashSelVec, common::ValueVector& tmpHashResultVector,
         uint8_t** probedTuples);
@@ -40,23 +54,50 @@ public:
     }
     void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
     uint64_t getNumTuples() { return factorizedTable->getNumTuples(); }
+    uint64_t getMemoryUsage() const { return factorizedTable->getMemoryUsage(); }
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
-    uint8_t* getTupleForHash(common::hash_t hash) {
-        auto slotIdx = getSlotIdxForHash(hash);
-        KU_ASSERT(slotIdx < maxNumHashSlots);
-        return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
-                                ->getData()))[slotIdx & slotIdxInBlockMask];
+    // Returns the head of the chain of `hash`, or nullptr if the tag of the slot rules it out.
+    uint8_t* getTupleForHash(common::hash_t hash) const {
+        return getTupleFromSlotEntry(*getHashSlot(hash), hash);
     }
     FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
     const FactorizedTableSchema* getTableSchema() { return factorizedTable->getTableSchema(); }
 
 private:
-    uint8_t** findHashSlot(const uint8_t* tuple) const;
+    static slot_entry_t getTag(common::hash_t hash) {
+        // The slot index is taken from the lower bits of the hash, so the tag uses the upper ones.
+        return (slot_entry_t)1 << (NUM_POINTER_BITS + (hash >> 60));
+    }
+    uint8_t* getPointer(slot_entry_t entry) const {
+        return reinterpret_cast<uint8_t*>(
+            static_cast<uintptr_t>(useTags ? entry & POINTER_MASK : entry));
+    }
+    uint8_t* getTupleFromSlotEntry(slot_entry_t entry, common::hash_t hash) const {
+        if (useTags && (entry & getTag(hash)) == 0) {
+            return nullptr;
+        }
+        return getPointer(entry);
+    }
+    slot_entry_t* getHashSlot(common::hash_t hash) const {
+        auto slotIdx = getSlotIdxForHash(hash);
+        KU_ASSERT(slotIdx < maxNumHashSlots);
+        return reinterpret_cast<slot_entry_t*>(
+                   hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData()) +
+               (slotIdx & slotIdxInBlockMask);
+    }
     // This function returns the pointer that previously stored in the same slot.
     uint8_t* insertEntry(uint8_t* tuple) const;
 
+    template<typename COMPARE>
+    common::sel_t matchFlatKeys(uint8_t** probedTuples, uint8_t** matchedTuples,
+        COMPARE compare) const;
+    template<typename COMPARE>
+    common::sel_t matchUnFlatKey(const common::ValueVector& keyVector, uint8_t** probedTuples,
+        uint8_t** matchedTuples, common::SelectionVector& matchedTuplesSelVector,
+        COMPARE compare) const;
+
     // Join hash table assumes all keys to be flat.
     void computeVectorHashes(std::vector<common::ValueVector*> keyVectors);
 
@@ -67,6 +108,8 @@ private:
     static constexpr uint64_t HASH_COL_IDX = 2;
     const FactorizedTableSchema* tableSchema;
     uint64_t prevPtrColOffset;
+    // Tags are disabled if any tuple lives above the addresses covered by POINTER_MASK.
+    bool useTags;
 };
 
 } // namespace processor
@@ -3,9 +3,13 @@
 #include <numeric>
 
 #include "processor/operator/sink.h"
+#include "storage/stats/table_statistics_collector.h"
 #include "storage/store/table.h"
 
 namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
 namespace storage {
 class MemoryManager;
 class ChunkedNodeGroup;
@@ -51,6 +55,9 @@ struct BatchInsertSharedState {
     std::shared_ptr<FactorizedTable> fTable;
     storage::WAL* wal;
     storage::MemoryManager* mm;
+    // Only set if the table is empty before the copy. The statistics collected by each thread on
+    // the values it copies are merged here, and set on the table entry once the copy is done.
+    std::unique_ptr<storage::TableStatisticsCollector> statisticsCollector;
 
     BatchInsertSharedState(storage::Table* table, std::shared_ptr<FactorizedTable> fTable,
         storage::WAL* wal, storage::MemoryManager* mm)
@@ -60,6 +67,8 @@ struct BatchInsertSharedState {
 
     virtual ~BatchInsertSharedState() = default;
 
+    void initStatisticsCollector(const catalog::TableCatalogEntry& tableEntry);
+
     std::unique_ptr<BatchInsertSharedState> copy() const {
         auto result = std::make_unique<BatchInsertSharedState>(table, fTable, wal, mm);
         result->numRows.store(numRows.load());
@@ -78,6 +87,7 @@ struct BatchInsertSharedState {
 
 struct BatchInsertLocalState {
     std::unique_ptr<storage::ChunkedNodeGroup> chunkedGroup;
+    std::unique_ptr<storage::TableStatisticsCollector> statisticsCollector;
 
     virtual ~BatchInsertLocalState() = default;
 
@@ -104,6 +114,12 @@ public:
 
     std::shared_ptr<BatchInsertSharedState> getSharedState() const { return sharedState; }
 
+protected:
+    void initLocalStatisticsCollector(main::ClientContext* context) const;
+    void mergeLocalStatistics() const;
+    // Sets the collected statistics on the table entry, if any were collected.
+    void updateStatistics(main::ClientContext* context, common::row_idx_t numRows) const;
+
 protected:
     std::unique_ptr<BatchInsertInfo> info;
     std::shared_ptr<BatchInsertSharedState> sharedState;
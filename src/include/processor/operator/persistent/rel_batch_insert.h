@@ -67,6 +67,8 @@ struct RelBatchInsertInfo final : BatchInsertInfo {
 struct RelBatchInsertLocalState final : BatchInsertLocalState {
     common::partition_idx_t nodeGroupIdx = common::INVALID_NODE_GROUP_IDX;
     std::unique_ptr<common::DataChunk> dummyAllNullDataChunk;
+    // Vectors of the properties to collect statistics on.
+    std::unique_ptr<common::DataChunk> statisticsDataChunk;
 };
 
 class RelBatchInsert final : public BatchInsert {
@@ -116,6 +118,10 @@ private:
         common::offset_t startNodeOffset, const RelBatchInsertInfo& relInfo,
         const RelBatchInsertLocalState& localState, common::offset_t numNodes, bool leaveGaps);
 
+    static void collectStatistics(storage::InMemChunkedNodeGroupCollection& partition,
+        const storage::ChunkedCSRHeader& csrHeader, common::offset_t numNodes,
+        const RelBatchInsertInfo& relInfo, const RelBatchInsertLocalState& localState);
+
     static void populateCSRLengths(const storage::ChunkedCSRHeader& csrHeader,
         common::offset_t numNodes, storage::InMemChunkedNodeGroupCollection& partition,
         common::column_id_t boundNodeOffsetColumn);
@@ -30,6 +30,7 @@ public:
     }
 
     inline uint64_t getNumNodes() const { return numNodes; }
+    inline const common::node_id_set_t& getNodeIDs() const { return nodeIDs; }
 
 private:
     uint64_t numNodes;
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * Shortest path computation between a single src and a single dst node. Instead of a BFS from the
+ * src, extends a frontier forward from the src and a frontier backward from the dst, one level at a
+ * time and always on the side with the smaller frontier, until the two searches meet. Each search
+ * only needs to reach about half the length of the path, which visits far fewer nodes than a
+ * single BFS on graphs with high degrees.
+ *
+ * The first node that is visited by both searches lies on a shortest path: when a level of one
+ * search visits a node of the other, no node is within a shorter total distance to both src and
+ * dst, otherwise an earlier level would have visited it.
+ *
+ * Once the computation finishes, the frontiers of BaseBFSState contain this path as if a BFS from
+ * the src had found it, i.e. frontier i contains the i'th node of the path, so that frontier
+ * scanners can output the path unchanged.
+ */
+class BidirectionalShortestPathState : public BaseBFSState {
+    struct Search {
+        // Visited nodes and the (nbr, rel) pair through which they were visited, where nbr is one
+        // step closer to the node the search starts from.
+        common::node_id_map_t<node_rel_id_t> parents;
+        std::vector<common::nodeID_t> currentFrontier;
+        std::vector<common::nodeID_t> nextFrontier;
+        uint8_t level = 0;
+
+        void reset(common::nodeID_t nodeID) {
+            parents.clear();
+            parents.insert({nodeID, {nodeID, {common::INVALID_OFFSET, common::INVALID_TABLE_ID}}});
+            currentFrontier.clear();
+            currentFrontier.push_back(nodeID);
+            nextFrontier.clear();
+            level = 0;
+        }
+    };
+
+public:
+    BidirectionalShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes,
+        bool trackPath)
+        : BaseBFSState{upperBound, targetDstNodes}, trackPath{trackPath}, extendingFwd{true},
+          meetingNodeID{common::INVALID_OFFSET, common::INVALID_TABLE_ID} {}
+
+    inline bool isComplete() final {
+        return meetingNodeID.offset != common::INVALID_OFFSET || fwd.currentFrontier.empty() ||
+               bwd.currentFrontier.empty() || fwd.level + bwd.level == upperBound;
+    }
+
+    inline void resetState() final {
+        currentLevel = 0;
+        nextNodeIdxToExtend = 0;
+        frontiers.clear();
+        meetingNodeID = {common::INVALID_OFFSET, common::INVALID_TABLE_ID};
+    }
+
+    inline void markSrc(common::nodeID_t nodeID) final { fwd.reset(nodeID); }
+    inline void markDst(common::nodeID_t nodeID) { bwd.reset(nodeID); }
+
+    // Picks the search to extend in the next level and returns true if it is the forward one.
+    inline bool beginLevel() {
+        extendingFwd = fwd.currentFrontier.size() <= bwd.currentFrontier.size();
+        nextNodeIdxToExtend = 0;
+        return extendingFwd;
+    }
+    inline common::nodeID_t getNextNodeIDToExtend() {
+        auto& frontier = getSearch().currentFrontier;
+        if (nextNodeIdxToExtend == frontier.size()) {
+            return common::nodeID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
+        }
+        return frontier[nextNodeIdxToExtend++];
+    }
+
+    // For the backward search, relID must be marked flipped if the rel points from nbrNodeID to
+    // boundNodeID, i.e. as if the rel had been visited from nbrNodeID by the forward search.
+    inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::relID_t relID, uint64_t /*multiplicity*/) final {
+        auto& search = getSearch();
+        if (search.parents.contains(nbrNodeID)) {
+            return;
+        }
+        search.parents.insert({nbrNodeID, {boundNodeID, relID}});
+        search.nextFrontier.push_back(nbrNodeID);
+        auto& otherSearch = extendingFwd ? bwd : fwd;
+        if (meetingNodeID.offset == common::INVALID_OFFSET &&
+            otherSearch.parents.contains(nbrNodeID)) {
+            meetingNodeID = nbrNodeID;
+        }
+    }
+
+    inline void finalizeLevel() {
+        auto& search = getSearch();
+        std::swap(search.currentFrontier, search.nextFrontier);
+        search.nextFrontier.clear();
+        search.level++;
+        if (meetingNodeID.offset != common::INVALID_OFFSET) {
+            populatePathFrontiers();
+        }
+    }
+
+private:
+    inline Search& getSearch() { return extendingFwd ? fwd : bwd; }
+
+    void populatePathFrontiers() {
+        // Collect the path from src to dst, where rels[i] connects nodes[i] and nodes[i + 1].
+        std::vector<common::nodeID_t> nodes;
+        std::vector<common::relID_t> rels;
+        for (auto nodeID = meetingNodeID;;) {
+            nodes.push_back(nodeID);
+            auto& [parentID, relID] = fwd.parents.at(nodeID);
+            if (relID.offset == common::INVALID_OFFSET) {
+                break;
+            }
+            rels.push_back(relID);
+            nodeID = parentID;
+        }
+        std::reverse(nodes.begin(), nodes.end());
+        std::reverse(rels.begin(), rels.end());
+        for (auto nodeID = meetingNodeID;;) {
+            auto& [parentID, relID] = bwd.parents.at(nodeID);
+            if (relID.offset == common::INVALID_OFFSET) {
+                break;
+            }
+            nodes.push_back(parentID);
+            rels.push_back(relID);
+            nodeID = parentID;
+        }
+        frontiers.clear();
+        initStartFrontier();
+        currentFrontier->addNodeWithMultiplicity(nodes[0], 1);
+        for (auto i = 0u; i < rels.size(); ++i) {
+            addNextFrontier();
+            if (trackPath) {
+                nextFrontier->addEdge(nodes[i], nodes[i + 1], rels[i]);
+            } else {
+                nextFrontier->addNodeWithMultiplicity(nodes[i + 1], 1);
+            }
+        }
+    }
+
+private:
+    bool trackPath;
+    Search fwd;
+    Search bwd;
+    bool extendingFwd;
+    common::nodeID_t meetingNodeID;
+};
+
+} // namespace processor
+} // namespace kuzu
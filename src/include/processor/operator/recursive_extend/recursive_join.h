@@ -1,6 +1,7 @@
 #pragma once
 
 #include "bfs_state.h"
+#include "bidirectional_shortest_path_state.h"
 #include "common/enums/extend_direction.h"
 #include "common/enums/query_rel_type.h"
 #include "common/mask.h"
@@ -36,6 +37,10 @@ struct RecursiveJoinDataInfo {
     std::unordered_set<common::table_id_t> recursiveDstNodeTableIDs;
     DataPos recursiveEdgeIDPos;
     DataPos recursiveEdgeDirectionPos;
+    // Recursive plan that extends in the opposite direction for bidirectional shortest path
+    // computation. Data positions are the same as in the recursive plan. Null if the join cannot
+    // be computed bidirectionally.
+    std::unique_ptr<ResultSetDescriptor> reverseLocalResultSetDescriptor;
     // Path info
     DataPos pathPos;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
@@ -56,6 +61,9 @@ private:
         recursiveDstNodeTableIDs = other.recursiveDstNodeTableIDs;
         recursiveEdgeIDPos = other.recursiveEdgeIDPos;
         recursiveEdgeDirectionPos = other.recursiveEdgeDirectionPos;
+        if (other.reverseLocalResultSetDescriptor != nullptr) {
+            reverseLocalResultSetDescriptor = other.reverseLocalResultSetDescriptor->copy();
+        }
         pathPos = other.pathPos;
         tableIDToName = other.tableIDToName;
     }
@@ -79,6 +87,10 @@ struct RecursiveJoinVectors {
     common::ValueVector* recursiveEdgeDirectionVector = nullptr;
     common::ValueVector* recursiveDstNodeIDVector = nullptr;
     common::ValueVector* recursiveNodePredicateExecFlagVector = nullptr;
+
+    common::ValueVector* reverseRecursiveEdgeIDVector = nullptr;
+    common::ValueVector* reverseRecursiveEdgeDirectionVector = nullptr;
+    common::ValueVector* reverseRecursiveDstNodeIDVector = nullptr;
 };
 
 struct RecursiveJoinInfo {
@@ -111,10 +123,13 @@ class RecursiveJoin : public PhysicalOperator {
 public:
     RecursiveJoin(RecursiveJoinInfo info, std::shared_ptr<RecursiveJoinSharedState> sharedState,
         std::unique_ptr<PhysicalOperator> child, uint32_t id,
-        std::unique_ptr<PhysicalOperator> recursiveRoot, std::unique_ptr<OPPrintInfo> printInfo)
+        std::unique_ptr<PhysicalOperator> recursiveRoot,
+        std::unique_ptr<PhysicalOperator> reverseRecursiveRoot,
+        std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
           info{std::move(info)}, sharedState{std::move(sharedState)},
-          recursiveRoot{std::move(recursiveRoot)}, recursiveSource{nullptr} {}
+          recursiveRoot{std::move(recursiveRoot)}, recursiveSource{nullptr},
+          reverseRecursiveRoot{std::move(reverseRecursiveRoot)}, reverseRecursiveSource{nullptr} {}
 
     std::vector<common::NodeSemiMask*> getSemiMask() const;
 
@@ -124,7 +139,9 @@ public:
 
     std::unique_ptr<PhysicalOperator> clone() final {
         return std::make_unique<RecursiveJoin>(info.copy(), sharedState, children[0]->clone(), id,
-            recursiveRoot->clone(), printInfo->copy());
+            recursiveRoot->clone(),
+            reverseRecursiveRoot == nullptr ? nullptr : reverseRecursiveRoot->clone(),
+            printInfo->copy());
     }
 
 private:
@@ -136,8 +153,12 @@ private:
 
     // Compute BFS for a given src node.
     void computeBFS(ExecutionContext* context);
+    // Compute the shortest path from the src node to the single target dst node by extending from
+    // both of them.
+    void computeBidirectionalBFS(ExecutionContext* context);
 
     void updateVisitedNodes(common::nodeID_t boundNodeID);
+    void updateBidirectionalVisitedNodes(common::nodeID_t boundNodeID, bool extendingFwd);
 
 private:
     RecursiveJoinInfo info;
@@ -147,9 +168,14 @@ private:
     std::unique_ptr<ResultSet> localResultSet;
     std::unique_ptr<PhysicalOperator> recursiveRoot;
     OffsetScanNodeTable* recursiveSource;
+    std::unique_ptr<ResultSet> reverseLocalResultSet;
+    std::unique_ptr<PhysicalOperator> reverseRecursiveRoot;
+    OffsetScanNodeTable* reverseRecursiveSource;
 
     std::unique_ptr<RecursiveJoinVectors> vectors;
     std::unique_ptr<BaseBFSState> bfsState;
+    // Used instead of bfsState if there is a single target dst node other than the src node.
+    std::unique_ptr<BidirectionalShortestPathState> bidirectionalBFSState;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
 };
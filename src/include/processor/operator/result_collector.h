@@ -3,6 +3,7 @@
 #include "common/enums/accumulate_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/streaming_result_queue.h"
 
 namespace kuzu {
 namespace processor {
@@ -19,9 +20,17 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    // In streaming mode, local tables are handed to the queue in batches instead of being merged
+    // into the shared table.
+    void setStreamingQueue(std::shared_ptr<StreamingResultQueue> queue) {
+        streamingQueue = std::move(queue);
+    }
+    StreamingResultQueue* getStreamingQueue() const { return streamingQueue.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    std::shared_ptr<StreamingResultQueue> streamingQueue;
 };
 
 struct ResultCollectorInfo {
@@ -61,6 +70,9 @@ struct ResultCollectorPrintInfo final : OPPrintInfo {
 
 class ResultCollector : public Sink {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::RESULT_COLLECTOR;
+    // Number of (factorized) tuples buffered per thread before a batch is pushed to the streaming
+    // queue.
+    static constexpr uint64_t STREAMING_BATCH_SIZE = common::DEFAULT_VECTOR_CAPACITY;
 
 public:
     ResultCollector(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
@@ -76,6 +88,16 @@ public:
 
     std::shared_ptr<FactorizedTable> getResultFactorizedTable() { return sharedState->getTable(); }
 
+    // Streaming is only supported for regular accumulation with a non-empty payload, since optional
+    // accumulation needs to see the full result in finalize.
+    bool canStreamResult() const {
+        return info.accumulateType == common::AccumulateType::REGULAR &&
+               !info.payloadPositions.empty();
+    }
+    void setStreamingQueue(std::shared_ptr<StreamingResultQueue> queue) {
+        sharedState->setStreamingQueue(std::move(queue));
+    }
+
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info.copy(), sharedState,
             children[0]->clone(), id, printInfo->copy());
@@ -84,6 +106,9 @@ public:
 private:
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
+    std::unique_ptr<FactorizedTable> createLocalTable(ExecutionContext* context) const;
+    void pushLocalTableToStream(ExecutionContext* context);
+
 private:
     ResultCollectorInfo info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
@@ -46,7 +46,7 @@ struct PartitionerSharedState;
 class PlanMapper {
 public:
     explicit PlanMapper(main::ClientContext* clientContext)
-        : clientContext{clientContext}, physicalOperatorID{0} {}
+        : clientContext{clientContext}, physicalOperatorID{0}, numSpillingOperators{0} {}
 
     std::unique_ptr<PhysicalPlan> mapLogicalPlanToPhysical(const planner::LogicalPlan* logicalPlan,
         const binder::expression_vector& expressionsToCollect);
@@ -197,6 +197,9 @@ private:
     RelTableSetInfo getRelTableSetInfo(const catalog::TableCatalogEntry& entry,
         const binder::Expression& expr) const;
     uint32_t getOperatorID() { return physicalOperatorID++; }
+    // Memory each operator which can spill to disk (hash joins and hash aggregates) may use before
+    // it starts spilling. Half of the buffer pool is split evenly between them.
+    uint64_t getSpillingMemoryLimit() const;
 
     static void mapSIPJoin(PhysicalOperator* joinRoot);
 
@@ -214,6 +217,7 @@ public:
 private:
     std::unordered_map<planner::LogicalOperator*, PhysicalOperator*> logicalOpToPhysicalOpMap;
     uint32_t physicalOperatorID;
+    uint64_t numSpillingOperators;
 };
 
 } // namespace processor
@@ -3,6 +3,7 @@
 #include "common/task_system/task_scheduler.h"
 #include "processor/physical_plan.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/streaming_result_queue.h"
 
 namespace kuzu {
 namespace processor {
@@ -16,7 +17,17 @@ public:
 
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
+    static bool canStreamResult(PhysicalPlan* physicalPlan);
+    // Executes the plan while handing result batches to the queue as soon as they are produced.
+    // Blocks until all pipelines finished and throws if one of them errored. The root pipeline
+    // runs on dedicated threads as it may block on a slow consumer.
+    void executeStreaming(PhysicalPlan* physicalPlan, ExecutionContext* context,
+        std::shared_ptr<StreamingResultQueue> queue);
+
 private:
+    std::shared_ptr<common::Task> createRootTask(PhysicalPlan* physicalPlan,
+        ExecutionContext* context);
+
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
     void initTask(common::Task* task);
@@ -15,6 +15,8 @@ public:
 
     virtual ~BaseHashTable() = default;
 
+    const std::vector<common::LogicalType>& getKeyTypes() const { return keyTypes; }
+
 protected:
     static constexpr uint64_t HASH_BLOCK_SIZE = common::TEMP_PAGE_SIZE;
 
@@ -29,6 +29,7 @@ public:
     }
 
     uint8_t* getData() const { return block->getBuffer().data(); }
+    uint64_t getSize() const { return block->getBuffer().size(); }
     uint8_t* getWritableData() const { return block->getBuffer().last(freeSize).data(); }
     void resetNumTuplesAndFreeSize() {
         freeSize = block->getBuffer().size();
@@ -67,6 +68,7 @@ public:
     const std::vector<std::unique_ptr<DataBlock>>& getBlocks() const { return blocks; }
     DataBlock* getBlock(ft_block_idx_t blockIdx) { return blocks[blockIdx].get(); }
     DataBlock* getLastBlock() { return blocks.back().get(); }
+    void releaseBlock(ft_block_idx_t blockIdx) { blocks[blockIdx].reset(); }
 
     void merge(DataBlockCollection& other);
 
@@ -131,10 +133,17 @@ public:
     uint64_t getNumTuples() const { return numTuples; }
     uint64_t getTotalNumFlatTuples() const;
     uint64_t getNumFlatTuples(ft_tuple_idx_t tupleIdx) const;
+    // Memory held by the tuple blocks and the overflow buffer of the table.
+    uint64_t getMemoryUsage() const;
 
     const std::vector<std::unique_ptr<DataBlock>>& getTupleDataBlocks() {
         return flatTupleBlockCollection->getBlocks();
     }
+    // Frees a block of flat tuples which is no longer read. The table must be cleared before it is
+    // used again.
+    void releaseTupleDataBlock(ft_block_idx_t blockIdx) {
+        flatTupleBlockCollection->releaseBlock(blockIdx);
+    }
     const FactorizedTableSchema* getTableSchema() const { return &tableSchema; }
 
     template<typename TYPE>
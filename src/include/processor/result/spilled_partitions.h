@@ -0,0 +1,116 @@
+#pragma once
+
+#include <mutex>
+
+#include "common/serializer/buffered_serializer.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/vector/value_vector.h"
+
+namespace kuzu {
+namespace storage {
+class MemoryManager;
+class Spiller;
+} // namespace storage
+
+namespace processor {
+
+struct SpilledRun {
+    uint64_t filePosition;
+    uint64_t numBytes;
+};
+
+// Runs of serialized tuples written to the spill file by an operator which partitions its input by
+// hash (e.g. one side of a grace hash join), grouped by partition. A tuple belongs to the partition
+// given by the top bits of its key hash, so that the lower bits used for hash slots stay evenly
+// distributed inside a reloaded partition.
+// A partition which is still too large can be split again into partitions of the next level, which
+// are given by the next NUM_PARTITIONS_LOG2 bits of the hash.
+class SpilledPartitions {
+public:
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 6;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+    static constexpr uint64_t MAX_LEVEL = 3;
+
+    explicit SpilledPartitions(uint64_t level = 0)
+        : level{level}, runs(NUM_PARTITIONS), numBytes(NUM_PARTITIONS, 0) {
+        KU_ASSERT(level <= MAX_LEVEL);
+    }
+
+    static uint64_t getPartitionIdx(common::hash_t hash, uint64_t level = 0) {
+        return (hash >> (sizeof(common::hash_t) * 8 - NUM_PARTITIONS_LOG2 * (level + 1))) &
+               (NUM_PARTITIONS - 1);
+    }
+
+    uint64_t getLevel() const { return level; }
+    void addRun(uint64_t partitionIdx, SpilledRun run);
+    // Must only be called once all writers have been flushed.
+    const std::vector<SpilledRun>& getRuns(uint64_t partitionIdx) const {
+        return runs[partitionIdx];
+    }
+    uint64_t getNumBytes(uint64_t partitionIdx) const { return numBytes[partitionIdx]; }
+
+private:
+    uint64_t level;
+    std::mutex mtx;
+    std::vector<std::vector<SpilledRun>> runs;
+    std::vector<uint64_t> numBytes;
+};
+
+// Thread-local writer of spilled partitions. Input vectors are split into partitions by the hash of
+// their keys and serialized into a buffer per partition, which is written to the spill file as a
+// run once it grows beyond RUN_SIZE.
+class SpilledPartitionWriter {
+public:
+    static constexpr uint64_t RUN_SIZE = common::TEMP_PAGE_SIZE;
+
+    SpilledPartitionWriter(storage::Spiller* spiller, SpilledPartitions* partitions,
+        storage::MemoryManager* memoryManager);
+
+    // Serializes the selected tuples of vectors. Tuples sharing the state of the (unflat) keys are
+    // split across partitions; vectors in other states are written as a whole to each partition
+    // receiving tuples from the batch.
+    void write(const std::vector<common::ValueVector*>& keyVectors,
+        const std::vector<common::ValueVector*>& vectors);
+    // Writes the remaining buffered tuples to the spill file.
+    void flush();
+
+private:
+    void computeHashes(const std::vector<common::ValueVector*>& keyVectors);
+    void writeBatch(uint64_t partitionIdx, const std::vector<common::ValueVector*>& vectors);
+    void writeRun(uint64_t partitionIdx);
+
+private:
+    storage::Spiller* spiller;
+    SpilledPartitions* partitions;
+    std::vector<std::shared_ptr<common::BufferedSerializer>> buffers;
+    std::vector<std::unique_ptr<common::Serializer>> serializers;
+    std::unique_ptr<common::ValueVector> hashVector;
+    std::unique_ptr<common::ValueVector> tmpHashVector;
+    std::unique_ptr<common::ValueVector> combinedHashVector;
+    std::vector<std::vector<common::sel_t>> partitionPositions;
+    std::shared_ptr<common::SelectionVector> partitionSelVector;
+};
+
+// Reads back the batches written to one partition, in the order their runs were added.
+class SpilledPartitionReader {
+public:
+    SpilledPartitionReader(storage::Spiller* spiller, const std::vector<SpilledRun>& runs,
+        storage::MemoryManager* memoryManager)
+        : spiller{spiller}, runs{runs}, memoryManager{memoryManager}, nextRunIdx{0} {}
+
+    // Deserializes the next batch into newly created vectors, in the same order and with the same
+    // factorization they were written with. Returns false once all runs have been read.
+    bool readBatch(std::vector<std::unique_ptr<common::ValueVector>>& vectors);
+
+private:
+    storage::Spiller* spiller;
+    const std::vector<SpilledRun>& runs;
+    storage::MemoryManager* memoryManager;
+    uint64_t nextRunIdx;
+    std::unique_ptr<uint8_t[]> runData;
+    std::unique_ptr<common::Deserializer> deserializer;
+};
+
+} // namespace processor
+} // namespace kuzu
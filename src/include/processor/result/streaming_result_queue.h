@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// A bounded multi-producer single-consumer queue of result batches. ResultCollector threads push
+// batches while the pipelines are still running, and the QueryResult pops them as the client reads.
+// Producers block when the queue is full (backpressure). Once the consumer cancels the queue,
+// blocked and subsequent pushes fail so that the pipelines can stop early.
+class StreamingResultQueue {
+public:
+    explicit StreamingResultQueue(uint64_t capacity)
+        : capacity{capacity}, finished{false}, cancelled{false} {}
+
+    // Blocks while the queue is full. Returns false if the queue has been cancelled, in which case
+    // the batch is dropped.
+    bool push(std::unique_ptr<FactorizedTable> batch);
+    // Blocks until a batch is available. Returns nullptr once the producers have finished and all
+    // batches have been consumed. Rethrows the exception the producers finished with, if any.
+    std::unique_ptr<FactorizedTable> pop();
+
+    // Called once all producers are done, with the exception they failed with (if any).
+    void finishProducing(std::exception_ptr exceptionPtr);
+    // Called by the consumer when it is no longer interested in the remaining batches.
+    void cancel();
+    bool isCancelled();
+
+private:
+    std::mutex mtx;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<std::unique_ptr<FactorizedTable>> batches;
+    uint64_t capacity;
+    bool finished;
+    bool cancelled;
+    std::exception_ptr exceptionPtr;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -4,9 +4,12 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "common/types/types.h"
+#include "storage/buffer_manager/sharded_counters.h"
+#include "storage/enums/page_access_pattern.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/file_handle.h"
 
@@ -19,8 +22,51 @@ class EmptyBufferManagerTest;
 };
 namespace storage {
 class ChunkedNodeGroup;
+class PagePrefetcher;
 class Spiller;
 
+enum class BufferPoolCounter : uint8_t {
+    // Reads of pages that were already cached.
+    CACHE_HITS = 0,
+    // Pages read from disk into frames.
+    CACHE_MISSES = 1,
+    EVICTIONS = 2,
+    // Eviction candidates which could not be evicted, since their pages were accessed after they
+    // were picked.
+    FAILED_EVICTIONS = 3,
+    // Optimistic reads repeated since their pages changed during the read.
+    OPTIMISTIC_READ_RETRIES = 4,
+    // Pages allocated by the memory manager, in total and currently.
+    TEMP_PAGE_ALLOCATIONS = 5,
+    TEMP_PAGES_IN_USE = 6,
+    NUM_COUNTERS = 7,
+};
+
+// Snapshot of the counters of the buffer manager, with the bytes read and written summed up over
+// all files.
+struct BufferPoolInfo {
+    uint64_t bufferPoolSize;
+    uint64_t usedMemory;
+    uint64_t numCacheHits;
+    uint64_t numCacheMisses;
+    uint64_t numEvictions;
+    uint64_t numFailedEvictions;
+    uint64_t numOptimisticReadRetries;
+    uint64_t numTempPageAllocations;
+    uint64_t numTempPagesInUse;
+    uint64_t numBytesRead;
+    uint64_t numBytesWritten;
+};
+
+struct FileHandleInfo {
+    std::string filePath;
+    uint64_t numPages;
+    // Pages of the file which are currently held in frames.
+    uint64_t numCachedPages;
+    uint64_t numBytesRead;
+    uint64_t numBytesWritten;
+};
+
 // This class keeps state info for pages potentially can be evicted.
 // The page state of a candidate is set to MARKED when it is first enqueued. After enqueued, if the
 // candidate was recently accessed, it is no longer immediately evictable. See the state transition
@@ -49,7 +95,7 @@ struct EvictionCandidate {
 };
 
 // A circular buffer queue storing eviction candidates
-// One candidate should be stored for each page currently in memory
+// One candidate should be stored for each page currently in memory, in one of the BM's queues
 class EvictionQueue {
 public:
     static constexpr auto EMPTY = EvictionCandidate{UINT32_MAX, common::INVALID_PAGE_IDX};
@@ -67,6 +113,8 @@ public:
     std::atomic<EvictionCandidate>* next();
     void removeCandidatesForFile(uint32_t fileIndex);
     void clear(std::atomic<EvictionCandidate>& candidate);
+    // Returns false if the slot no longer holds the given candidate
+    bool tryRemove(std::atomic<EvictionCandidate>& slot, EvictionCandidate candidate);
 
     uint64_t getSize() const { return size; }
     uint64_t getCapacity() const { return capacity; }
@@ -126,7 +174,7 @@ private:
  * region. Both disk pages and memory buffers are all managed by the BM to make sure that actually
  * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
  * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
- * comments above `claimAFrame()` for more details.
+ * comments above `claimAFrame()` and `evictPages()` for more details.
  *
  * Page states in BM:
  * A page can be in one of the four states: a) LOCKED, b) UNLOCKED, c) MARKED, d) EVICTED.
@@ -167,6 +215,16 @@ private:
  * 7. During eviction, if the page is in the MARKED state, it will be LOCKED first (7.1), then
  * removed from its frame, and set to EVICTED (7.2).
  *
+ * Eviction candidates are kept in two queues, similar to 2Q. Newly cached pages enter the
+ * probationary queue. Pinning a cached page, or optimistically reading it with the RANDOM access
+ * pattern, flags it as reaccessed, and when eviction finds a reaccessed page in the probationary
+ * queue, the page is promoted to the protected queue instead of being marked. Pages read by large
+ * scans use the SCAN access pattern and are thus evicted from the probationary queue without
+ * displacing the frequently reused pages in the protected queue, such as hash index slots.
+ * Eviction only takes from the protected queue first once it holds more than
+ * PROTECTED_QUEUE_RATIO of all candidates, or when the probationary queue has nothing left to
+ * evict.
+ *
  * The design is inspired by vmcache in the paper "Virtual-Memory Assisted Buffer Management"
  * (https://www.cs.cit.tum.de/fileadmin/w00cfj/dis/_my_direct_uploads/vmcache.pdf).
  * We would also like to thank Fadhil Abubaker for doing the initial research and prototyping of
@@ -176,8 +234,15 @@ private:
 class BufferManager {
     friend class FileHandle;
     friend class MemoryManager;
+    friend class PagePrefetcher;
 
 public:
+    // Maximum number of pages that scans ask to be prefetched at once.
+    static constexpr common::page_idx_t MAX_NUM_PAGES_TO_PREFETCH = 64;
+    // Maximum fraction of eviction candidates kept in the protected queue before its pages are
+    // evicted as well.
+    static constexpr double PROTECTED_QUEUE_RATIO = 0.75;
+
     BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
         uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly);
     ~BufferManager();
@@ -186,11 +251,15 @@ public:
     void removeFilePagesFromFrames(FileHandle& fileHandle);
     void updateFrameIfPageIsInFrameWithoutLock(common::file_idx_t fileIdx, const uint8_t* newPage,
         common::page_idx_t pageIdx);
+    // Waits until the reads of all prefetched pages are complete. Pages must not be written to disk
+    // behind the buffer manager's back while a prefetch may still read their old content.
+    void waitForPrefetchedPages();
 
     // For files that are managed by BM, their FileHandles should be created through this function.
     FileHandle* getFileHandle(const std::string& filePath, uint8_t flags,
         common::VirtualFileSystem* vfs, main::ClientContext* context,
         common::PageSizeClass pageSizeClass = common::REGULAR_PAGE) {
+        std::unique_lock lck{fileHandlesMtx};
         fileHandles.emplace_back(std::unique_ptr<FileHandle>(new FileHandle(filePath, flags, this,
             fileHandles.size(), pageSizeClass, vfs, context)));
         return fileHandles.back().get();
@@ -198,6 +267,14 @@ public:
 
     uint64_t getUsedMemory() const { return usedMemory; }
 
+    uint64_t getCounter(BufferPoolCounter counter) const { return counters.get(counter); }
+    // Accesses to pages that were already cached, and pages read from disk into frames.
+    uint64_t getNumCacheHits() const { return counters.get(BufferPoolCounter::CACHE_HITS); }
+    uint64_t getNumCacheMisses() const { return counters.get(BufferPoolCounter::CACHE_MISSES); }
+    uint64_t getNumProtectedPages() const { return protectedQueue.getSize(); }
+    BufferPoolInfo getBufferPoolInfo();
+    std::vector<FileHandleInfo> getFileHandleInfos();
+
     void getSpillerOrSkip(std::function<void(Spiller&)> func) {
         if (spiller) {
             return func(*spiller);
@@ -208,7 +285,9 @@ private:
     uint8_t* pin(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(FileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func, PageAccessPattern accessPattern);
+    void prefetchPages(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
     // The function assumes that the requested page is already pinned.
     void unpin(FileHandle& fileHandle, common::page_idx_t pageIdx);
     uint8_t* getFrame(FileHandle& fileHandle, common::page_idx_t pageIdx) const {
@@ -226,11 +305,19 @@ private:
     bool reserve(uint64_t sizeToReserve);
     bool claimAFrame(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
+    bool reserveFrame(FileHandle& fileHandle, common::page_idx_t pageIdx);
     // Return number of bytes freed.
-    uint64_t tryEvictPage(std::atomic<EvictionCandidate>& candidate);
+    uint64_t tryEvictPage(EvictionQueue& queue, std::atomic<EvictionCandidate>& candidate);
 
     void cachePageIntoFrame(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
+    struct PageRun {
+        common::page_idx_t startPageIdx;
+        common::page_idx_t numPages;
+    };
+    // Pages of the runs must be locked and have their frames reserved. The runs are read from disk
+    // as one batch.
+    void cachePagesIntoFrames(FileHandle& fileHandle, const std::vector<PageRun>& runs);
     void removePageFromFrame(FileHandle& fileHandle, common::page_idx_t pageIdx, bool shouldFlush);
 
     uint64_t freeUsedMemory(uint64_t size);
@@ -240,20 +327,26 @@ private:
     }
 
     uint64_t evictPages();
+    bool tryPromotePage(std::atomic<EvictionCandidate>& candidate, uint64_t pageStateAndVersion);
 
 private:
     std::atomic<uint64_t> bufferPoolSize;
-    EvictionQueue evictionQueue;
+    EvictionQueue probationaryQueue;
+    EvictionQueue protectedQueue;
     // Total memory used
     std::atomic<uint64_t> usedMemory;
     // Amount of memory used which cannot be evicted
     std::atomic<uint64_t> nonEvictableMemory;
+    ShardedCounters<BufferPoolCounter> counters;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
     // hold two sizes of REGULAR_PAGE and TEMP_PAGE.
     std::vector<std::unique_ptr<VMRegion>> vmRegions;
     std::vector<std::unique_ptr<FileHandle>> fileHandles;
+    // Guards adding file handles against reading the counters of all of them.
+    std::mutex fileHandlesMtx;
     std::unique_ptr<Spiller> spiller;
     common::VirtualFileSystem* vfs;
+    std::unique_ptr<PagePrefetcher> prefetcher;
 };
 
 } // namespace storage
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storage/buffer_manager/buffer_manager.h"
+
+namespace kuzu {
+namespace storage {
+
+// Reads prefetched pages into their frames on a background thread, so that scans keep processing
+// the pages they have while the next ones are read. The scanning thread locks the pages and
+// reserves their frames before submitting them, so threads accessing them in the meantime wait
+// for the read to complete, as they would for a page being read by a pin. Pages whose read fails
+// are evicted again, and the error is reported to the next thread reading them.
+class PagePrefetcher {
+public:
+    explicit PagePrefetcher(BufferManager& bufferManager) : bufferManager{bufferManager} {}
+    // Completes all submitted reads, so that no page is left locked.
+    ~PagePrefetcher();
+
+    void submit(FileHandle& fileHandle, std::vector<BufferManager::PageRun> runs);
+    void waitForAll();
+
+private:
+    void run();
+
+private:
+    struct Task {
+        FileHandle* fileHandle;
+        std::vector<BufferManager::PageRun> runs;
+    };
+
+    BufferManager& bufferManager;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<Task> tasks;
+    bool isRunningTask = false;
+    bool stopped = false;
+    // Started by the first submission, so that databases which never read from disk don't have it.
+    std::thread thread;
+};
+
+} // namespace storage
+} // namespace kuzu
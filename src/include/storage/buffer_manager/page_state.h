@@ -19,6 +19,9 @@ public:
     static constexpr uint64_t LOCKED = 1;
     static constexpr uint64_t MARKED = 2;
     static constexpr uint64_t EVICTED = 3;
+    // Set when a cached page is accessed again other than by a scan. Used by the eviction policy to
+    // tell reused pages from pages that are only read by scans. Cleared when the page is marked.
+    static constexpr uint64_t REACCESSED_MASK = 0x0040000000000000;
 
     PageState() { stateAndVersion.store(EVICTED << NUM_BITS_TO_SHIFT_FOR_STATE); }
 
@@ -49,6 +52,12 @@ public:
         // KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
         stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), UNLOCKED));
     }
+    // Unlocks the page without incrementing its version. Only for callers that locked the page in
+    // the given state and did not change its content.
+    void unlockWithSameVersion(uint64_t oldStateAndVersion) {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion.store(updateStateWithSameVersion(oldStateAndVersion, UNLOCKED));
+    }
     // Change page state from Mark to Unlocked.
     bool tryClearMark(uint64_t oldStateAndVersion) {
         KU_ASSERT(getState(oldStateAndVersion) == MARKED);
@@ -57,7 +66,7 @@ public:
     }
     bool tryMark(uint64_t oldStateAndVersion) {
         return stateAndVersion.compare_exchange_strong(oldStateAndVersion,
-            updateStateWithSameVersion(oldStateAndVersion, MARKED));
+            updateStateWithSameVersion(oldStateAndVersion, MARKED) & ~REACCESSED_MASK);
     }
 
     void setDirty() {
@@ -72,6 +81,17 @@ public:
     // Should not be used if other threads are modifying the page state
     void clearDirtyWithoutLock() { stateAndVersion &= ~DIRTY_MASK; }
     bool isDirty() const { return stateAndVersion & DIRTY_MASK; }
+    void setReaccessed() {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion |= REACCESSED_MASK;
+    }
+    // Sets the reaccessed flag of an unlocked page. Fails if the page state has changed.
+    bool trySetReaccessed(uint64_t oldStateAndVersion) {
+        KU_ASSERT(getState(oldStateAndVersion) == UNLOCKED);
+        return stateAndVersion.compare_exchange_strong(oldStateAndVersion,
+            oldStateAndVersion | REACCESSED_MASK);
+    }
+    static bool isReaccessed(uint64_t stateAndVersion) { return stateAndVersion & REACCESSED_MASK; }
     uint64_t getStateAndVersion() const { return stateAndVersion.load(); }
 
     void resetToEvicted() { stateAndVersion.store(EVICTED << NUM_BITS_TO_SHIFT_FOR_STATE); }
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// Event counters for hot paths of the buffer manager. Each thread adds to the counters of its own
+// cache-line aligned shard, so that counting does not make threads contend on a cache line, and a
+// counter is read by summing it up over all shards. Since counters wrap around, a value added by
+// one thread and subtracted by another still sums up correctly. Reads racing with updates are only
+// approximate.
+// COUNTER is an enum class whose last value is NUM_COUNTERS.
+template<typename COUNTER>
+class ShardedCounters {
+    static constexpr uint64_t NUM_SHARDS = 32;
+    static constexpr auto NUM_COUNTERS = static_cast<uint64_t>(COUNTER::NUM_COUNTERS);
+
+public:
+    void add(COUNTER counter, uint64_t value = 1) {
+        shards[getShardIdx()].values[static_cast<uint64_t>(counter)].fetch_add(value,
+            std::memory_order_relaxed);
+    }
+    void subtract(COUNTER counter, uint64_t value = 1) {
+        shards[getShardIdx()].values[static_cast<uint64_t>(counter)].fetch_sub(value,
+            std::memory_order_relaxed);
+    }
+
+    uint64_t get(COUNTER counter) const {
+        uint64_t result = 0;
+        for (auto& shard : shards) {
+            result += shard.values[static_cast<uint64_t>(counter)].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+private:
+    // Threads are assigned to shards round-robin when they first count anything.
+    static uint64_t getShardIdx() {
+        static std::atomic<uint64_t> nextShardIdx{0};
+        thread_local const uint64_t shardIdx =
+            nextShardIdx.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+        return shardIdx;
+    }
+
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, NUM_COUNTERS> values{};
+    };
+
+    std::array<Shard, NUM_SHARDS> shards{};
+};
+
+} // namespace storage
+} // namespace kuzu
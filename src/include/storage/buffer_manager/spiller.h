@@ -21,17 +21,27 @@ public:
     void clearUnusedChunk(ChunkedNodeGroup* nodeGroup);
     uint64_t spillToDisk(ColumnChunkData& chunk) const;
     void loadFromDisk(ColumnChunkData& chunk) const;
+    // Appends a buffer to the end of the file and returns the position it was written at.
+    uint64_t spillToDisk(const uint8_t* data, uint64_t size) const;
+    void loadFromDisk(uint8_t* data, uint64_t size, uint64_t filePosition) const;
     // reclaims memory from the next full partitioner group in the set
     // and returns the amount of memory reclaimed
     // If the set is empty, returns zero
     uint64_t claimNextGroup();
-    // Must only be used once all chunks have been loaded from disk.
+    // Spilled data which must outlive the query that cleared the file (e.g. the partitions of a
+    // concurrently running hash join) retains the file until it is no longer needed.
+    void retainFile();
+    void releaseFile();
+    // Must only be used once all chunks have been loaded from disk. Does nothing while the file is
+    // retained.
     void clearFile();
     ~Spiller();
 
 private:
     std::mutex partitionerGroupsMtx;
     std::unordered_set<ChunkedNodeGroup*> fullPartitionerGroups;
+    std::mutex fileMtx;
+    uint64_t numFileRetainers;
     FileHandle* dataFH;
 };
 
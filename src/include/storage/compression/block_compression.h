@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "storage/compression/compression.h"
+
+namespace kuzu::storage {
+
+// General purpose compression (LZ4 or ZSTD) for byte data such as string payloads, which the
+// lightweight compression schemes don't work on.
+//
+// Data is split into independently compressed blocks of BLOCK_SIZE uncompressed bytes (the last
+// block may be shorter), so that a range of the data can be read without decompressing all of it.
+// The compressed layout starts with a header storing the end offset of each compressed block
+// (relative to the end of the header), followed by the compressed blocks.
+struct BlockCompression {
+    static constexpr uint64_t BLOCK_SIZE = 16 * 1024;
+    // Data is only kept compressed if it shrinks by at least this factor.
+    static constexpr double MIN_COMPRESSION_RATIO = 1.2;
+    // LZ4 decompresses several times faster than ZSTD, so ZSTD is only picked if its output is
+    // smaller than LZ4's by at least this factor.
+    static constexpr double MIN_ZSTD_GAIN = 1.1;
+    // Number of blocks compressed with both codecs to choose the codec for a chunk.
+    static constexpr uint64_t NUM_SAMPLE_BLOCKS = 4;
+
+    struct CompressedData {
+        CompressionType compression;
+        std::vector<uint8_t> data;
+    };
+
+    static bool isBlockCompression(CompressionType compression) {
+        return compression == CompressionType::LZ4 || compression == CompressionType::ZSTD;
+    }
+
+    static uint64_t getNumBlocks(uint64_t numBytes) {
+        return (numBytes + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    }
+    static uint64_t getHeaderSize(uint64_t numBytes) {
+        return getNumBlocks(numBytes) * sizeof(uint64_t);
+    }
+    static uint64_t getBlockSize(uint64_t numBytes, uint64_t blockIdx) {
+        return std::min(BLOCK_SIZE, numBytes - blockIdx * BLOCK_SIZE);
+    }
+
+    // Compresses the data into the block layout with the codec which compresses a sample of its
+    // blocks best. Returns nullopt if compression does not save enough space to be worth it.
+    static std::optional<CompressedData> compress(std::span<const uint8_t> data);
+    // Compresses a single value (e.g. a long string) as one block with the codec which compresses
+    // it best. Returns nullopt if compression does not save enough space to be worth it.
+    static std::optional<CompressedData> compressValue(std::span<const uint8_t> data);
+
+    // Decompresses one compressed block (or value) into dst, which must have exactly the
+    // uncompressed size of the block.
+    static void decompressBlock(CompressionType compression, std::span<const uint8_t> src,
+        std::span<uint8_t> dst);
+};
+
+} // namespace kuzu::storage
@@ -110,6 +110,9 @@ enum class CompressionType : uint8_t {
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
     ALP = 4,
+    // General purpose block compression of byte data (see BlockCompression)
+    LZ4 = 5,
+    ZSTD = 6,
 };
 
 struct ExtraMetadata {
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// How a page is read. The buffer manager counts RANDOM reads of cached pages as reuses, which
+// protect the page from eviction, while SCAN reads, which usually touch each page only for a
+// short while, don't.
+enum class PageAccessPattern : uint8_t { RANDOM = 0, SCAN = 1 };
+
+} // namespace storage
+} // namespace kuzu
@@ -14,7 +14,9 @@
 #include "common/file_system/file_info.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/page_state.h"
+#include "storage/buffer_manager/sharded_counters.h"
 #include "storage/buffer_manager/vm_region.h"
+#include "storage/enums/page_access_pattern.h"
 #include "storage/enums/page_read_policy.h"
 
 namespace kuzu {
@@ -37,6 +39,9 @@ namespace storage {
 
 class ShadowFile;
 class BufferManager;
+
+enum class FileIOCounter : uint8_t { BYTES_READ = 0, BYTES_WRITTEN = 1, NUM_COUNTERS = 2 };
+
 class FileHandle {
 public:
     friend class BufferManager;
@@ -63,9 +68,13 @@ public:
 
     uint8_t* pinPage(common::page_idx_t pageIdx, PageReadPolicy readPolicy);
     void optimisticReadPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readOp);
+        const std::function<void(uint8_t*)>& readOp,
+        PageAccessPattern accessPattern = PageAccessPattern::RANDOM);
     // The function assumes that the requested page is already pinned.
     void unpinPage(common::page_idx_t pageIdx);
+    // Hints that [startPageIdx, startPageIdx + numPages) is about to be read. Evicted pages in the
+    // range are read into their frames with as few reads as possible.
+    void prefetchPages(common::page_idx_t startPageIdx, common::page_idx_t numPages);
 
     // This function assumes the page is already LOCKED.
     void setLockedPageDirty(common::page_idx_t pageIdx) {
@@ -86,7 +95,17 @@ public:
     void readPageFromDisk(uint8_t* frame, common::page_idx_t pageIdx) const {
         KU_ASSERT(!isInMemoryMode());
         KU_ASSERT(pageIdx < numPages);
-        fileInfo->readFromFile(frame, getPageSize(), pageIdx * getPageSize());
+        readFromFile(frame, getPageSize(), pageIdx * getPageSize());
+    }
+    void readPagesFromDisk(uint8_t* frames, common::page_idx_t startPageIdx,
+        common::page_idx_t numPagesToRead) const {
+        KU_ASSERT(!isInMemoryMode());
+        KU_ASSERT(startPageIdx + numPagesToRead <= numPages);
+        readFromFile(frames, numPagesToRead * getPageSize(), startPageIdx * getPageSize());
+    }
+    void readFromFile(uint8_t* buffer, uint64_t numBytes, uint64_t position) const {
+        fileInfo->readFromFile(buffer, numBytes, position);
+        ioCounters.add(FileIOCounter::BYTES_READ, numBytes);
     }
     void writePageToFile(const uint8_t* buffer, common::page_idx_t pageIdx) {
         KU_ASSERT(pageIdx < numPages);
@@ -98,6 +117,7 @@ public:
             memcpy(frame, buffer, size);
         } else {
             fileInfo->writeFile(buffer, size, startPageIdx * getPageSize());
+            ioCounters.add(FileIOCounter::BYTES_WRITTEN, size);
         }
     }
 
@@ -110,6 +130,10 @@ public:
         return isLargePaged() ? common::TEMP_PAGE_SIZE : common::PAGE_SIZE;
     }
 
+    // Bytes read from and written to the file through this handle.
+    uint64_t getNumBytesRead() const { return ioCounters.get(FileIOCounter::BYTES_READ); }
+    uint64_t getNumBytesWritten() const { return ioCounters.get(FileIOCounter::BYTES_WRITTEN); }
+
 private:
     bool isLargePaged() const { return flags & isLargePagedMask; }
     bool isNewTmpFile() const { return flags & isNewInMemoryTmpFileMask; }
@@ -163,6 +187,7 @@ private:
     // and left at the default which won't increase access cost for the frame groups until 16TB of
     // data has been written
     common::ConcurrentVector<common::page_group_idx_t> frameGroupIdxes;
+    mutable ShardedCounters<FileIOCounter> ioCounters;
 };
 
 } // namespace storage
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <functional>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class ValueVector;
+} // namespace common
+
+namespace storage {
+
+// Calls `func` with batches of keys and node IDs of the nodes in a node group visible to the
+// checkpoint. Null keys are included.
+using index_scan_func_t = std::function<void(const common::ValueVector& keyVector,
+    const common::ValueVector& nodeIDVector)>;
+using node_group_scanner_t =
+    std::function<void(common::node_group_idx_t nodeGroupIdx, const index_scan_func_t& func)>;
+
+// Secondary index on a column of a node table. NodeTable feeds indexes with the values of
+// committed nodes, and tells them about updated and deleted nodes. Indexes which are not persisted
+// are rebuilt when the table is loaded.
+class ColumnIndex {
+public:
+    virtual ~ColumnIndex() = default;
+
+    // Inserts the key at each selected position of `keyVector`, paired with the node offset at the
+    // same position of `nodeIDVector`. Null keys are skipped.
+    virtual void insert(const common::ValueVector& keyVector,
+        const common::ValueVector& nodeIDVector) = 0;
+    virtual void insert(const common::ValueVector& keyVector, common::sel_t pos,
+        common::offset_t offset) = 0;
+    // The indexed value of the node may have changed or the node may have been deleted.
+    virtual void markStale(common::offset_t /*offset*/) {}
+
+    // Called by the table checkpoint, with a scanner of the checkpointed values of the column.
+    virtual void checkpoint(const node_group_scanner_t& /*scanNodeGroup*/) {}
+
+    virtual uint64_t getNumEntries() const = 0;
+};
+
+} // namespace storage
+} // namespace kuzu
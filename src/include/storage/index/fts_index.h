@@ -0,0 +1,143 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "storage/index/column_index.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+class FileHandle;
+class ShadowFile;
+struct FTSDiskArrays;
+
+struct FTSIndexConstants {
+    // BM25 term frequency saturation and document length normalization.
+    static constexpr double K1 = 1.2;
+    static constexpr double B = 0.75;
+    // Number of offsets in each bitpacked block of a postings list.
+    static constexpr uint64_t POSTINGS_BLOCK_SIZE = 128;
+};
+
+// Splits text into lower-cased terms at every ASCII character that is not a letter or a digit,
+// drops English stop words and reduces the remaining terms to their stem. Bytes of non-ASCII
+// UTF-8 characters are kept as part of terms.
+struct FTSTokenizer {
+    static std::vector<std::string> tokenize(std::string_view text);
+    // The Porter stemmer.
+    static std::string stem(std::string term);
+};
+
+// Statistics of the indexed documents used to rank the matches of a query with BM25.
+struct FTSQueryStatistics {
+    uint64_t numDocs;
+    double avgDocLength;
+    // Inverse document frequency of each query term.
+    std::vector<double> idfs;
+};
+
+// Inverted index from the terms of a STRING property to the offsets of the nodes containing them.
+//
+// The index as of the last checkpoint is stored in disk arrays in the data file: the term
+// dictionary, which is also kept in memory, the postings lists of the terms, read through the
+// buffer manager when queried, and the length of each document. Postings lists are sorted and
+// split into blocks of offset deltas encoded with the bitpacking of `storage/compression`.
+// Postings of nodes inserted or updated since the last checkpoint are kept in memory, and the
+// WAL restores them after a crash.
+//
+// Like PropertyIndex, the index is a candidate generator: an update indexes the new text of a node
+// next to its old one until the next checkpoint, which rescans the node groups changed since the
+// previous one. Consumers must re-check the visible text of each candidate. The document count
+// and lengths follow committed updates and deletes, and are recomputed for rolled back changes at
+// the next checkpoint.
+class FTSIndex final : public ColumnIndex {
+public:
+    FTSIndex(FileHandle& dataFH, ShadowFile& shadowFile, common::Deserializer* deSer = nullptr);
+    ~FTSIndex() override;
+
+    static bool isSupportedType(const common::LogicalType& type);
+    // Fills the inverse document frequencies of the statistics from the number of documents
+    // containing each query term.
+    static void computeIDFs(FTSQueryStatistics& statistics,
+        const std::vector<uint64_t>& docFrequencies);
+    static double computeBM25(const FTSQueryStatistics& statistics,
+        const std::vector<uint64_t>& termFrequencies, uint64_t docLength);
+
+    void insert(const common::ValueVector& keyVector,
+        const common::ValueVector& nodeIDVector) override;
+    void insert(const common::ValueVector& keyVector, common::sel_t pos,
+        common::offset_t offset) override;
+    void markStale(common::offset_t offset) override;
+
+    // Returns the sorted offsets of the nodes that contained at least one of `terms` when indexed.
+    std::vector<common::offset_t> search(const std::vector<std::string>& terms) const;
+    // Returns the document count and average length. Document frequencies are left to the caller,
+    // which counts them over the visible matches.
+    FTSQueryStatistics getStatistics() const;
+
+    void checkpoint(const node_group_scanner_t& scanNodeGroup) override;
+    void serialize(common::Serializer& serializer) const;
+
+    uint64_t getNumEntries() const override;
+
+private:
+    class PostingsList {
+    public:
+        void append(common::offset_t offset);
+        void scan(std::vector<common::offset_t>& result) const;
+
+    private:
+        // Frame of reference encoding: offsets are stored as their difference to the smallest
+        // offset of the block, packed with the bit width of the largest difference.
+        struct Block {
+            common::offset_t base;
+            uint16_t bitWidth;
+            std::vector<uint32_t> data;
+        };
+
+        void compressTail();
+
+        std::vector<Block> blocks;
+        std::vector<common::offset_t> tail;
+    };
+
+    // Location of the checkpointed postings list of a term.
+    struct TermInfo {
+        uint64_t postingsStart;
+        uint64_t postingsSize;
+    };
+
+    void insertNoLock(std::string_view text, common::offset_t offset);
+    void setDocLengthNoLock(common::offset_t offset, uint32_t docLength);
+    uint32_t getDocLengthNoLock(common::offset_t offset) const;
+    void scanCheckpointedPostings(const TermInfo& termInfo,
+        std::vector<common::offset_t>& result) const;
+    void loadDictionary();
+
+private:
+    std::unique_ptr<FTSDiskArrays> diskArrays;
+    std::unordered_map<std::string, TermInfo> dictionary;
+    // Postings of the documents indexed since the last checkpoint.
+    std::unordered_map<std::string, PostingsList> postings;
+    // Lengths of the documents changed since the last checkpoint.
+    std::unordered_map<common::offset_t, uint32_t> changedDocLengths;
+    std::unordered_set<common::node_group_idx_t> staleNodeGroups;
+    uint64_t numDictionaryBytes;
+    uint64_t numDocs;
+    uint64_t totalDocLength;
+    mutable std::shared_mutex mtx;
+};
+
+} // namespace storage
+} // namespace kuzu
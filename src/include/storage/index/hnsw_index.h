@@ -0,0 +1,171 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/enums/vector_distance_metric.h"
+#include "common/random_engine.h"
+#include "storage/index/column_index.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+class FileHandle;
+class MemoryBuffer;
+class MemoryManager;
+class ShadowFile;
+struct HNSWDiskArrays;
+
+struct HNSWIndexConstants {
+    // Maximum number of neighbors of an element on the upper layers. Layer 0 holds the most
+    // elements and keeps twice as many.
+    static constexpr uint64_t MAX_DEGREE = 16;
+    // Size of the candidate list when searching for the neighbors of a new element.
+    static constexpr uint64_t EF_CONSTRUCTION = 128;
+    // Default size of the candidate list when searching for the nearest neighbors of a query.
+    static constexpr uint64_t DEFAULT_EF_SEARCH = 64;
+};
+
+struct VectorSearchResult {
+    common::offset_t offset;
+    double distance;
+};
+
+// Approximate nearest neighbor index over a FLOAT[n] or DOUBLE[n] property, implemented as a
+// hierarchical navigable small world (HNSW) graph.
+//
+// The graph as of the last checkpoint is stored in disk arrays in the data file and read through
+// the buffer manager: the vectors, the neighbor lists of each layer, and a record per element,
+// which are also kept in memory. Elements inserted and neighbor lists changed since the last
+// checkpoint are kept in memory, with the vectors of new elements in blocks allocated from the
+// buffer manager. A checkpoint writes them to the disk arrays through the shadow file, and the
+// WAL restores them after a crash.
+//
+// An update inserts the new vector of a node next to its old one. Consumers must re-check the
+// visible vector of each candidate. A checkpoint compares the elements of the node groups changed
+// since the previous one with the checkpointed vectors, and tombstones the elements of deleted
+// nodes, old vectors and rolled back changes. Tombstoned elements still route searches but are
+// never returned.
+class HNSWIndex final : public ColumnIndex {
+public:
+    HNSWIndex(const common::LogicalType& keyType, common::VectorDistanceMetric metric,
+        MemoryManager* memoryManager, FileHandle& dataFH, ShadowFile& shadowFile,
+        common::Deserializer* deSer = nullptr);
+    ~HNSWIndex() override;
+
+    static bool isSupportedType(const common::LogicalType& type);
+    // Distance reported by the index. L2 is the euclidean distance, COSINE is one minus the cosine
+    // similarity, and INNER_PRODUCT is the negated inner product, so smaller is always closer.
+    static double computeDistance(common::VectorDistanceMetric metric, const float* left,
+        const float* right, uint64_t dimension);
+    // Copies the array at `pos` of `keyVector` into `result` as floats. Returns false if any
+    // element is null.
+    static bool readVector(const common::ValueVector& keyVector, common::sel_t pos, float* result);
+
+    void insert(const common::ValueVector& keyVector,
+        const common::ValueVector& nodeIDVector) override;
+    void insert(const common::ValueVector& keyVector, common::sel_t pos,
+        common::offset_t offset) override;
+    void markStale(common::offset_t offset) override;
+
+    // Returns up to `efSearch` candidates, nearest first, with distances computed on the indexed
+    // vectors. An offset can be returned more than once if its vector has been updated.
+    std::vector<VectorSearchResult> search(std::span<const float> query,
+        uint64_t efSearch) const;
+
+    void checkpoint(const node_group_scanner_t& scanNodeGroup) override;
+    void serialize(common::Serializer& serializer) const;
+
+    common::VectorDistanceMetric getMetric() const { return metric; }
+    uint64_t getDimension() const { return dimension; }
+    // Number of elements which are not tombstoned.
+    uint64_t getNumEntries() const override;
+    // Upper bound on the number of candidates returned by a search which are not visible to
+    // transactions started after the last checkpoint, or whose vector is outdated.
+    uint64_t getNumPendingChanges() const;
+
+private:
+    using element_idx_t = uint32_t;
+    // Distance used to navigate the graph. It ranks the elements like `computeDistance`, but is
+    // cheaper: cosine vectors are normalized on insertion and L2 distances are not square rooted.
+    using candidate_t = std::pair<float, element_idx_t>;
+
+    struct Element {
+        common::offset_t offset;
+        // Index of the neighbor list of layer 1 in the disk array of upper layer lists. The lists
+        // of the upper layers of an element are consecutive.
+        uint32_t upperNeighborsIdx;
+        uint8_t layer;
+        bool deleted;
+    };
+
+    void insertNoLock(const float* vector, common::offset_t offset);
+    // Returns the vector of an element inserted since the last checkpoint.
+    float* getNewVector(element_idx_t elementIdx) const;
+    // Vectors of elements not checkpointed yet are returned from memory. Others are read into
+    // `buffer`, which must hold `dimension` floats.
+    const float* getVector(element_idx_t elementIdx, float* buffer) const;
+    // Returns the neighbors of the element on the layer, read into `buffer` unless changed since
+    // the last checkpoint.
+    const std::vector<element_idx_t>& getNeighbors(element_idx_t elementIdx, uint64_t layer,
+        std::vector<element_idx_t>& buffer) const;
+    std::vector<element_idx_t>& getNeighborsToUpdate(element_idx_t elementIdx, uint64_t layer);
+    static uint64_t getNeighborsKey(element_idx_t elementIdx, uint64_t layer);
+    float computeGraphDistance(const float* left, const float* right) const;
+    uint64_t getMaxDegree(uint64_t layer) const {
+        return layer == 0 ? 2 * HNSWIndexConstants::MAX_DEGREE : HNSWIndexConstants::MAX_DEGREE;
+    }
+    uint64_t getRandomLayer();
+
+    void validateNodeGroups(const node_group_scanner_t& scanNodeGroup);
+    void writeToDisk();
+
+    element_idx_t searchLayerGreedy(const float* query, element_idx_t entryPoint,
+        uint64_t layer) const;
+    // Returns the `ef` nearest elements found on `layer`, nearest first. Tombstoned elements are
+    // traversed but not returned if `skipDeleted` is set.
+    std::vector<candidate_t> searchLayer(const float* query,
+        const std::vector<candidate_t>& entryPoints, uint64_t ef, uint64_t layer,
+        bool skipDeleted = false) const;
+    // Keeps at most `maxDegree` of the sorted candidates, preferring ones that are closer to the
+    // element than to any neighbor already kept, so that neighbors cover different directions.
+    std::vector<element_idx_t> selectNeighbors(const std::vector<candidate_t>& candidates,
+        uint64_t maxDegree) const;
+    void addNeighbor(element_idx_t elementIdx, element_idx_t neighborIdx, uint64_t layer);
+
+private:
+    common::VectorDistanceMetric metric;
+    uint64_t dimension;
+    MemoryManager* memoryManager;
+    std::unique_ptr<HNSWDiskArrays> diskArrays;
+    // Elements up to this index are stored on disk.
+    element_idx_t numCheckpointedElements;
+    std::vector<Element> elements;
+    uint64_t numDeletedElements;
+    // Vectors of the elements inserted since the last checkpoint.
+    uint64_t numVectorsPerBlock;
+    std::vector<std::unique_ptr<MemoryBuffer>> vectorBlocks;
+    // Neighbor lists changed since the last checkpoint, including all lists of new elements.
+    std::unordered_map<uint64_t, std::vector<element_idx_t>> changedNeighbors;
+    // Checkpointed elements tombstoned since the last checkpoint.
+    std::vector<element_idx_t> newlyDeletedElements;
+    uint64_t numUpperNeighborLists;
+    std::unordered_set<common::node_group_idx_t> staleNodeGroups;
+    uint64_t numPendingChanges;
+    element_idx_t entryPoint;
+    uint64_t maxLayer;
+    common::RandomEngine randomEngine;
+    mutable std::shared_mutex mtx;
+};
+
+} // namespace storage
+} // namespace kuzu
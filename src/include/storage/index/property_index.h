@@ -0,0 +1,65 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "storage/index/column_index.h"
+#include "storage/predicate/constant_predicate.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+class FileHandle;
+class ShadowFile;
+class PropertyIndexStorage;
+
+// Ordered secondary index from the values of a node property to the offsets of the nodes holding
+// them. The index is a candidate generator, not a source of truth: consumers must re-evaluate the
+// predicate on the visible version of each candidate.
+//
+// The entries as of the last checkpoint are stored as a sorted run in a disk array in the data
+// file, whose header is serialized with the table. Entries of nodes inserted or updated since are
+// kept in memory, and lookups merge both. Old values of updated nodes, deleted nodes and rolled
+// back changes stay candidates until the next checkpoint, which rescans the node groups changed
+// since the previous one and rewrites the run in place through the shadow file. Changes since the
+// last checkpoint are restored by replaying the WAL.
+//
+// STRING keys are indexed by a fixed-length prefix, so all strings sharing it are candidates for
+// each other. FLOAT and DOUBLE keys are ordered with NaN after all other values.
+class PropertyIndex final : public ColumnIndex {
+public:
+    PropertyIndex(const common::LogicalType& keyType, FileHandle& dataFH, ShadowFile& shadowFile,
+        common::Deserializer* deSer = nullptr);
+    ~PropertyIndex() override;
+
+    static bool isSupportedType(const common::LogicalType& type);
+
+    void insert(const common::ValueVector& keyVector,
+        const common::ValueVector& nodeIDVector) override;
+    void insert(const common::ValueVector& keyVector, common::sel_t pos,
+        common::offset_t offset) override;
+    void markStale(common::offset_t offset) override;
+
+    // Calls `func` for the offset of every entry whose key satisfies all `predicates`.
+    // Only EQUALS and range comparisons narrow the lookup. Other predicates are ignored.
+    void lookup(const std::vector<ColumnConstantPredicate>& predicates,
+        const std::function<void(common::offset_t)>& func) const;
+
+    void checkpoint(const node_group_scanner_t& scanNodeGroup) override;
+    void serialize(common::Serializer& serializer) const;
+
+    uint64_t getNumEntries() const override;
+
+private:
+    std::unique_ptr<PropertyIndexStorage> storage;
+    mutable std::mutex mtx;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -22,6 +22,9 @@ public:
         return std::make_unique<ColumnConstantPredicate>(columnName, expressionType, value);
     }
 
+    common::ExpressionType getExpressionType() const { return expressionType; }
+    const common::Value& getValue() const { return value; }
+
 private:
     common::ExpressionType expressionType;
     common::Value value;
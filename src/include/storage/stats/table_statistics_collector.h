@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catalog/table_statistics.h"
+#include "common/hyper_log_log.h"
+#include "common/random_engine.h"
+#include "common/vector/value_vector.h"
+
+namespace kuzu {
+namespace catalog {
+class TableCatalogEntry;
+} // namespace catalog
+
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace storage {
+
+class MemoryManager;
+class StorageManager;
+
+// Collects the statistics of a property from batches of its values. Distinct values are counted
+// on all of them, while the histogram is built from a fixed-size uniform sample. Collectors which
+// don't build a histogram can be merged, so that each thread of a COPY can use its own one.
+class ColumnStatisticsCollector {
+    static constexpr uint64_t SAMPLE_SIZE = 16384;
+    static constexpr uint64_t NUM_HISTOGRAM_BUCKETS = 64;
+
+public:
+    ColumnStatisticsCollector(const common::LogicalType& type, MemoryManager* memoryManager,
+        bool buildHistogram);
+
+    void update(const common::ValueVector& vector);
+    void merge(const ColumnStatisticsCollector& other);
+    catalog::ColumnStatistics finalize();
+
+private:
+    // Reservoir sampling.
+    void addToSample(double value);
+
+private:
+    catalog::ColumnStatistics statistics;
+    common::HyperLogLog hyperLogLog;
+    bool buildHistogram;
+    double min;
+    double max;
+    uint64_t numSampledValues = 0;
+    std::vector<double> sample;
+    common::ValueVector hashVector;
+    common::RandomEngine randomEngine;
+};
+
+// Collects the statistics of a node or rel table. ANALYZE and checkpoints scan the whole table
+// with `collect`. COPY into an empty table feeds a collector without histograms with the values
+// it loads instead, so that freshly loaded tables don't need to be scanned again.
+class TableStatisticsCollector {
+public:
+    TableStatisticsCollector(const catalog::TableCatalogEntry& entry,
+        MemoryManager* memoryManager, bool buildHistograms);
+
+    // The internal rel id is unique and never filtered on, so it is not collected.
+    const std::vector<std::string>& getPropertyNames() const { return propertyNames; }
+    const std::vector<common::column_id_t>& getColumnIDs() const { return columnIDs; }
+
+    void update(common::idx_t propertyIdx, const common::ValueVector& vector) {
+        columnCollectors[propertyIdx]->update(vector);
+    }
+    // Adds a bound node with `degree` rels in the given direction.
+    void addDegree(common::RelDataDirection direction, uint64_t degree);
+    void merge(const TableStatisticsCollector& other);
+    catalog::TableStatistics finalize(uint64_t numRows);
+
+    // Scans the committed rows of the table visible to `transaction`.
+    static catalog::TableStatistics collect(transaction::Transaction* transaction,
+        MemoryManager* memoryManager, StorageManager& storageManager,
+        const catalog::TableCatalogEntry& entry);
+
+private:
+    uint64_t scanNodeTable(transaction::Transaction* transaction, StorageManager& storageManager,
+        const catalog::TableCatalogEntry& entry);
+    // Scans the rels of every bound node in the given direction to collect the degree
+    // distribution, together with the statistics of the properties if `scanProperties` is set.
+    void scanRelTable(transaction::Transaction* transaction, StorageManager& storageManager,
+        const catalog::TableCatalogEntry& entry, common::RelDataDirection direction,
+        bool scanProperties);
+
+private:
+    MemoryManager* memoryManager;
+    std::vector<std::string> propertyNames;
+    std::vector<common::column_id_t> columnIDs;
+    std::vector<std::unique_ptr<ColumnStatisticsCollector>> columnCollectors;
+    catalog::DegreeStatistics fwdDegrees;
+    catalog::DegreeStatistics bwdDegrees;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -17,6 +17,10 @@ class Table;
 class DiskArrayCollection;
 
 class StorageManager {
+    // Statistics of a table are collected again at a checkpoint once its number of rows changed by
+    // more than this fraction since they were last collected.
+    static constexpr double STATISTICS_REFRESH_RATIO = 0.2;
+
 public:
     StorageManager(const std::string& databasePath, bool readOnly, const catalog::Catalog& catalog,
         MemoryManager& memoryManager, bool enableCompression, common::VirtualFileSystem* vfs,
@@ -28,6 +32,10 @@ public:
     void createTable(common::table_id_t tableID, const catalog::Catalog* catalog,
         main::ClientContext* context);
 
+    // Flushes committed in-memory data of all tables to new pages of the data file, without
+    // blocking transactions. The following checkpoint reuses the flushed data for the node groups
+    // which were not changed in between.
+    void preCheckpoint();
     void checkpoint(main::ClientContext& clientContext);
 
     PrimaryKeyIndex* getPKIndex(common::table_id_t tableID);
@@ -62,6 +70,11 @@ private:
     void createRdfGraph(common::table_id_t tableID, catalog::RDFGraphCatalogEntry* tableSchema,
         const catalog::Catalog* catalog, main::ClientContext* context);
 
+    // Collects the statistics of tables with rows but no statistics, and of tables which changed
+    // too much since their statistics were collected. The statistics are set on the catalog
+    // entries in place, which the following catalog checkpoint persists.
+    void refreshStatistics(main::ClientContext& clientContext);
+
 private:
     std::mutex mtx;
     std::string databasePath;
@@ -69,6 +82,9 @@ private:
     FileHandle* dataFH;
     FileHandle* metadataFH;
     std::unordered_map<common::table_id_t, std::unique_ptr<Table>> tables;
+    // Number of rows of each table when its statistics were last checked at a checkpoint. Tables
+    // whose statistics were collected before the database was loaded start from the first check.
+    std::unordered_map<common::table_id_t, common::row_idx_t> numRowsAtLastStatistics;
     MemoryManager& memoryManager;
     std::unique_ptr<WAL> wal;
     std::unique_ptr<ShadowFile> shadowFile;
@@ -51,13 +51,27 @@ private:
     uint8_t* addANewPage();
     void setStringOverflow(const char* inMemSrcStr, uint64_t len,
         common::ku_string_t& diskDstString);
+    // Writes the bytes at the next position to write to, continuing on new pages as needed.
+    void writeToPages(uint8_t*& pageToWrite, const uint8_t* data, uint64_t numBytes);
 
     void read(transaction::TransactionType trxType, common::page_idx_t pageIdx,
         const std::function<void(uint8_t*)>& func) const;
+    // Reads the bytes at the cursor, following the chain of pages, and moves the cursor past them.
+    void readFromPages(transaction::TransactionType trxType, PageCursor& cursor, uint8_t* result,
+        uint64_t numBytes) const;
+    void readCompressedString(transaction::TransactionType trxType, PageCursor& cursor,
+        uint8_t* result, uint64_t length) const;
 
 private:
     static constexpr common::page_idx_t END_OF_PAGE =
         common::PAGE_SIZE - sizeof(common::page_idx_t);
+    // Strings at least this long are compressed with LZ4 or ZSTD if that saves enough space.
+    // Compressed strings are stored as the compression type (1 byte) and the compressed size
+    // (4 bytes) followed by the compressed data, and flagged in the position within the page of
+    // the overflow pointer, which never uses its highest bit.
+    static constexpr uint64_t MIN_LENGTH_TO_COMPRESS = 128;
+    static constexpr uint32_t COMPRESSED_FLAG = 1u << 31;
+    static_assert(common::PAGE_SIZE < COMPRESSED_FLAG);
     // This is the index of the last free byte to which we can write.
     PageCursor& nextPosToWriteTo;
     OverflowFile& overflowFile;
@@ -97,6 +97,10 @@ public:
 
     bool hasUpdates() const;
     bool hasDeletions(const transaction::Transaction* transaction) const;
+    // Returns true if all rows were inserted by committed transactions and none of them has been
+    // updated (or deleted, unless allowed), so the in-memory data can't change anymore until the
+    // next checkpoint.
+    bool hasOnlyCommittedInsertions(bool allowDeletions);
     common::row_idx_t getNumUpdatedRows(const transaction::Transaction* transaction,
         common::column_id_t columnID);
 
@@ -176,6 +180,9 @@ protected:
     std::atomic<common::row_idx_t> numRows;
     std::vector<std::unique_ptr<ColumnChunk>> chunks;
     std::unique_ptr<VersionInfo> versionInfo;
+    // Serializes modifications of the version info and update info from concurrent write
+    // transactions.
+    std::mutex writeMtx;
     std::mutex spillToDiskMutex;
     // Used to track if the group may be in use and to verify that spillToDisk is only called when
     // it is safe to do so. If false, it is safe to spill the data to disk.
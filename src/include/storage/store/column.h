@@ -26,6 +26,7 @@ struct ColumnCheckpointState;
 class ShadowFile;
 class BufferManager;
 class Column {
+    friend class DictionaryColumn;
     friend class StringColumn;
     friend class StructColumn;
     friend class ListColumn;
@@ -88,6 +88,8 @@ public:
     bool hasUpdates() const { return updateInfo != nullptr; }
     bool hasUpdates(const transaction::Transaction* transaction, common::row_idx_t startRow,
         common::length_t numRows) const;
+    bool isUpdatedByOtherTransaction(const transaction::Transaction* transaction,
+        common::offset_t offsetInChunk) const;
     // These functions should only work on in-memory and temporary column chunks.
     void resetToEmpty() const { data->resetToEmpty(); }
     void resetToAllNull() const { data->resetToAllNull(); }
@@ -160,6 +160,10 @@ public:
 
     virtual void flush(FileHandle& dataFH);
 
+    // Flushes the data compressed as a whole with LZ4 or ZSTD, if that saves enough space. Only for
+    // UINT8 chunks storing string data, which lightweight compression doesn't work on.
+    void enableBlockCompression();
+
     ColumnChunkMetadata flushBuffer(FileHandle* dataFH, common::page_idx_t startPageIdx,
         const ColumnChunkMetadata& metadata) const;
 
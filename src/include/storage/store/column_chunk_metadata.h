@@ -1,6 +1,9 @@
 #pragma once
 
+#include <mutex>
+
 #include "common/types/types.h"
+#include "storage/compression/block_compression.h"
 #include "storage/compression/compression.h"
 
 namespace kuzu::storage {
@@ -66,6 +69,32 @@ public:
         uint64_t numValues, StorageValue min, StorageValue max);
 };
 
+// Data compressed when getting the metadata of a block compressed chunk, kept until the chunk is
+// flushed so that the data doesn't need to be compressed a second time.
+struct BlockCompressionCache {
+    std::mutex mtx;
+    const uint8_t* buffer = nullptr;
+    uint64_t numValues = 0;
+    std::optional<BlockCompression::CompressedData> compressedData;
+};
+
+// Compresses byte data with LZ4 or ZSTD (see BlockCompression) if that saves enough space, and
+// falls back to the metadata of the given compression otherwise.
+class GetBlockCompressionMetadata {
+    GetCompressionMetadata fallback;
+    std::shared_ptr<BlockCompressionCache> cache;
+
+public:
+    GetBlockCompressionMetadata(GetCompressionMetadata fallback,
+        std::shared_ptr<BlockCompressionCache> cache)
+        : fallback{std::move(fallback)}, cache{std::move(cache)} {}
+
+    GetBlockCompressionMetadata(const GetBlockCompressionMetadata& other) = default;
+
+    ColumnChunkMetadata operator()(std::span<const uint8_t> buffer, uint64_t capacity,
+        uint64_t numValues, StorageValue min, StorageValue max) const;
+};
+
 ColumnChunkMetadata uncompressedGetMetadata(std::span<const uint8_t> buffer, uint64_t capacity,
     uint64_t numValues, StorageValue min, StorageValue max);
 
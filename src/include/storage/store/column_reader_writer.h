@@ -79,7 +79,12 @@ public:
         common::offset_t numValues, const write_values_func_t& writeFunc) = 0;
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readFunc);
+        const std::function<void(uint8_t*)>& readFunc,
+        PageAccessPattern accessPattern = PageAccessPattern::RANDOM);
+    // Reads ahead the pages of the chunk starting from startPageIdx in the background, once the
+    // scan gets within half a prefetch window of the pages that are not cached.
+    void prefetchPages(transaction::Transaction* transaction, const ColumnChunkMetadata& metadata,
+        common::page_idx_t startPageIdx);
 
     void updatePageWithCursor(PageCursor cursor,
         const std::function<void(uint8_t*, common::offset_t)>& writeOp) const;
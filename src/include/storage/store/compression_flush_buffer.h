@@ -38,6 +38,21 @@ public:
         common::page_idx_t startPageIdx, const ColumnChunkMetadata& metadata) const;
 };
 
+// Flushes data with the metadata from GetBlockCompressionMetadata, writing the block compressed
+// data cached there if the metadata uses block compression.
+class BlockCompressedFlushBuffer {
+    std::shared_ptr<BlockCompressionCache> cache;
+
+public:
+    explicit BlockCompressedFlushBuffer(std::shared_ptr<BlockCompressionCache> cache)
+        : cache{std::move(cache)} {}
+
+    BlockCompressedFlushBuffer(const BlockCompressedFlushBuffer& other) = default;
+
+    ColumnChunkMetadata operator()(std::span<const uint8_t> buffer, FileHandle* dataFH,
+        common::page_idx_t startPageIdx, const ColumnChunkMetadata& metadata) const;
+};
+
 ColumnChunkMetadata uncompressedFlushBuffer(std::span<const uint8_t> buffer, FileHandle* dataFH,
     common::page_idx_t startPageIdx, const ColumnChunkMetadata& metadata);
 
@@ -218,6 +218,7 @@ public:
     void addColumn(transaction::Transaction* transaction, TableAddColumnState& addColumnState,
         FileHandle* dataFH) override;
 
+    void preCheckpoint(MemoryManager& memoryManager, FileHandle& dataFH) override;
     void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state) override;
 
     bool isEmpty() const override { return !persistentChunkGroup && NodeGroup::isEmpty(); }
@@ -225,6 +226,7 @@ public:
     ChunkedNodeGroup* getPersistentChunkedGroup() const { return persistentChunkGroup.get(); }
     void setPersistentChunkedGroup(std::unique_ptr<ChunkedNodeGroup> chunkedNodeGroup) {
         KU_ASSERT(chunkedNodeGroup->getFormat() == NodeGroupDataFormat::CSR);
+        const auto lock = chunkedGroups.lock();
         persistentChunkGroup = std::move(chunkedNodeGroup);
     }
 
@@ -255,7 +257,11 @@ private:
     NodeGroupScanResult scanCommittedInMemRandom(transaction::Transaction* transaction,
         const RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState);
 
-    void checkpointInMemOnly(const common::UniqLock& lock, NodeGroupCheckpointState& state);
+    void checkpointInMemOnly(const common::UniqLock& lock, NodeGroupCheckpointState& state,
+        std::unique_ptr<ChunkedNodeGroup> preCheckpointedChunkedGroup);
+    // Flushes the in-memory rels to new CSR chunks on disk. Returns nullptr if there are none.
+    std::unique_ptr<ChunkedNodeGroup> flushInMemOnly(const common::UniqLock& lock,
+        CSRNodeGroupCheckpointState& csrState);
     void checkpointInMemAndOnDisk(const common::UniqLock& lock, NodeGroupCheckpointState& state);
 
     void populateCSRLengthInMemOnly(const common::UniqLock& lock, common::offset_t numNodes,
@@ -7,6 +7,8 @@
 namespace kuzu {
 namespace storage {
 
+class BlockCompressedDataReader;
+
 class DictionaryColumn {
 public:
     DictionaryColumn(const std::string& name, FileHandle* dataFH, MemoryManager* mm,
@@ -35,9 +37,10 @@ private:
     void scanOffsets(transaction::Transaction* transaction, const ChunkState& state,
         DictionaryChunk::string_offset_t* offsets, uint64_t index, uint64_t numValues,
         uint64_t dataSize);
+    // The reader is only used (and must be given) if the data is block compressed.
     void scanValueToVector(transaction::Transaction* transaction, const ChunkState& dataState,
         uint64_t startOffset, uint64_t endOffset, common::ValueVector* resultVector,
-        uint64_t offsetInVector);
+        uint64_t offsetInVector, BlockCompressedDataReader* compressedDataReader);
 
     bool canDataCommitInPlace(const ChunkState& dataState, uint64_t totalStringLengthToAdd);
     bool canOffsetCommitInPlace(const ChunkState& offsetState, const ChunkState& dataState,
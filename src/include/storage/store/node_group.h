@@ -124,6 +124,9 @@ public:
     common::row_idx_t append(const transaction::Transaction* transaction,
         const std::vector<ColumnChunk*>& chunkedGroup, common::row_idx_t startRowIdx,
         common::row_idx_t numRowsToAppend);
+    common::row_idx_t append(const common::UniqLock& lock,
+        const transaction::Transaction* transaction, const std::vector<ColumnChunk*>& chunkedGroup,
+        common::row_idx_t startRowIdx, common::row_idx_t numRowsToAppend);
     void append(const transaction::Transaction* transaction,
         const std::vector<common::ValueVector*>& vectors, common::row_idx_t startRowIdx,
         common::row_idx_t numRowsToAppend);
@@ -150,6 +153,10 @@ public:
 
     void flush(transaction::Transaction* transaction, FileHandle& dataFH);
 
+    // Flushes in-memory data which can't change anymore before the next checkpoint to new pages,
+    // while transactions keep running on the in-memory data. The next checkpoint only swaps the
+    // flushed data in, unless the node group has been modified since.
+    virtual void preCheckpoint(MemoryManager& memoryManager, FileHandle& dataFH);
     virtual void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
 
     bool hasChanges();
@@ -204,6 +211,14 @@ private:
         common::offset_t startNodeOffset, common::row_idx_t numRows);
 
 protected:
+    bool hasOnlyCommittedInsertions(const common::UniqLock& lock, bool allowDeletions);
+    void setPreCheckpointedGroup(const common::UniqLock& lock,
+        std::unique_ptr<ChunkedNodeGroup> flushedGroup);
+    // Returns the data flushed by preCheckpoint() if it is still up to date with the in-memory
+    // data and has the columns to checkpoint. The flushed data is dropped either way.
+    std::unique_ptr<ChunkedNodeGroup> takePreCheckpointedGroup(const common::UniqLock& lock,
+        const std::vector<common::column_id_t>& columnIDs, bool allowDeletions);
+
     common::node_group_idx_t nodeGroupIdx;
     NodeGroupDataFormat format;
     bool enableCompression;
@@ -216,6 +231,12 @@ protected:
     common::row_idx_t capacity;
     std::vector<common::LogicalType> dataTypes;
     GroupCollection<ChunkedNodeGroup> chunkedGroups;
+    // Data flushed by preCheckpoint(), together with the number of rows appended to the node group
+    // and the columns at the time it was flushed. `numRows` only grows until the next checkpoint,
+    // so an unchanged count means no rows were appended since.
+    std::unique_ptr<ChunkedNodeGroup> preCheckpointedGroup;
+    common::row_idx_t numPreCheckpointedRows = 0;
+    std::vector<common::column_id_t> preCheckpointedColumnIDs;
 };
 
 } // namespace storage
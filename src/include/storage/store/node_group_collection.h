@@ -60,6 +60,7 @@ public:
 
     uint64_t getEstimatedMemoryUsage();
 
+    void preCheckpoint(MemoryManager& memoryManager);
     void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
 
     void serialize(common::Serializer& ser);
@@ -4,7 +4,10 @@
 
 #include "common/types/types.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/index/fts_index.h"
 #include "storage/index/hash_index.h"
+#include "storage/index/hnsw_index.h"
+#include "storage/index/property_index.h"
 #include "storage/store/node_group_collection.h"
 #include "storage/store/table.h"
 
@@ -129,6 +132,18 @@ public:
 
     common::column_id_t getPKColumnID() const { return pkColumnID; }
     PrimaryKeyIndex* getPKIndex() const { return pkIndex.get(); }
+
+    // Builds the secondary index of a column from all committed node groups visible to
+    // `transaction`, replacing the existing index of the column if any. The index is registered
+    // before the build, so commits racing with the build are indexed as well.
+    void buildPropertyIndex(transaction::Transaction* transaction, common::column_id_t columnID);
+    void buildVectorIndex(transaction::Transaction* transaction, common::column_id_t columnID,
+        common::VectorDistanceMetric metric);
+    void buildFTSIndex(transaction::Transaction* transaction, common::column_id_t columnID);
+    // Return nullptr if the column has no secondary index of the requested kind.
+    std::shared_ptr<PropertyIndex> getPropertyIndex(common::column_id_t columnID) const;
+    std::shared_ptr<HNSWIndex> getVectorIndex(common::column_id_t columnID) const;
+    std::shared_ptr<FTSIndex> getFTSIndex(common::column_id_t columnID) const;
     common::column_id_t getNumColumns() const { return columns.size(); }
     Column* getColumnPtr(common::column_id_t columnID) const {
         KU_ASSERT(columnID < columns.size());
@@ -147,6 +162,7 @@ public:
         transaction::Transaction* transaction, ChunkedNodeGroup& chunkedGroup);
 
     void commit(transaction::Transaction* transaction, LocalTable* localTable) override;
+    void preCheckpoint() override { nodeGroups->preCheckpoint(*memoryManager); }
     void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) override;
 
     common::node_group_idx_t getNumCommittedNodeGroups() const {
@@ -165,11 +181,25 @@ public:
     }
 
 private:
+    // `visibilityTransaction` decides which existing keys are visible when checking uniqueness.
+    // It is the inserting transaction itself unless specified.
     void insertPK(const transaction::Transaction* transaction,
-        const common::ValueVector& nodeIDVector, const common::ValueVector& pkVector) const;
+        const common::ValueVector& nodeIDVector, const common::ValueVector& pkVector,
+        const transaction::Transaction* visibilityTransaction = nullptr) const;
     void validatePkNotExists(const transaction::Transaction* transaction,
         common::ValueVector* pkVector);
 
+    void buildColumnIndex(transaction::Transaction* transaction, common::column_id_t columnID,
+        std::shared_ptr<ColumnIndex> columnIndex);
+    // Scans the committed values of a column in a node group visible to `transaction`.
+    void scanColumnForIndex(transaction::Transaction* transaction, common::column_id_t columnID,
+        common::node_group_idx_t nodeGroupIdx, const index_scan_func_t& func);
+    std::shared_ptr<ColumnIndex> getColumnIndex(common::column_id_t columnID) const;
+    std::vector<std::pair<common::column_id_t, std::shared_ptr<ColumnIndex>>>
+    getColumnIndexes() const;
+    void insertIntoColumnIndexes(const ChunkedNodeGroup& chunkedGroup,
+        common::offset_t startOffset, common::row_idx_t numRows) const;
+
     void serialize(common::Serializer& serializer) const override;
 
 private:
@@ -177,6 +207,10 @@ private:
     std::unique_ptr<NodeGroupCollection> nodeGroups;
     common::column_id_t pkColumnID;
     std::unique_ptr<PrimaryKeyIndex> pkIndex;
+    // Property indexes are serialized with the table. Other secondary indexes are rebuilt when the
+    // table is loaded.
+    std::unordered_map<common::column_id_t, std::shared_ptr<ColumnIndex>> columnIndexes;
+    mutable std::mutex columnIndexesMtx;
 };
 
 } // namespace storage
@@ -167,6 +167,10 @@ public:
         common::RelDataDirection direction) const;
 
     void commit(transaction::Transaction* transaction, LocalTable* localTable) override;
+    void preCheckpoint() override {
+        fwdRelTableData->preCheckpoint();
+        bwdRelTableData->preCheckpoint();
+    }
     void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) override;
 
     common::row_idx_t getNumRows() override { return nextRelOffset; }
@@ -66,6 +66,7 @@ public:
         return numRows;
     }
 
+    void preCheckpoint() { nodeGroups->preCheckpoint(*memoryManager); }
     void checkpoint(const std::vector<common::column_id_t>& columnIDs);
 
     void serialize(common::Serializer& serializer) const;
@@ -169,6 +169,8 @@ public:
     void dropColumn() { setHasChanges(); }
 
     virtual void commit(transaction::Transaction* transaction, LocalTable* localTable) = 0;
+    // Flushes committed in-memory data ahead of a checkpoint, while transactions keep running.
+    virtual void preCheckpoint() {}
     virtual void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) = 0;
 
     virtual common::row_idx_t getNumRows() = 0;
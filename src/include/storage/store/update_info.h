@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <bitset>
+#include <mutex>
 
 #include "column_chunk_data.h"
 #include "common/constants.h"
@@ -23,6 +25,9 @@ struct VectorUpdateInfo {
     common::transaction_t version;
     std::array<common::sel_t, common::DEFAULT_VECTOR_CAPACITY> rowsInVector;
     common::sel_t numRowsUpdated;
+    // Rows written by the transaction of this version. The other rows in `rowsInVector` are carried
+    // over from older versions.
+    std::bitset<common::DEFAULT_VECTOR_CAPACITY> rowsWritten;
     // Older versions.
     std::unique_ptr<VectorUpdateInfo> prev;
     // Newer versions.
@@ -32,7 +37,8 @@ struct VectorUpdateInfo {
 
     explicit VectorUpdateInfo(MemoryManager& memoryManager,
         const common::transaction_t transactionID, common::LogicalType dataType)
-        : version{transactionID}, rowsInVector{}, numRowsUpdated{0}, prev{nullptr}, next{nullptr} {
+        : version{transactionID}, rowsInVector{}, numRowsUpdated{0}, rowsWritten{}, prev{nullptr},
+          next{nullptr} {
         data = ColumnChunkFactory::createColumnChunkData(memoryManager, std::move(dataType), false,
             common::DEFAULT_VECTOR_CAPACITY, ResidencyState::IN_MEMORY);
     }
@@ -52,26 +58,38 @@ public:
         const transaction::Transaction* transaction, common::idx_t vectorIdx,
         common::sel_t rowIdxInVector, const common::ValueVector& values);
 
-    void setVectorInfo(common::idx_t vectorIdx, std::unique_ptr<VectorUpdateInfo> vectorInfo) {
-        vectorsInfo[vectorIdx] = std::move(vectorInfo);
-    }
-    void clearVectorInfo(common::idx_t vectorIdx) { vectorsInfo[vectorIdx] = nullptr; }
-
     common::idx_t getNumVectors() const { return vectorsInfo.size(); }
     VectorUpdateInfo* getVectorInfo(const transaction::Transaction* transaction,
         common::idx_t idx) const;
 
     common::row_idx_t getNumUpdatedRows(const transaction::Transaction* transaction) const;
 
+    // Checks if the row is updated by a transaction that is either uncommitted or committed after
+    // the given transaction started.
+    bool isUpdatedByOtherTransaction(const transaction::Transaction* transaction,
+        common::idx_t vectorIdx, common::sel_t rowIdxInVector) const;
+
+    // Rows committed by other transactions after `vectorInfo` was created are carried over into
+    // it, and it is moved to the head of the version chain. This keeps committed versions ordered
+    // by commit timestamp, each containing all committed updates of the vector.
+    void commitVectorInfo(common::idx_t vectorIdx, VectorUpdateInfo& vectorInfo,
+        common::transaction_t commitTS);
+    void rollbackVectorInfo(const transaction::Transaction* transaction, common::idx_t vectorIdx,
+        const VectorUpdateInfo* vectorInfo);
+
     bool hasUpdates(const transaction::Transaction* transaction, common::row_idx_t startRow,
         common::length_t numRows) const;
 
 private:
+    VectorUpdateInfo* getVectorInfoNoLock(const transaction::Transaction* transaction,
+        common::idx_t idx) const;
     VectorUpdateInfo& getOrCreateVectorInfo(MemoryManager& memoryManager,
         const transaction::Transaction* transaction, common::idx_t vectorIdx,
         common::sel_t rowIdxInVector, const common::LogicalType& dataType);
 
 private:
+    // Concurrent write transactions may update different rows of the same vector.
+    mutable std::mutex mtx;
     std::vector<std::unique_ptr<VectorUpdateInfo>> vectorsInfo;
 };
 
@@ -65,6 +65,9 @@ struct VectorVersionInfo {
     // Given startTS and transactionID, if the row is readable to the transaction, return true.
     bool isInserted(common::transaction_t startTS, common::transaction_t transactionID,
         common::row_idx_t rowIdx) const;
+    // If the row is deleted by any transaction other than the given one, return true.
+    bool isDeletedByOtherTransaction(common::transaction_t transactionID,
+        common::row_idx_t rowIdx) const;
 
     common::row_idx_t getNumDeletions(common::transaction_t startTS,
         common::transaction_t transactionID, common::row_idx_t startRow,
@@ -104,6 +107,8 @@ public:
     bool isDeleted(const transaction::Transaction* transaction, common::row_idx_t rowInChunk) const;
     bool isInserted(const transaction::Transaction* transaction,
         common::row_idx_t rowInChunk) const;
+    bool isDeletedByOtherTransaction(const transaction::Transaction* transaction,
+        common::row_idx_t rowInChunk) const;
 
     bool hasDeletions(const transaction::Transaction* transaction) const;
 
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "common/copy_constructors.h"
+#include "common/enums/rel_direction.h"
+#include "common/serializer/buffered_serializer.h"
+#include "storage/wal/wal_record.h"
+
+namespace kuzu {
+namespace binder {
+struct BoundAlterInfo;
+struct BoundCreateTableInfo;
+} // namespace binder
+namespace common {
+class ValueVector;
+} // namespace common
+
+namespace catalog {
+class CatalogEntry;
+} // namespace catalog
+
+namespace storage {
+class Spiller;
+class WAL;
+// Buffers the WAL records of a single write transaction. Records are only appended to the shared
+// WAL file, surrounded by BEGIN and COMMIT records, when the transaction commits. This keeps records
+// of concurrent write transactions from interleaving in the WAL file, and rolled back transactions
+// leave nothing behind to be replayed.
+// Records are buffered in memory until they exceed SPILL_THRESHOLD, at which point the buffer is
+// moved to the spiller's temporary file, so large transactions don't hold all their records in
+// memory until they commit.
+class LocalWAL {
+    friend class WAL;
+
+public:
+    static constexpr uint64_t SPILL_THRESHOLD = 16 * 1024 * 1024;
+
+    explicit LocalWAL(Spiller* spiller = nullptr)
+        : serializer{std::make_shared<common::BufferedSerializer>()}, numRecords{0},
+          spiller{spiller}, spilledSize{0} {}
+    DELETE_COPY_AND_MOVE(LocalWAL);
+    ~LocalWAL();
+
+    void logCreateTableEntryRecord(binder::BoundCreateTableInfo tableInfo);
+    void logCreateCatalogEntryRecord(catalog::CatalogEntry* catalogEntry);
+    void logDropCatalogEntryRecord(uint64_t entryID, catalog::CatalogEntryType type);
+    void logAlterTableEntryRecord(const binder::BoundAlterInfo* alterInfo);
+    void logUpdateSequenceRecord(common::sequence_id_t sequenceID, uint64_t kCount);
+
+    void logTableInsertion(common::table_id_t tableID, common::TableType tableType,
+        common::row_idx_t numRows, const std::vector<common::ValueVector*>& vectors);
+    void logNodeDeletion(common::table_id_t tableID, common::offset_t nodeOffset,
+        common::ValueVector* pkVector);
+    void logNodeUpdate(common::table_id_t tableID, common::column_id_t columnID,
+        common::offset_t nodeOffset, common::ValueVector* propertyVector);
+    void logRelDelete(common::table_id_t tableID, common::ValueVector* srcNodeVector,
+        common::ValueVector* dstNodeVector, common::ValueVector* relIDVector);
+    void logRelDetachDelete(common::table_id_t tableID, common::RelDataDirection direction,
+        common::ValueVector* srcNodeVector);
+    void logRelUpdate(common::table_id_t tableID, common::column_id_t columnID,
+        common::ValueVector* srcNodeVector, common::ValueVector* dstNodeVector,
+        common::ValueVector* relIDVector, common::ValueVector* propertyVector);
+
+    bool isEmpty() const { return numRecords == 0; }
+    uint64_t getSize() const { return spilledSize + serializer->getSize(); }
+    bool hasSpilled() const { return !spilledBlocks.empty(); }
+
+    void clear();
+
+private:
+    void addNewWALRecord(const WALRecord& walRecord);
+    void spill();
+    // Writes all buffered records, including the spilled ones, in the order they were logged.
+    void writeTo(common::Writer& writer) const;
+
+private:
+    struct SpilledBlock {
+        uint64_t filePosition;
+        uint64_t size;
+    };
+
+    std::shared_ptr<common::BufferedSerializer> serializer;
+    uint64_t numRecords;
+    Spiller* spiller;
+    std::vector<SpilledBlock> spilledBlocks;
+    uint64_t spilledSize;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -44,6 +44,8 @@ public:
     void clearAll(main::ClientContext& context);
 
 private:
+    static constexpr common::page_idx_t NUM_PAGES_PER_REPLAY_BATCH = 64;
+
     static std::unique_ptr<common::FileInfo> getFileInfo(const main::ClientContext& context,
         DBFileID dbFileID);
 
@@ -3,27 +3,17 @@
 #include <cstdint>
 #include <unordered_set>
 
-#include "common/enums/rel_direction.h"
 #include "common/serializer/buffered_file.h"
 #include "storage/wal/wal_record.h"
 
 namespace kuzu {
-namespace binder {
-struct BoundAlterInfo;
-struct BoundCreateTableInfo;
-} // namespace binder
 namespace common {
 class BufferedFileWriter;
 class VirtualFileSystem;
-class ValueVector;
 } // namespace common
 
-namespace catalog {
-class CatalogEntry;
-struct SequenceRollbackData;
-} // namespace catalog
-
 namespace storage {
+class LocalWAL;
 class WALReplayer;
 class WAL {
     friend class WALReplayer;
@@ -34,33 +24,12 @@ public:
 
     ~WAL();
 
-    // Currently, only creating a table entry has its own WAL record. Eventually,
-    // we want to log minimal info into the WAL, so each entry type should have its
-    // own WAL record
-    void logCreateTableEntryRecord(binder::BoundCreateTableInfo tableInfo);
-    void logCreateCatalogEntryRecord(catalog::CatalogEntry* catalogEntry);
-    void logDropCatalogEntryRecord(uint64_t entryID, catalog::CatalogEntryType type);
-    void logAlterTableEntryRecord(const binder::BoundAlterInfo* alterInfo);
-    void logUpdateSequenceRecord(common::sequence_id_t sequenceID, uint64_t kCount);
-
-    void logTableInsertion(common::table_id_t tableID, common::TableType tableType,
-        common::row_idx_t numRows, const std::vector<common::ValueVector*>& vectors);
-    void logNodeDeletion(common::table_id_t tableID, common::offset_t nodeOffset,
-        common::ValueVector* pkVector);
-    void logNodeUpdate(common::table_id_t tableID, common::column_id_t columnID,
-        common::offset_t nodeOffset, common::ValueVector* propertyVector);
-    void logRelDelete(common::table_id_t tableID, common::ValueVector* srcNodeVector,
-        common::ValueVector* dstNodeVector, common::ValueVector* relIDVector);
-    void logRelDetachDelete(common::table_id_t tableID, common::RelDataDirection direction,
-        common::ValueVector* srcNodeVector);
-    void logRelUpdate(common::table_id_t tableID, common::column_id_t columnID,
-        common::ValueVector* srcNodeVector, common::ValueVector* dstNodeVector,
-        common::ValueVector* relIDVector, common::ValueVector* propertyVector);
     void logCopyTableRecord(common::table_id_t tableID);
 
-    void logBeginTransaction();
-    void logAndFlushCommit();
-    void logRollback();
+    // Appends the records buffered by a committing transaction to the WAL file, surrounded by
+    // BEGIN and COMMIT records, and flushes the file.
+    void logCommittedWAL(const LocalWAL& localWAL);
+
     void logAndFlushCheckpoint();
 
     // Removes the contents of WAL file.
@@ -15,6 +15,7 @@ class ClientContext;
 } // namespace main
 namespace storage {
 class LocalStorage;
+class LocalWAL;
 class UndoBuffer;
 class WAL;
 class VersionInfo;
@@ -74,6 +75,10 @@ public:
 
     uint64_t getEstimatedMemUsage() const;
     storage::LocalStorage* getLocalStorage() const { return localStorage.get(); }
+    storage::LocalWAL& getLocalWAL() const {
+        KU_ASSERT(localWAL);
+        return *localWAL;
+    }
     bool hasNewlyInsertedNodes(common::table_id_t tableID) const {
         return maxCommittedNodeOffsets.contains(tableID);
     }
@@ -105,6 +110,7 @@ private:
     main::ClientContext* clientContext;
     std::unique_ptr<storage::LocalStorage> localStorage;
     std::unique_ptr<storage::UndoBuffer> undoBuffer;
+    std::unique_ptr<storage::LocalWAL> localWAL;
     bool forceCheckpoint;
 
     std::unordered_map<common::table_id_t, common::offset_t> maxCommittedNodeOffsets;
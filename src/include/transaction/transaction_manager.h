@@ -1,7 +1,9 @@
 #pragma once
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_set>
 
 #include "storage/wal/wal.h"
@@ -23,8 +25,8 @@ class TransactionManager {
 
 public:
     // Timestamp starts from 1. 0 is reserved for the dummy system transaction.
-    explicit TransactionManager(storage::WAL& wal)
-        : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1} {};
+    explicit TransactionManager(storage::WAL& wal);
+    ~TransactionManager();
 
     std::unique_ptr<Transaction> beginTransaction(main::ClientContext& clientContext,
         TransactionType type);
@@ -33,10 +35,27 @@ public:
     void rollback(main::ClientContext& clientContext, const Transaction* transaction);
     void checkpoint(main::ClientContext& clientContext);
 
+    // Stops the background checkpointer thread if it is running. Must be called before the
+    // database starts to tear down the storage.
+    void stopBackgroundCheckpoint();
+
+    // Counts write transactions that have started and not yet committed or rolled back.
+    uint64_t getNumActiveWriteTransactions();
+
 private:
     bool canAutoCheckpoint(const main::ClientContext& clientContext) const;
     bool canCheckpointNoLock() const;
     void checkpointNoLock(main::ClientContext& clientContext);
+    // Checkpoints storage, catalog and WAL. The caller must make sure that no transaction is
+    // active and no new transaction can start.
+    void checkpointStorageNoLock(main::ClientContext& clientContext);
+
+    void requestBackgroundCheckpointNoLock(const main::ClientContext& clientContext);
+    void runBackgroundCheckpointer();
+    // Returns false if the checkpoint has to be retried later, because some transactions are
+    // still active. If waitForTransactions is set, new transactions are kept from starting while
+    // waiting up to the checkpoint wait timeout for the active ones to leave.
+    bool tryBackgroundCheckpoint(bool waitForTransactions);
     // This functions locks the mutex to start new transactions. This lock needs to be manually
     // unlocked later by calling allowReceivingNewTransactions() by the thread that called
     // stopNewTransactionsAndWaitUntilAllTransactionsLeave().
@@ -62,6 +81,18 @@ private:
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
+
+    // Background checkpointing. The checkpointer thread is started on the first request. It first
+    // flushes the committed data while transactions keep running, and then checkpoints with its
+    // own client context once there is no active transaction. If the system does not become idle
+    // within BACKGROUND_CHECKPOINT_MAX_DELAY_IN_MICROS, it briefly stops new transactions from
+    // starting until the active ones have left.
+    std::unique_ptr<main::ClientContext> backgroundCheckpointContext;
+    std::thread backgroundCheckpointer;
+    std::mutex mtxForBackgroundCheckpoint;
+    std::condition_variable backgroundCheckpointCV;
+    bool backgroundCheckpointRequested;
+    bool stopBackgroundCheckpointer;
 };
 } // namespace transaction
 } // namespace kuzu
@@ -10,11 +10,13 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/streaming_query.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/planner.h"
+#include "processor/operator/result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -68,9 +70,12 @@ ClientContext::ClientContext(Database* database)
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
     clientConfig.warningLimit = ClientConfigDefault::WARNING_LIMIT;
+    clientConfig.enableStreamingResult = ClientConfigDefault::ENABLE_STREAMING_RESULT;
 }
 
-ClientContext::~ClientContext() = default;
+ClientContext::~ClientContext() {
+    finishStreamingQueryNoLock();
+}
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
     KU_ASSERT(hasTimeout());
@@ -218,6 +223,10 @@ VirtualFileSystem* ClientContext::getVFSUnsafe() const {
     return localDatabase->vfs.get();
 }
 
+graph::GraphCache* ClientContext::getGraphCache() const {
+    return remoteDatabase == nullptr ? localDatabase->graphCache.get() : nullptr;
+}
+
 RandomEngine* ClientContext::getRandomEngine() {
     return randomEngine.get();
 }
@@ -241,6 +250,7 @@ std::string ClientContext::getEnvVariable(const std::string& name) {
 
 std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query) {
     std::unique_lock<std::mutex> lck{mtx};
+    finishStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -263,6 +273,7 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view queryStatemen
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::string_view encodedJoin, bool enumerateAllPlans, std::optional<uint64_t> queryID) {
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -271,10 +282,13 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     }
     std::unique_ptr<QueryResult> queryResult;
     QueryResult* lastResult = nullptr;
+    // A streaming result would be cancelled by the execution of the next statement.
+    auto allowStreaming = parsedStatements.size() == 1;
     for (auto& statement : parsedStatements) {
         auto preparedStatement = prepareNoLock(statement,
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
-        auto currentQueryResult = executeNoLock(preparedStatement.get(), 0u, queryID);
+        auto currentQueryResult =
+            executeNoLock(preparedStatement.get(), 0u, queryID, allowStreaming);
         if (!lastResult) {
             // first result of the query
             queryResult = std::move(currentQueryResult);
@@ -419,6 +433,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
                                        // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -431,7 +446,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
     auto rebindPreparedStatement = prepareNoLock(preparedStatement->parsedStatement, false, "",
         false, preparedStatement->parameterMap);
-    return executeNoLock(rebindPreparedStatement.get(), 0u, queryID);
+    return executeNoLock(rebindPreparedStatement.get(), 0u, queryID, true /* allowStreaming */);
 }
 
 void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
@@ -450,7 +465,7 @@ void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
 }
 
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
-    uint32_t planIdx, std::optional<uint64_t> queryID) {
+    uint32_t planIdx, std::optional<uint64_t> queryID, bool allowStreaming) {
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -481,6 +496,38 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
+    if (allowStreaming && canStreamResult(preparedStatement, physicalPlan.get())) {
+        // The result collector's table is never populated in streaming mode. We keep it as the
+        // result table in case the query turns out to produce no tuple.
+        resultFT = ku_dynamic_cast<ResultCollector*>(physicalPlan->lastOperator.get())
+                       ->getResultFactorizedTable();
+        auto streamingQuery = std::make_shared<StreamingQuery>(this, std::move(physicalPlan),
+            std::move(profiler), std::move(executionContext),
+            ClientConfigDefault::STREAMING_RESULT_QUEUE_CAPACITY);
+        streamingQuery->start(localDatabase->queryProcessor.get());
+        std::unique_ptr<FactorizedTable> firstBatch;
+        try {
+            // Wait for the first batch so that errors raised early in the execution are still
+            // reported through the query result.
+            firstBatch = streamingQuery->getNextBatch();
+        } catch (std::exception& e) {
+            streamingQuery->finish();
+            return queryResultWithError(e.what());
+        }
+        executingTimer.stop();
+        queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+        auto sResult = preparedStatement->statementResult.get();
+        queryResult->setColumnHeader(sResult->getColumnNames(), sResult->getColumnTypes());
+        if (firstBatch == nullptr) {
+            streamingQuery->finish();
+            queryResult->initResultTableAndIterator(std::move(resultFT));
+        } else {
+            activeStreamingQuery = streamingQuery;
+            queryResult->initResultTableAndIterator(std::move(firstBatch));
+            queryResult->streamingQuery = std::move(streamingQuery);
+        }
+        return queryResult;
+    }
     try {
         if (preparedStatement->isTransactionStatement()) {
             resultFT =
@@ -509,6 +556,31 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     return queryResult;
 }
 
+bool ClientContext::canStreamResult(PreparedStatement* preparedStatement,
+    PhysicalPlan* physicalPlan) const {
+    // Only read-only queries in auto transactions can be streamed, as their transaction needs to
+    // outlive the call that returns the result.
+    return clientConfig.enableStreamingResult && transactionContext->isAutoTransaction() &&
+           preparedStatement->isReadOnly() &&
+           preparedStatement->getStatementType() == StatementType::QUERY &&
+           QueryProcessor::canStreamResult(physicalPlan);
+}
+
+void ClientContext::finishStreamingQuery(StreamingQuery& streamingQuery) {
+    lock_t lck{mtx};
+    streamingQuery.finish();
+    if (activeStreamingQuery.lock().get() == &streamingQuery) {
+        activeStreamingQuery.reset();
+    }
+}
+
+void ClientContext::finishStreamingQueryNoLock() {
+    if (auto streamingQuery = activeStreamingQuery.lock()) {
+        streamingQuery->finish();
+    }
+    activeStreamingQuery.reset();
+}
+
 // If there is an active transaction in the context, we execute the function in current active
 // transaction. If there is no active transaction, we start an auto commit transaction.
 void ClientContext::runFuncInTransaction(const std::function<void(void)>& fun) {
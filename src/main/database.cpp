@@ -13,6 +13,7 @@
 #include "common/exception/extension.h"
 #include "common/file_system/virtual_file_system.h"
 #include "extension/extension.h"
+#include "graph/graph_cache.h"
 #include "main/db_config.h"
 #include "processor/processor.h"
 #include "storage/storage_extension.h"
@@ -90,9 +91,13 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     StorageManager::recover(clientContext);
     extensionOptions = std::make_unique<extension::ExtensionOptions>();
     databaseManager = std::make_unique<DatabaseManager>();
+    graphCache = std::make_unique<graph::GraphCache>();
 }
 
 Database::~Database() {
+    // The background checkpointer works on this database, so it has to finish before any of the
+    // database's components are destructed.
+    transactionManager->stopBackgroundCheckpoint();
     if (!dbConfig.readOnly && dbConfig.forceCheckpointOnClose) {
         try {
             ClientContext clientContext(this);
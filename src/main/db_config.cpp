@@ -1,6 +1,8 @@
 #include "main/db_config.h"
 
 #include "common/string_utils.h"
+#include "graph/graph_cache.h"
+#include "main/client_context.h"
 #include "main/database.h"
 #include "main/settings.h"
 
@@ -21,14 +23,25 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(ProgressBarTimerSetting), GET_CONFIGURATION(RecursivePatternSemanticSetting),
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
+    GET_CONFIGURATION(BackgroundCheckpointSetting),
     GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskFileSetting),
-    GET_CONFIGURATION(EnableGDSSetting)};
+    GET_CONFIGURATION(EnableGDSSetting), GET_CONFIGURATION(EnableGraphCacheSetting),
+    GET_CONFIGURATION(EnableStreamingResultSetting)};
+
+void EnableGraphCacheSetting::setContext(ClientContext* context, const Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enableGraphCache = parameter.getValue<bool>();
+    // Frees cached graphs. Connections still using the cache repopulate it on their next query.
+    if (!context->getClientConfig()->enableGraphCache && context->getGraphCache() != nullptr) {
+        context->getGraphCache()->clear();
+    }
+}
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
       enableCompression{systemConfig.enableCompression}, readOnly{systemConfig.readOnly},
       maxDBSize{systemConfig.maxDBSize}, enableMultiWrites{false},
-      autoCheckpoint{systemConfig.autoCheckpoint},
+      autoCheckpoint{systemConfig.autoCheckpoint}, backgroundCheckpoint{false},
       checkpointThreshold{systemConfig.checkpointThreshold}, forceCheckpointOnClose{true} {}
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
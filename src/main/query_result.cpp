@@ -2,6 +2,8 @@
 
 #include "common/arrow/arrow_converter.h"
 #include "common/exception/runtime.h"
+#include "main/client_context.h"
+#include "main/streaming_query.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
 
@@ -19,7 +21,20 @@ QueryResult::QueryResult(const PreparedSummary& preparedSummary)
     querySummary->setPreparedSummary(preparedSummary);
 }
 
-QueryResult::~QueryResult() = default;
+QueryResult::~QueryResult() {
+    if (streamingQuery != nullptr) {
+        // Stops the pipelines if the client did not read the whole result.
+        finishStreamingQuery();
+    }
+}
+
+void QueryResult::finishStreamingQuery() const {
+    // Destroying the client context or running the next statement on it finishes the query
+    // first, so the context is still alive if the query has not been finished yet.
+    if (!streamingQuery->isFinished()) {
+        streamingQuery->getClientContext()->finishStreamingQuery(*streamingQuery);
+    }
+}
 
 bool QueryResult::isSuccess() const {
     return success;
@@ -42,7 +57,7 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
-    return factorizedTable->getTotalNumFlatTuples();
+    return numTuplesInPreviousBatches + factorizedTable->getTotalNumFlatTuples();
 }
 
 QuerySummary* QueryResult::getQuerySummary() const {
@@ -50,6 +65,10 @@ QuerySummary* QueryResult::getQuerySummary() const {
 }
 
 void QueryResult::resetIterator() {
+    if (numTuplesInPreviousBatches > 0) {
+        throw RuntimeException("Cannot reset the iterator of a streaming query result after its "
+                               "first batch of tuples has been read.");
+    }
     iterator->resetState();
 }
 
@@ -72,9 +91,35 @@ void QueryResult::initResultTableAndIterator(
     iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
 }
 
+bool QueryResult::fetchNextStreamingBatch() const {
+    while (true) {
+        auto batch = streamingQuery->getNextBatch();
+        if (batch == nullptr) {
+            // Commits the transaction of the query as early as possible.
+            finishStreamingQuery();
+            return false;
+        }
+        if (batch->isEmpty()) {
+            continue;
+        }
+        numTuplesInPreviousBatches += factorizedTable->getTotalNumFlatTuples();
+        std::vector<Value*> valuesToCollect;
+        for (auto i = 0u; i < tuple->len(); ++i) {
+            valuesToCollect.push_back(tuple->getValue(i));
+        }
+        // The iterator refers to the table, so it must be replaced first.
+        iterator = std::make_unique<FlatTupleIterator>(*batch, std::move(valuesToCollect));
+        factorizedTable = std::move(batch);
+        return true;
+    }
+}
+
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
-    return iterator->hasNextFlatTuple();
+    if (iterator->hasNextFlatTuple()) {
+        return true;
+    }
+    return streamingQuery != nullptr && fetchNextStreamingBatch();
 }
 
 bool QueryResult::hasNextQueryResult() const {
@@ -0,0 +1,71 @@
+#include "main/streaming_query.h"
+
+#include "main/client_context.h"
+#include "processor/processor.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+StreamingQuery::StreamingQuery(ClientContext* clientContext, std::unique_ptr<PhysicalPlan> plan,
+    std::unique_ptr<Profiler> profiler, std::unique_ptr<ExecutionContext> executionContext,
+    uint64_t queueCapacity)
+    : clientContext{clientContext}, plan{std::move(plan)}, profiler{std::move(profiler)},
+      executionContext{std::move(executionContext)},
+      queue{std::make_shared<StreamingResultQueue>(queueCapacity)}, executionFailed{false},
+      finished{false} {}
+
+StreamingQuery::~StreamingQuery() {
+    finish();
+}
+
+void StreamingQuery::start(QueryProcessor* queryProcessor) {
+    driverThread = std::thread([this, queryProcessor] {
+        try {
+            queryProcessor->executeStreaming(plan.get(), executionContext.get(), queue);
+            queue->finishProducing(nullptr /* exceptionPtr */);
+        } catch (std::exception& e) {
+            executionFailed = true;
+            queue->finishProducing(std::current_exception());
+        }
+    });
+}
+
+std::unique_ptr<FactorizedTable> StreamingQuery::getNextBatch() {
+    return queue->pop();
+}
+
+void StreamingQuery::finish() {
+    std::unique_lock lck{mtx};
+    if (finished) {
+        return;
+    }
+    finished = true;
+    // Unblocks the producers if the consumer stops reading before the end of the result.
+    queue->cancel();
+    if (driverThread.joinable()) {
+        driverThread.join();
+    }
+    auto transactionContext = clientContext->getTransactionContext();
+    if (executionFailed) {
+        transactionContext->rollback();
+        clientContext->getProgressBar()->endProgress(executionContext->queryID);
+    } else {
+        transactionContext->commit();
+    }
+    clientContext->getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+        [](auto& spiller) { spiller.clearFile(); });
+}
+
+bool StreamingQuery::isFinished() {
+    std::unique_lock lck{mtx};
+    return finished;
+}
+
+} // namespace main
+} // namespace kuzu
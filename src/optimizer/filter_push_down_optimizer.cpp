@@ -3,13 +3,17 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "main/client_context.h"
+#include "planner/join_order/cardinality_estimator.h"
 #include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_table_function_call.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "storage/predicate/constant_predicate.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -202,9 +206,69 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
     }
+    if (scan.getScanType() == LogicalScanNodeTableType::SCAN && scan.getExtraInfo() == nullptr &&
+        tableIDs.size() == 1) {
+        tryApplyPropertyIndexScan(scan);
+    }
     return finishPushDown(op);
 }
 
+static bool canNarrowIndexLookup(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void FilterPushDownOptimizer::tryApplyPropertyIndexScan(LogicalScanNodeTable& scan) {
+    const auto tableEntry =
+        context->getCatalog()->getTableCatalogEntry(context->getTx(), scan.getTableIDs()[0]);
+    const auto& nodeTableEntry = tableEntry->constCast<catalog::NodeTableCatalogEntry>();
+    if (nodeTableEntry.getIndexedProperties().empty()) {
+        return;
+    }
+    std::unique_ptr<PropertyIndexScanInfo> indexScanInfo;
+    auto estimator = planner::CardinalityEstimator{context};
+    auto minSelectivity = PlannerKnobs::PROPERTY_INDEX_SCAN_SELECTIVITY;
+    for (auto& property : scan.getProperties()) {
+        const auto propertyName = property->constCast<PropertyExpression>().getPropertyName();
+        if (!nodeTableEntry.hasIndex(propertyName)) {
+            continue;
+        }
+        std::vector<ColumnConstantPredicate> indexPredicates;
+        auto selectivity = 1.0;
+        for (auto& predicate : predicateSet.getAllPredicates()) {
+            const auto columnPredicate = ColumnPredicateUtil::tryConvert(*property, *predicate);
+            if (columnPredicate == nullptr) {
+                continue;
+            }
+            auto& constantPredicate = columnPredicate->constCast<ColumnConstantPredicate>();
+            const auto& value = constantPredicate.getValue();
+            if (!canNarrowIndexLookup(constantPredicate.getExpressionType()) || value.isNull() ||
+                value.getDataType() != property->getDataType()) {
+                continue;
+            }
+            selectivity *= estimator.getPredicateSelectivity(*predicate);
+            indexPredicates.push_back(constantPredicate);
+        }
+        if (!indexPredicates.empty() && selectivity <= minSelectivity) {
+            minSelectivity = selectivity;
+            indexScanInfo =
+                std::make_unique<PropertyIndexScanInfo>(propertyName, std::move(indexPredicates));
+        }
+    }
+    if (indexScanInfo != nullptr) {
+        // Predicates are kept in the filter above the scan to re-check candidates.
+        scan.setExtraInfo(std::move(indexScanInfo));
+    }
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitTableFunctionCallReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto& tableFunctionCall = op->cast<LogicalTableFunctionCall>();
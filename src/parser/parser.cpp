@@ -7,10 +7,12 @@
 #pragma GCC diagnostic pop
 
 #include "common/exception/parser.h"
+#include "common/string_utils.h"
 #include "main/client_context.h"
 #include "parser/antlr_parser/kuzu_cypher_parser.h"
 #include "parser/antlr_parser/parser_error_listener.h"
 #include "parser/antlr_parser/parser_error_strategy.h"
+#include "parser/ddl/alter.h"
 #include "parser/transformer.h"
 
 using namespace antlr4;
@@ -18,6 +20,52 @@ using namespace antlr4;
 namespace kuzu {
 namespace parser {
 
+static std::optional<std::string> getSymbolicName(const Token& token) {
+    switch (token.getType()) {
+    case CypherLexer::UnescapedSymbolicName:
+        return token.getText();
+    case CypherLexer::EscapedSymbolicName: {
+        auto text = token.getText();
+        return text.substr(1, text.size() - 2);
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+// Index DDL is not part of the generated grammar yet, so statements of the form
+// `CREATE INDEX ON Table(property)` and `DROP INDEX ON Table(property)` are recognized on the
+// lexer's tokens. Returns nullptr if the query is anything else.
+static std::shared_ptr<Statement> parseIndexDDL(const std::vector<Token*>& allTokens) {
+    std::vector<const Token*> tokens;
+    for (auto token : allTokens) {
+        if (token->getType() != CypherLexer::SP && token->getType() != Token::EOF) {
+            tokens.push_back(token);
+        }
+    }
+    if (!tokens.empty() && tokens.back()->getText() == ";") {
+        tokens.pop_back();
+    }
+    if (tokens.size() != 7 ||
+        (tokens[0]->getType() != CypherLexer::CREATE &&
+            tokens[0]->getType() != CypherLexer::DROP) ||
+        tokens[1]->getType() != CypherLexer::UnescapedSymbolicName ||
+        common::StringUtils::getUpper(tokens[1]->getText()) != "INDEX" ||
+        tokens[2]->getType() != CypherLexer::ON || tokens[4]->getText() != "(" ||
+        tokens[6]->getText() != ")") {
+        return nullptr;
+    }
+    auto tableName = getSymbolicName(*tokens[3]);
+    auto propertyName = getSymbolicName(*tokens[5]);
+    if (!tableName || !propertyName) {
+        return nullptr;
+    }
+    auto alterType = tokens[0]->getType() == CypherLexer::CREATE ? common::AlterType::CREATE_INDEX :
+                                                                    common::AlterType::DROP_INDEX;
+    return std::make_shared<Alter>(AlterInfo{alterType, std::move(*tableName),
+        std::make_unique<ExtraIndexInfo>(std::move(*propertyName))});
+}
+
 std::vector<std::shared_ptr<Statement>> Parser::parseQuery(std::string_view query,
     main::ClientContext* context) {
     // LCOV_EXCL_START
@@ -36,6 +84,9 @@ std::vector<std::shared_ptr<Statement>> Parser::parseQuery(std::string_view quer
     cypherLexer.addErrorListener(&parserErrorListener);
     auto tokens = CommonTokenStream(&cypherLexer);
     tokens.fill();
+    if (auto indexDDL = parseIndexDDL(tokens.getTokens())) {
+        return {std::move(indexDDL)};
+    }
 
     auto kuzuCypherParser = KuzuCypherParser(&tokens);
     kuzuCypherParser.removeErrorListeners();
@@ -1,6 +1,10 @@
 #include "parser/visitor/statement_read_write_analyzer.h"
 
+#include "common/string_utils.h"
+#include "function/table/call_functions.h"
 #include "parser/expression/parsed_expression_visitor.h"
+#include "parser/expression/parsed_function_expression.h"
+#include "parser/query/reading_clause/in_query_call_clause.h"
 #include "parser/query/reading_clause/reading_clause.h"
 #include "parser/query/return_with_clause/with_clause.h"
 
@@ -18,7 +22,28 @@ static bool hasSequenceUpdate(const ParsedExpression* expr) {
     return collector.hasSeqUpdate();
 }
 
+// Index DDL and ANALYZE are exposed as table functions, which are otherwise read-only.
+static bool isWriteCall(const ReadingClause* readingClause) {
+    if (readingClause->getClauseType() != common::ClauseType::IN_QUERY_CALL) {
+        return false;
+    }
+    auto expr = readingClause->constCast<InQueryCallClause>().getFunctionExpression();
+    if (expr->getExpressionType() != common::ExpressionType::FUNCTION) {
+        return false;
+    }
+    auto funcName = common::StringUtils::getUpper(
+        expr->constCast<ParsedFunctionExpression>().getFunctionName());
+    return funcName == function::CreateVectorIndexFunction::name ||
+           funcName == function::DropVectorIndexFunction::name ||
+           funcName == function::CreateFTSIndexFunction::name ||
+           funcName == function::DropFTSIndexFunction::name ||
+           funcName == function::AnalyzeFunction::name;
+}
+
 void StatementReadWriteAnalyzer::visitReadingClause(const ReadingClause* readingClause) {
+    if (isWriteCall(readingClause)) {
+        readOnly = false;
+    }
     if (readingClause->hasWherePredicate()) {
         if (hasSequenceUpdate(readingClause->getWherePredicate())) {
             readOnly = false;
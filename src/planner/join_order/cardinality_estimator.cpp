@@ -1,6 +1,10 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/type_utils.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
@@ -8,6 +12,7 @@
 #include "storage/store/table.h"
 
 using namespace kuzu::binder;
+using namespace kuzu::catalog;
 using namespace kuzu::common;
 using namespace kuzu::transaction;
 
@@ -43,20 +48,26 @@ uint64_t CardinalityEstimator::estimateScanNode(LogicalOperator* op) {
 
 uint64_t CardinalityEstimator::estimateHashJoin(const expression_vector& joinKeys,
     const LogicalPlan& probePlan, const LogicalPlan& buildPlan) {
-    auto denominator = 1u;
+    // Computed in floating point, since the product of the domains of several join keys easily
+    // exceeds the range of 64-bit integers.
+    double denominator = 1;
     for (auto& joinKey : joinKeys) {
-        // TODO(Xiyang): we should be able to estimate non-ID-based joins as well.
         if (nodeIDName2dom.contains(joinKey->getUniqueName())) {
-            denominator *= getNodeIDDom(joinKey->getUniqueName());
+            denominator *= atLeastOne(getNodeIDDom(joinKey->getUniqueName()));
+        } else if (joinKey->expressionType == ExpressionType::PROPERTY) {
+            const auto numDistinctValues =
+                getNumDistinctValues(joinKey->constCast<PropertyExpression>());
+            denominator *= atLeastOne(numDistinctValues);
         }
     }
-    return atLeastOne(probePlan.estCardinality *
-                      JoinOrderUtil::getJoinKeysFlatCardinality(joinKeys, buildPlan) / denominator);
+    return toCardinality((double)probePlan.estCardinality *
+                         (double)JoinOrderUtil::getJoinKeysFlatCardinality(joinKeys, buildPlan) /
+                         denominator);
 }
 
 uint64_t CardinalityEstimator::estimateCrossProduct(const LogicalPlan& probePlan,
     const LogicalPlan& buildPlan) {
-    return atLeastOne(probePlan.estCardinality * buildPlan.estCardinality);
+    return toCardinality((double)probePlan.estCardinality * buildPlan.estCardinality);
 }
 
 uint64_t CardinalityEstimator::estimateIntersect(const expression_vector& joinNodeIDs,
@@ -65,15 +76,15 @@ uint64_t CardinalityEstimator::estimateIntersect(const expression_vector& joinNo
     uint64_t estCardinality1 =
         probePlan.estCardinality * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
     // Formula 2: assume independence on join conditions.
-    auto denominator = 1u;
+    double denominator = 1;
     for (auto& joinNodeID : joinNodeIDs) {
-        denominator *= getNodeIDDom(joinNodeID->getUniqueName());
+        denominator *= atLeastOne(getNodeIDDom(joinNodeID->getUniqueName()));
     }
-    auto numerator = probePlan.estCardinality;
+    auto numerator = (double)probePlan.estCardinality;
     for (auto& buildPlan : buildPlans) {
         numerator *= buildPlan->estCardinality;
     }
-    auto estCardinality2 = numerator / denominator;
+    auto estCardinality2 = toCardinality(numerator / denominator);
     // Pick minimum between the two formulas.
     return atLeastOne(std::min<uint64_t>(estCardinality1, estCardinality2));
 }
@@ -93,17 +104,111 @@ static bool isPrimaryKey(const Expression& expression) {
 
 uint64_t CardinalityEstimator::estimateFilter(const LogicalPlan& childPlan,
     const Expression& predicate) {
-    if (predicate.expressionType == ExpressionType::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
-        } else {
-            return atLeastOne(
-                childPlan.estCardinality * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+    if (predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
+    }
+    return atLeastOne(childPlan.estCardinality * getPredicateSelectivity(predicate));
+}
+
+static double getDefaultSelectivity(ExpressionType predicateType) {
+    if (predicateType == ExpressionType::EQUALS) {
+        return PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+    }
+    return PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+}
+
+static std::optional<double> getNumericValue(const Value& value) {
+    std::optional<double> result;
+    TypeUtils::visit(
+        value.getDataType().getPhysicalType(),
+        [&]<typename T>(T)
+            requires(std::is_arithmetic_v<T>)
+        { result = (double)value.getValue<T>(); },
+        [](auto) {});
+    return result;
+}
+
+// Selectivity of `property <comparison> value` on a single table, or nullopt if the statistics
+// cannot tell.
+static std::optional<double> getSelectivity(const ColumnStatistics& statistics,
+    ExpressionType comparison, const Value* value, const LogicalType& propertyType) {
+    switch (comparison) {
+    case ExpressionType::IS_NULL:
+        return statistics.getNullFraction();
+    case ExpressionType::IS_NOT_NULL:
+        return 1 - statistics.getNullFraction();
+    default:
+        break;
+    }
+    KU_ASSERT(value != nullptr);
+    if (value->isNull()) {
+        // Comparisons with null are never true.
+        return 0;
+    }
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+        return statistics.getEqualitySelectivity();
+    case ExpressionType::NOT_EQUALS:
+        return std::max(0.0,
+            1 - statistics.getNullFraction() - statistics.getEqualitySelectivity());
+    default:
+        break;
+    }
+    const auto numericValue = getNumericValue(*value);
+    if (!statistics.hasHistogram() || value->getDataType() != propertyType || !numericValue) {
+        return std::nullopt;
+    }
+    return statistics.getRangeSelectivity(comparison, *numericValue);
+}
+
+double CardinalityEstimator::getPredicateSelectivity(const Expression& predicate) {
+    const PropertyExpression* property = nullptr;
+    const Value* value = nullptr;
+    std::unique_ptr<Value> literalValue;
+    auto comparison = predicate.expressionType;
+    if ((comparison == ExpressionType::IS_NULL || comparison == ExpressionType::IS_NOT_NULL) &&
+        predicate.getChild(0)->expressionType == ExpressionType::PROPERTY) {
+        property = predicate.getChild(0)->constPtrCast<PropertyExpression>();
+    } else if (ExpressionTypeUtil::isComparison(comparison)) {
+        auto left = predicate.getChild(0);
+        auto right = predicate.getChild(1);
+        if (left->expressionType == ExpressionType::LITERAL) {
+            std::swap(left, right);
+            comparison = ExpressionTypeUtil::reverseComparisonDirection(comparison);
+        }
+        if (left->expressionType == ExpressionType::PROPERTY &&
+            right->expressionType == ExpressionType::LITERAL) {
+            property = left->constPtrCast<PropertyExpression>();
+            literalValue =
+                std::make_unique<Value>(right->constCast<LiteralExpression>().getValue());
+            value = literalValue.get();
         }
-    } else {
-        return atLeastOne(
-            childPlan.estCardinality * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
     }
+    const auto defaultSelectivity = getDefaultSelectivity(predicate.expressionType);
+    if (property == nullptr) {
+        return defaultSelectivity;
+    }
+    // Combine the selectivities on each table of the property, weighted by the table sizes.
+    double numRows = 0;
+    double numSelectedRows = 0;
+    for (const auto tableID : property->getTableIDs()) {
+        const auto numTableRows =
+            (double)context->getStorageManager()->getTable(tableID)->getNumRows();
+        auto selectivity = defaultSelectivity;
+        const auto statistics = getStatistics(tableID);
+        if (property->hasProperty(tableID) && statistics != nullptr &&
+            statistics->hasColumnStatistics(property->getPropertyName())) {
+            const auto& columnStatistics =
+                statistics->getColumnStatistics(property->getPropertyName());
+            const auto columnSelectivity =
+                getSelectivity(columnStatistics, comparison, value, property->getDataType());
+            selectivity = columnSelectivity.value_or(defaultSelectivity);
+        }
+        numRows += numTableRows;
+        numSelectedRows += numTableRows * selectivity;
+    }
+    return numRows == 0 ? defaultSelectivity : numSelectedRows / numRows;
 }
 
 uint64_t CardinalityEstimator::getNumNodes(const std::vector<table_id_t>& tableIDs) {
@@ -122,6 +227,52 @@ uint64_t CardinalityEstimator::getNumRels(const std::vector<table_id_t>& tableID
     return atLeastOne(numRels);
 }
 
+const TableStatistics* CardinalityEstimator::getStatistics(table_id_t tableID) const {
+    return context->getCatalog()->getTableCatalogEntry(context->getTx(), tableID)->getStatistics();
+}
+
+uint64_t CardinalityEstimator::getNumDistinctValues(const PropertyExpression& property) {
+    uint64_t numDistinctValues = 0;
+    for (const auto tableID : property.getTableIDs()) {
+        if (!property.hasProperty(tableID)) {
+            continue;
+        }
+        const auto statistics = getStatistics(tableID);
+        if (statistics == nullptr || !statistics->hasColumnStatistics(property.getPropertyName())) {
+            return 0;
+        }
+        numDistinctValues +=
+            statistics->getColumnStatistics(property.getPropertyName()).numDistinctValues;
+    }
+    return numDistinctValues;
+}
+
+double CardinalityEstimator::getExcessDegree(const RelExpression& rel,
+    const NodeExpression& boundNode) const {
+    std::vector<RelDataDirection> directions;
+    if (rel.getDirectionType() == RelDirectionType::BOTH) {
+        directions = {RelDataDirection::FWD, RelDataDirection::BWD};
+    } else if (rel.getSrcNodeName() == boundNode.getUniqueName()) {
+        directions = {RelDataDirection::FWD};
+    } else {
+        directions = {RelDataDirection::BWD};
+    }
+    double numRels = 0;
+    double sumSquaredDegrees = 0;
+    for (const auto tableID : rel.getTableIDs()) {
+        const auto statistics = getStatistics(tableID);
+        if (statistics == nullptr) {
+            return 0;
+        }
+        for (const auto direction : directions) {
+            const auto& degreeStatistics = statistics->getDegreeStatistics(direction);
+            numRels += (double)degreeStatistics.numRels;
+            sumSquaredDegrees += degreeStatistics.sumSquaredDegrees;
+        }
+    }
+    return numRels == 0 ? 0 : sumSquaredDegrees / numRels;
+}
+
 double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     const NodeExpression& boundNode) {
     auto numBoundNodes = (double)getNumNodes(boundNode.getTableIDs());
@@ -134,7 +285,19 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     case QueryRelType::VARIABLE_LENGTH:
     case QueryRelType::SHORTEST:
     case QueryRelType::ALL_SHORTEST: {
-        auto rate = std::min<double>(oneHopExtensionRate * rel.getUpperBound(), numRels);
+        auto rate = oneHopExtensionRate * rel.getUpperBound();
+        const auto excessDegree = getExcessDegree(rel, boundNode);
+        if (excessDegree > 0) {
+            // Nodes are reached in proportion to their degrees, so every hop after the first one
+            // extends by the excess degree instead of the average degree.
+            rate = 0;
+            auto hopRate = oneHopExtensionRate;
+            for (auto i = 0u; i < rel.getUpperBound() && rate < numRels; i++) {
+                rate += hopRate;
+                hopRate *= excessDegree;
+            }
+        }
+        rate = std::min<double>(rate, numRels);
         return rate * context->getClientConfig()->recursivePatternCardinalityScaleFactor;
     }
     default:
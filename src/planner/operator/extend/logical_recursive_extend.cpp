@@ -29,6 +29,9 @@ void LogicalRecursiveExtend::computeFlatSchema() {
     }
     auto rewriter = optimizer::RemoveFactorizationRewriter();
     rewriter.visitOperator(recursiveChild);
+    if (reverseRecursiveChild != nullptr) {
+        rewriter.visitOperator(reverseRecursiveChild);
+    }
 }
 
 void LogicalRecursiveExtend::computeFactorizedSchema() {
@@ -45,6 +48,9 @@ void LogicalRecursiveExtend::computeFactorizedSchema() {
     }
     auto rewriter = optimizer::FactorizationRewriter();
     rewriter.visitOperator(recursiveChild.get());
+    if (reverseRecursiveChild != nullptr) {
+        rewriter.visitOperator(reverseRecursiveChild.get());
+    }
 }
 
 void LogicalPathPropertyProbe::computeFactorizedSchema() {
@@ -195,6 +195,17 @@ void Planner::appendRecursiveExtendAsGDS(const std::shared_ptr<NodeExpression>&
     appendHashJoin(joinConditions, JoinType::INNER, probePlan, plan, plan);
 }
 
+static ExtendDirection getReverseExtendDirection(ExtendDirection direction) {
+    switch (direction) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    default:
+        return direction;
+    }
+}
+
 void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& boundNode,
     const std::shared_ptr<NodeExpression>& nbrNode, const std::shared_ptr<RelExpression>& rel,
     ExtendDirection direction, LogicalPlan& plan) {
@@ -213,6 +224,15 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     auto extend = std::make_shared<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
         extendFromSource, RecursiveJoinType::TRACK_PATH, plan.getLastOperator(),
         recursivePlan->getLastOperator(), printInfo->copy());
+    // A shortest path join can search from both ends of a path if it does not filter intermediate
+    // nodes. The predicate of an intermediate node is checked when it is extended, which the node
+    // where the two searches meet never is.
+    if (rel->getRelType() == QueryRelType::SHORTEST && recursiveInfo->nodePredicate == nullptr) {
+        auto reverseRecursivePlan = std::make_unique<LogicalPlan>();
+        createRecursivePlan(*recursiveInfo, getReverseExtendDirection(direction),
+            extendFromSource, *reverseRecursivePlan);
+        extend->setReverseRecursiveChild(reverseRecursivePlan->getLastOperator());
+    }
     appendFlattens(extend->getGroupsPosToFlatten(), plan);
     extend->setChild(0, plan.getLastOperator());
     extend->computeFactorizedSchema();
@@ -5,6 +5,7 @@
 #include "processor/operator/aggregate/simple_aggregate.h"
 #include "processor/operator/aggregate/simple_aggregate_scan.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -142,6 +143,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(const expressi
     allKeys.insert(allKeys.end(), payloads.begin(), payloads.end());
     auto aggregateInputInfos = getAggregateInputInfos(allKeys, aggregates, *inSchema);
     auto sharedState = std::make_shared<HashAggregateSharedState>(aggFunctions);
+    // Spilled input is replayed into fresh partitions, which would count distinct values again.
+    auto hasDistinctAggregate = std::any_of(aggFunctions.begin(), aggFunctions.end(),
+        [](const AggregateFunction& function) { return function.isFunctionDistinct(); });
+    if (!hasDistinctAggregate) {
+        // Partition the remaining input to disk once groups outgrow their share of the buffer
+        // pool.
+        clientContext->getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+            [&](auto& spiller) {
+                sharedState->enableSpilling(&spiller, getSpillingMemoryLimit());
+            });
+    }
     auto flatKeys = getKeyExpressions(keys, *inSchema, true /* isFlat */);
     auto unFlatKeys = getKeyExpressions(keys, *inSchema, false /* isFlat */);
     auto tableSchema = getFactorizedTableSchema(flatKeys, unFlatKeys, payloads, aggFunctions);
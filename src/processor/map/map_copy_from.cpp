@@ -74,6 +74,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapCopyNodeFrom(LogicalOperator* l
     auto sharedState = std::make_shared<NodeBatchInsertSharedState>(nodeTable, pkColumnID,
         pkDefinition.getType().copy(), fTable, &storageManager->getWAL(),
         clientContext->getMemoryManager());
+    sharedState->initStatisticsCollector(*nodeTableEntry);
 
     if (prevOperator->getOperatorType() == PhysicalOperatorType::TABLE_FUNCTION_CALL) {
         const auto call = prevOperator->ptrCast<TableFunctionCall>();
@@ -193,6 +194,7 @@ physical_op_vector_t PlanMapper::mapCopyRelFrom(LogicalOperator* logicalOperator
         FactorizedTableUtils::getSingleStringColumnFTable(clientContext->getMemoryManager());
     const auto batchInsertSharedState = std::make_shared<BatchInsertSharedState>(relTable, fTable,
         &storageManager->getWAL(), clientContext->getMemoryManager());
+    batchInsertSharedState->initStatisticsCollector(relTableEntry);
     auto copyRelFWD = createCopyRel(partitionerSharedState, batchInsertSharedState, copyFrom,
         RelDataDirection::FWD, LogicalType::copy(columnTypes));
     auto copyRelBWD = createCopyRel(partitionerSharedState, batchInsertSharedState, copyFrom,
@@ -1,4 +1,5 @@
 #include "binder/expression/node_expression.h"
+#include "graph/graph_cache.h"
 #include "graph/on_disk_graph.h"
 #include "planner/operator/logical_gds_call.h"
 #include "processor/operator/gds_call.h"
@@ -14,6 +15,25 @@ using namespace kuzu::storage;
 namespace kuzu {
 namespace processor {
 
+// Returns a cached in-memory copy of the projected graph if graph caching is enabled. Only
+// read-only transactions use the cache, since write transactions may see their own changes.
+static std::unique_ptr<Graph> getGraph(main::ClientContext* context, const GraphEntry& entry) {
+    auto graph = std::make_unique<OnDiskGraph>(context, entry);
+    auto cache = context->getGraphCache();
+    auto transaction = context->getTx();
+    if (!context->getClientConfig()->enableGraphCache || cache == nullptr ||
+        !transaction->isReadOnly()) {
+        return graph;
+    }
+    auto key = GraphCache::getKey(entry);
+    auto data = cache->get(key, transaction->getStartTS());
+    if (data == nullptr) {
+        data = InMemoryGraphData::materialize(*graph);
+        cache->put(key, transaction->getStartTS(), data);
+    }
+    return std::make_unique<InMemoryGraph>(std::move(data));
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapGDSCall(LogicalOperator* logicalOperator) {
     auto& call = logicalOperator->constCast<LogicalGDSCall>();
     auto outSchema = call.getSchema();
@@ -27,7 +47,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapGDSCall(LogicalOperator* logica
     }
     auto table =
         std::make_shared<FactorizedTable>(clientContext->getMemoryManager(), tableSchema->copy());
-    auto graph = std::make_unique<OnDiskGraph>(clientContext, call.getInfo().graphEntry);
+    auto graph = getGraph(clientContext, call.getInfo().graphEntry);
     common::table_id_map_t<std::unique_ptr<NodeOffsetLevelSemiMask>> masks;
     if (call.getInfo().getBindData()->hasNodeInput()) {
         // Generate an empty semi mask which later on picked by SemiMaker.
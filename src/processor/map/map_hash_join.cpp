@@ -3,6 +3,7 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::planner;
@@ -86,6 +87,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    // Partition the build side to disk once it outgrows its share of the buffer pool.
+    clientContext->getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+        [&](auto& spiller) { sharedState->enableSpilling(&spiller, getSpillingMemoryLimit()); });
     auto buildPrintInfo = std::make_unique<HashJoinBuildPrintInfo>(buildKeys, payloads);
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema),
@@ -108,6 +112,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     } else {
         probeDataInfo.markDataPos = DataPos::getInvalidPos();
     }
+    for (auto& expression : hashJoin->getChild(0)->getSchema()->getExpressionsInScope()) {
+        if (outSchema->isExpressionInScope(*expression)) {
+            probeDataInfo.probeSideDataPos.emplace_back(outSchema->getExpressionPos(*expression));
+        }
+    }
     auto probePrintInfo = std::make_unique<HashJoinProbePrintInfo>(probeKeys);
     auto hashJoinProbe = make_unique<HashJoinProbe>(sharedState, hashJoin->getJoinType(),
         hashJoin->requireFlatProbeKeys(), probeDataInfo, std::move(probeSidePrevOperator),
@@ -56,6 +56,19 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
         dataInfo.recursiveEdgeDirectionPos =
             getDataPos(*recursiveInfo->rel->getDirectionExpr(), *recursivePlanSchema);
     }
+    // Map the reverse recursive plan, which appends the same operators as the recursive plan and
+    // thus keeps the recursive vectors at the same positions.
+    std::unique_ptr<PhysicalOperator> reverseRecursiveRoot;
+    if (auto logicalReverseRoot = extend->getReverseRecursiveChild()) {
+        auto reversePlanSchema = logicalReverseRoot->getSchema();
+        KU_ASSERT(getDataPos(*recursiveInfo->nodeCopy->getInternalID(), *reversePlanSchema) ==
+                  dataInfo.recursiveDstNodeIDPos);
+        KU_ASSERT(getDataPos(*recursiveInfo->rel->getInternalIDProperty(), *reversePlanSchema) ==
+                  dataInfo.recursiveEdgeIDPos);
+        reverseRecursiveRoot = mapOperator(logicalReverseRoot.get());
+        dataInfo.reverseLocalResultSetDescriptor =
+            std::make_unique<ResultSetDescriptor>(reversePlanSchema);
+    }
     if (extend->getJoinType() == RecursiveJoinType::TRACK_PATH) {
         dataInfo.pathPos = getDataPos(*rel, *outSchema);
     } else {
@@ -76,7 +89,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     auto printInfo = std::make_unique<OPPrintInfo>();
     return std::make_unique<RecursiveJoin>(std::move(info), sharedState, std::move(prevOperator),
-        getOperatorID(), std::move(recursiveRoot), std::move(printInfo));
+        getOperatorID(), std::move(recursiveRoot), std::move(reverseRecursiveRoot),
+        std::move(printInfo));
 }
 
 } // namespace processor
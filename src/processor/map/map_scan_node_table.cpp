@@ -13,6 +13,20 @@ using namespace kuzu::planner;
 namespace kuzu {
 namespace processor {
 
+// Pre-fills the semi mask with the candidates from the secondary index, so the scan only reads
+// vectors that may contain matching nodes. Semi maskers registered later AND with this mask.
+static void initSemiMaskFromPropertyIndex(const storage::NodeTable& table, column_id_t columnID,
+    const PropertyIndexScanInfo& info, NodeSemiMask& semiMask) {
+    const auto propertyIndex = table.getPropertyIndex(columnID);
+    if (propertyIndex == nullptr) {
+        return;
+    }
+    KU_ASSERT(semiMask.getNumMasks() == 0);
+    semiMask.incrementNumMasks();
+    propertyIndex->lookup(info.predicates,
+        [&](offset_t offset) { semiMask.incrementMaskValue(offset, 0 /* currentMaskValue */); });
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(LogicalOperator* logicalOperator) {
     auto catalog = clientContext->getCatalog();
     auto storageManager = clientContext->getStorageManager();
@@ -43,6 +57,13 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(LogicalOperator*
     for (auto& tableID : tableIDs) {
         auto table = storageManager->getTable(tableID)->ptrCast<storage::NodeTable>();
         auto semiMask = std::make_unique<NodeVectorLevelSemiMask>(tableID, table->getNumRows());
+        if (scan.getScanType() == LogicalScanNodeTableType::SCAN &&
+            scan.getExtraInfo() != nullptr) {
+            auto& indexScanInfo = scan.getExtraInfo()->constCast<PropertyIndexScanInfo>();
+            const auto tableEntry = catalog->getTableCatalogEntry(transaction, tableID);
+            initSemiMaskFromPropertyIndex(*table,
+                tableEntry->getColumnID(indexScanInfo.propertyName), indexScanInfo, *semiMask);
+        }
         sharedStates.push_back(std::make_shared<ScanNodeTableSharedState>(std::move(semiMask)));
     }
 
@@ -1,5 +1,8 @@
 #include "processor/plan_mapper.h"
 
+#include "main/client_context.h"
+#include "main/db_config.h"
+#include "planner/operator/logical_aggregate.h"
 #include "processor/operator/profile.h"
 
 using namespace kuzu::common;
@@ -15,8 +18,27 @@ static void setPhysicalPlanIfProfile(const LogicalPlan* logicalPlan, PhysicalPla
     }
 }
 
+static uint64_t getNumSpillingOperators(const LogicalOperator& logicalOperator) {
+    uint64_t numOperators = 0;
+    switch (logicalOperator.getOperatorType()) {
+    case LogicalOperatorType::HASH_JOIN: {
+        numOperators++;
+    } break;
+    case LogicalOperatorType::AGGREGATE: {
+        numOperators += logicalOperator.constCast<LogicalAggregate>().hasKeys();
+    } break;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < logicalOperator.getNumChildren(); i++) {
+        numOperators += getNumSpillingOperators(*logicalOperator.getChild(i));
+    }
+    return numOperators;
+}
+
 std::unique_ptr<PhysicalPlan> PlanMapper::mapLogicalPlanToPhysical(const LogicalPlan* logicalPlan,
     const binder::expression_vector& expressionsToCollect) {
+    numSpillingOperators = getNumSpillingOperators(*logicalPlan->getLastOperator());
     auto lastOperator = mapOperator(logicalPlan->getLastOperator().get());
     lastOperator = createResultCollector(AccumulateType::REGULAR, expressionsToCollect,
         logicalPlan->getSchema(), std::move(lastOperator));
@@ -25,6 +47,11 @@ std::unique_ptr<PhysicalPlan> PlanMapper::mapLogicalPlanToPhysical(const Logical
     return physicalPlan;
 }
 
+uint64_t PlanMapper::getSpillingMemoryLimit() const {
+    return clientContext->getDBConfig()->bufferPoolSize / 2 /
+           std::max<uint64_t>(numSpillingOperators, 1);
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logicalOperator) {
     std::unique_ptr<PhysicalOperator> physicalOperator;
     switch (logicalOperator->getOperatorType()) {
@@ -1,6 +1,7 @@
 #include "processor/operator/aggregate/aggregate_hash_table.h"
 
 #include "common/utils.h"
+#include "processor/result/spilled_partitions.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -62,6 +63,15 @@ bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
 }
 
 void AggregateHashTable::merge(AggregateHashTable& other) {
+    std::vector<uint8_t*> tuples;
+    tuples.reserve(other.getNumEntries());
+    for (auto i = 0u; i < other.getNumEntries(); i++) {
+        tuples.push_back(other.getEntry(i));
+    }
+    merge(other, tuples);
+}
+
+void AggregateHashTable::merge(AggregateHashTable& other, std::vector<uint8_t*>& tuples) {
     std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
     std::vector<ValueVector*> vectorsToScan(keyTypes.size() + payloadTypes.size());
     std::vector<ValueVector*> groupByHashVectors(keyTypes.size());
@@ -91,10 +101,11 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
     // Note: we store hash values at the last column of factorizedTable.
     colIdxesToScan.push_back(factorizedTable->getTableSchema()->getNumColumns() - 1);
     uint64_t startTupleIdx = 0;
-    while (startTupleIdx < other.factorizedTable->getNumTuples()) {
-        auto numTuplesToScan = std::min(other.factorizedTable->getNumTuples() - startTupleIdx,
-            DEFAULT_VECTOR_CAPACITY);
-        other.factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
+    while (startTupleIdx < tuples.size()) {
+        auto numTuplesToScan = std::min(tuples.size() - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
+        resizeHashTableIfNecessary(numTuplesToScan);
+        other.factorizedTable->lookup(vectorsToScan, colIdxesToScan, tuples.data(), startTupleIdx,
+            numTuplesToScan);
         findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors,
             vectorsToScanState.get());
         auto aggregateStateOffset = aggStateColOffsetInFT;
@@ -102,8 +113,7 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
             for (auto i = 0u; i < numTuplesToScan; i++) {
                 aggregateFunction.combineState(hashSlotsToUpdateAggState[i]->entry +
                                                    aggregateStateOffset,
-                    other.factorizedTable->getTuple(startTupleIdx + i) + aggregateStateOffset,
-                    &memoryManager);
+                    tuples[startTupleIdx + i] + aggregateStateOffset, &memoryManager);
             }
             aggregateStateOffset += aggregateFunction.getAggregateStateSize();
         }
@@ -111,6 +121,42 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
     }
 }
 
+std::vector<std::vector<uint8_t*>> AggregateHashTable::partitionEntries(
+    ft_block_idx_t blockIdx) const {
+    std::vector<std::vector<uint8_t*>> partitions(SpilledPartitions::NUM_PARTITIONS);
+    auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    auto& tupleBlock = factorizedTable->getTupleDataBlocks()[blockIdx];
+    uint8_t* tuple = tupleBlock->getData();
+    for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+        auto hash = *(hash_t*)(tuple + hashColOffsetInFT);
+        partitions[SpilledPartitions::getPartitionIdx(hash)].push_back(tuple);
+        tuple += numBytesPerTuple;
+    }
+    return partitions;
+}
+
+void AggregateHashTable::releaseTupleBlock(ft_block_idx_t blockIdx) {
+    hashSlotsBlocks.clear();
+    factorizedTable->releaseTupleDataBlock(blockIdx);
+}
+
+std::unique_ptr<AggregateHashTable> AggregateHashTable::createEmptyCopy(
+    uint64_t numEntriesToAllocate) const {
+    std::vector<LogicalType> distinctAggKeyTypes;
+    for (auto& distinctHT : distinctHashTables) {
+        // The distinct key is the last key of a distinct hash table.
+        distinctAggKeyTypes.push_back(
+            distinctHT ? distinctHT->getKeyTypes().back().copy() : LogicalType::ANY());
+    }
+    return std::make_unique<AggregateHashTable>(memoryManager, LogicalType::copy(keyTypes),
+        LogicalType::copy(payloadTypes), aggregateFunctions, distinctAggKeyTypes,
+        numEntriesToAllocate, factorizedTable->getTableSchema()->copy());
+}
+
+uint64_t AggregateHashTable::getMemoryUsage() const {
+    return factorizedTable->getMemoryUsage() + hashSlotsBlocks.size() * HASH_BLOCK_SIZE;
+}
+
 void AggregateHashTable::finalizeAggregateStates() {
     for (auto i = 0u; i < getNumEntries(); ++i) {
         auto entry = getEntry(i);
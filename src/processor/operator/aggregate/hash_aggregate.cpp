@@ -2,6 +2,7 @@
 
 #include "binder/expression/expression_util.h"
 #include "common/utils.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -19,44 +20,120 @@ std::string HashAggregatePrintInfo::toString() const {
     return result;
 }
 
+HashAggregateSharedState::~HashAggregateSharedState() {
+    if (spilled) {
+        spiller->releaseFile();
+    }
+}
+
 void HashAggregateSharedState::appendAggregateHashTable(
     std::unique_ptr<AggregateHashTable> aggregateHashTable) {
-    std::unique_lock lck{mtx};
-    localAggregateHashTables.push_back(std::move(aggregateHashTable));
+    {
+        std::unique_lock lck{mtx};
+        numEntries += aggregateHashTable->getNumEntries();
+        if (emptyHashTable == nullptr) {
+            emptyHashTable = aggregateHashTable->createEmptyCopy(0 /* numEntriesToAllocate */);
+        }
+    }
+    // Blocks are released as soon as their groups have been merged, so that the groups are only
+    // held once in memory while moving into the partitions.
+    for (auto blockIdx = 0u; blockIdx < aggregateHashTable->getNumTupleBlocks(); blockIdx++) {
+        auto partitionEntries = aggregateHashTable->partitionEntries(blockIdx);
+        for (auto partitionIdx = 0u; partitionIdx < SpilledPartitions::NUM_PARTITIONS;
+             partitionIdx++) {
+            auto& entries = partitionEntries[partitionIdx];
+            if (entries.empty()) {
+                continue;
+            }
+            std::unique_lock lck{partitionMtxes[partitionIdx]};
+            auto& partition = partitionHashTables[partitionIdx];
+            if (partition == nullptr) {
+                partition = emptyHashTable->createEmptyCopy(entries.size());
+            }
+            partition->merge(*aggregateHashTable, entries);
+        }
+        aggregateHashTable->releaseTupleBlock(blockIdx);
+    }
 }
 
-void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
-    std::unique_lock lck{mtx};
-    if (localAggregateHashTables.size() == 1) {
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-    } else {
-        auto numEntries = 0u;
-        for (auto& ht : localAggregateHashTables) {
-            numEntries += ht->getNumEntries();
+std::unique_ptr<AggregateHashTable> HashAggregateSharedState::getNextPartition(
+    MemoryManager* memoryManager) {
+    uint64_t partitionIdx = 0;
+    // All local tables have been merged into the partitions at this point, and each partition is
+    // only claimed once, so partitions can be finalized concurrently.
+    while (true) {
+        partitionIdx = nextPartitionIdx++;
+        if (partitionIdx >= SpilledPartitions::NUM_PARTITIONS) {
+            return nullptr;
         }
-        localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-        for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
-            globalAggregateHashTable->merge(*localAggregateHashTables[i]);
+        if (partitionHashTables[partitionIdx] != nullptr ||
+            (spilled && !spilledPartitions.getRuns(partitionIdx).empty())) {
+            break;
         }
     }
+    auto partition = std::move(partitionHashTables[partitionIdx]);
+    if (partition == nullptr) {
+        partition = emptyHashTable->createEmptyCopy(0 /* numEntriesToAllocate */);
+    }
+    if (spilled) {
+        appendSpilledPartition(*partition, partitionIdx, memoryManager);
+    }
+    partition->finalizeAggregateStates();
+    return partition;
 }
 
-void HashAggregateSharedState::finalizeAggregateHashTable() {
-    std::unique_lock lck{mtx};
-    globalAggregateHashTable->finalizeAggregateStates();
+void HashAggregateSharedState::appendSpilledPartition(AggregateHashTable& hashTable,
+    uint64_t partitionIdx, MemoryManager* memoryManager) {
+    SpilledPartitionReader reader{spiller, spilledPartitions.getRuns(partitionIdx),
+        memoryManager};
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    while (reader.readBatch(vectors)) {
+        auto vectorIdx = 0u;
+        auto nextVectors = [&](uint32_t numVectors) {
+            std::vector<ValueVector*> result;
+            for (auto i = 0u; i < numVectors; i++) {
+                result.push_back(vectors[vectorIdx++].get());
+            }
+            return result;
+        };
+        auto flatKeyVectors = nextVectors(spillLayout.numFlatKeys);
+        auto unFlatKeyVectors = nextVectors(spillLayout.numUnFlatKeys);
+        auto dependentKeyVectors = nextVectors(spillLayout.numDependentKeys);
+        std::vector<AggregateInput> aggregateInputs;
+        std::vector<std::unique_ptr<DataChunk>> multiplicityChunks;
+        for (auto i = 0u; i < spillLayout.hasAggregateVector.size(); i++) {
+            AggregateInput aggregateInput;
+            if (spillLayout.hasAggregateVector[i]) {
+                aggregateInput.aggregateVector = vectors[vectorIdx++].get();
+            }
+            for (auto j = 0u; j < spillLayout.numMultiplicityChunks[i]; j++) {
+                auto chunk = std::make_unique<DataChunk>(0, vectors[vectorIdx++]->state);
+                aggregateInput.multiplicityChunks.push_back(chunk.get());
+                multiplicityChunks.push_back(std::move(chunk));
+            }
+            aggregateInputs.push_back(std::move(aggregateInput));
+        }
+        auto leadingState = unFlatKeyVectors.empty() ? flatKeyVectors[0]->state.get() :
+                                                       unFlatKeyVectors[0]->state.get();
+        // Batches were written once per unit of result set multiplicity.
+        hashTable.append(flatKeyVectors, unFlatKeyVectors, dependentKeyVectors, leadingState,
+            aggregateInputs, 1 /* resultSetMultiplicity */);
+    }
+}
+
+double HashAggregateSharedState::getProgress() const {
+    auto numClaimedPartitions =
+        std::min(nextPartitionIdx.load(), SpilledPartitions::NUM_PARTITIONS);
+    return static_cast<double>(numClaimedPartitions) / SpilledPartitions::NUM_PARTITIONS;
 }
 
-std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
+void HashAggregateSharedState::startSpilling(HashAggregateSpillLayout layout) {
     std::unique_lock lck{mtx};
-    if (currentOffset >= globalAggregateHashTable->getNumEntries()) {
-        return std::make_pair(currentOffset, currentOffset);
-    }
-    auto startOffset = currentOffset;
-    auto range = std::min(DEFAULT_VECTOR_CAPACITY,
-        globalAggregateHashTable->getNumEntries() - currentOffset);
-    currentOffset += range;
-    return std::make_pair(startOffset, startOffset + range);
+    if (!spilled) {
+        spiller->retainFile();
+        spillLayout = std::move(layout);
+        spilled = true;
+    }
 }
 
 HashAggregateInfo::HashAggregateInfo(std::vector<DataPos> flatKeysPos,
@@ -103,6 +180,53 @@ uint64_t HashAggregateLocalState::append(const std::vector<AggregateInput>& aggr
         leadingState, aggregateInputs, multiplicity);
 }
 
+HashAggregateSpillLayout HashAggregateLocalState::getSpillLayout(
+    const std::vector<AggregateInput>& aggregateInputs) const {
+    HashAggregateSpillLayout layout;
+    layout.numFlatKeys = flatKeyVectors.size();
+    layout.numUnFlatKeys = unFlatKeyVectors.size();
+    layout.numDependentKeys = dependentKeyVectors.size();
+    for (auto& aggregateInput : aggregateInputs) {
+        layout.hasAggregateVector.push_back(aggregateInput.aggregateVector != nullptr);
+        layout.numMultiplicityChunks.push_back(aggregateInput.multiplicityChunks.size());
+    }
+    return layout;
+}
+
+void HashAggregateLocalState::initSpillWriter(Spiller* spiller, SpilledPartitions* partitions,
+    MemoryManager* memoryManager, const std::vector<AggregateInput>& aggregateInputs) {
+    if (spillWriter) {
+        return;
+    }
+    spillWriter = std::make_unique<SpilledPartitionWriter>(spiller, partitions, memoryManager);
+    spillKeyVectors = flatKeyVectors;
+    spillKeyVectors.insert(spillKeyVectors.end(), unFlatKeyVectors.begin(),
+        unFlatKeyVectors.end());
+    spillVectors = spillKeyVectors;
+    spillVectors.insert(spillVectors.end(), dependentKeyVectors.begin(),
+        dependentKeyVectors.end());
+    for (auto& aggregateInput : aggregateInputs) {
+        if (aggregateInput.aggregateVector) {
+            spillVectors.push_back(aggregateInput.aggregateVector);
+        }
+        for (auto& chunk : aggregateInput.multiplicityChunks) {
+            // Only the size of a multiplicity chunk matters, so write a null vector in its state.
+            auto vector = std::make_unique<ValueVector>(LogicalType::BOOL(), memoryManager);
+            vector->state = chunk->state;
+            vector->setAllNull();
+            spillVectors.push_back(vector.get());
+            multiplicityVectors.push_back(std::move(vector));
+        }
+    }
+}
+
+uint64_t HashAggregateLocalState::spill(uint64_t multiplicity) const {
+    for (auto i = 0u; i < multiplicity; i++) {
+        spillWriter->write(spillKeyVectors, spillVectors);
+    }
+    return leadingState->getSelVector().getSelSize() * multiplicity;
+}
+
 void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     BaseAggregate::initLocalStateInternal(resultSet, context);
     std::vector<LogicalType> distinctAggKeyTypes;
@@ -114,16 +238,33 @@ void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
 }
 
 void HashAggregate::executeInternal(ExecutionContext* context) {
+    auto memoryManager = context->clientContext->getMemoryManager();
     while (children[0]->getNextTuple(context)) {
+        if (sharedState->isSpilled()) {
+            localState.initSpillWriter(sharedState->getSpiller(),
+                sharedState->getSpilledPartitions(), memoryManager, aggInputs);
+            metrics->numOutputTuple.increase(localState.spill(resultSet->multiplicity));
+            continue;
+        }
         const auto numAppendedFlatTuples = localState.append(aggInputs, resultSet->multiplicity);
         metrics->numOutputTuple.increase(numAppendedFlatTuples);
+        if (sharedState->canSpill()) {
+            auto memoryUsage = localState.aggregateHashTable->getMemoryUsage();
+            sharedState->increaseMemoryUsage(memoryUsage - localState.memoryUsage);
+            localState.memoryUsage = memoryUsage;
+            if (sharedState->exceedsMemoryLimit()) {
+                sharedState->startSpilling(localState.getSpillLayout(aggInputs));
+            }
+        }
+    }
+    if (localState.spillWriter) {
+        localState.spillWriter->flush();
     }
     sharedState->appendAggregateHashTable(std::move(localState.aggregateHashTable));
 }
 
-void HashAggregate::finalizeInternal(ExecutionContext* context) {
-    sharedState->combineAggregateHashTable(*context->clientContext->getMemoryManager());
-    sharedState->finalizeAggregateHashTable();
+void HashAggregate::finalizeInternal(ExecutionContext* /*context*/) {
+    // Partitions are merged and finalized in parallel by HashAggregateScan.
 }
 
 } // namespace processor
@@ -1,5 +1,8 @@
 #include "processor/operator/aggregate/hash_aggregate_scan.h"
 
+#include "main/client_context.h"
+
+using namespace kuzu::common;
 using namespace kuzu::function;
 
 namespace kuzu {
@@ -15,18 +18,24 @@ void HashAggregateScan::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
     iota(groupByKeyVectorsColIdxes.begin(), groupByKeyVectorsColIdxes.end(), 0);
 }
 
-bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
-    auto [startOffset, endOffset] = sharedState->getNextRangeToRead();
-    if (startOffset >= endOffset) {
-        return false;
+bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* context) {
+    while (partition == nullptr || currentOffset >= partition->getNumEntries()) {
+        partition = sharedState->getNextPartition(context->clientContext->getMemoryManager());
+        currentOffset = 0;
+        if (partition == nullptr) {
+            return false;
+        }
     }
-    auto numRowsToScan = endOffset - startOffset;
-    sharedState->getFactorizedTable()->scan(groupByKeyVectors, startOffset, numRowsToScan,
+    auto startOffset = currentOffset;
+    auto numRowsToScan =
+        std::min(DEFAULT_VECTOR_CAPACITY, partition->getNumEntries() - currentOffset);
+    currentOffset += numRowsToScan;
+    auto factorizedTable = partition->getFactorizedTable();
+    factorizedTable->scan(groupByKeyVectors, startOffset, numRowsToScan,
         groupByKeyVectorsColIdxes);
     for (auto pos = 0u; pos < numRowsToScan; ++pos) {
-        auto entry = sharedState->getRow(startOffset + pos);
-        auto offset = sharedState->getFactorizedTable()->getTableSchema()->getColOffset(
-            groupByKeyVectors.size());
+        auto entry = partition->getEntry(startOffset + pos);
+        auto offset = factorizedTable->getTableSchema()->getColOffset(groupByKeyVectors.size());
         for (auto& vector : aggregateVectors) {
             auto aggState = (AggregateState*)(entry + offset);
             writeAggregateResultToVector(*vector, pos, aggState);
@@ -38,13 +47,7 @@ bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
 }
 
 double HashAggregateScan::getProgress(ExecutionContext* /*context*/) const {
-    uint64_t totalNumTuples = sharedState->getFactorizedTable()->getNumTuples();
-    if (totalNumTuples == 0) {
-        return 0.0;
-    } else if (sharedState->getCurrentOffset() == totalNumTuples) {
-        return 1.0;
-    }
-    return static_cast<double>(sharedState->getCurrentOffset()) / totalNumTuples;
+    return sharedState->getProgress();
 }
 
 } // namespace processor
@@ -2,10 +2,13 @@
 
 #include "catalog/catalog.h"
 #include "common/enums/alter_type.h"
+#include "common/exception/runtime.h"
 #include "storage/storage_manager.h"
-#include "storage/store/table.h"
+#include "storage/store/node_table.h"
+#include "transaction/transaction_manager.h"
 
 using namespace kuzu::binder;
+using namespace kuzu::transaction;
 
 namespace kuzu {
 namespace processor {
@@ -14,6 +17,14 @@ void Alter::executeDDLInternal(ExecutionContext* context) {
     auto catalog = context->clientContext->getCatalog();
     auto transaction = context->clientContext->getTx();
     const auto storageManager = context->clientContext->getStorageManager();
+    // Tuples committed by a concurrent writer between the build scan and the registration of the
+    // index could be missed, so an index can only be created by the only active writer.
+    if (info.alterType == common::AlterType::CREATE_INDEX &&
+        context->clientContext->getTransactionManagerUnsafe()->getNumActiveWriteTransactions() >
+            1) {
+        throw common::RuntimeException(
+            "Cannot create an index while other write transactions are active.");
+    }
     catalog->alterTableEntry(transaction, info);
     if (info.alterType == common::AlterType::ADD_PROPERTY) {
         auto& boundAddPropInfo = info.extraInfo->constCast<BoundExtraAddPropertyInfo>();
@@ -27,13 +38,30 @@ void Alter::executeDDLInternal(ExecutionContext* context) {
         const auto schema = context->clientContext->getCatalog()->getTableCatalogEntry(
             context->clientContext->getTx(), info.tableName);
         storageManager->getTable(schema->getTableID())->dropColumn();
+    } else if (info.alterType == common::AlterType::CREATE_INDEX) {
+        auto& propertyName = info.extraInfo->constCast<BoundExtraIndexInfo>().propertyName;
+        const auto entry = catalog->getTableCatalogEntry(transaction, info.tableName);
+        auto& nodeTable = storageManager->getTable(entry->getTableID())->cast<storage::NodeTable>();
+        // Index all committed tuples, including the ones committed after this transaction started,
+        // together with the local updates of this transaction.
+        Transaction buildTransaction{TransactionType::WRITE, transaction->getID(),
+            Transaction::START_TRANSACTION_ID - 1};
+        nodeTable.buildPropertyIndex(&buildTransaction, entry->getColumnID(propertyName));
     }
+    // Dropping an index only alters the catalog. The index is released by the next checkpoint, as
+    // transactions started before this one may still be using it.
 }
 
 std::string Alter::getOutputMsg() {
     if (info.alterType == common::AlterType::COMMENT) {
         return common::stringFormat("Table {} comment updated.", info.tableName);
     }
+    if (info.alterType == common::AlterType::CREATE_INDEX ||
+        info.alterType == common::AlterType::DROP_INDEX) {
+        return common::stringFormat("Index on {}({}) {}.", info.tableName,
+            info.extraInfo->constCast<BoundExtraIndexInfo>().propertyName,
+            info.alterType == common::AlterType::CREATE_INDEX ? "created" : "dropped");
+    }
     return common::stringFormat("Table {} altered.", info.tableName);
 }
 
@@ -1,6 +1,9 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
+#include <numeric>
+
 #include "binder/expression/expression_util.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -18,9 +21,164 @@ std::string HashJoinBuildPrintInfo::toString() const {
     return result;
 }
 
-void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
+HashJoinSharedState::~HashJoinSharedState() {
+    if (spilled) {
+        spiller->releaseFile();
+    }
+}
+
+bool HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     std::unique_lock lck(mtx);
+    if (spilled) {
+        return false;
+    }
     hashTable->merge(localHashTable);
+    return true;
+}
+
+void HashJoinSharedState::startSpilling() {
+    std::unique_lock lck(mtx);
+    if (!spilled) {
+        spiller->retainFile();
+        spilled = true;
+    }
+}
+
+void HashJoinSharedState::startPartitioningProbeSide() {
+    std::unique_lock lck(mtx);
+    KU_ASSERT(!spilledJoinStarted);
+    numProbePartitioners++;
+}
+
+void HashJoinSharedState::finishPartitioningProbeSide() {
+    std::unique_lock lck(mtx);
+    numProbePartitioners--;
+    cv.notify_all();
+}
+
+void HashJoinSharedState::waitForProbePartitioners() {
+    std::unique_lock lck(mtx);
+    // Probe threads pull their input from shared morsels, so once a thread has run out of input
+    // only threads which already started partitioning can still add probe tuples.
+    cv.wait(lck, [&] { return numProbePartitioners == 0; });
+}
+
+bool HashJoinSharedState::getNextSpilledProbeRun(SpilledProbeRun& probeRun,
+    const std::vector<idx_t>& probeKeyIdxes, MemoryManager* memoryManager) {
+    probeRun.hashTable.reset();
+    std::unique_lock lck(mtx);
+    if (!spilledJoinStarted) {
+        spilledJoinStarted = true;
+        spilledLevels.emplace_back(&spilledPartitions, &spilledProbePartitions, UINT64_MAX);
+    }
+    while (partitionHashTable == nullptr || nextProbeRunIdx == partitionProbeRuns->size()) {
+        // The hash table of the previous partition is released once the threads still probing it
+        // are done, without waiting for them.
+        partitionHashTable.reset();
+        if (!loadNextSpilledPartition(probeKeyIdxes, memoryManager)) {
+            return false;
+        }
+    }
+    probeRun.hashTable = partitionHashTable;
+    probeRun.run = (*partitionProbeRuns)[nextProbeRunIdx++];
+    return true;
+}
+
+// The in-memory hash table of a partition is larger than its spilled tuples, and the table of the
+// previous partition can still be probed while the next one is built, so a partition is only built
+// if its spilled size is below half of the memory limit.
+bool HashJoinSharedState::loadNextSpilledPartition(const std::vector<idx_t>& probeKeyIdxes,
+    MemoryManager* memoryManager) {
+    while (!spilledLevels.empty()) {
+        auto& level = spilledLevels.back();
+        if (level.nextPartitionIdx == SpilledPartitions::NUM_PARTITIONS) {
+            spilledLevels.pop_back();
+            continue;
+        }
+        auto partitionIdx = level.nextPartitionIdx++;
+        auto& probeRuns = level.probePartitions->getRuns(partitionIdx);
+        if (probeRuns.empty()) {
+            continue;
+        }
+        auto numBytes = level.buildPartitions->getNumBytes(partitionIdx);
+        if (numBytes > memoryLimit / 2 &&
+            level.buildPartitions->getLevel() < SpilledPartitions::MAX_LEVEL &&
+            numBytes < level.parentNumBytes / 10 * 9) {
+            repartition(level, partitionIdx, probeKeyIdxes, memoryManager);
+            continue;
+        }
+        buildPartitionHashTable(level.buildPartitions->getRuns(partitionIdx), memoryManager);
+        partitionProbeRuns = &probeRuns;
+        nextProbeRunIdx = 0;
+        return true;
+    }
+    return false;
+}
+
+static void repartitionRuns(Spiller* spiller, const std::vector<SpilledRun>& runs,
+    SpilledPartitions& partitions, const std::vector<idx_t>& keyIdxes,
+    MemoryManager* memoryManager) {
+    SpilledPartitionReader reader{spiller, runs, memoryManager};
+    SpilledPartitionWriter writer{spiller, &partitions, memoryManager};
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    while (reader.readBatch(vectors)) {
+        std::vector<ValueVector*> keyVectors;
+        for (auto keyIdx : keyIdxes) {
+            keyVectors.push_back(vectors[keyIdx].get());
+        }
+        std::vector<ValueVector*> allVectors;
+        for (auto& vector : vectors) {
+            allVectors.push_back(vector.get());
+        }
+        writer.write(keyVectors, allVectors);
+    }
+    writer.flush();
+}
+
+void HashJoinSharedState::repartition(const SpilledPartitionLevel& level, uint64_t partitionIdx,
+    const std::vector<idx_t>& probeKeyIdxes, MemoryManager* memoryManager) {
+    auto nextLevel = level.buildPartitions->getLevel() + 1;
+    SpilledPartitionLevel partitionLevel{nullptr, nullptr,
+        level.buildPartitions->getNumBytes(partitionIdx)};
+    partitionLevel.ownedBuildPartitions = std::make_unique<SpilledPartitions>(nextLevel);
+    partitionLevel.ownedProbePartitions = std::make_unique<SpilledPartitions>(nextLevel);
+    std::vector<idx_t> buildKeyIdxes(hashTable->getKeyTypes().size());
+    std::iota(buildKeyIdxes.begin(), buildKeyIdxes.end(), 0);
+    repartitionRuns(spiller, level.buildPartitions->getRuns(partitionIdx),
+        *partitionLevel.ownedBuildPartitions, buildKeyIdxes, memoryManager);
+    repartitionRuns(spiller, level.probePartitions->getRuns(partitionIdx),
+        *partitionLevel.ownedProbePartitions, probeKeyIdxes, memoryManager);
+    partitionLevel.buildPartitions = partitionLevel.ownedBuildPartitions.get();
+    partitionLevel.probePartitions = partitionLevel.ownedProbePartitions.get();
+    spilledLevels.push_back(std::move(partitionLevel));
+}
+
+void HashJoinSharedState::buildPartitionHashTable(const std::vector<SpilledRun>& runs,
+    MemoryManager* memoryManager) {
+    partitionHashTable = std::make_shared<JoinHashTable>(*memoryManager,
+        LogicalType::copy(hashTable->getKeyTypes()), hashTable->getTableSchema()->copy());
+    auto numKeys = hashTable->getKeyTypes().size();
+    SpilledPartitionReader reader{spiller, runs, memoryManager};
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    while (reader.readBatch(vectors)) {
+        std::vector<ValueVector*> keyVectors;
+        std::vector<ValueVector*> payloadVectors;
+        DataChunkState* keyState = vectors[0]->state.get();
+        for (auto i = 0u; i < vectors.size(); i++) {
+            auto vector = vectors[i].get();
+            if (i >= numKeys) {
+                payloadVectors.push_back(vector);
+                continue;
+            }
+            keyVectors.push_back(vector);
+            if (!vector->state->isFlat()) {
+                keyState = vector->state.get();
+            }
+        }
+        partitionHashTable->appendVectors(keyVectors, payloadVectors, keyState);
+    }
+    partitionHashTable->allocateHashSlots(partitionHashTable->getNumTuples());
+    partitionHashTable->buildHashSlots();
 }
 
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
@@ -51,7 +209,14 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
+void HashJoinBuild::finalize(ExecutionContext* context) {
+    if (sharedState->isSpilled()) {
+        // Local tables merged before spilling started still need to be spilled.
+        initSpillState(context);
+        spillHashTable(*sharedState->getHashTable());
+        spillWriter->flush();
+        return;
+    }
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
@@ -61,13 +226,95 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
     // Append thread-local tuples
     while (children[0]->getNextTuple(context)) {
         uint64_t numAppended = 0u;
-        for (auto i = 0u; i < resultSet->multiplicity; ++i) {
-            numAppended += appendVectors();
+        if (sharedState->isSpilled()) {
+            initSpillState(context);
+            spillHashTable(*hashTable);
+            for (auto i = 0u; i < resultSet->multiplicity; ++i) {
+                numAppended += spillVectors();
+            }
+        } else {
+            for (auto i = 0u; i < resultSet->multiplicity; ++i) {
+                numAppended += appendVectors();
+            }
+            if (sharedState->canSpill()) {
+                auto memoryUsage = hashTable->getMemoryUsage();
+                sharedState->increaseMemoryUsage(memoryUsage - localMemoryUsage);
+                localMemoryUsage = memoryUsage;
+                if (sharedState->exceedsMemoryLimit()) {
+                    sharedState->startSpilling();
+                }
+            }
         }
         metrics->numOutputTuple.increase(numAppended);
     }
     // Merge with global hash table once local tuples are all appended.
-    sharedState->mergeLocalHashTable(*hashTable);
+    if (!sharedState->mergeLocalHashTable(*hashTable)) {
+        initSpillState(context);
+        spillHashTable(*hashTable);
+        spillWriter->flush();
+    }
+}
+
+uint64_t HashJoinBuild::spillVectors() {
+    std::vector<ValueVector*> vectors = keyVectors;
+    vectors.insert(vectors.end(), payloadVectors.begin(), payloadVectors.end());
+    spillWriter->write(keyVectors, vectors);
+    return keyState->getSelVector().getSelSize();
+}
+
+void HashJoinBuild::spillHashTable(JoinHashTable& table) {
+    auto factorizedTable = table.getFactorizedTable();
+    if (factorizedTable->getNumTuples() == 0) {
+        return;
+    }
+    std::vector<ValueVector*> vectors;
+    for (auto& vector : spillScanVectors) {
+        vectors.push_back(vector.get());
+    }
+    std::vector<ValueVector*> scanKeyVectors{vectors.begin(), vectors.begin() + keyVectors.size()};
+    for (auto tupleIdx = 0u; tupleIdx < factorizedTable->getNumTuples();
+         tupleIdx += numTuplesPerSpillScan) {
+        auto numTuplesToScan =
+            std::min(numTuplesPerSpillScan, factorizedTable->getNumTuples() - tupleIdx);
+        factorizedTable->scan(vectors, tupleIdx, numTuplesToScan, spillScanColIdxes);
+        spillWriter->write(scanKeyVectors, vectors);
+    }
+    factorizedTable->clear();
+}
+
+void HashJoinBuild::initSpillState(ExecutionContext* context) {
+    if (spillWriter != nullptr) {
+        return;
+    }
+    auto memoryManager = context->clientContext->getMemoryManager();
+    spillWriter = std::make_unique<SpilledPartitionWriter>(sharedState->getSpiller(),
+        sharedState->getSpilledPartitions(), memoryManager);
+    auto tableSchema = info->getTableSchema();
+    auto numColumns = keyVectors.size() + payloadVectors.size();
+    auto hasUnflatCol = false;
+    for (auto i = 0u; i < numColumns; i++) {
+        hasUnflatCol |= !tableSchema->getColumn(i)->isFlat();
+    }
+    // Flat columns can only be scanned a tuple at a time alongside unflat ones.
+    auto flatColState = hasUnflatCol ? DataChunkState::getSingleValueDataChunkState() :
+                                       std::make_shared<DataChunkState>();
+    numTuplesPerSpillScan = hasUnflatCol ? 1 : DEFAULT_VECTOR_CAPACITY;
+    std::unordered_map<idx_t, std::shared_ptr<DataChunkState>> unflatColStates;
+    for (auto i = 0u; i < numColumns; i++) {
+        auto vector = i < keyVectors.size() ? keyVectors[i] : payloadVectors[i - keyVectors.size()];
+        auto scanVector = std::make_unique<ValueVector>(vector->dataType.copy(), memoryManager);
+        auto column = tableSchema->getColumn(i);
+        if (column->isFlat()) {
+            scanVector->setState(flatColState);
+        } else {
+            if (!unflatColStates.contains(column->getGroupID())) {
+                unflatColStates[column->getGroupID()] = std::make_shared<DataChunkState>();
+            }
+            scanVector->setState(unflatColStates.at(column->getGroupID()));
+        }
+        spillScanVectors.push_back(std::move(scanVector));
+        spillScanColIdxes.push_back(i);
+    }
 }
 
 } // namespace processor
@@ -39,6 +39,86 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
         tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(),
             context->clientContext->getMemoryManager());
     }
+    hashTable = sharedState->getHashTable();
+    for (auto& dataPos : probeDataInfo.probeSideDataPos) {
+        probeSideVectors.push_back(resultSet->getValueVector(dataPos).get());
+    }
+    for (auto& keyDataPos : probeDataInfo.keysDataPos) {
+        auto& probeSideDataPos = probeDataInfo.probeSideDataPos;
+        auto it = std::find(probeSideDataPos.begin(), probeSideDataPos.end(), keyDataPos);
+        KU_ASSERT(probeSideDataPos.empty() || it != probeSideDataPos.end());
+        probeSideKeyIdxes.push_back(it - probeSideDataPos.begin());
+    }
+}
+
+bool HashJoinProbe::getNextSpilledProbeTuple(ExecutionContext* context) {
+    if (spilledProbeState == nullptr) {
+        spilledProbeState = std::make_unique<SpilledProbeState>();
+    }
+    if (!spilledProbeState->partitioned) {
+        partitionProbeSide(context);
+        spilledProbeState->partitioned = true;
+    }
+    std::vector<std::unique_ptr<ValueVector>> spilledVectors;
+    while (spilledProbeState->reader == nullptr ||
+           !spilledProbeState->reader->readBatch(spilledVectors)) {
+        if (!loadNextSpilledRun(context)) {
+            return false;
+        }
+    }
+    // Restore the spilled tuples into the vectors of the probe side.
+    KU_ASSERT(spilledVectors.size() == probeSideVectors.size());
+    for (auto i = 0u; i < probeSideVectors.size(); i++) {
+        auto vector = probeSideVectors[i];
+        auto& spilledVector = *spilledVectors[i];
+        auto numValues = spilledVector.state->getSelVector().getSelSize();
+        vector->resetAuxiliaryBuffer();
+        for (auto pos = 0u; pos < numValues; pos++) {
+            vector->copyFromVectorData(pos, &spilledVector, pos);
+        }
+        vector->state->getSelVectorUnsafe().setToUnfiltered(numValues);
+    }
+    return true;
+}
+
+void HashJoinProbe::partitionProbeSide(ExecutionContext* context) {
+    sharedState->startPartitioningProbeSide();
+    try {
+        SpilledPartitionWriter writer{sharedState->getSpiller(),
+            sharedState->getSpilledProbePartitions(), context->clientContext->getMemoryManager()};
+        while (children[0]->getNextTuple(context)) {
+            for (auto i = 0u; i < resultSet->multiplicity; ++i) {
+                writer.write(keyVectors, probeSideVectors);
+            }
+        }
+        writer.flush();
+    } catch (...) {
+        // Don't leave the other probe threads waiting for this one.
+        sharedState->finishPartitioningProbeSide();
+        throw;
+    }
+    sharedState->finishPartitioningProbeSide();
+    sharedState->waitForProbePartitioners();
+}
+
+bool HashJoinProbe::loadNextSpilledRun(ExecutionContext* context) {
+    auto& state = *spilledProbeState;
+    state.reader.reset();
+    if (!sharedState->getNextSpilledProbeRun(state.probeRun, probeSideKeyIdxes,
+            context->clientContext->getMemoryManager())) {
+        hashTable = sharedState->getHashTable();
+        return false;
+    }
+    if (hashTable != state.probeRun.hashTable.get()) {
+        hashTable = state.probeRun.hashTable.get();
+        // Pointers into the previous partition must not survive into this one.
+        std::fill(probeState->probedTuples.get(),
+            probeState->probedTuples.get() + DEFAULT_VECTOR_CAPACITY, nullptr);
+    }
+    state.runs = {state.probeRun.run};
+    state.reader = std::make_unique<SpilledPartitionReader>(sharedState->getSpiller(), state.runs,
+        context->clientContext->getMemoryManager());
+    return true;
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -51,14 +131,14 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(*keyVectors[0]->state);
-        if (!children[0]->getNextTuple(context)) {
+        if (!getNextProbeTuple(context)) {
             return false;
         }
         saveSelVector(*keyVectors[0]->state);
-        sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
+        hashTable->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
             probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
+    auto numMatchedTuples = hashTable->matchFlatKeys(keyVectors,
         probeState->probedTuples.get(), probeState->matchedTuples.get());
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
@@ -69,14 +149,14 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
     restoreSelVector(*keyVector->state);
-    if (!children[0]->getNextTuple(context)) {
+    if (!getNextProbeTuple(context)) {
         return false;
     }
     saveSelVector(*keyVector->state);
-    sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
+    hashTable->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
         probeState->probedTuples.get());
     auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        hashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
             probeState->matchedTuples.get(), probeState->matchedSelVector);
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
@@ -88,7 +168,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -108,7 +188,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         }
         keySelVector.setToFiltered(numTuplesToRead);
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
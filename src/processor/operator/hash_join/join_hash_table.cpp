@@ -12,8 +12,8 @@ namespace processor {
 
 JoinHashTable::JoinHashTable(MemoryManager& memoryManager, logical_type_vec_t keyTypes,
     FactorizedTableSchema tableSchema)
-    : BaseHashTable{memoryManager, std::move(keyTypes)} {
-    auto numSlotsPerBlock = HASH_BLOCK_SIZE / sizeof(uint8_t*);
+    : BaseHashTable{memoryManager, std::move(keyTypes)}, useTags{true} {
+    auto numSlotsPerBlock = HASH_BLOCK_SIZE / sizeof(slot_entry_t);
     initSlotConstant(numSlotsPerBlock);
     // Prev pointer is always the last column in the table.
     prevPtrColOffset = tableSchema.getColOffset(tableSchema.getNumColumns() - PREV_PTR_COL_IDX);
@@ -21,6 +21,14 @@ JoinHashTable::JoinHashTable(MemoryManager& memoryManager, logical_type_vec_t ke
     this->tableSchema = factorizedTable->getTableSchema();
 }
 
+static void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
 static bool discardNullFromKeys(const std::vector<ValueVector*>& vectors) {
     bool hasNonNullKeys = true;
     for (auto& vector : vectors) {
@@ -115,6 +123,16 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
 }
 
 void JoinHashTable::buildHashSlots() {
+    const auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        const auto blockEnd = reinterpret_cast<uintptr_t>(tupleBlock->getData()) +
+                              tupleBlock->numTuples * numBytesPerTuple;
+        if ((blockEnd & ~POINTER_MASK) != 0) {
+            // LCOV_EXCL_START
+            useTags = false;
+            // LCOV_EXCL_STOP
+        }
+    }
     for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
         uint8_t* tuple = tupleBlock->getData();
         for (auto i = 0u; i < tupleBlock->numTuples; i++) {
@@ -122,7 +140,7 @@ void JoinHashTable::buildHashSlots() {
             auto prevPtr = getPrevTuple(tuple);
             memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
                 sizeof(uint8_t*));
-            tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
+            tuple += numBytesPerTuple;
         }
     }
 }
@@ -146,36 +164,49 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
         function::VectorHashFunction::combineHash(hashVector, hashSelVec, tmpHashResultVector,
             hashSelVec, hashVector, hashSelVec);
     }
-    for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
-        KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
-        probedTuples[i] = getTupleForHash(hashVector.getValue<hash_t>(hashSelVec[i]));
+    // Slots and chain heads are prefetched for the whole selection first, so that the cache misses
+    // of different keys overlap instead of being paid one after the other.
+    const auto hashes = reinterpret_cast<const hash_t*>(hashVector.getData());
+    const auto numHashes = hashSelVec.getSelSize();
+    KU_ASSERT(numHashes <= DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < numHashes; i++) {
+        prefetch(getHashSlot(hashes[hashSelVec[i]]));
+    }
+    for (auto i = 0u; i < numHashes; i++) {
+        const auto hash = hashes[hashSelVec[i]];
+        probedTuples[i] = getTupleFromSlotEntry(*getHashSlot(hash), hash);
+        if (probedTuples[i]) {
+            prefetch(probedTuples[i]);
+        }
     }
 }
 
-sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
-    uint8_t** probedTuples, uint8_t** matchedTuples) {
-    auto numMatchedTuples = 0;
+template<typename COMPARE>
+sel_t JoinHashTable::matchFlatKeys(uint8_t** probedTuples, uint8_t** matchedTuples,
+    COMPARE compare) const {
+    sel_t numMatchedTuples = 0;
     while (probedTuples[0]) {
         if (numMatchedTuples == DEFAULT_VECTOR_CAPACITY) {
             break;
         }
         auto currentTuple = probedTuples[0];
         matchedTuples[numMatchedTuples] = currentTuple;
-        numMatchedTuples += matchFlatVecWithEntry(keyVectors, currentTuple);
+        numMatchedTuples += compare(currentTuple);
         probedTuples[0] = *getPrevTuple(currentTuple);
     }
     return numMatchedTuples;
 }
 
-sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTuples,
-    uint8_t** matchedTuples, SelectionVector& matchedTuplesSelVector) {
-    auto numMatchedTuples = 0;
-    for (auto i = 0u; i < keyVector->state->getSelVector().getSelSize(); ++i) {
-        auto pos = keyVector->state->getSelVector()[i];
+template<typename COMPARE>
+sel_t JoinHashTable::matchUnFlatKey(const ValueVector& keyVector, uint8_t** probedTuples,
+    uint8_t** matchedTuples, SelectionVector& matchedTuplesSelVector, COMPARE compare) const {
+    sel_t numMatchedTuples = 0;
+    const auto& selVector = keyVector.state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+        auto pos = selVector[i];
         while (probedTuples[i]) {
             auto currentTuple = probedTuples[i];
-            auto entryCompareResult = compareEntryFuncs[0](keyVector, pos, currentTuple);
-            if (entryCompareResult) {
+            if (compare(pos, currentTuple)) {
                 matchedTuples[numMatchedTuples] = currentTuple;
                 matchedTuplesSelVector[numMatchedTuples] = pos;
                 numMatchedTuples++;
@@ -187,18 +218,67 @@ sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTupl
     return numMatchedTuples;
 }
 
-uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
-    auto hash = *(hash_t*)(tuple + getHashValueColOffset());
-    auto slotIdx = getSlotIdxForHash(hash);
-    return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
-                       (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
+// Keys of the most common join key types are compared inline instead of through the type-erased
+// compare functions. Null keys never reach the comparison as they are discarded on both sides.
+sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
+    uint8_t** probedTuples, uint8_t** matchedTuples) {
+    if (keyVectors.size() == 1) {
+        const auto keyVector = keyVectors[0];
+        const auto pos = keyVector->state->getSelVector()[0];
+        switch (keyVector->dataType.getPhysicalType()) {
+        case PhysicalTypeID::INTERNAL_ID: {
+            const auto key = keyVector->getValue<internalID_t>(pos);
+            return matchFlatKeys(probedTuples, matchedTuples, [&](const uint8_t* tuple) {
+                return *reinterpret_cast<const internalID_t*>(tuple) == key;
+            });
+        }
+        case PhysicalTypeID::INT64: {
+            const auto key = keyVector->getValue<int64_t>(pos);
+            return matchFlatKeys(probedTuples, matchedTuples, [&](const uint8_t* tuple) {
+                return *reinterpret_cast<const int64_t*>(tuple) == key;
+            });
+        }
+        default:
+            break;
+        }
+    }
+    return matchFlatKeys(probedTuples, matchedTuples,
+        [&](const uint8_t* tuple) { return matchFlatVecWithEntry(keyVectors, tuple); });
+}
+
+sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTuples,
+    uint8_t** matchedTuples, SelectionVector& matchedTuplesSelVector) {
+    switch (keyVector->dataType.getPhysicalType()) {
+    case PhysicalTypeID::INTERNAL_ID: {
+        const auto keys = reinterpret_cast<const internalID_t*>(keyVector->getData());
+        return matchUnFlatKey(*keyVector, probedTuples, matchedTuples, matchedTuplesSelVector,
+            [&](sel_t pos, const uint8_t* tuple) {
+                return *reinterpret_cast<const internalID_t*>(tuple) == keys[pos];
+            });
+    }
+    case PhysicalTypeID::INT64: {
+        const auto keys = reinterpret_cast<const int64_t*>(keyVector->getData());
+        return matchUnFlatKey(*keyVector, probedTuples, matchedTuples, matchedTuplesSelVector,
+            [&](sel_t pos, const uint8_t* tuple) {
+                return *reinterpret_cast<const int64_t*>(tuple) == keys[pos];
+            });
+    }
+    default:
+        return matchUnFlatKey(*keyVector, probedTuples, matchedTuples, matchedTuplesSelVector,
+            [&](sel_t pos, const uint8_t* tuple) {
+                return compareEntryFuncs[0](keyVector, pos, tuple);
+            });
+    }
 }
 
 uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
-    auto slot = findHashSlot(tuple);
-    auto prevPtr = *slot;
-    *slot = tuple;
-    return prevPtr;
+    const auto hash = *(hash_t*)(tuple + getHashValueColOffset());
+    const auto slot = getHashSlot(hash);
+    const auto prevEntry = *slot;
+    const auto tuplePtr = static_cast<slot_entry_t>(reinterpret_cast<uintptr_t>(tuple));
+    // The tags of the chain accumulate, so a set tag bit only means the key may be in the chain.
+    *slot = useTags ? (prevEntry & ~POINTER_MASK) | getTag(hash) | tuplePtr : tuplePtr;
+    return getPointer(prevEntry);
 }
 
 void JoinHashTable::computeVectorHashes(std::vector<common::ValueVector*> keyVectors) {
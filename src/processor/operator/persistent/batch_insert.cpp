@@ -0,0 +1,48 @@
+#include "processor/operator/persistent/batch_insert.h"
+
+#include "binder/ddl/bound_alter_info.h"
+#include "catalog/catalog.h"
+#include "main/client_context.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+void BatchInsertSharedState::initStatisticsCollector(
+    const catalog::TableCatalogEntry& tableEntry) {
+    if (table->getNumRows() == 0) {
+        statisticsCollector =
+            std::make_unique<TableStatisticsCollector>(tableEntry, mm, false /* buildHistograms */);
+    }
+}
+
+void BatchInsert::initLocalStatisticsCollector(main::ClientContext* context) const {
+    if (sharedState->statisticsCollector) {
+        localState->statisticsCollector = std::make_unique<TableStatisticsCollector>(
+            *info->tableEntry, context->getMemoryManager(), false /* buildHistograms */);
+    }
+}
+
+void BatchInsert::mergeLocalStatistics() const {
+    if (localState->statisticsCollector) {
+        std::unique_lock lck{sharedState->mtx};
+        sharedState->statisticsCollector->merge(*localState->statisticsCollector);
+    }
+}
+
+void BatchInsert::updateStatistics(main::ClientContext* context, row_idx_t numRows) const {
+    if (!sharedState->statisticsCollector) {
+        return;
+    }
+    auto statistics = sharedState->statisticsCollector->finalize(numRows);
+    sharedState->statisticsCollector.reset();
+    context->getCatalog()->alterTableEntry(context->getTx(),
+        BoundAlterInfo{AlterType::UPDATE_STATISTICS, info->tableEntry->getName(),
+            std::make_unique<BoundExtraStatisticsInfo>(std::move(statistics))});
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -33,7 +33,7 @@ void NodeBatchInsertSharedState::initPKIndex(const ExecutionContext* context) {
         numRows = scanSharedState->getNumRows();
     } else {
         KU_ASSERT(distinctSharedState);
-        numRows = distinctSharedState->getFactorizedTable()->getNumTuples();
+        numRows = distinctSharedState->getNumEntries();
     }
     auto* nodeTable = ku_dynamic_cast<NodeTable*>(table);
     nodeTable->getPKIndex()->bulkReserve(numRows);
@@ -74,6 +74,7 @@ void NodeBatchInsert::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
         info->compressionEnabled, StorageConstants::NODE_GROUP_SIZE, 0, ResidencyState::IN_MEMORY);
     KU_ASSERT(resultSet->dataChunks[0]);
     nodeLocalState->columnState = resultSet->dataChunks[0]->state;
+    initLocalStatisticsCollector(context->clientContext);
 }
 
 void NodeBatchInsert::executeInternal(ExecutionContext* context) {
@@ -102,10 +103,17 @@ void NodeBatchInsert::executeInternal(ExecutionContext* context) {
                 break;
             }
         }
+        if (const auto& collector = nodeLocalState->statisticsCollector) {
+            // Column vectors are in the order of the table columns.
+            for (auto i = 0u; i < collector->getColumnIDs().size(); i++) {
+                collector->update(i, *nodeLocalState->columnVectors[collector->getColumnIDs()[i]]);
+            }
+        }
         copyToNodeGroup(context->clientContext->getTx(),
             context->clientContext->getMemoryManager());
         nodeLocalState->columnState->setSelVector(originalSelVector);
     }
+    mergeLocalStatistics();
     if (nodeLocalState->chunkedGroup->getNumRows() > 0) {
         appendIncompleteNodeGroup(context->clientContext->getTx(),
             std::move(nodeLocalState->chunkedGroup), nodeLocalState->localIndexBuilder,
@@ -229,8 +237,10 @@ void NodeBatchInsert::finalize(ExecutionContext* context) {
 }
 
 void NodeBatchInsert::finalizeInternal(ExecutionContext* context) {
-    auto outputMsg = stringFormat("{} tuples have been copied to the {} table.",
-        sharedState->getNumRows() - sharedState->getNumErroredRows(), info->tableEntry->getName());
+    const auto numCopiedRows = sharedState->getNumRows() - sharedState->getNumErroredRows();
+    updateStatistics(context->clientContext, numCopiedRows);
+    auto outputMsg = stringFormat("{} tuples have been copied to the {} table.", numCopiedRows,
+        info->tableEntry->getName());
     FactorizedTableUtils::appendStringToTable(sharedState->fTable.get(), outputMsg,
         context->clientContext->getMemoryManager());
 
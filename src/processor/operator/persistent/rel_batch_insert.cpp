@@ -45,6 +45,16 @@ void RelBatchInsert::initLocalStateInternal(ResultSet* /*resultSet_*/, Execution
         valueVector->setAllNull();
         relLocalState->dummyAllNullDataChunk->insert(i, std::move(valueVector));
     }
+    initLocalStatisticsCollector(context->clientContext);
+    if (relLocalState->statisticsCollector && relInfo->direction == RelDataDirection::FWD) {
+        const auto& propertyNames = relLocalState->statisticsCollector->getPropertyNames();
+        relLocalState->statisticsDataChunk = std::make_unique<DataChunk>(propertyNames.size());
+        for (auto i = 0u; i < propertyNames.size(); i++) {
+            const auto& type = relInfo->tableEntry->getProperty(propertyNames[i]).getType();
+            relLocalState->statisticsDataChunk->insert(i, std::make_shared<ValueVector>(
+                type.copy(), context->clientContext->getMemoryManager()));
+        }
+    }
 }
 
 void RelBatchInsert::initGlobalStateInternal(ExecutionContext* /* context */) {
@@ -74,6 +84,7 @@ void RelBatchInsert::executeInternal(ExecutionContext* context) {
             *sharedState, *partitionerSharedState);
         updateProgress(context);
     }
+    mergeLocalStatistics();
 }
 
 void RelBatchInsert::appendNodeGroup(transaction::Transaction* transaction, CSRNodeGroup& nodeGroup,
@@ -99,6 +110,9 @@ void RelBatchInsert::appendNodeGroup(transaction::Transaction* transaction, CSRN
     populateCSRHeaderAndRowIdx(*partitioningBuffer, startNodeOffset, relInfo, localState, numNodes,
         leaveGaps);
     const auto& csrHeader = localState.chunkedGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader();
+    if (localState.statisticsCollector) {
+        collectStatistics(*partitioningBuffer, csrHeader, numNodes, relInfo, localState);
+    }
     const auto maxSize = csrHeader.getEndCSROffset(numNodes - 1);
     for (auto& chunkedGroup : partitioningBuffer->getChunkedGroups()) {
         sharedState.incrementNumRows(chunkedGroup->getNumRows());
@@ -155,6 +169,39 @@ void RelBatchInsert::populateCSRHeaderAndRowIdx(InMemChunkedNodeGroupCollection&
     KU_ASSERT(csrHeader.sanityCheck());
 }
 
+void RelBatchInsert::collectStatistics(InMemChunkedNodeGroupCollection& partition,
+    const ChunkedCSRHeader& csrHeader, offset_t numNodes, const RelBatchInsertInfo& relInfo,
+    const RelBatchInsertLocalState& localState) {
+    auto& collector = *localState.statisticsCollector;
+    for (auto i = 0u; i < numNodes; i++) {
+        collector.addDegree(relInfo.direction, csrHeader.length->getData().getValue<length_t>(i));
+    }
+    // Each rel is copied in both directions, so properties only need to be collected in one.
+    if (relInfo.direction != RelDataDirection::FWD) {
+        return;
+    }
+    auto& dataChunk = *localState.statisticsDataChunk;
+    const auto& columnIDs = collector.getColumnIDs();
+    for (auto& chunkedGroup : partition.getChunkedGroups()) {
+        const auto numRows = chunkedGroup->getNumRows();
+        for (offset_t startRow = 0; startRow < numRows; startRow += DEFAULT_VECTOR_CAPACITY) {
+            const auto numRowsToScan = std::min(DEFAULT_VECTOR_CAPACITY, numRows - startRow);
+            dataChunk.state->getSelVectorUnsafe().setSelSize(numRowsToScan);
+            for (auto i = 0u; i < columnIDs.size(); i++) {
+                // The partition has the bound node offset column on top of the table columns.
+                const auto columnIdx = columnIDs[i] >= relInfo.boundNodeOffsetColumnID ?
+                                           columnIDs[i] + 1 :
+                                           columnIDs[i];
+                auto& vector = dataChunk.getValueVectorMutable(i);
+                vector.resetAuxiliaryBuffer();
+                chunkedGroup->getColumnChunk(columnIdx).getData().scan(vector, startRow,
+                    numRowsToScan);
+                collector.update(i, vector);
+            }
+        }
+    }
+}
+
 void RelBatchInsert::populateCSRLengths(const ChunkedCSRHeader& csrHeader, offset_t numNodes,
     InMemChunkedNodeGroupCollection& partition, column_id_t boundNodeOffsetColumn) {
     KU_ASSERT(numNodes == csrHeader.length->getNumValues() &&
@@ -212,6 +259,7 @@ void RelBatchInsert::finalizeInternal(ExecutionContext* context) {
         KU_ASSERT(
             relInfo->partitioningIdx == partitionerSharedState->partitioningBuffers.size() - 1);
 
+        updateStatistics(context->clientContext, sharedState->getNumRows());
         auto outputMsg = stringFormat("{} tuples have been copied to the {} table.",
             sharedState->getNumRows(), info->tableEntry->getName());
         FactorizedTableUtils::appendStringToTable(sharedState->fTable.get(), outputMsg,
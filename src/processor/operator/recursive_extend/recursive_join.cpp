@@ -96,6 +96,13 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
         default:
             KU_UNREACHABLE;
         }
+        if (dataInfo.reverseLocalResultSetDescriptor != nullptr &&
+            targetDstNodes->getNodeIDs().size() == 1 &&
+            dataInfo.recursiveDstNodeTableIDs.contains(
+                targetDstNodes->getNodeIDs().begin()->tableID)) {
+            bidirectionalBFSState = std::make_unique<BidirectionalShortestPathState>(upperBound,
+                targetDstNodes.get(), joinType == planner::RecursiveJoinType::TRACK_PATH);
+        }
     } break;
     case QueryRelType::ALL_SHORTEST: {
         if (semantic != PathSemantic::WALK) {
@@ -189,6 +196,15 @@ bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
         if (!children[0]->getNextTuple(context)) {
             return false;
         }
+        auto srcNodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+            vectors->srcNodeIDVector->state->getSelVector()[0]);
+        if (bidirectionalBFSState != nullptr &&
+            !targetDstNodes->getNodeIDs().contains(srcNodeID)) {
+            bidirectionalBFSState->resetState();
+            computeBidirectionalBFS(context); // Phase 1
+            frontiersScanner->resetState(*bidirectionalBFSState);
+            continue;
+        }
         bfsState->resetState();
         computeBFS(context); // Phase 1
         frontiersScanner->resetState(*bfsState);
@@ -231,6 +247,28 @@ void RecursiveJoin::computeBFS(ExecutionContext* context) {
     }
 }
 
+void RecursiveJoin::computeBidirectionalBFS(ExecutionContext* context) {
+    auto srcNodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+        vectors->srcNodeIDVector->state->getSelVector()[0]);
+    auto& state = *bidirectionalBFSState;
+    state.markSrc(srcNodeID);
+    state.markDst(*targetDstNodes->getNodeIDs().begin());
+    while (!state.isComplete()) {
+        auto extendingFwd = state.beginLevel();
+        auto source = extendingFwd ? recursiveSource : reverseRecursiveSource;
+        auto root = extendingFwd ? recursiveRoot.get() : reverseRecursiveRoot.get();
+        auto boundNodeID = state.getNextNodeIDToExtend();
+        while (boundNodeID.offset != INVALID_OFFSET) {
+            source->init(boundNodeID);
+            while (root->getNextTuple(context)) { // Exhaust recursive plan.
+                updateBidirectionalVisitedNodes(boundNodeID, extendingFwd);
+            }
+            boundNodeID = state.getNextNodeIDToExtend();
+        }
+        state.finalizeLevel();
+    }
+}
+
 void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     auto boundNodeMultiplicity = bfsState->getMultiplicity(boundNodeID);
     auto& selVector = vectors->recursiveDstNodeIDVector->state->getSelVector();
@@ -247,6 +285,28 @@ void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     }
 }
 
+void RecursiveJoin::updateBidirectionalVisitedNodes(nodeID_t boundNodeID, bool extendingFwd) {
+    auto dstNodeIDVector =
+        extendingFwd ? vectors->recursiveDstNodeIDVector : vectors->reverseRecursiveDstNodeIDVector;
+    auto edgeIDVector =
+        extendingFwd ? vectors->recursiveEdgeIDVector : vectors->reverseRecursiveEdgeIDVector;
+    auto edgeDirectionVector = extendingFwd ? vectors->recursiveEdgeDirectionVector :
+                                              vectors->reverseRecursiveEdgeDirectionVector;
+    auto& selVector = dstNodeIDVector->state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+        auto pos = selVector[i];
+        auto nbrNodeID = dstNodeIDVector->getValue<nodeID_t>(pos);
+        auto edgeID = edgeIDVector->getValue<relID_t>(pos);
+        // The backward search visits rels from the end closer to the dst node, so a rel that it
+        // does not visit against its direction is visited against its direction on the path.
+        if (edgeDirectionVector != nullptr &&
+            edgeDirectionVector->getValue<bool>(pos) == extendingFwd) {
+            RelIDMasker::markFlip(edgeID);
+        }
+        bidirectionalBFSState->markVisited(boundNodeID, nbrNodeID, edgeID, 1 /* multiplicity */);
+    }
+}
+
 static PhysicalOperator* getSource(PhysicalOperator* op) {
     while (op->getNumChildren() != 0) {
         KU_ASSERT(op->getNumChildren() == 1);
@@ -271,6 +331,22 @@ void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     }
     recursiveRoot->initLocalState(localResultSet.get(), context);
     recursiveSource = getSource(recursiveRoot.get())->ptrCast<OffsetScanNodeTable>();
+    if (reverseRecursiveRoot != nullptr) {
+        reverseLocalResultSet = std::make_unique<ResultSet>(
+            dataInfo.reverseLocalResultSetDescriptor.get(),
+            context->clientContext->getMemoryManager());
+        vectors->reverseRecursiveDstNodeIDVector =
+            reverseLocalResultSet->getValueVector(dataInfo.recursiveDstNodeIDPos).get();
+        vectors->reverseRecursiveEdgeIDVector =
+            reverseLocalResultSet->getValueVector(dataInfo.recursiveEdgeIDPos).get();
+        if (dataInfo.recursiveEdgeDirectionPos.isValid()) {
+            vectors->reverseRecursiveEdgeDirectionVector =
+                reverseLocalResultSet->getValueVector(dataInfo.recursiveEdgeDirectionPos).get();
+        }
+        reverseRecursiveRoot->initLocalState(reverseLocalResultSet.get(), context);
+        reverseRecursiveSource =
+            getSource(reverseRecursiveRoot.get())->ptrCast<OffsetScanNodeTable>();
+    }
 }
 
 void RecursiveJoin::populateTargetDstNodes(ExecutionContext*) {
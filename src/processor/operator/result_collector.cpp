@@ -1,6 +1,7 @@
 #include "processor/operator/result_collector.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/exception/interrupt.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -32,22 +33,47 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
         markVector->setValue<bool>(0, true);
         payloadAndMarkVectors.push_back(markVector.get());
     }
-    localTable = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
+    localTable = createLocalTable(context);
+}
+
+std::unique_ptr<FactorizedTable> ResultCollector::createLocalTable(
+    ExecutionContext* context) const {
+    return std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
         info.tableSchema.copy());
 }
 
+void ResultCollector::pushLocalTableToStream(ExecutionContext* context) {
+    metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+    if (!sharedState->getStreamingQueue()->push(std::move(localTable))) {
+        // The consumer stopped reading. Stop the pipeline.
+        throw InterruptException{};
+    }
+    localTable = createLocalTable(context);
+}
+
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    auto streaming = sharedState->getStreamingQueue() != nullptr;
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(payloadAndMarkVectors);
             }
+            if (streaming && localTable->getNumTuples() >= STREAMING_BATCH_SIZE) {
+                pushLocalTableToStream(context);
+            }
         }
     }
-    if (!payloadVectors.empty()) {
-        metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
-        sharedState->mergeLocalTable(*localTable);
+    if (payloadVectors.empty()) {
+        return;
+    }
+    if (streaming) {
+        if (!localTable->isEmpty()) {
+            pushLocalTableToStream(context);
+        }
+        return;
     }
+    metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+    sharedState->mergeLocalTable(*localTable);
 }
 
 void ResultCollector::finalizeInternal(ExecutionContext* /*context*/) {
@@ -15,6 +15,34 @@ QueryProcessor::QueryProcessor(uint64_t numThreads) {
 }
 
 std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalPlan,
+    ExecutionContext* context) {
+    auto task = createRootTask(physicalPlan, context);
+    context->clientContext->getProgressBar()->startProgress(context->queryID);
+    taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    context->clientContext->getProgressBar()->endProgress(context->queryID);
+    auto resultCollector = ku_dynamic_cast<ResultCollector*>(physicalPlan->lastOperator.get());
+    return resultCollector->getResultFactorizedTable();
+}
+
+bool QueryProcessor::canStreamResult(PhysicalPlan* physicalPlan) {
+    auto lastOperator = physicalPlan->lastOperator.get();
+    return lastOperator->getOperatorType() == PhysicalOperatorType::RESULT_COLLECTOR &&
+           ku_dynamic_cast<ResultCollector*>(lastOperator)->canStreamResult();
+}
+
+void QueryProcessor::executeStreaming(PhysicalPlan* physicalPlan, ExecutionContext* context,
+    std::shared_ptr<StreamingResultQueue> queue) {
+    KU_ASSERT(canStreamResult(physicalPlan));
+    auto resultCollector = ku_dynamic_cast<ResultCollector*>(physicalPlan->lastOperator.get());
+    resultCollector->setStreamingQueue(std::move(queue));
+    auto task = createRootTask(physicalPlan, context);
+    context->clientContext->getProgressBar()->startProgress(context->queryID);
+    taskScheduler->runTaskOnDedicatedThreadsAndWaitOrError(task, context,
+        context->clientContext->getMaxNumThreadForExec());
+    context->clientContext->getProgressBar()->endProgress(context->queryID);
+}
+
+std::shared_ptr<Task> QueryProcessor::createRootTask(PhysicalPlan* physicalPlan,
     ExecutionContext* context) {
     auto lastOperator = physicalPlan->lastOperator.get();
     auto resultCollector = ku_dynamic_cast<ResultCollector*>(lastOperator);
@@ -25,10 +53,7 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
     decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
     initTask(task.get());
-    context->clientContext->getProgressBar()->startProgress(context->queryID);
-    taskScheduler->scheduleTaskAndWaitOrError(task, context);
-    context->clientContext->getProgressBar()->endProgress(context->queryID);
-    return resultCollector->getResultFactorizedTable();
+    return task;
 }
 
 void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
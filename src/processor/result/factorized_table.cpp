@@ -208,6 +208,17 @@ uint64_t FactorizedTable::getNumFlatTuples(ft_tuple_idx_t tupleIdx) const {
     return numFlatTuples;
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& block : flatTupleBlockCollection->getBlocks()) {
+        memoryUsage += block->getSize();
+    }
+    for (auto& block : unFlatTupleBlockCollection->getBlocks()) {
+        memoryUsage += block->getSize();
+    }
+    return memoryUsage + inMemOverflowBuffer->getMemoryUsage();
+}
+
 uint8_t* FactorizedTable::getTuple(ft_tuple_idx_t tupleIdx) const {
     KU_ASSERT(tupleIdx < numTuples);
     auto [blockIdx, tupleIdxInBlock] = getBlockIdxAndTupleIdxInBlock(tupleIdx);
@@ -0,0 +1,172 @@
+#include "processor/result/spilled_partitions.h"
+
+#include <algorithm>
+
+#include "common/serializer/buffer_reader.h"
+#include "function/hash/vector_hash_functions.h"
+#include "storage/buffer_manager/spiller.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+void SpilledPartitions::addRun(uint64_t partitionIdx, SpilledRun run) {
+    std::unique_lock lck{mtx};
+    runs[partitionIdx].push_back(run);
+    numBytes[partitionIdx] += run.numBytes;
+}
+
+SpilledPartitionWriter::SpilledPartitionWriter(Spiller* spiller, SpilledPartitions* partitions,
+    MemoryManager* memoryManager)
+    : spiller{spiller}, partitions{partitions},
+      partitionPositions(SpilledPartitions::NUM_PARTITIONS) {
+    for (auto i = 0u; i < SpilledPartitions::NUM_PARTITIONS; i++) {
+        auto buffer = std::make_shared<BufferedSerializer>();
+        serializers.push_back(std::make_unique<Serializer>(buffer));
+        buffers.push_back(std::move(buffer));
+    }
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH(), memoryManager);
+    tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(), memoryManager);
+    combinedHashVector = std::make_unique<ValueVector>(LogicalType::HASH(), memoryManager);
+    partitionSelVector = std::make_shared<SelectionVector>(DEFAULT_VECTOR_CAPACITY);
+}
+
+void SpilledPartitionWriter::write(const std::vector<ValueVector*>& keyVectors,
+    const std::vector<ValueVector*>& vectors) {
+    computeHashes(keyVectors);
+    auto& keyState = hashVector->state;
+    auto& keySelVector = keyState->getSelVector();
+    if (keyState->isFlat()) {
+        auto hash = hashVector->getValue<hash_t>(keySelVector[0]);
+        writeBatch(SpilledPartitions::getPartitionIdx(hash, partitions->getLevel()), vectors);
+        return;
+    }
+    for (auto i = 0u; i < keySelVector.getSelSize(); i++) {
+        auto pos = keySelVector[i];
+        auto hash = hashVector->getValue<hash_t>(pos);
+        auto partitionIdx = SpilledPartitions::getPartitionIdx(hash, partitions->getLevel());
+        partitionPositions[partitionIdx].push_back(pos);
+    }
+    // Narrow the selection of the key state down to one partition at a time while serializing.
+    auto originalSelVector = keyState->getSelVectorShared();
+    for (auto partitionIdx = 0u; partitionIdx < SpilledPartitions::NUM_PARTITIONS;
+         partitionIdx++) {
+        auto& positions = partitionPositions[partitionIdx];
+        if (positions.empty()) {
+            continue;
+        }
+        std::copy(positions.begin(), positions.end(),
+            partitionSelVector->getMutableBuffer().begin());
+        partitionSelVector->setToFiltered(positions.size());
+        keyState->setSelVector(partitionSelVector);
+        writeBatch(partitionIdx, vectors);
+        positions.clear();
+    }
+    keyState->setSelVector(originalSelVector);
+}
+
+void SpilledPartitionWriter::flush() {
+    for (auto partitionIdx = 0u; partitionIdx < SpilledPartitions::NUM_PARTITIONS;
+         partitionIdx++) {
+        if (buffers[partitionIdx]->getSize() > 0) {
+            writeRun(partitionIdx);
+        }
+    }
+}
+
+// Keys are hashed the same way as by BaseHashTable, so that tuples land in the same partition as
+// the hashes stored in hash tables. The state of the result is the (shared) state of the unflat
+// keys, or a flat state if all keys are flat.
+void SpilledPartitionWriter::computeHashes(const std::vector<ValueVector*>& keyVectors) {
+    function::VectorHashFunction::computeHash(*keyVectors[0],
+        keyVectors[0]->state->getSelVector(), *hashVector, keyVectors[0]->state->getSelVector());
+    for (auto i = 1u; i < keyVectors.size(); i++) {
+        auto keyVector = keyVectors[i];
+        function::VectorHashFunction::computeHash(*keyVector, keyVector->state->getSelVector(),
+            *tmpHashVector, keyVector->state->getSelVector());
+        combinedHashVector->state =
+            !tmpHashVector->state->isFlat() ? tmpHashVector->state : hashVector->state;
+        function::VectorHashFunction::combineHash(*hashVector, hashVector->state->getSelVector(),
+            *tmpHashVector, tmpHashVector->state->getSelVector(), *combinedHashVector,
+            combinedHashVector->state->getSelVector());
+        std::swap(hashVector, combinedHashVector);
+    }
+}
+
+// A batch is serialized as the flatness of each distinct state, followed by each vector prefixed
+// with the index of its state.
+void SpilledPartitionWriter::writeBatch(uint64_t partitionIdx,
+    const std::vector<ValueVector*>& vectors) {
+    std::vector<DataChunkState*> states;
+    std::vector<uint32_t> stateIdxes;
+    for (auto& vector : vectors) {
+        auto it = std::find(states.begin(), states.end(), vector->state.get());
+        stateIdxes.push_back(it - states.begin());
+        if (it == states.end()) {
+            states.push_back(vector->state.get());
+        }
+    }
+    auto& ser = *serializers[partitionIdx];
+    ser.write<uint32_t>(states.size());
+    for (auto& state : states) {
+        ser.write<bool>(state->isFlat());
+    }
+    ser.write<uint32_t>(vectors.size());
+    for (auto i = 0u; i < vectors.size(); i++) {
+        ser.write<uint32_t>(stateIdxes[i]);
+        vectors[i]->serialize(ser);
+    }
+    if (buffers[partitionIdx]->getSize() >= RUN_SIZE) {
+        writeRun(partitionIdx);
+    }
+}
+
+void SpilledPartitionWriter::writeRun(uint64_t partitionIdx) {
+    auto& buffer = *buffers[partitionIdx];
+    auto filePosition = spiller->spillToDisk(buffer.getBlobData(), buffer.getSize());
+    partitions->addRun(partitionIdx, SpilledRun{filePosition, buffer.getSize()});
+    buffer.reset();
+}
+
+bool SpilledPartitionReader::readBatch(std::vector<std::unique_ptr<ValueVector>>& vectors) {
+    while (deserializer == nullptr || deserializer->finished()) {
+        if (nextRunIdx == runs.size()) {
+            return false;
+        }
+        auto& run = runs[nextRunIdx++];
+        runData = std::make_unique<uint8_t[]>(run.numBytes);
+        spiller->loadFromDisk(runData.get(), run.numBytes, run.filePosition);
+        deserializer =
+            std::make_unique<Deserializer>(std::make_unique<BufferReader>(runData.get(),
+                run.numBytes));
+    }
+    uint32_t numStates = 0;
+    deserializer->deserializeValue<uint32_t>(numStates);
+    std::vector<std::shared_ptr<DataChunkState>> states;
+    for (auto i = 0u; i < numStates; i++) {
+        bool isFlat = false;
+        deserializer->deserializeValue<bool>(isFlat);
+        auto state = std::make_shared<DataChunkState>();
+        if (isFlat) {
+            state->setToFlat();
+        }
+        states.push_back(std::move(state));
+    }
+    uint32_t numVectors = 0;
+    deserializer->deserializeValue<uint32_t>(numVectors);
+    vectors.clear();
+    for (auto i = 0u; i < numVectors; i++) {
+        uint32_t stateIdx = 0;
+        deserializer->deserializeValue<uint32_t>(stateIdx);
+        auto vector = ValueVector::deSerialize(*deserializer, memoryManager, states[stateIdx]);
+        // Struct fields need to share the state of their parent.
+        vector->setState(states[stateIdx]);
+        vectors.push_back(std::move(vector));
+    }
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
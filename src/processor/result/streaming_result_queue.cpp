@@ -0,0 +1,56 @@
+#include "processor/result/streaming_result_queue.h"
+
+namespace kuzu {
+namespace processor {
+
+bool StreamingResultQueue::push(std::unique_ptr<FactorizedTable> batch) {
+    std::unique_lock lck{mtx};
+    notFull.wait(lck, [&] { return cancelled || batches.size() < capacity; });
+    if (cancelled) {
+        return false;
+    }
+    batches.push_back(std::move(batch));
+    lck.unlock();
+    notEmpty.notify_one();
+    return true;
+}
+
+std::unique_ptr<FactorizedTable> StreamingResultQueue::pop() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&] { return !batches.empty() || finished; });
+    if (!batches.empty()) {
+        auto batch = std::move(batches.front());
+        batches.pop_front();
+        lck.unlock();
+        notFull.notify_one();
+        return batch;
+    }
+    if (exceptionPtr != nullptr) {
+        std::rethrow_exception(exceptionPtr);
+    }
+    return nullptr;
+}
+
+void StreamingResultQueue::finishProducing(std::exception_ptr exceptionPtr_) {
+    std::unique_lock lck{mtx};
+    finished = true;
+    exceptionPtr = std::move(exceptionPtr_);
+    lck.unlock();
+    notEmpty.notify_all();
+}
+
+void StreamingResultQueue::cancel() {
+    std::unique_lock lck{mtx};
+    cancelled = true;
+    batches.clear();
+    lck.unlock();
+    notFull.notify_all();
+}
+
+bool StreamingResultQueue::isCancelled() {
+    std::unique_lock lck{mtx};
+    return cancelled;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #include "storage/buffer_manager/buffer_manager.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstring>
@@ -12,6 +13,7 @@
 #include "common/file_system/virtual_file_system.h"
 #include "common/types/types.h"
 #include "main/db_config.h"
+#include "storage/buffer_manager/page_prefetcher.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/file_handle.h"
 #include "storage/store/column_chunk_data.h"
@@ -70,6 +72,14 @@ void EvictionQueue::removeCandidatesForFile(uint32_t fileIndex) {
     }
 }
 
+bool EvictionQueue::tryRemove(std::atomic<EvictionCandidate>& slot, EvictionCandidate candidate) {
+    if (slot.compare_exchange_strong(candidate, EMPTY)) {
+        size--;
+        return true;
+    }
+    return false;
+}
+
 void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
     auto nonEmpty = candidate.load();
     if (nonEmpty != EMPTY && candidate.compare_exchange_strong(nonEmpty, EMPTY)) {
@@ -81,8 +91,11 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
 
 BufferManager::BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
     uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly)
-    : bufferPoolSize{bufferPoolSize}, evictionQueue{bufferPoolSize / PAGE_SIZE},
-      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
+    : bufferPoolSize{bufferPoolSize}, probationaryQueue{bufferPoolSize / PAGE_SIZE},
+      protectedQueue{bufferPoolSize / PAGE_SIZE},
+      usedMemory{(probationaryQueue.getCapacity() + protectedQueue.getCapacity()) *
+                 sizeof(EvictionCandidate)},
+      vfs{vfs}, prefetcher{std::make_unique<PagePrefetcher>(*this)} {
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize);
@@ -137,7 +150,7 @@ uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
                     throw BufferManagerException("Unable to allocate memory! The buffer pool is "
                                                  "full and no memory could be freed!");
                 }
-                if (!evictionQueue.insert(fileHandle.getFileIndex(), pageIdx)) {
+                if (!probationaryQueue.insert(fileHandle.getFileIndex(), pageIdx)) {
                     throw BufferManagerException(
                         "Eviction queue is full! This should be impossible.");
                 }
@@ -147,6 +160,10 @@ uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
         case PageState::UNLOCKED:
         case PageState::MARKED: {
             if (pageState->tryLock(currStateAndVersion)) {
+                pageState->setReaccessed();
+                if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
+                    counters.add(BufferPoolCounter::CACHE_HITS);
+                }
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
@@ -217,23 +234,36 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PageAccessPattern accessPattern) {
     auto pageState = fileHandle.getPageState(pageIdx);
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
 #endif
+    // Pages read from disk by this call are counted as misses by pin.
+    bool isPinned = false;
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
         case PageState::UNLOCKED: {
             if (!try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
                     fileHandle.getPageSizeClass())) {
+                counters.add(BufferPoolCounter::OPTIMISTIC_READ_RETRIES);
                 continue;
             }
             if (pageState->getStateAndVersion() == currStateAndVersion) {
+                if (!isPinned) {
+                    counters.add(BufferPoolCounter::CACHE_HITS);
+                    // Failing to set the flag due to a concurrent state change is fine, as the
+                    // flag is only a hint for eviction.
+                    if (accessPattern == PageAccessPattern::RANDOM &&
+                        !PageState::isReaccessed(currStateAndVersion)) {
+                        pageState->trySetReaccessed(currStateAndVersion);
+                    }
+                }
                 return;
             }
+            counters.add(BufferPoolCounter::OPTIMISTIC_READ_RETRIES);
         } break;
         case PageState::MARKED: {
             // If the page is marked, we try to switch to unlocked.
@@ -243,6 +273,7 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
             unpin(fileHandle, pageIdx);
+            isPinned = true;
         } break;
         default: {
             // When locked, continue the spinning.
@@ -252,15 +283,67 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
     }
 }
 
+// Loads the evicted pages in [startPageIdx, startPageIdx + numPages) into their frames ahead of a
+// scan, so that the scan does not read them one by one. Frames of consecutive pages in the same
+// page group are contiguous, so each run of such pages is read with a single request, and all runs
+// are submitted to the file system as one batch. Pages that are not evicted or are locked by other
+// threads are skipped, and prefetching stops once no more memory can be reserved. The pages are
+// locked and their frames reserved here, while the batch is read by the prefetcher in the
+// background. Prefetched pages go through the same transitions as a pin followed by an unpin,
+// i.e., they end up UNLOCKED and in the probationary queue once read.
+void BufferManager::prefetchPages(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    KU_ASSERT(!fileHandle.isInMemoryMode());
+    const auto endPageIdx = std::min(startPageIdx + numPages, fileHandle.getNumPages());
+    // Pages of the runs are locked and have their frames reserved. A run ends at a page which can't
+    // be prefetched or at the end of a page group, as frames are only contiguous within a group.
+    std::vector<PageRun> runs;
+    bool isInRun = false;
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; ++pageIdx) {
+        if ((pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) == 0) {
+            isInRun = false;
+        }
+        auto pageState = fileHandle.getPageState(pageIdx);
+        auto currStateAndVersion = pageState->getStateAndVersion();
+        if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+            !pageState->tryLock(currStateAndVersion)) {
+            isInRun = false;
+            continue;
+        }
+        if (!reserveFrame(fileHandle, pageIdx)) {
+            pageState->resetToEvicted();
+            break;
+        }
+        if (isInRun) {
+            runs.back().numPages++;
+        } else {
+            runs.push_back({pageIdx, 1});
+            isInRun = true;
+        }
+    }
+    if (!runs.empty()) {
+        prefetcher->submit(fileHandle, std::move(runs));
+    }
+}
+
+void BufferManager::waitForPrefetchedPages() {
+    prefetcher->waitForAll();
+}
+
 void BufferManager::unpin(FileHandle& fileHandle, page_idx_t pageIdx) {
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->unlock();
 }
 
 // evicts up to 64 pages and returns the space reclaimed
+// Candidates are taken from the probationary queue first, unless the protected queue holds more
+// than PROTECTED_QUEUE_RATIO of all candidates. The other queue is only tried once the first one
+// has been tried twice without finding enough evictable pages. Reaccessed pages found in the
+// probationary queue are promoted to the protected queue.
 uint64_t BufferManager::evictPages() {
     constexpr size_t BATCH_SIZE = 64;
     std::array<std::atomic<EvictionCandidate>*, BATCH_SIZE> evictionCandidates{};
+    std::array<EvictionQueue*, BATCH_SIZE> evictionCandidateQueues{};
     size_t evictablePages = 0;
     size_t pagesTried = 0;
     uint64_t claimedMemory = 0;
@@ -269,9 +352,20 @@ uint64_t BufferManager::evictPages() {
     // E.g. if the vast majority of pages are unmarked and unlocked,
     // the first pass will mark them and the second pass, if insufficient marked pages
     // are found, will evict the first batch.
-    auto failureLimit = evictionQueue.getSize() * 2;
+    const auto numProbationaryPages = probationaryQueue.getSize();
+    const auto numProtectedPages = protectedQueue.getSize();
+    const bool isProtectedQueueFull =
+        numProtectedPages > (numProbationaryPages + numProtectedPages) * PROTECTED_QUEUE_RATIO;
+    auto& firstQueue = isProtectedQueueFull ? protectedQueue : probationaryQueue;
+    auto& secondQueue = isProtectedQueueFull ? probationaryQueue : protectedQueue;
+    const auto firstQueueLimit =
+        (isProtectedQueueFull ? numProtectedPages : numProbationaryPages) * 2;
+    auto failureLimit = (numProbationaryPages + numProtectedPages) * 2;
     while (evictablePages < BATCH_SIZE && pagesTried < failureLimit) {
-        evictionCandidates[evictablePages] = evictionQueue.next();
+        auto& queue = pagesTried < firstQueueLimit ? firstQueue : secondQueue;
+        const bool isProbationary = &queue == &probationaryQueue;
+        evictionCandidates[evictablePages] = queue.next();
+        evictionCandidateQueues[evictablePages] = &queue;
         pagesTried++;
         auto evictionCandidate = evictionCandidates[evictablePages]->load();
         if (evictionCandidate == EvictionQueue::EMPTY) {
@@ -282,7 +376,11 @@ uint64_t BufferManager::evictPages() {
         auto pageStateAndVersion = pageState->getStateAndVersion();
         if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
             if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
-                pageState->tryMark(pageStateAndVersion);
+                if (isProbationary && PageState::isReaccessed(pageStateAndVersion)) {
+                    tryPromotePage(*evictionCandidates[evictablePages], pageStateAndVersion);
+                } else {
+                    pageState->tryMark(pageStateAndVersion);
+                }
             }
             continue;
         }
@@ -290,11 +388,38 @@ uint64_t BufferManager::evictPages() {
     }
 
     for (size_t i = 0; i < evictablePages; i++) {
-        claimedMemory += tryEvictPage(*evictionCandidates[i]);
+        claimedMemory += tryEvictPage(*evictionCandidateQueues[i], *evictionCandidates[i]);
     }
     return claimedMemory;
 }
 
+// Moves the candidate of an UNLOCKED page from the probationary to the protected queue. The page is
+// locked while it is moved, so that it can't be evicted concurrently, and then unlocked with the
+// same version since its content is unchanged.
+bool BufferManager::tryPromotePage(std::atomic<EvictionCandidate>& _candidate,
+    uint64_t pageStateAndVersion) {
+    auto candidate = _candidate.load();
+    if (candidate == EvictionQueue::EMPTY) {
+        return false;
+    }
+    auto& pageState = *fileHandles[candidate.fileIdx]->getPageState(candidate.pageIdx);
+    if (!pageState.tryLock(pageStateAndVersion)) {
+        return false;
+    }
+    const auto unlockedStateAndVersion = pageStateAndVersion & ~PageState::REACCESSED_MASK;
+    if (!probationaryQueue.tryRemove(_candidate, candidate)) {
+        pageState.unlockWithSameVersion(unlockedStateAndVersion);
+        return false;
+    }
+    if (!protectedQueue.insert(candidate.fileIdx, candidate.pageIdx) &&
+        !probationaryQueue.insert(candidate.fileIdx, candidate.pageIdx)) {
+        pageState.unlockWithSameVersion(unlockedStateAndVersion);
+        throw BufferManagerException("Eviction queue is full! This should be impossible.");
+    }
+    pageState.unlockWithSameVersion(unlockedStateAndVersion);
+    return true;
+}
+
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
 // uniquely mapped to a frame. Thus, claiming a frame is equivalent to ensuring enough physical
 // memory is available.
@@ -305,6 +430,14 @@ uint64_t BufferManager::evictPages() {
 // and return false, otherwise, we load the page to its corresponding frame and return true.
 bool BufferManager::claimAFrame(FileHandle& fileHandle, page_idx_t pageIdx,
     PageReadPolicy pageReadPolicy) {
+    if (!reserveFrame(fileHandle, pageIdx)) {
+        return false;
+    }
+    cachePageIntoFrame(fileHandle, pageIdx, pageReadPolicy);
+    return true;
+}
+
+bool BufferManager::reserveFrame(FileHandle& fileHandle, page_idx_t pageIdx) {
     page_offset_t pageSizeToClaim = fileHandle.getPageSize();
     if (!reserve(pageSizeToClaim)) {
         return false;
@@ -320,8 +453,9 @@ bool BufferManager::claimAFrame(FileHandle& fileHandle, page_idx_t pageIdx,
             stringFormat("VirtualAlloc MEM_COMMIT failed with error code {}: {}.", GetLastError(),
                 std::system_category().message(GetLastError())));
     }
+#else
+    (void)pageIdx;
 #endif
-    cachePageIntoFrame(fileHandle, pageIdx, pageReadPolicy);
     return true;
 }
 
@@ -369,7 +503,8 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
     return true;
 }
 
-uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate) {
+uint64_t BufferManager::tryEvictPage(EvictionQueue& queue,
+    std::atomic<EvictionCandidate>& _candidate) {
     auto candidate = _candidate.load();
     // Page must have been evicted by another thread already
     if (candidate.pageIdx == INVALID_PAGE_IDX) {
@@ -380,12 +515,14 @@ uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate)
     // We check if the page is evictable again. Note that if the page's state or version has
     // changed after the check, `tryLock` will fail, and we will abort the eviction of this page.
     if (!candidate.isEvictable(currStateAndVersion) || !pageState.tryLock(currStateAndVersion)) {
+        counters.add(BufferPoolCounter::FAILED_EVICTIONS);
         return 0;
     }
     // The pageState was locked, but another thread already evicted this candidate and unlocked it
     // before the lock occurred
     if (_candidate.load() != candidate) {
         pageState.unlock();
+        counters.add(BufferPoolCounter::FAILED_EVICTIONS);
         return 0;
     }
     if (fileHandles[candidate.fileIdx]->isInMemoryMode()) {
@@ -400,7 +537,8 @@ uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate)
     auto numBytesFreed = fileHandle.getPageSize();
     releaseFrameForPage(fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
-    evictionQueue.clear(_candidate);
+    queue.clear(_candidate);
+    counters.add(BufferPoolCounter::EVICTIONS);
     return numBytesFreed;
 }
 
@@ -410,11 +548,52 @@ void BufferManager::cachePageIntoFrame(FileHandle& fileHandle, page_idx_t pageId
     pageState->clearDirty();
     if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
         fileHandle.readPageFromDisk(getFrame(fileHandle, pageIdx), pageIdx);
+        counters.add(BufferPoolCounter::CACHE_MISSES);
+    }
+}
+
+void BufferManager::cachePagesIntoFrames(FileHandle& fileHandle, const std::vector<PageRun>& runs) {
+    const auto pageSize = fileHandle.getPageSize();
+    std::vector<FileReadRequest> requests;
+    requests.reserve(runs.size());
+    uint64_t numBytesToRead = 0;
+    for (auto& run : runs) {
+        KU_ASSERT(run.startPageIdx + run.numPages <= fileHandle.getNumPages());
+        requests.push_back({getFrame(fileHandle, run.startPageIdx),
+            (uint64_t)run.numPages * pageSize, (uint64_t)run.startPageIdx * pageSize});
+        numBytesToRead += requests.back().numBytes;
+    }
+    try {
+        fileHandle.getFileInfo()->readFromFileBatch(requests);
+        fileHandle.ioCounters.add(FileIOCounter::BYTES_READ, numBytesToRead);
+    } catch (...) {
+        for (auto& run : runs) {
+            for (auto pageIdx = run.startPageIdx; pageIdx < run.startPageIdx + run.numPages;
+                 ++pageIdx) {
+                releaseFrameForPage(fileHandle, pageIdx);
+                freeUsedMemory(pageSize);
+                fileHandle.getPageState(pageIdx)->resetToEvicted();
+            }
+        }
+        throw;
+    }
+    for (auto& run : runs) {
+        counters.add(BufferPoolCounter::CACHE_MISSES, run.numPages);
+        for (auto pageIdx = run.startPageIdx; pageIdx < run.startPageIdx + run.numPages;
+             ++pageIdx) {
+            auto pageState = fileHandle.getPageState(pageIdx);
+            pageState->clearDirty();
+            if (!probationaryQueue.insert(fileHandle.getFileIndex(), pageIdx)) {
+                throw BufferManagerException("Eviction queue is full! This should be impossible.");
+            }
+            pageState->unlock();
+        }
     }
 }
 
 void BufferManager::removeFilePagesFromFrames(FileHandle& fileHandle) {
-    evictionQueue.removeCandidatesForFile(fileHandle.getFileIndex());
+    probationaryQueue.removeCandidatesForFile(fileHandle.getFileIndex());
+    protectedQueue.removeCandidatesForFile(fileHandle.getFileIndex());
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
         removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
     }
@@ -453,12 +632,52 @@ void BufferManager::removePageFromFrame(FileHandle& fileHandle, page_idx_t pageI
     pageState->resetToEvicted();
 }
 
+BufferPoolInfo BufferManager::getBufferPoolInfo() {
+    BufferPoolInfo info{};
+    info.bufferPoolSize = bufferPoolSize;
+    info.usedMemory = usedMemory;
+    info.numCacheHits = counters.get(BufferPoolCounter::CACHE_HITS);
+    info.numCacheMisses = counters.get(BufferPoolCounter::CACHE_MISSES);
+    info.numEvictions = counters.get(BufferPoolCounter::EVICTIONS);
+    info.numFailedEvictions = counters.get(BufferPoolCounter::FAILED_EVICTIONS);
+    info.numOptimisticReadRetries = counters.get(BufferPoolCounter::OPTIMISTIC_READ_RETRIES);
+    info.numTempPageAllocations = counters.get(BufferPoolCounter::TEMP_PAGE_ALLOCATIONS);
+    info.numTempPagesInUse = counters.get(BufferPoolCounter::TEMP_PAGES_IN_USE);
+    std::unique_lock lck{fileHandlesMtx};
+    for (auto& fileHandle : fileHandles) {
+        info.numBytesRead += fileHandle->getNumBytesRead();
+        info.numBytesWritten += fileHandle->getNumBytesWritten();
+    }
+    return info;
+}
+
+std::vector<FileHandleInfo> BufferManager::getFileHandleInfos() {
+    std::vector<FileHandleInfo> infos;
+    std::unique_lock lck{fileHandlesMtx};
+    for (auto& fileHandle : fileHandles) {
+        FileHandleInfo info{};
+        info.filePath = fileHandle->getFileInfo()->path;
+        info.numPages = fileHandle->getNumPages();
+        for (auto pageIdx = 0u; pageIdx < info.numPages; ++pageIdx) {
+            info.numCachedPages +=
+                fileHandle->getPageState(pageIdx)->getState() != PageState::EVICTED;
+        }
+        info.numBytesRead = fileHandle->getNumBytesRead();
+        info.numBytesWritten = fileHandle->getNumBytesWritten();
+        infos.push_back(std::move(info));
+    }
+    return infos;
+}
+
 uint64_t BufferManager::freeUsedMemory(uint64_t size) {
     KU_ASSERT(usedMemory.load() >= size);
     return usedMemory.fetch_sub(size);
 }
 
-BufferManager::~BufferManager() = default;
+BufferManager::~BufferManager() {
+    // Complete pending reads before the frames and file handles they read into are destroyed.
+    prefetcher.reset();
+}
 
 } // namespace storage
 } // namespace kuzu
@@ -82,6 +82,8 @@ std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZer
         }
     }
     auto buffer = bm->pin(*fh, pageIdx, PageReadPolicy::DONT_READ_PAGE);
+    bm->counters.add(BufferPoolCounter::TEMP_PAGE_ALLOCATIONS);
+    bm->counters.add(BufferPoolCounter::TEMP_PAGES_IN_USE);
     auto memoryBuffer = std::make_unique<MemoryBuffer>(this, pageIdx, buffer);
     if (initializeToZero) {
         memset(memoryBuffer->getBuffer().data(), 0, pageSize);
@@ -96,6 +98,7 @@ void MemoryManager::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
         bm->nonEvictableMemory -= buffer.size();
     } else {
         bm->unpin(*fh, pageIdx);
+        bm->counters.subtract(BufferPoolCounter::TEMP_PAGES_IN_USE);
         std::unique_lock<std::mutex> lock(allocatorLock);
         freePages.push(pageIdx);
     }
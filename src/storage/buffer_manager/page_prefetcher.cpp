@@ -0,0 +1,69 @@
+#include "storage/buffer_manager/page_prefetcher.h"
+
+#include <system_error>
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace storage {
+
+PagePrefetcher::~PagePrefetcher() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+    }
+    cv.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void PagePrefetcher::submit(FileHandle& fileHandle, std::vector<BufferManager::PageRun> runs) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(!stopped);
+    if (!thread.joinable()) {
+        try {
+            thread = std::thread(&PagePrefetcher::run, this);
+        } catch (std::system_error&) {
+            // LCOV_EXCL_START
+            // The pages are locked already, so they are read here instead.
+            lck.unlock();
+            bufferManager.cachePagesIntoFrames(fileHandle, runs);
+            return;
+            // LCOV_EXCL_STOP
+        }
+    }
+    tasks.push_back({&fileHandle, std::move(runs)});
+    lck.unlock();
+    cv.notify_all();
+}
+
+void PagePrefetcher::waitForAll() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return tasks.empty() && !isRunningTask; });
+}
+
+void PagePrefetcher::run() {
+    std::unique_lock lck{mtx};
+    while (true) {
+        cv.wait(lck, [&] { return stopped || !tasks.empty(); });
+        if (tasks.empty()) {
+            return;
+        }
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+        isRunningTask = true;
+        lck.unlock();
+        try {
+            bufferManager.cachePagesIntoFrames(*task.fileHandle, task.runs);
+        } catch (...) { // NOLINT(bugprone-empty-catch):
+            // The pages have been evicted again, and are read by the next thread accessing them.
+        }
+        lck.lock();
+        isRunningTask = false;
+        cv.notify_all();
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
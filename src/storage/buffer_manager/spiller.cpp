@@ -18,7 +18,7 @@ namespace storage {
 Spiller::Spiller(const std::string& tmpFilePath, BufferManager& bufferManager,
     common::VirtualFileSystem* vfs)
     // This should only be used with a LocalFileSystem
-    : dataFH{bufferManager.getFileHandle(tmpFilePath,
+    : numFileRetainers{0}, dataFH{bufferManager.getFileHandle(tmpFilePath,
           FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS, vfs, nullptr)} {
     // Clear the file if it already existed (e.g. from a previous run which
     // failed to clean up).
@@ -61,11 +61,22 @@ void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
     auto& buffer = *chunk.buffer;
     if (buffer.evicted) {
         buffer.prepareLoadFromDisk();
-        dataFH->getFileInfo()->readFromFile(buffer.buffer.data(), buffer.buffer.size(),
-            buffer.filePosition);
+        dataFH->readFromFile(buffer.buffer.data(), buffer.buffer.size(), buffer.filePosition);
     }
 }
 
+uint64_t Spiller::spillToDisk(const uint8_t* data, uint64_t size) const {
+    auto pageSize = dataFH->getPageSize();
+    auto numPages = (size + pageSize - 1) / pageSize;
+    auto startPage = dataFH->addNewPages(numPages);
+    dataFH->writePagesToFile(data, size, startPage);
+    return startPage * pageSize;
+}
+
+void Spiller::loadFromDisk(uint8_t* data, uint64_t size, uint64_t filePosition) const {
+    dataFH->readFromFile(data, size, filePosition);
+}
+
 uint64_t Spiller::claimNextGroup() {
     ChunkedNodeGroup* groupToFlush = nullptr;
     {
@@ -82,9 +93,22 @@ uint64_t Spiller::claimNextGroup() {
     return groupToFlush->spillToDisk();
 }
 
-// NOLINTNEXTLINE(readability-make-member-function-const): Function shouldn't be re-ordered
+void Spiller::retainFile() {
+    std::unique_lock<std::mutex> lock(fileMtx);
+    numFileRetainers++;
+}
+
+void Spiller::releaseFile() {
+    std::unique_lock<std::mutex> lock(fileMtx);
+    KU_ASSERT(numFileRetainers > 0);
+    numFileRetainers--;
+}
+
 void Spiller::clearFile() {
-    dataFH->getFileInfo()->truncate(0);
+    std::unique_lock<std::mutex> lock(fileMtx);
+    if (numFileRetainers == 0) {
+        dataFH->getFileInfo()->truncate(0);
+    }
 }
 } // namespace storage
 } // namespace kuzu
@@ -0,0 +1,151 @@
+#include "storage/compression/block_compression.h"
+
+#include "common/exception/storage.h"
+#include "common/string_format.h"
+#include "lz4.hpp"
+#include "zstd.h"
+
+using namespace kuzu::common;
+
+namespace kuzu::storage {
+
+namespace {
+
+uint64_t getMaxCompressedSize(CompressionType compression, uint64_t numBytes) {
+    switch (compression) {
+    case CompressionType::LZ4: {
+        return kuzu_lz4::LZ4_compressBound(numBytes);
+    }
+    case CompressionType::ZSTD: {
+        return kuzu_zstd::ZSTD_compressBound(numBytes);
+    }
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+// Returns the compressed size.
+uint64_t compressBlock(CompressionType compression, std::span<const uint8_t> src, uint8_t* dst,
+    uint64_t dstCapacity) {
+    switch (compression) {
+    case CompressionType::LZ4: {
+        const auto compressedSize = kuzu_lz4::LZ4_compress_default(
+            reinterpret_cast<const char*>(src.data()), reinterpret_cast<char*>(dst), src.size(),
+            dstCapacity);
+        if (compressedSize <= 0) {
+            throw StorageException("LZ4 compression failed.");
+        }
+        return compressedSize;
+    }
+    case CompressionType::ZSTD: {
+        const auto compressedSize = kuzu_zstd::ZSTD_compress(dst, dstCapacity, src.data(),
+            src.size(), ZSTD_CLEVEL_DEFAULT);
+        if (kuzu_zstd::ZSTD_isError(compressedSize)) {
+            throw StorageException(stringFormat("ZSTD compression failed: {}.",
+                kuzu_zstd::ZSTD_getErrorName(compressedSize)));
+        }
+        return compressedSize;
+    }
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+// LZ4 is preferred unless ZSTD compresses notably better.
+CompressionType chooseCompression(uint64_t lz4Size, uint64_t zstdSize) {
+    return zstdSize * BlockCompression::MIN_ZSTD_GAIN <= lz4Size ? CompressionType::ZSTD :
+                                                                  CompressionType::LZ4;
+}
+
+bool isWorthCompressing(uint64_t uncompressedSize, uint64_t compressedSize) {
+    return compressedSize * BlockCompression::MIN_COMPRESSION_RATIO <= uncompressedSize;
+}
+
+} // namespace
+
+std::optional<BlockCompression::CompressedData> BlockCompression::compress(
+    std::span<const uint8_t> data) {
+    if (data.empty()) {
+        return std::nullopt;
+    }
+    const auto numBlocks = getNumBlocks(data.size());
+    // Choose the codec by compressing blocks spread evenly over the data with both codecs.
+    const auto numSampleBlocks = std::min(NUM_SAMPLE_BLOCKS, numBlocks);
+    uint64_t sampleSize = 0, lz4Size = 0, zstdSize = 0;
+    std::vector<uint8_t> sampleBuffer(getMaxCompressedSize(CompressionType::ZSTD, BLOCK_SIZE));
+    for (auto i = 0u; i < numSampleBlocks; i++) {
+        const auto blockIdx = i * numBlocks / numSampleBlocks;
+        const auto block = data.subspan(blockIdx * BLOCK_SIZE, getBlockSize(data.size(), blockIdx));
+        sampleSize += block.size();
+        lz4Size += compressBlock(CompressionType::LZ4, block, sampleBuffer.data(),
+            sampleBuffer.size());
+        zstdSize += compressBlock(CompressionType::ZSTD, block, sampleBuffer.data(),
+            sampleBuffer.size());
+    }
+    const auto compression = chooseCompression(lz4Size, zstdSize);
+    if (!isWorthCompressing(sampleSize, std::min(lz4Size, zstdSize))) {
+        return std::nullopt;
+    }
+
+    const auto headerSize = getHeaderSize(data.size());
+    CompressedData result{compression, std::vector<uint8_t>(headerSize +
+                                           numBlocks * getMaxCompressedSize(compression,
+                                                           BLOCK_SIZE))};
+    auto* blockEnds = reinterpret_cast<uint64_t*>(result.data.data());
+    uint64_t compressedSize = 0;
+    for (auto blockIdx = 0u; blockIdx < numBlocks; blockIdx++) {
+        const auto block = data.subspan(blockIdx * BLOCK_SIZE, getBlockSize(data.size(), blockIdx));
+        auto* dst = result.data.data() + headerSize + compressedSize;
+        compressedSize += compressBlock(compression, block, dst,
+            result.data.size() - headerSize - compressedSize);
+        blockEnds[blockIdx] = compressedSize;
+    }
+    if (!isWorthCompressing(data.size(), headerSize + compressedSize)) {
+        return std::nullopt;
+    }
+    result.data.resize(headerSize + compressedSize);
+    return result;
+}
+
+std::optional<BlockCompression::CompressedData> BlockCompression::compressValue(
+    std::span<const uint8_t> data) {
+    std::vector<uint8_t> lz4Data(getMaxCompressedSize(CompressionType::LZ4, data.size()));
+    lz4Data.resize(compressBlock(CompressionType::LZ4, data, lz4Data.data(), lz4Data.size()));
+    std::vector<uint8_t> zstdData(getMaxCompressedSize(CompressionType::ZSTD, data.size()));
+    zstdData.resize(compressBlock(CompressionType::ZSTD, data, zstdData.data(), zstdData.size()));
+    auto result = chooseCompression(lz4Data.size(), zstdData.size()) == CompressionType::ZSTD ?
+                      CompressedData{CompressionType::ZSTD, std::move(zstdData)} :
+                      CompressedData{CompressionType::LZ4, std::move(lz4Data)};
+    if (!isWorthCompressing(data.size(), result.data.size())) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+void BlockCompression::decompressBlock(CompressionType compression, std::span<const uint8_t> src,
+    std::span<uint8_t> dst) {
+    switch (compression) {
+    case CompressionType::LZ4: {
+        const auto decompressedSize =
+            kuzu_lz4::LZ4_decompress_safe(reinterpret_cast<const char*>(src.data()),
+                reinterpret_cast<char*>(dst.data()), src.size(), dst.size());
+        if (decompressedSize < 0 || static_cast<uint64_t>(decompressedSize) != dst.size()) {
+            throw StorageException("Failed to decompress LZ4 compressed data.");
+        }
+    } break;
+    case CompressionType::ZSTD: {
+        const auto decompressedSize =
+            kuzu_zstd::ZSTD_decompress(dst.data(), dst.size(), src.data(), src.size());
+        if (kuzu_zstd::ZSTD_isError(decompressedSize) || decompressedSize != dst.size()) {
+            throw StorageException("Failed to decompress ZSTD compressed data.");
+        }
+    } break;
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+} // namespace kuzu::storage
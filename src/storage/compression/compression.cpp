@@ -192,7 +192,9 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     }
     case CompressionType::CONSTANT:
     case CompressionType::ALP:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::LZ4:
+    case CompressionType::ZSTD: {
         return false;
     }
     default: {
@@ -242,6 +244,11 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
     case CompressionType::UNCOMPRESSED: {
         return true;
     }
+    case CompressionType::LZ4:
+    case CompressionType::ZSTD: {
+        // Block compressed data is rewritten as a whole.
+        return false;
+    }
     case CompressionType::ALP: {
         return TypeUtils::visit(
             physicalType,
@@ -349,6 +356,12 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
+    case CompressionType::LZ4:
+    case CompressionType::ZSTD: {
+        // Block compressed values can't be located by page. This is only the number of values
+        // which would fit in the page uncompressed.
+        return Uncompressed::numValues(pageSize, dataType);
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -468,6 +481,12 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::LZ4: {
+        return "LZ4";
+    }
+    case CompressionType::ZSTD: {
+        return "ZSTD";
+    }
     default: {
         KU_UNREACHABLE;
     }
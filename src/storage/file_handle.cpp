@@ -93,14 +93,14 @@ uint8_t* FileHandle::pinPage(page_idx_t pageIdx, PageReadPolicy readPolicy) {
 }
 
 void FileHandle::optimisticReadPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readOp) {
+    const std::function<void(uint8_t*)>& readOp, PageAccessPattern accessPattern) {
     if (isInMemoryMode()) {
         KU_ASSERT(
             PageState::getState(getPageState(pageIdx)->getStateAndVersion()) == PageState::LOCKED);
         const auto frame = bm->getFrame(*this, pageIdx);
         readOp(frame);
     } else {
-        bm->optimisticRead(*this, pageIdx, readOp);
+        bm->optimisticRead(*this, pageIdx, readOp, accessPattern);
     }
 }
 
@@ -108,6 +108,13 @@ void FileHandle::unpinPage(page_idx_t pageIdx) {
     bm->unpin(*this, pageIdx);
 }
 
+void FileHandle::prefetchPages(page_idx_t startPageIdx, page_idx_t numPages) {
+    if (isInMemoryMode()) {
+        return;
+    }
+    bm->prefetchPages(*this, startPageIdx, numPages);
+}
+
 void FileHandle::resetToZeroPagesAndPageCapacity() {
     removePageIdxAndTruncateIfNecessary(0 /* pageIdx */);
     if (isInMemoryMode()) {
@@ -145,8 +152,31 @@ void FileHandle::removePageFromFrameIfNecessary(page_idx_t pageIdx) {
 }
 
 void FileHandle::flushAllDirtyPagesInFrames() {
+    if (isInMemoryMode()) {
+        return;
+    }
+    // Frames of consecutive pages within a page group are contiguous, so runs of dirty pages are
+    // written with a single request. All requests are submitted to the file system as one batch.
+    std::vector<FileWriteRequest> requests;
+    std::vector<page_idx_t> dirtyPages;
     for (auto pageIdx = 0u; pageIdx < numPages; ++pageIdx) {
-        flushPageIfDirtyWithoutLock(pageIdx);
+        if (!getPageState(pageIdx)->isDirty()) {
+            continue;
+        }
+        const bool extendsLastRequest = !dirtyPages.empty() && dirtyPages.back() + 1 == pageIdx &&
+                                        (pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) != 0;
+        if (extendsLastRequest) {
+            requests.back().numBytes += getPageSize();
+        } else {
+            requests.push_back(
+                {getFrame(pageIdx), getPageSize(), (uint64_t)pageIdx * getPageSize()});
+        }
+        dirtyPages.push_back(pageIdx);
+    }
+    fileInfo->writeFileBatch(requests);
+    ioCounters.add(FileIOCounter::BYTES_WRITTEN, dirtyPages.size() * getPageSize());
+    for (auto pageIdx : dirtyPages) {
+        getPageState(pageIdx)->clearDirtyWithoutLock();
     }
 }
 
@@ -154,6 +184,7 @@ void FileHandle::flushPageIfDirtyWithoutLock(page_idx_t pageIdx) {
     auto pageState = getPageState(pageIdx);
     if (!isInMemoryMode() && pageState->isDirty()) {
         fileInfo->writeFile(getFrame(pageIdx), getPageSize(), pageIdx * getPageSize());
+        ioCounters.add(FileIOCounter::BYTES_WRITTEN, getPageSize());
         pageState->clearDirtyWithoutLock();
     }
 }
@@ -0,0 +1,707 @@
+#include "storage/index/fts_index.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/ku_string.h"
+#include "common/vector/value_vector.h"
+#include "storage/compression/bitpacking_utils.h"
+#include "storage/storage_structure/disk_array.h"
+#include "storage/storage_utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+// Lucene's default English stop words.
+static const std::unordered_set<std::string_view> STOP_WORDS{"a", "an", "and", "are", "as", "at",
+    "be", "but", "by", "for", "if", "in", "into", "is", "it", "no", "not", "of", "on", "or", "such",
+    "that", "the", "their", "then", "there", "these", "they", "this", "to", "was", "will", "with"};
+
+std::vector<std::string> FTSTokenizer::tokenize(std::string_view text) {
+    std::vector<std::string> terms;
+    std::string term;
+    auto flush = [&]() {
+        if (!term.empty() && !STOP_WORDS.contains(term)) {
+            terms.push_back(stem(std::move(term)));
+        }
+        term.clear();
+    };
+    for (const auto c : text) {
+        const auto byte = static_cast<uint8_t>(c);
+        if (byte >= 0x80 || std::isalnum(byte)) {
+            term.push_back(static_cast<char>(std::tolower(byte)));
+        } else {
+            flush();
+        }
+    }
+    flush();
+    return terms;
+}
+
+static bool isConsonant(const std::string& term, uint64_t i) {
+    switch (term[i]) {
+    case 'a':
+    case 'e':
+    case 'i':
+    case 'o':
+    case 'u':
+        return false;
+    case 'y':
+        return i == 0 || !isConsonant(term, i - 1);
+    default:
+        return true;
+    }
+}
+
+// Number of vowel-consonant sequences in the first `length` characters.
+static uint64_t getMeasure(const std::string& term, uint64_t length) {
+    uint64_t measure = 0;
+    uint64_t i = 0;
+    while (i < length && isConsonant(term, i)) {
+        i++;
+    }
+    while (i < length) {
+        while (i < length && !isConsonant(term, i)) {
+            i++;
+        }
+        if (i == length) {
+            break;
+        }
+        while (i < length && isConsonant(term, i)) {
+            i++;
+        }
+        measure++;
+    }
+    return measure;
+}
+
+static bool containsVowel(const std::string& term, uint64_t length) {
+    for (auto i = 0u; i < length; i++) {
+        if (!isConsonant(term, i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool endsWithDoubleConsonant(const std::string& term) {
+    const auto length = term.size();
+    return length >= 2 && term[length - 1] == term[length - 2] && isConsonant(term, length - 1);
+}
+
+// Whether the term ends with consonant-vowel-consonant, where the last consonant is not w, x or y.
+static bool endsWithCVC(const std::string& term) {
+    const auto length = term.size();
+    if (length < 3 || !isConsonant(term, length - 1) || isConsonant(term, length - 2) ||
+        !isConsonant(term, length - 3)) {
+        return false;
+    }
+    const auto last = term[length - 1];
+    return last != 'w' && last != 'x' && last != 'y';
+}
+
+using suffix_rule_t = std::pair<std::string_view, std::string_view>;
+
+// Suffixes sharing an ending are listed longest first.
+static constexpr suffix_rule_t STEP2_SUFFIXES[] = {{"ational", "ate"}, {"tional", "tion"},
+    {"enci", "ence"}, {"anci", "ance"}, {"izer", "ize"}, {"abli", "able"}, {"alli", "al"},
+    {"entli", "ent"}, {"eli", "e"}, {"ousli", "ous"}, {"ization", "ize"}, {"ation", "ate"},
+    {"ator", "ate"}, {"alism", "al"}, {"iveness", "ive"}, {"fulness", "ful"}, {"ousness", "ous"},
+    {"aliti", "al"}, {"iviti", "ive"}, {"biliti", "ble"}};
+static constexpr suffix_rule_t STEP3_SUFFIXES[] = {{"icate", "ic"}, {"ative", ""},
+    {"alize", "al"}, {"iciti", "ic"}, {"ical", "ic"}, {"ful", ""}, {"ness", ""}};
+static constexpr std::string_view STEP4_SUFFIXES[] = {"al", "ance", "ence", "er", "ic", "able",
+    "ible", "ant", "ement", "ment", "ent", "ion", "ou", "ism", "ate", "iti", "ous", "ive", "ize"};
+
+// Replaces the first matching suffix if the measure of the remaining stem is above `minMeasure`.
+// Other suffixes are not tried once one matches.
+template<size_t N>
+static void replaceSuffix(std::string& term, const suffix_rule_t (&rules)[N],
+    uint64_t minMeasure) {
+    for (const auto& [suffix, replacement] : rules) {
+        if (!term.ends_with(suffix)) {
+            continue;
+        }
+        const auto stemLength = term.size() - suffix.size();
+        if (getMeasure(term, stemLength) > minMeasure) {
+            term.resize(stemLength);
+            term.append(replacement);
+        }
+        return;
+    }
+}
+
+std::string FTSTokenizer::stem(std::string term) {
+    if (term.size() <= 2) {
+        return term;
+    }
+    // Step 1a.
+    if (term.ends_with("sses") || term.ends_with("ies")) {
+        term.resize(term.size() - 2);
+    } else if (term.ends_with("s") && !term.ends_with("ss")) {
+        term.pop_back();
+    }
+    // Step 1b.
+    auto suffixRemoved = false;
+    if (term.ends_with("eed")) {
+        if (getMeasure(term, term.size() - 3) > 0) {
+            term.pop_back();
+        }
+    } else if (term.ends_with("ed") && containsVowel(term, term.size() - 2)) {
+        term.resize(term.size() - 2);
+        suffixRemoved = true;
+    } else if (term.ends_with("ing") && containsVowel(term, term.size() - 3)) {
+        term.resize(term.size() - 3);
+        suffixRemoved = true;
+    }
+    if (suffixRemoved) {
+        if (term.ends_with("at") || term.ends_with("bl") || term.ends_with("iz")) {
+            term.push_back('e');
+        } else if (endsWithDoubleConsonant(term) && !term.ends_with("l") &&
+                   !term.ends_with("s") && !term.ends_with("z")) {
+            term.pop_back();
+        } else if (getMeasure(term, term.size()) == 1 && endsWithCVC(term)) {
+            term.push_back('e');
+        }
+    }
+    // Step 1c.
+    if (term.ends_with("y") && containsVowel(term, term.size() - 1)) {
+        term.back() = 'i';
+    }
+    // Step 2.
+    replaceSuffix(term, STEP2_SUFFIXES, 0 /* minMeasure */);
+    // Step 3.
+    replaceSuffix(term, STEP3_SUFFIXES, 0 /* minMeasure */);
+    // Step 4.
+    for (const auto suffix : STEP4_SUFFIXES) {
+        if (!term.ends_with(suffix)) {
+            continue;
+        }
+        const auto stemLength = term.size() - suffix.size();
+        const auto isIon = suffix == "ion";
+        if (getMeasure(term, stemLength) > 1 &&
+            (!isIon || (stemLength > 0 && (term[stemLength - 1] == 's' ||
+                                              term[stemLength - 1] == 't')))) {
+            term.resize(stemLength);
+        }
+        break;
+    }
+    // Step 5a.
+    if (term.ends_with("e")) {
+        const auto stem = term.substr(0, term.size() - 1);
+        const auto measure = getMeasure(stem, stem.size());
+        if (measure > 1 || (measure == 1 && !endsWithCVC(stem))) {
+            term.pop_back();
+        }
+    }
+    // Step 5b.
+    if (getMeasure(term, term.size()) > 1 && endsWithDoubleConsonant(term) &&
+        term.ends_with("l")) {
+        term.pop_back();
+    }
+    return term;
+}
+
+void FTSIndex::PostingsList::append(offset_t offset) {
+    tail.push_back(offset);
+    if (tail.size() == FTSIndexConstants::POSTINGS_BLOCK_SIZE) {
+        compressTail();
+    }
+}
+
+void FTSIndex::PostingsList::compressTail() {
+    // Offsets are appended in commit order, which is not sorted after updates, so the block is
+    // encoded relative to its minimum rather than as deltas between consecutive offsets.
+    const auto [min, max] = std::minmax_element(tail.begin(), tail.end());
+    Block block;
+    block.base = *min;
+    block.bitWidth = std::bit_width(*max - *min);
+    const auto numBits = tail.size() * block.bitWidth;
+    block.data.resize((numBits + 31) / 32);
+    if (block.bitWidth > 0) {
+        for (auto i = 0u; i < tail.size(); i++) {
+            BitpackingUtils<offset_t>::packSingle(tail[i] - block.base,
+                reinterpret_cast<uint8_t*>(block.data.data()), block.bitWidth, i);
+        }
+    }
+    blocks.push_back(std::move(block));
+    tail.clear();
+}
+
+void FTSIndex::PostingsList::scan(std::vector<offset_t>& result) const {
+    for (auto& block : blocks) {
+        for (auto i = 0u; i < FTSIndexConstants::POSTINGS_BLOCK_SIZE; i++) {
+            offset_t difference = 0;
+            if (block.bitWidth > 0) {
+                BitpackingUtils<offset_t>::unpackSingle(
+                    reinterpret_cast<const uint8_t*>(block.data.data()), &difference,
+                    block.bitWidth, i);
+            }
+            result.push_back(block.base + difference);
+        }
+    }
+    result.insert(result.end(), tail.begin(), tail.end());
+}
+
+static constexpr uint32_t INVALID_DOC_LENGTH = UINT32_MAX;
+
+struct FTSPage {
+    uint8_t data[PAGE_SIZE];
+};
+
+struct DocLength {
+    uint32_t length = INVALID_DOC_LENGTH;
+};
+
+template<typename U>
+struct FTSDiskArray {
+    DiskArrayHeader readHeader;
+    DiskArrayHeader writeHeader;
+    std::unique_ptr<DiskArray<U>> array;
+
+    FTSDiskArray(FileHandle& dataFH, ShadowFile& shadowFile, Deserializer* deSer) {
+        if (deSer) {
+            deSer->deserializeValue<uint64_t>(readHeader.numElements);
+            deSer->deserializeValue<page_idx_t>(readHeader.firstPIPPageIdx);
+            writeHeader = readHeader;
+        }
+        array = std::make_unique<DiskArray<U>>(dataFH, DBFileID::newDataFileID(), readHeader,
+            writeHeader, &shadowFile);
+    }
+
+    void serialize(Serializer& serializer) const {
+        serializer.serializeValue<uint64_t>(readHeader.numElements);
+        serializer.serializeValue<page_idx_t>(readHeader.firstPIPPageIdx);
+    }
+
+    void checkpoint() {
+        array->checkpoint();
+        array->checkpointInMemoryIfNecessary();
+        readHeader = writeHeader;
+    }
+};
+
+// The dictionary and the postings lists are byte streams stored in pages.
+struct FTSDiskArrays {
+    FTSDiskArray<FTSPage> dictionaryPages;
+    FTSDiskArray<FTSPage> postingsPages;
+    // Indexed by node offset.
+    FTSDiskArray<DocLength> docLengths;
+
+    FTSDiskArrays(FileHandle& dataFH, ShadowFile& shadowFile, Deserializer* deSer)
+        : dictionaryPages{dataFH, shadowFile, deSer}, postingsPages{dataFH, shadowFile, deSer},
+          docLengths{dataFH, shadowFile, deSer} {}
+
+    void serialize(Serializer& serializer) const {
+        dictionaryPages.serialize(serializer);
+        postingsPages.serialize(serializer);
+        docLengths.serialize(serializer);
+    }
+
+    void checkpoint() {
+        dictionaryPages.checkpoint();
+        postingsPages.checkpoint();
+        docLengths.checkpoint();
+    }
+};
+
+static void readBytes(DiskArray<FTSPage>& pages, uint64_t start, uint64_t size, uint8_t* result) {
+    while (size > 0) {
+        const auto pageIdx = start / PAGE_SIZE;
+        const auto offsetInPage = start % PAGE_SIZE;
+        const auto numBytes = std::min(size, PAGE_SIZE - offsetInPage);
+        const auto page = pages.get(pageIdx, &DUMMY_TRANSACTION);
+        memcpy(result, page.data + offsetInPage, numBytes);
+        start += numBytes;
+        size -= numBytes;
+        result += numBytes;
+    }
+}
+
+// Overwrites the pages in place, and appends pages past the end of the array.
+static void writeBytes(FTSDiskArray<FTSPage>& pages, const std::vector<uint8_t>& bytes) {
+    auto iter = pages.array->iter_mut();
+    for (uint64_t start = 0; start < bytes.size(); start += PAGE_SIZE) {
+        FTSPage page{};
+        memcpy(page.data, bytes.data() + start, std::min(PAGE_SIZE, bytes.size() - start));
+        const auto pageIdx = start / PAGE_SIZE;
+        if (pageIdx < pages.writeHeader.numElements) {
+            iter.seek(pageIdx);
+            *iter = page;
+        } else {
+            iter.pushBack(&DUMMY_CHECKPOINT_TRANSACTION, page);
+        }
+    }
+}
+
+template<typename T>
+static void appendValue(std::vector<uint8_t>& bytes, T value) {
+    const auto start = bytes.size();
+    bytes.resize(start + sizeof(T));
+    memcpy(bytes.data() + start, &value, sizeof(T));
+}
+
+template<typename T>
+static T readValue(const uint8_t*& data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    return value;
+}
+
+// Each block of a checkpointed postings list stores its first offset, the number of offsets and the
+// bit width of the deltas between consecutive offsets, followed by the packed deltas.
+static void encodePostings(const std::vector<offset_t>& offsets, std::vector<uint8_t>& bytes) {
+    for (uint64_t start = 0; start < offsets.size();
+         start += FTSIndexConstants::POSTINGS_BLOCK_SIZE) {
+        const auto numOffsets =
+            std::min(FTSIndexConstants::POSTINGS_BLOCK_SIZE, offsets.size() - start);
+        offset_t maxDelta = 0;
+        for (auto i = 1u; i < numOffsets; i++) {
+            maxDelta = std::max(maxDelta, offsets[start + i] - offsets[start + i - 1]);
+        }
+        const auto bitWidth = static_cast<uint16_t>(std::bit_width(maxDelta));
+        std::vector<uint32_t> data(((numOffsets - 1) * bitWidth + 31) / 32);
+        if (bitWidth > 0) {
+            for (auto i = 1u; i < numOffsets; i++) {
+                BitpackingUtils<offset_t>::packSingle(offsets[start + i] - offsets[start + i - 1],
+                    reinterpret_cast<uint8_t*>(data.data()), bitWidth, i - 1);
+            }
+        }
+        appendValue<offset_t>(bytes, offsets[start]);
+        appendValue<uint16_t>(bytes, numOffsets);
+        appendValue<uint16_t>(bytes, bitWidth);
+        const auto dataStart = bytes.size();
+        bytes.resize(dataStart + data.size() * sizeof(uint32_t));
+        memcpy(bytes.data() + dataStart, data.data(), data.size() * sizeof(uint32_t));
+    }
+}
+
+static void decodePostings(const std::vector<uint8_t>& bytes, std::vector<offset_t>& result) {
+    const auto* data = bytes.data();
+    const auto* end = bytes.data() + bytes.size();
+    while (data < end) {
+        auto offset = readValue<offset_t>(data);
+        const auto numOffsets = readValue<uint16_t>(data);
+        const auto bitWidth = readValue<uint16_t>(data);
+        result.push_back(offset);
+        for (auto i = 1u; i < numOffsets; i++) {
+            offset_t delta = 0;
+            if (bitWidth > 0) {
+                BitpackingUtils<offset_t>::unpackSingle(data, &delta, bitWidth, i - 1);
+            }
+            offset += delta;
+            result.push_back(offset);
+        }
+        data += ((numOffsets - 1) * bitWidth + 31) / 32 * sizeof(uint32_t);
+    }
+}
+
+FTSIndex::FTSIndex(FileHandle& dataFH, ShadowFile& shadowFile, Deserializer* deSer)
+    : numDictionaryBytes{0}, numDocs{0}, totalDocLength{0} {
+    if (deSer) {
+        std::string key;
+        deSer->validateDebuggingInfo(key, "fts_index");
+        deSer->deserializeValue<uint64_t>(numDocs);
+        deSer->deserializeValue<uint64_t>(totalDocLength);
+        deSer->deserializeValue<uint64_t>(numDictionaryBytes);
+    }
+    diskArrays = std::make_unique<FTSDiskArrays>(dataFH, shadowFile, deSer);
+    loadDictionary();
+}
+
+FTSIndex::~FTSIndex() = default;
+
+// Each dictionary entry stores the length of the term, the term, and the start and size of its
+// postings list in the postings stream.
+void FTSIndex::loadDictionary() {
+    std::vector<uint8_t> bytes(numDictionaryBytes);
+    readBytes(*diskArrays->dictionaryPages.array, 0, numDictionaryBytes, bytes.data());
+    const auto* data = bytes.data();
+    const auto* end = bytes.data() + bytes.size();
+    while (data < end) {
+        const auto termLength = readValue<uint32_t>(data);
+        std::string term{reinterpret_cast<const char*>(data), termLength};
+        data += termLength;
+        TermInfo termInfo{};
+        termInfo.postingsStart = readValue<uint64_t>(data);
+        termInfo.postingsSize = readValue<uint64_t>(data);
+        dictionary.emplace(std::move(term), termInfo);
+    }
+}
+
+bool FTSIndex::isSupportedType(const LogicalType& type) {
+    return type.getLogicalTypeID() == LogicalTypeID::STRING;
+}
+
+void FTSIndex::computeIDFs(FTSQueryStatistics& statistics,
+    const std::vector<uint64_t>& docFrequencies) {
+    statistics.idfs.clear();
+    for (const auto docFrequency : docFrequencies) {
+        // Lucene's variant of the BM25 inverse document frequency, which is never negative. The
+        // document count may lag behind the visible matches until the next checkpoint.
+        const auto numDocs = std::max(statistics.numDocs, docFrequency);
+        statistics.idfs.push_back(
+            std::log(1.0 + (numDocs - docFrequency + 0.5) / (docFrequency + 0.5)));
+    }
+}
+
+double FTSIndex::computeBM25(const FTSQueryStatistics& statistics,
+    const std::vector<uint64_t>& termFrequencies, uint64_t docLength) {
+    KU_ASSERT(termFrequencies.size() == statistics.idfs.size());
+    const auto lengthNorm = statistics.avgDocLength == 0 ?
+                                1.0 :
+                                1.0 - FTSIndexConstants::B +
+                                    FTSIndexConstants::B * docLength / statistics.avgDocLength;
+    double score = 0;
+    for (auto i = 0u; i < termFrequencies.size(); i++) {
+        const auto tf = static_cast<double>(termFrequencies[i]);
+        score += statistics.idfs[i] * tf * (FTSIndexConstants::K1 + 1) /
+                 (tf + FTSIndexConstants::K1 * lengthNorm);
+    }
+    return score;
+}
+
+void FTSIndex::insert(const ValueVector& keyVector, const ValueVector& nodeIDVector) {
+    std::unique_lock lck{mtx};
+    const auto& selVector = keyVector.state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (!keyVector.isNull(pos)) {
+            insertNoLock(keyVector.getValue<ku_string_t>(pos).getAsStringView(),
+                nodeIDVector.getValue<nodeID_t>(pos).offset);
+        }
+    }
+}
+
+void FTSIndex::insert(const ValueVector& keyVector, sel_t pos, offset_t offset) {
+    std::unique_lock lck{mtx};
+    // The node is updated. Its old postings are dropped at the next checkpoint.
+    staleNodeGroups.insert(StorageUtils::getNodeGroupIdx(offset));
+    if (keyVector.isNull(pos)) {
+        setDocLengthNoLock(offset, INVALID_DOC_LENGTH);
+        return;
+    }
+    insertNoLock(keyVector.getValue<ku_string_t>(pos).getAsStringView(), offset);
+}
+
+void FTSIndex::markStale(offset_t offset) {
+    std::unique_lock lck{mtx};
+    staleNodeGroups.insert(StorageUtils::getNodeGroupIdx(offset));
+    setDocLengthNoLock(offset, INVALID_DOC_LENGTH);
+}
+
+void FTSIndex::insertNoLock(std::string_view text, offset_t offset) {
+    auto terms = FTSTokenizer::tokenize(text);
+    setDocLengthNoLock(offset, terms.size());
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+    for (auto& term : terms) {
+        postings[std::move(term)].append(offset);
+    }
+}
+
+void FTSIndex::setDocLengthNoLock(offset_t offset, uint32_t docLength) {
+    const auto oldDocLength = getDocLengthNoLock(offset);
+    if (oldDocLength != INVALID_DOC_LENGTH) {
+        numDocs--;
+        totalDocLength -= oldDocLength;
+    }
+    if (docLength != INVALID_DOC_LENGTH) {
+        numDocs++;
+        totalDocLength += docLength;
+    }
+    changedDocLengths[offset] = docLength;
+}
+
+uint32_t FTSIndex::getDocLengthNoLock(offset_t offset) const {
+    if (const auto iter = changedDocLengths.find(offset); iter != changedDocLengths.end()) {
+        return iter->second;
+    }
+    if (offset >= diskArrays->docLengths.readHeader.numElements) {
+        return INVALID_DOC_LENGTH;
+    }
+    return diskArrays->docLengths.array->get(offset, &DUMMY_TRANSACTION).length;
+}
+
+void FTSIndex::scanCheckpointedPostings(const TermInfo& termInfo,
+    std::vector<offset_t>& result) const {
+    std::vector<uint8_t> bytes(termInfo.postingsSize);
+    readBytes(*diskArrays->postingsPages.array, termInfo.postingsStart, termInfo.postingsSize,
+        bytes.data());
+    decodePostings(bytes, result);
+}
+
+std::vector<offset_t> FTSIndex::search(const std::vector<std::string>& terms) const {
+    std::vector<offset_t> result;
+    {
+        std::shared_lock lck{mtx};
+        for (auto& term : terms) {
+            if (const auto it = dictionary.find(term); it != dictionary.end()) {
+                scanCheckpointedPostings(it->second, result);
+            }
+            if (const auto it = postings.find(term); it != postings.end()) {
+                it->second.scan(result);
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+FTSQueryStatistics FTSIndex::getStatistics() const {
+    std::shared_lock lck{mtx};
+    FTSQueryStatistics statistics;
+    statistics.numDocs = numDocs;
+    statistics.avgDocLength = numDocs == 0 ? 0 : static_cast<double>(totalDocLength) / numDocs;
+    return statistics;
+}
+
+void FTSIndex::checkpoint(const node_group_scanner_t& scanNodeGroup) {
+    std::unique_lock lck{mtx};
+    if (postings.empty() && changedDocLengths.empty() && staleNodeGroups.empty()) {
+        return;
+    }
+    // Reindex the current text of the changed node groups, which also recounts documents whose
+    // changes were rolled back.
+    auto isStale = [&](offset_t offset) {
+        return staleNodeGroups.contains(StorageUtils::getNodeGroupIdx(offset));
+    };
+    std::vector<offset_t> docsToReset;
+    for (auto& [offset, _] : changedDocLengths) {
+        if (isStale(offset)) {
+            docsToReset.push_back(offset);
+        }
+    }
+    for (const auto nodeGroupIdx : staleNodeGroups) {
+        const auto startOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+        const auto endOffset = std::min(startOffset + StorageConstants::NODE_GROUP_SIZE,
+            diskArrays->docLengths.readHeader.numElements);
+        for (auto offset = startOffset; offset < endOffset; offset++) {
+            if (getDocLengthNoLock(offset) != INVALID_DOC_LENGTH) {
+                docsToReset.push_back(offset);
+            }
+        }
+    }
+    for (const auto offset : docsToReset) {
+        setDocLengthNoLock(offset, INVALID_DOC_LENGTH);
+    }
+    std::unordered_map<std::string, std::vector<offset_t>> freshPostings;
+    for (const auto nodeGroupIdx : staleNodeGroups) {
+        scanNodeGroup(nodeGroupIdx,
+            [&](const ValueVector& keyVector, const ValueVector& nodeIDVector) {
+                for (auto i = 0u; i < nodeIDVector.state->getSelVector().getSelSize(); i++) {
+                    const auto pos = nodeIDVector.state->getSelVector()[i];
+                    if (keyVector.isNull(pos)) {
+                        continue;
+                    }
+                    const auto offset = nodeIDVector.readNodeOffset(pos);
+                    auto terms = FTSTokenizer::tokenize(
+                        keyVector.getValue<ku_string_t>(pos).getAsStringView());
+                    setDocLengthNoLock(offset, terms.size());
+                    std::sort(terms.begin(), terms.end());
+                    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+                    for (auto& term : terms) {
+                        freshPostings[std::move(term)].push_back(offset);
+                    }
+                }
+            });
+    }
+    // Merge the checkpointed postings of unchanged node groups, the postings of nodes inserted
+    // since and the reindexed postings into new dictionary and postings streams.
+    std::vector<std::string> terms;
+    for (auto& [term, _] : dictionary) {
+        terms.push_back(term);
+    }
+    for (auto& [term, _] : postings) {
+        terms.push_back(term);
+    }
+    for (auto& [term, _] : freshPostings) {
+        terms.push_back(term);
+    }
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+    // The new streams are written to shadow pages, which are only read back once the checkpoint
+    // is replayed, so the new dictionary is kept from the merge.
+    std::unordered_map<std::string, TermInfo> newDictionary;
+    std::vector<uint8_t> dictionaryBytes, postingsBytes;
+    std::vector<offset_t> offsets;
+    for (auto& term : terms) {
+        offsets.clear();
+        if (const auto it = dictionary.find(term); it != dictionary.end()) {
+            scanCheckpointedPostings(it->second, offsets);
+        }
+        if (const auto it = postings.find(term); it != postings.end()) {
+            it->second.scan(offsets);
+        }
+        offsets.erase(std::remove_if(offsets.begin(), offsets.end(), isStale), offsets.end());
+        if (const auto it = freshPostings.find(term); it != freshPostings.end()) {
+            offsets.insert(offsets.end(), it->second.begin(), it->second.end());
+        }
+        if (offsets.empty()) {
+            continue;
+        }
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+        const auto postingsStart = postingsBytes.size();
+        encodePostings(offsets, postingsBytes);
+        appendValue<uint32_t>(dictionaryBytes, term.size());
+        dictionaryBytes.insert(dictionaryBytes.end(), term.begin(), term.end());
+        appendValue<uint64_t>(dictionaryBytes, postingsStart);
+        appendValue<uint64_t>(dictionaryBytes, postingsBytes.size() - postingsStart);
+        newDictionary.emplace(term, TermInfo{postingsStart, postingsBytes.size() - postingsStart});
+    }
+    writeBytes(diskArrays->dictionaryPages, dictionaryBytes);
+    writeBytes(diskArrays->postingsPages, postingsBytes);
+    auto& docLengths = diskArrays->docLengths;
+    std::vector<std::pair<offset_t, uint32_t>> docLengthsToWrite{changedDocLengths.begin(),
+        changedDocLengths.end()};
+    std::sort(docLengthsToWrite.begin(), docLengthsToWrite.end());
+    if (!docLengthsToWrite.empty() &&
+        docLengthsToWrite.back().first >= docLengths.writeHeader.numElements) {
+        docLengths.array->resize(&DUMMY_CHECKPOINT_TRANSACTION,
+            docLengthsToWrite.back().first + 1);
+    }
+    {
+        auto iter = docLengths.array->iter_mut();
+        for (auto& [offset, docLength] : docLengthsToWrite) {
+            iter.seek(offset);
+            *iter = DocLength{docLength};
+        }
+    }
+    diskArrays->checkpoint();
+    numDictionaryBytes = dictionaryBytes.size();
+    dictionary = std::move(newDictionary);
+    postings.clear();
+    changedDocLengths.clear();
+    staleNodeGroups.clear();
+}
+
+void FTSIndex::serialize(Serializer& serializer) const {
+    std::shared_lock lck{mtx};
+    serializer.writeDebuggingInfo("fts_index");
+    serializer.serializeValue<uint64_t>(numDocs);
+    serializer.serializeValue<uint64_t>(totalDocLength);
+    serializer.serializeValue<uint64_t>(numDictionaryBytes);
+    diskArrays->serialize(serializer);
+}
+
+uint64_t FTSIndex::getNumEntries() const {
+    std::shared_lock lck{mtx};
+    return numDocs;
+}
+
+} // namespace storage
+} // namespace kuzu
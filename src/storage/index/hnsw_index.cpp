@@ -0,0 +1,692 @@
+#include "storage/index/hnsw_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <queue>
+#include <unordered_set>
+
+#include "common/constants.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/vector/value_vector.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/storage_structure/disk_array.h"
+#include "storage/storage_utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+static constexpr uint64_t MAX_NUM_LAYERS = 16;
+static constexpr uint32_t INVALID_ELEMENT_IDX = UINT32_MAX;
+
+struct ElementRecord {
+    offset_t offset;
+    uint32_t upperNeighborsIdx;
+    uint8_t layer;
+    uint8_t deleted;
+    uint16_t _padding{};
+};
+
+// Neighbor lists are padded with INVALID_ELEMENT_IDX.
+template<uint64_t MAX_DEGREE>
+struct NeighborList {
+    uint32_t neighbors[MAX_DEGREE];
+};
+using Layer0NeighborList = NeighborList<2 * HNSWIndexConstants::MAX_DEGREE>;
+using UpperNeighborList = NeighborList<HNSWIndexConstants::MAX_DEGREE>;
+
+template<typename ARRAY>
+struct HNSWDiskArray {
+    DiskArrayHeader readHeader;
+    DiskArrayHeader writeHeader;
+    std::unique_ptr<ARRAY> array;
+
+    void deserialize(Deserializer& deSer) {
+        deSer.deserializeValue<uint64_t>(readHeader.numElements);
+        deSer.deserializeValue<page_idx_t>(readHeader.firstPIPPageIdx);
+        writeHeader = readHeader;
+    }
+    void serialize(Serializer& serializer) const {
+        serializer.serializeValue<uint64_t>(readHeader.numElements);
+        serializer.serializeValue<page_idx_t>(readHeader.firstPIPPageIdx);
+    }
+    void checkpoint() {
+        array->checkpoint();
+        array->checkpointInMemoryIfNecessary();
+        readHeader = writeHeader;
+    }
+};
+
+// Vectors are split into equally sized chunks which fit in a page, and the chunks of a vector are
+// consecutive elements of `vectorChunks`.
+struct HNSWDiskArrays {
+    HNSWDiskArray<DiskArray<ElementRecord>> elements;
+    HNSWDiskArray<DiskArrayInternal> vectorChunks;
+    HNSWDiskArray<DiskArray<Layer0NeighborList>> layer0Neighbors;
+    HNSWDiskArray<DiskArray<UpperNeighborList>> upperNeighbors;
+    uint64_t numChunksPerVector;
+    uint64_t numFloatsPerChunk;
+
+    HNSWDiskArrays(uint64_t dimension, FileHandle& dataFH, ShadowFile& shadowFile,
+        Deserializer* deSer)
+        : numChunksPerVector{(dimension * sizeof(float) + PAGE_SIZE - 1) / PAGE_SIZE},
+          numFloatsPerChunk{(dimension + numChunksPerVector - 1) / numChunksPerVector} {
+        if (deSer) {
+            elements.deserialize(*deSer);
+            vectorChunks.deserialize(*deSer);
+            layer0Neighbors.deserialize(*deSer);
+            upperNeighbors.deserialize(*deSer);
+        }
+        elements.array = std::make_unique<DiskArray<ElementRecord>>(dataFH,
+            DBFileID::newDataFileID(), elements.readHeader, elements.writeHeader, &shadowFile);
+        vectorChunks.array = std::make_unique<DiskArrayInternal>(dataFH, DBFileID::newDataFileID(),
+            vectorChunks.readHeader, vectorChunks.writeHeader, &shadowFile,
+            numFloatsPerChunk * sizeof(float));
+        layer0Neighbors.array = std::make_unique<DiskArray<Layer0NeighborList>>(dataFH,
+            DBFileID::newDataFileID(), layer0Neighbors.readHeader, layer0Neighbors.writeHeader,
+            &shadowFile);
+        upperNeighbors.array = std::make_unique<DiskArray<UpperNeighborList>>(dataFH,
+            DBFileID::newDataFileID(), upperNeighbors.readHeader, upperNeighbors.writeHeader,
+            &shadowFile);
+    }
+
+    void serialize(Serializer& serializer) const {
+        elements.serialize(serializer);
+        vectorChunks.serialize(serializer);
+        layer0Neighbors.serialize(serializer);
+        upperNeighbors.serialize(serializer);
+    }
+
+    void checkpoint() {
+        elements.checkpoint();
+        vectorChunks.checkpoint();
+        layer0Neighbors.checkpoint();
+        upperNeighbors.checkpoint();
+    }
+
+    void readVector(uint64_t elementIdx, float* result, uint64_t dimension) const {
+        for (auto i = 0u; i < numChunksPerVector; i++) {
+            const auto numFloats = std::min(numFloatsPerChunk, dimension - i * numFloatsPerChunk);
+            vectorChunks.array->get(elementIdx * numChunksPerVector + i, &DUMMY_TRANSACTION,
+                std::span(reinterpret_cast<std::byte*>(result + i * numFloatsPerChunk),
+                    numFloats * sizeof(float)));
+        }
+    }
+
+    void appendVector(const float* vector, uint64_t dimension) {
+        std::vector<float> chunk(numFloatsPerChunk);
+        for (auto i = 0u; i < numChunksPerVector; i++) {
+            const auto numFloats = std::min(numFloatsPerChunk, dimension - i * numFloatsPerChunk);
+            std::fill(chunk.begin(), chunk.end(), 0.0f);
+            memcpy(chunk.data(), vector + i * numFloatsPerChunk, numFloats * sizeof(float));
+            vectorChunks.array->pushBack(&DUMMY_CHECKPOINT_TRANSACTION,
+                std::span(reinterpret_cast<std::byte*>(chunk.data()),
+                    chunk.size() * sizeof(float)));
+        }
+    }
+};
+
+template<typename LIST>
+static LIST toNeighborList(const std::vector<uint32_t>& neighbors) {
+    LIST result;
+    KU_ASSERT(neighbors.size() <= std::size(result.neighbors));
+    std::fill(std::begin(result.neighbors), std::end(result.neighbors), INVALID_ELEMENT_IDX);
+    std::copy(neighbors.begin(), neighbors.end(), std::begin(result.neighbors));
+    return result;
+}
+
+template<typename LIST>
+static void fromNeighborList(const LIST& list, std::vector<uint32_t>& result) {
+    result.clear();
+    for (const auto neighborIdx : list.neighbors) {
+        if (neighborIdx == INVALID_ELEMENT_IDX) {
+            break;
+        }
+        result.push_back(neighborIdx);
+    }
+}
+
+HNSWIndex::HNSWIndex(const LogicalType& keyType, VectorDistanceMetric metric,
+    MemoryManager* memoryManager, FileHandle& dataFH, ShadowFile& shadowFile, Deserializer* deSer)
+    : metric{metric}, dimension{ArrayType::getNumElements(keyType)},
+      memoryManager{memoryManager}, numCheckpointedElements{0}, numDeletedElements{0},
+      numUpperNeighborLists{0}, numPendingChanges{0}, entryPoint{0}, maxLayer{0},
+      randomEngine{0 /* seed */, 0 /* stream */} {
+    KU_ASSERT(isSupportedType(keyType));
+    numVectorsPerBlock = std::max<uint64_t>(TEMP_PAGE_SIZE / (dimension * sizeof(float)), 1);
+    if (deSer) {
+        std::string key;
+        deSer->validateDebuggingInfo(key, "vector_index");
+        deSer->deserializeValue<element_idx_t>(entryPoint);
+        deSer->deserializeValue<uint64_t>(maxLayer);
+    }
+    diskArrays = std::make_unique<HNSWDiskArrays>(dimension, dataFH, shadowFile, deSer);
+    numCheckpointedElements = diskArrays->elements.array->getNumElements();
+    numUpperNeighborLists = diskArrays->upperNeighbors.array->getNumElements();
+    elements.reserve(numCheckpointedElements);
+    for (auto i = 0u; i < numCheckpointedElements; i++) {
+        const auto record = diskArrays->elements.array->get(i, &DUMMY_TRANSACTION);
+        elements.push_back(
+            Element{record.offset, record.upperNeighborsIdx, record.layer, record.deleted != 0});
+        numDeletedElements += record.deleted;
+    }
+    // Continue with different layers than the ones drawn before the database was closed.
+    randomEngine = RandomEngine{numCheckpointedElements, 0 /* stream */};
+}
+
+HNSWIndex::~HNSWIndex() = default;
+
+bool HNSWIndex::isSupportedType(const LogicalType& type) {
+    if (type.getLogicalTypeID() != LogicalTypeID::ARRAY || ArrayType::getNumElements(type) == 0) {
+        return false;
+    }
+    const auto childTypeID = ArrayType::getChildType(type).getLogicalTypeID();
+    return childTypeID == LogicalTypeID::FLOAT || childTypeID == LogicalTypeID::DOUBLE;
+}
+
+static float computeDotProduct(const float* left, const float* right, uint64_t dimension) {
+    float result = 0;
+    for (auto i = 0u; i < dimension; i++) {
+        result += left[i] * right[i];
+    }
+    return result;
+}
+
+static float computeSquaredL2Distance(const float* left, const float* right, uint64_t dimension) {
+    float result = 0;
+    for (auto i = 0u; i < dimension; i++) {
+        const auto diff = left[i] - right[i];
+        result += diff * diff;
+    }
+    return result;
+}
+
+static void normalize(float* vector, uint64_t dimension) {
+    const auto norm = std::sqrt(computeDotProduct(vector, vector, dimension));
+    if (norm == 0) {
+        return;
+    }
+    for (auto i = 0u; i < dimension; i++) {
+        vector[i] /= norm;
+    }
+}
+
+double HNSWIndex::computeDistance(VectorDistanceMetric metric, const float* left,
+    const float* right, uint64_t dimension) {
+    switch (metric) {
+    case VectorDistanceMetric::L2:
+        return std::sqrt(computeSquaredL2Distance(left, right, dimension));
+    case VectorDistanceMetric::COSINE: {
+        const auto norms = std::sqrt(computeDotProduct(left, left, dimension)) *
+                           std::sqrt(computeDotProduct(right, right, dimension));
+        return norms == 0 ? 1 : 1 - computeDotProduct(left, right, dimension) / norms;
+    }
+    case VectorDistanceMetric::INNER_PRODUCT:
+        return -computeDotProduct(left, right, dimension);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+bool HNSWIndex::readVector(const ValueVector& keyVector, sel_t pos, float* result) {
+    const auto& listEntry = keyVector.getValue<list_entry_t>(pos);
+    const auto dataVector = ListVector::getDataVector(&keyVector);
+    for (auto i = 0u; i < listEntry.size; i++) {
+        const auto dataPos = listEntry.offset + i;
+        if (dataVector->isNull(dataPos)) {
+            return false;
+        }
+        result[i] = dataVector->dataType.getLogicalTypeID() == LogicalTypeID::FLOAT ?
+                        dataVector->getValue<float>(dataPos) :
+                        (float)dataVector->getValue<double>(dataPos);
+    }
+    return true;
+}
+
+void HNSWIndex::insert(const ValueVector& keyVector, const ValueVector& nodeIDVector) {
+    KU_ASSERT(keyVector.state == nodeIDVector.state);
+    std::vector<float> vector(dimension);
+    std::unique_lock lck{mtx};
+    for (auto i = 0u; i < nodeIDVector.state->getSelVector().getSelSize(); i++) {
+        const auto pos = nodeIDVector.state->getSelVector()[i];
+        if (keyVector.isNull(pos) || nodeIDVector.isNull(pos) ||
+            !readVector(keyVector, pos, vector.data())) {
+            continue;
+        }
+        insertNoLock(vector.data(), nodeIDVector.readNodeOffset(pos));
+    }
+}
+
+void HNSWIndex::insert(const ValueVector& keyVector, sel_t pos, offset_t offset) {
+    std::vector<float> vector(dimension);
+    const auto isNull = keyVector.isNull(pos) || !readVector(keyVector, pos, vector.data());
+    std::unique_lock lck{mtx};
+    // The node is updated. Its old vector and, if the update is rolled back, the new one are
+    // tombstoned at the next checkpoint.
+    staleNodeGroups.insert(StorageUtils::getNodeGroupIdx(offset));
+    numPendingChanges++;
+    if (!isNull) {
+        insertNoLock(vector.data(), offset);
+    }
+}
+
+void HNSWIndex::markStale(offset_t offset) {
+    std::unique_lock lck{mtx};
+    staleNodeGroups.insert(StorageUtils::getNodeGroupIdx(offset));
+    numPendingChanges++;
+}
+
+std::vector<VectorSearchResult> HNSWIndex::search(std::span<const float> query,
+    uint64_t efSearch) const {
+    KU_ASSERT(query.size() == dimension);
+    std::vector<float> normalizedQuery{query.begin(), query.end()};
+    if (metric == VectorDistanceMetric::COSINE) {
+        normalize(normalizedQuery.data(), dimension);
+    }
+    std::vector<float> buffer(dimension);
+    std::shared_lock lck{mtx};
+    if (elements.empty()) {
+        return {};
+    }
+    auto current = entryPoint;
+    for (auto layer = maxLayer; layer > 0; layer--) {
+        current = searchLayerGreedy(normalizedQuery.data(), current, layer);
+    }
+    const auto candidates = searchLayer(normalizedQuery.data(),
+        {{computeGraphDistance(normalizedQuery.data(), getVector(current, buffer.data())),
+            current}},
+        std::max<uint64_t>(efSearch, 1), 0 /* layer */, true /* skipDeleted */);
+    std::vector<VectorSearchResult> result;
+    result.reserve(candidates.size());
+    for (auto& [distance, elementIdx] : candidates) {
+        result.push_back({elements[elementIdx].offset,
+            metric == VectorDistanceMetric::L2 ? std::sqrt(distance) : distance});
+    }
+    return result;
+}
+
+void HNSWIndex::checkpoint(const node_group_scanner_t& scanNodeGroup) {
+    std::unique_lock lck{mtx};
+    validateNodeGroups(scanNodeGroup);
+    if (numCheckpointedElements < elements.size() || !changedNeighbors.empty() ||
+        !newlyDeletedElements.empty()) {
+        writeToDisk();
+    }
+    numPendingChanges = 0;
+}
+
+void HNSWIndex::validateNodeGroups(const node_group_scanner_t& scanNodeGroup) {
+    if (staleNodeGroups.empty()) {
+        return;
+    }
+    std::unordered_map<offset_t, std::vector<element_idx_t>> elementsByOffset;
+    for (auto i = 0u; i < elements.size(); i++) {
+        if (!elements[i].deleted &&
+            staleNodeGroups.contains(StorageUtils::getNodeGroupIdx(elements[i].offset))) {
+            elementsByOffset[elements[i].offset].push_back(i);
+        }
+    }
+    // Keep the element holding the checkpointed vector of each node, and tombstone the others.
+    std::vector<float> vector(dimension), buffer(dimension);
+    std::unordered_set<element_idx_t> elementsToKeep;
+    for (const auto nodeGroupIdx : staleNodeGroups) {
+        scanNodeGroup(nodeGroupIdx,
+            [&](const ValueVector& keyVector, const ValueVector& nodeIDVector) {
+                for (auto i = 0u; i < nodeIDVector.state->getSelVector().getSelSize(); i++) {
+                    const auto pos = nodeIDVector.state->getSelVector()[i];
+                    if (keyVector.isNull(pos) || !readVector(keyVector, pos, vector.data())) {
+                        continue;
+                    }
+                    if (metric == VectorDistanceMetric::COSINE) {
+                        normalize(vector.data(), dimension);
+                    }
+                    const auto offset = nodeIDVector.readNodeOffset(pos);
+                    auto matched = false;
+                    if (const auto iter = elementsByOffset.find(offset);
+                        iter != elementsByOffset.end()) {
+                        for (const auto elementIdx : iter->second) {
+                            if (memcmp(getVector(elementIdx, buffer.data()), vector.data(),
+                                    dimension * sizeof(float)) == 0 &&
+                                elementsToKeep.insert(elementIdx).second) {
+                                matched = true;
+                                break;
+                            }
+                        }
+                    }
+                    if (!matched) {
+                        insertNoLock(vector.data(), offset);
+                        elementsToKeep.insert(elements.size() - 1);
+                    }
+                }
+            });
+    }
+    for (auto& [offset, elementIdxs] : elementsByOffset) {
+        for (const auto elementIdx : elementIdxs) {
+            if (elementsToKeep.contains(elementIdx)) {
+                continue;
+            }
+            elements[elementIdx].deleted = true;
+            numDeletedElements++;
+            if (elementIdx < numCheckpointedElements) {
+                newlyDeletedElements.push_back(elementIdx);
+            }
+        }
+    }
+    staleNodeGroups.clear();
+}
+
+void HNSWIndex::writeToDisk() {
+    auto& diskElements = *diskArrays->elements.array;
+    auto& layer0Neighbors = *diskArrays->layer0Neighbors.array;
+    auto& upperNeighbors = *diskArrays->upperNeighbors.array;
+    auto toRecord = [](const Element& element) {
+        return ElementRecord{element.offset, element.upperNeighborsIdx, element.layer,
+            element.deleted};
+    };
+    // Update checkpointed elements in place, then append the new ones.
+    for (const auto elementIdx : newlyDeletedElements) {
+        diskElements.update(&DUMMY_CHECKPOINT_TRANSACTION, elementIdx,
+            toRecord(elements[elementIdx]));
+    }
+    for (auto& [key, neighbors] : changedNeighbors) {
+        const auto elementIdx = key / MAX_NUM_LAYERS;
+        const auto layer = key % MAX_NUM_LAYERS;
+        if (elementIdx >= numCheckpointedElements) {
+            continue;
+        }
+        if (layer == 0) {
+            layer0Neighbors.update(&DUMMY_CHECKPOINT_TRANSACTION, elementIdx,
+                toNeighborList<Layer0NeighborList>(neighbors));
+        } else {
+            upperNeighbors.update(&DUMMY_CHECKPOINT_TRANSACTION,
+                elements[elementIdx].upperNeighborsIdx + layer - 1,
+                toNeighborList<UpperNeighborList>(neighbors));
+        }
+    }
+    KU_ASSERT(diskElements.getNumElements(TransactionType::CHECKPOINT) ==
+              numCheckpointedElements);
+    for (auto elementIdx = numCheckpointedElements; elementIdx < elements.size(); elementIdx++) {
+        const auto& element = elements[elementIdx];
+        diskElements.pushBack(&DUMMY_CHECKPOINT_TRANSACTION, toRecord(element));
+        diskArrays->appendVector(getNewVector(elementIdx), dimension);
+        layer0Neighbors.pushBack(&DUMMY_CHECKPOINT_TRANSACTION,
+            toNeighborList<Layer0NeighborList>(
+                changedNeighbors.at(getNeighborsKey(elementIdx, 0))));
+        for (auto layer = 1u; layer <= element.layer; layer++) {
+            KU_ASSERT(upperNeighbors.getNumElements(TransactionType::CHECKPOINT) ==
+                      element.upperNeighborsIdx + layer - 1);
+            upperNeighbors.pushBack(&DUMMY_CHECKPOINT_TRANSACTION,
+                toNeighborList<UpperNeighborList>(
+                    changedNeighbors.at(getNeighborsKey(elementIdx, layer))));
+        }
+    }
+    diskArrays->checkpoint();
+    numCheckpointedElements = elements.size();
+    vectorBlocks.clear();
+    changedNeighbors.clear();
+    newlyDeletedElements.clear();
+}
+
+void HNSWIndex::serialize(Serializer& serializer) const {
+    std::shared_lock lck{mtx};
+    serializer.writeDebuggingInfo("vector_index");
+    serializer.serializeValue<element_idx_t>(entryPoint);
+    serializer.serializeValue<uint64_t>(maxLayer);
+    diskArrays->serialize(serializer);
+}
+
+uint64_t HNSWIndex::getNumEntries() const {
+    std::shared_lock lck{mtx};
+    return elements.size() - numDeletedElements;
+}
+
+uint64_t HNSWIndex::getNumPendingChanges() const {
+    std::shared_lock lck{mtx};
+    // Nodes inserted since the last checkpoint may not be visible to a transaction, and other
+    // changed nodes can have up to one outdated element each.
+    return elements.size() - numCheckpointedElements + numPendingChanges;
+}
+
+void HNSWIndex::insertNoLock(const float* vector, offset_t offset) {
+    const auto elementIdx = (element_idx_t)elements.size();
+    const auto newElementIdx = elementIdx - numCheckpointedElements;
+    if (newElementIdx % numVectorsPerBlock == 0) {
+        vectorBlocks.push_back(memoryManager->allocateBuffer(false /* initializeToZero */,
+            std::max<uint64_t>(TEMP_PAGE_SIZE, dimension * sizeof(float))));
+    }
+    const auto layer = getRandomLayer();
+    elements.push_back(Element{offset, (uint32_t)numUpperNeighborLists, (uint8_t)layer, false});
+    numUpperNeighborLists += layer;
+    for (auto i = 0u; i <= layer; i++) {
+        changedNeighbors.emplace(getNeighborsKey(elementIdx, i), std::vector<element_idx_t>{});
+    }
+    const auto storedVector = getNewVector(elementIdx);
+    memcpy(storedVector, vector, dimension * sizeof(float));
+    if (metric == VectorDistanceMetric::COSINE) {
+        normalize(storedVector, dimension);
+    }
+    if (elementIdx == 0) {
+        entryPoint = elementIdx;
+        maxLayer = layer;
+        return;
+    }
+    std::vector<float> buffer(dimension);
+    auto current = entryPoint;
+    for (auto upperLayer = maxLayer; upperLayer > layer; upperLayer--) {
+        current = searchLayerGreedy(storedVector, current, upperLayer);
+    }
+    std::vector<candidate_t> entryPoints{
+        {computeGraphDistance(storedVector, getVector(current, buffer.data())), current}};
+    for (auto lowerLayer = std::min(layer, maxLayer) + 1; lowerLayer-- > 0;) {
+        // Tombstoned elements are kept as neighbors, as they may be the only elements connecting
+        // parts of the graph.
+        auto candidates = searchLayer(storedVector, entryPoints,
+            HNSWIndexConstants::EF_CONSTRUCTION, lowerLayer);
+        auto neighbors = selectNeighbors(candidates, getMaxDegree(lowerLayer));
+        for (const auto neighborIdx : neighbors) {
+            addNeighbor(neighborIdx, elementIdx, lowerLayer);
+        }
+        changedNeighbors[getNeighborsKey(elementIdx, lowerLayer)] = std::move(neighbors);
+        entryPoints = std::move(candidates);
+    }
+    if (layer > maxLayer) {
+        entryPoint = elementIdx;
+        maxLayer = layer;
+    }
+}
+
+float* HNSWIndex::getNewVector(element_idx_t elementIdx) const {
+    KU_ASSERT(elementIdx >= numCheckpointedElements);
+    const auto newElementIdx = elementIdx - numCheckpointedElements;
+    const auto block = vectorBlocks[newElementIdx / numVectorsPerBlock].get();
+    return reinterpret_cast<float*>(block->getData()) +
+           (newElementIdx % numVectorsPerBlock) * dimension;
+}
+
+const float* HNSWIndex::getVector(element_idx_t elementIdx, float* buffer) const {
+    if (elementIdx >= numCheckpointedElements) {
+        return getNewVector(elementIdx);
+    }
+    diskArrays->readVector(elementIdx, buffer, dimension);
+    return buffer;
+}
+
+uint64_t HNSWIndex::getNeighborsKey(element_idx_t elementIdx, uint64_t layer) {
+    return elementIdx * MAX_NUM_LAYERS + layer;
+}
+
+const std::vector<HNSWIndex::element_idx_t>& HNSWIndex::getNeighbors(element_idx_t elementIdx,
+    uint64_t layer, std::vector<element_idx_t>& buffer) const {
+    KU_ASSERT(layer <= elements[elementIdx].layer);
+    if (const auto iter = changedNeighbors.find(getNeighborsKey(elementIdx, layer));
+        iter != changedNeighbors.end()) {
+        return iter->second;
+    }
+    KU_ASSERT(elementIdx < numCheckpointedElements);
+    if (layer == 0) {
+        fromNeighborList(diskArrays->layer0Neighbors.array->get(elementIdx, &DUMMY_TRANSACTION),
+            buffer);
+    } else {
+        const auto listIdx = elements[elementIdx].upperNeighborsIdx + layer - 1;
+        fromNeighborList(diskArrays->upperNeighbors.array->get(listIdx, &DUMMY_TRANSACTION),
+            buffer);
+    }
+    return buffer;
+}
+
+std::vector<HNSWIndex::element_idx_t>& HNSWIndex::getNeighborsToUpdate(element_idx_t elementIdx,
+    uint64_t layer) {
+    const auto key = getNeighborsKey(elementIdx, layer);
+    if (!changedNeighbors.contains(key)) {
+        std::vector<element_idx_t> neighbors;
+        getNeighbors(elementIdx, layer, neighbors);
+        changedNeighbors.emplace(key, std::move(neighbors));
+    }
+    return changedNeighbors.at(key);
+}
+
+float HNSWIndex::computeGraphDistance(const float* left, const float* right) const {
+    switch (metric) {
+    case VectorDistanceMetric::L2:
+        return computeSquaredL2Distance(left, right, dimension);
+    case VectorDistanceMetric::COSINE:
+        return 1 - computeDotProduct(left, right, dimension);
+    case VectorDistanceMetric::INNER_PRODUCT:
+        return -computeDotProduct(left, right, dimension);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+uint64_t HNSWIndex::getRandomLayer() {
+    // Layers are drawn from an exponential distribution, so that each layer holds about
+    // 1/MAX_DEGREE of the elements of the layer below.
+    const auto uniform = ((double)randomEngine.nextRandomInteger() + 1) / 4294967296.0;
+    const auto layer = (uint64_t)(-std::log(uniform) / std::log(HNSWIndexConstants::MAX_DEGREE));
+    return std::min(layer, MAX_NUM_LAYERS - 1);
+}
+
+HNSWIndex::element_idx_t HNSWIndex::searchLayerGreedy(const float* query,
+    element_idx_t entryPoint, uint64_t layer) const {
+    std::vector<float> buffer(dimension);
+    std::vector<element_idx_t> neighborsBuffer;
+    auto current = entryPoint;
+    auto currentDistance = computeGraphDistance(query, getVector(current, buffer.data()));
+    auto improved = true;
+    while (improved) {
+        improved = false;
+        for (const auto neighborIdx : getNeighbors(current, layer, neighborsBuffer)) {
+            const auto distance =
+                computeGraphDistance(query, getVector(neighborIdx, buffer.data()));
+            if (distance < currentDistance) {
+                current = neighborIdx;
+                currentDistance = distance;
+                improved = true;
+            }
+        }
+    }
+    return current;
+}
+
+std::vector<HNSWIndex::candidate_t> HNSWIndex::searchLayer(const float* query,
+    const std::vector<candidate_t>& entryPoints, uint64_t ef, uint64_t layer,
+    bool skipDeleted) const {
+    std::vector<float> buffer(dimension);
+    std::vector<element_idx_t> neighborsBuffer;
+    std::unordered_set<element_idx_t> visited;
+    // Candidates to expand, nearest first.
+    std::priority_queue<candidate_t, std::vector<candidate_t>, std::greater<>> candidates;
+    // The `ef` nearest elements found so far, farthest first.
+    std::priority_queue<candidate_t> nearest;
+    auto addToNearest = [&](const candidate_t& candidate) {
+        if (skipDeleted && elements[candidate.second].deleted) {
+            return;
+        }
+        nearest.push(candidate);
+        if (nearest.size() > ef) {
+            nearest.pop();
+        }
+    };
+    for (auto& entry : entryPoints) {
+        visited.insert(entry.second);
+        candidates.push(entry);
+        addToNearest(entry);
+    }
+    while (!candidates.empty()) {
+        const auto [distance, elementIdx] = candidates.top();
+        if (nearest.size() >= ef && distance > nearest.top().first) {
+            break;
+        }
+        candidates.pop();
+        for (const auto neighborIdx : getNeighbors(elementIdx, layer, neighborsBuffer)) {
+            if (!visited.insert(neighborIdx).second) {
+                continue;
+            }
+            const auto neighborDistance =
+                computeGraphDistance(query, getVector(neighborIdx, buffer.data()));
+            if (nearest.size() < ef || neighborDistance < nearest.top().first) {
+                candidates.emplace(neighborDistance, neighborIdx);
+                addToNearest({neighborDistance, neighborIdx});
+            }
+        }
+    }
+    std::vector<candidate_t> result(nearest.size());
+    for (auto i = result.size(); i-- > 0;) {
+        result[i] = nearest.top();
+        nearest.pop();
+    }
+    return result;
+}
+
+std::vector<HNSWIndex::element_idx_t> HNSWIndex::selectNeighbors(
+    const std::vector<candidate_t>& candidates, uint64_t maxDegree) const {
+    std::vector<element_idx_t> result;
+    std::vector<bool> selected(candidates.size(), false);
+    std::vector<float> candidateBuffer(dimension), neighborBuffer(dimension);
+    for (auto i = 0u; i < candidates.size() && result.size() < maxDegree; i++) {
+        const auto [distance, candidateIdx] = candidates[i];
+        const auto candidateVector = getVector(candidateIdx, candidateBuffer.data());
+        const auto isDiverse = std::none_of(result.begin(), result.end(), [&](auto neighborIdx) {
+            return computeGraphDistance(candidateVector,
+                       getVector(neighborIdx, neighborBuffer.data())) < distance;
+        });
+        if (isDiverse) {
+            result.push_back(candidateIdx);
+            selected[i] = true;
+        }
+    }
+    // Fill the remaining slots with the nearest pruned candidates, which keeps clustered data
+    // well connected.
+    for (auto i = 0u; i < candidates.size() && result.size() < maxDegree; i++) {
+        if (!selected[i]) {
+            result.push_back(candidates[i].second);
+        }
+    }
+    return result;
+}
+
+void HNSWIndex::addNeighbor(element_idx_t elementIdx, element_idx_t neighborIdx,
+    uint64_t layer) {
+    auto& neighbors = getNeighborsToUpdate(elementIdx, layer);
+    neighbors.push_back(neighborIdx);
+    if (neighbors.size() <= getMaxDegree(layer)) {
+        return;
+    }
+    std::vector<float> vectorBuffer(dimension), buffer(dimension);
+    const auto vector = getVector(elementIdx, vectorBuffer.data());
+    std::vector<candidate_t> candidates;
+    candidates.reserve(neighbors.size());
+    for (const auto idx : neighbors) {
+        candidates.emplace_back(computeGraphDistance(vector, getVector(idx, buffer.data())), idx);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    neighbors = selectNeighbors(candidates, getMaxDegree(layer));
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,387 @@
+#include "storage/index/property_index.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <set>
+#include <unordered_set>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "common/types/ku_string.h"
+#include "common/vector/value_vector.h"
+#include "storage/storage_structure/disk_array.h"
+#include "storage/storage_utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+class PropertyIndexStorage {
+public:
+    virtual ~PropertyIndexStorage() = default;
+
+    virtual void insert(const ValueVector& keyVector, sel_t pos, offset_t offset) = 0;
+    virtual void markStale(offset_t offset) = 0;
+    virtual void lookup(const std::vector<ColumnConstantPredicate>& predicates,
+        const std::function<void(offset_t)>& func) const = 0;
+    virtual void checkpoint(const node_group_scanner_t& scanNodeGroup) = 0;
+    virtual void serialize(Serializer& serializer) const = 0;
+    virtual uint64_t getNumEntries() const = 0;
+};
+
+static constexpr uint64_t STRING_PREFIX_LENGTH = 24;
+
+struct StringPrefix {
+    std::array<uint8_t, STRING_PREFIX_LENGTH> bytes{};
+};
+
+template<typename T>
+struct PropertyIndexKey {
+    using key_t = T;
+
+    static key_t get(const ValueVector& vector, sel_t pos) { return vector.getValue<T>(pos); }
+    // Returns the key and whether it was truncated.
+    static std::pair<key_t, bool> get(const Value& value) {
+        return {value.getValue<T>(), false /* truncated */};
+    }
+    static bool less(const key_t& a, const key_t& b) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // NaN compares false with everything, which is not a strict weak ordering.
+            if (std::isnan(a)) {
+                return false;
+            }
+            if (std::isnan(b)) {
+                return true;
+            }
+        }
+        return a < b;
+    }
+};
+
+template<>
+struct PropertyIndexKey<ku_string_t> {
+    using key_t = StringPrefix;
+
+    static key_t get(const uint8_t* data, uint64_t length) {
+        key_t key;
+        memcpy(key.bytes.data(), data, std::min(length, STRING_PREFIX_LENGTH));
+        return key;
+    }
+    static key_t get(const ValueVector& vector, sel_t pos) {
+        const auto& str = vector.getValue<ku_string_t>(pos);
+        return get(str.getData(), str.len);
+    }
+    static std::pair<key_t, bool> get(const Value& value) {
+        const auto& str = value.getValue<std::string>();
+        // A string as long as the prefix is a proper prefix of the longer strings sharing it.
+        return {get(reinterpret_cast<const uint8_t*>(str.data()), str.size()),
+            str.size() >= STRING_PREFIX_LENGTH};
+    }
+    static bool less(const key_t& a, const key_t& b) {
+        return memcmp(a.bytes.data(), b.bytes.data(), STRING_PREFIX_LENGTH) < 0;
+    }
+};
+
+template<typename T>
+class PropertyIndexStorageImpl final : public PropertyIndexStorage {
+    using Key = PropertyIndexKey<T>;
+    using key_t = typename Key::key_t;
+
+    struct Entry {
+        key_t key;
+        offset_t offset;
+    };
+    struct EntryLess {
+        bool operator()(const Entry& a, const Entry& b) const {
+            if (Key::less(a.key, b.key)) {
+                return true;
+            }
+            if (Key::less(b.key, a.key)) {
+                return false;
+            }
+            return a.offset < b.offset;
+        }
+    };
+    struct Bound {
+        key_t key;
+        bool inclusive;
+    };
+
+public:
+    PropertyIndexStorageImpl(FileHandle& dataFH, ShadowFile& shadowFile, Deserializer* deSer)
+        : numRunEntries{0} {
+        if (deSer) {
+            std::string key;
+            deSer->validateDebuggingInfo(key, "property_index");
+            deSer->deserializeValue<uint64_t>(readHeader.numElements);
+            deSer->deserializeValue<page_idx_t>(readHeader.firstPIPPageIdx);
+            deSer->deserializeValue<uint64_t>(numRunEntries);
+            writeHeader = readHeader;
+        }
+        run = std::make_unique<DiskArray<Entry>>(dataFH, DBFileID::newDataFileID(), readHeader,
+            writeHeader, &shadowFile);
+    }
+
+    void insert(const ValueVector& keyVector, sel_t pos, offset_t offset) override {
+        delta.insert(Entry{Key::get(keyVector, pos), offset});
+        markStale(offset);
+    }
+
+    void markStale(offset_t offset) override {
+        staleNodeGroups.insert(StorageUtils::getNodeGroupIdx(offset));
+    }
+
+    void lookup(const std::vector<ColumnConstantPredicate>& predicates,
+        const std::function<void(offset_t)>& func) const override {
+        std::optional<Bound> lower, upper;
+        auto tightenLower = [&](const key_t& key, bool inclusive) {
+            if (!lower || Key::less(lower->key, key) ||
+                (!Key::less(key, lower->key) && !inclusive)) {
+                lower = Bound{key, inclusive};
+            }
+        };
+        auto tightenUpper = [&](const key_t& key, bool inclusive) {
+            if (!upper || Key::less(key, upper->key) ||
+                (!Key::less(upper->key, key) && !inclusive)) {
+                upper = Bound{key, inclusive};
+            }
+        };
+        for (auto& predicate : predicates) {
+            // Bounds on truncated keys must include all keys sharing the truncated prefix.
+            const auto [key, truncated] = Key::get(predicate.getValue());
+            switch (predicate.getExpressionType()) {
+            case ExpressionType::EQUALS: {
+                tightenLower(key, true /* inclusive */);
+                tightenUpper(key, true /* inclusive */);
+            } break;
+            case ExpressionType::GREATER_THAN: {
+                tightenLower(key, truncated /* inclusive */);
+            } break;
+            case ExpressionType::GREATER_THAN_EQUALS: {
+                tightenLower(key, true /* inclusive */);
+            } break;
+            case ExpressionType::LESS_THAN: {
+                tightenUpper(key, truncated /* inclusive */);
+            } break;
+            case ExpressionType::LESS_THAN_EQUALS: {
+                tightenUpper(key, true /* inclusive */);
+            } break;
+            default: {
+                // Cannot narrow the lookup.
+            }
+            }
+        }
+        auto isAboveLower = [&](const key_t& key) {
+            return !lower ||
+                   (lower->inclusive ? !Key::less(key, lower->key) : Key::less(lower->key, key));
+        };
+        auto isBelowUpper = [&](const key_t& key) {
+            return !upper ||
+                   (upper->inclusive ? !Key::less(upper->key, key) : Key::less(key, upper->key));
+        };
+        // Binary search the run for the first entry above the lower bound.
+        uint64_t begin = 0, end = numRunEntries;
+        while (begin < end) {
+            const auto mid = begin + (end - begin) / 2;
+            if (isAboveLower(run->get(mid, &DUMMY_TRANSACTION).key)) {
+                end = mid;
+            } else {
+                begin = mid + 1;
+            }
+        }
+        for (auto i = begin; i < numRunEntries; i++) {
+            const auto entry = run->get(i, &DUMMY_TRANSACTION);
+            if (!isBelowUpper(entry.key)) {
+                break;
+            }
+            func(entry.offset);
+        }
+        auto iter = delta.begin();
+        if (lower) {
+            iter = lower->inclusive ? delta.lower_bound(Entry{lower->key, 0}) :
+                                      delta.upper_bound(Entry{lower->key, INVALID_OFFSET});
+        }
+        for (; iter != delta.end() && isBelowUpper(iter->key); ++iter) {
+            func(iter->offset);
+        }
+    }
+
+    void checkpoint(const node_group_scanner_t& scanNodeGroup) override {
+        if (staleNodeGroups.empty()) {
+            return;
+        }
+        std::vector<Entry> freshEntries;
+        for (auto nodeGroupIdx : staleNodeGroups) {
+            scanNodeGroup(nodeGroupIdx,
+                [&](const ValueVector& keyVector, const ValueVector& nodeIDVector) {
+                    for (auto i = 0u; i < nodeIDVector.state->getSelVector().getSelSize(); i++) {
+                        const auto pos = nodeIDVector.state->getSelVector()[i];
+                        if (!keyVector.isNull(pos)) {
+                            freshEntries.push_back(
+                                Entry{Key::get(keyVector, pos), nodeIDVector.readNodeOffset(pos)});
+                        }
+                    }
+                });
+        }
+        std::sort(freshEntries.begin(), freshEntries.end(), EntryLess{});
+        // Merge the fresh entries with the entries of unchanged node groups into the run in place.
+        // The old run is read from the data file while the new one is written to shadow pages,
+        // so entries can be written ahead of the ones still to be read. Pages past the end of the
+        // new run are kept for later checkpoints.
+        uint64_t numEntries = 0;
+        {
+            auto writeIter = run->iter_mut();
+            auto write = [&](const Entry& entry) {
+                if (numEntries < writeHeader.numElements) {
+                    writeIter.seek(numEntries);
+                    *writeIter = entry;
+                } else {
+                    writeIter.pushBack(&DUMMY_CHECKPOINT_TRANSACTION, entry);
+                }
+                numEntries++;
+            };
+            auto freshIter = freshEntries.begin();
+            for (auto i = 0u; i < numRunEntries; i++) {
+                const auto entry = run->get(i, &DUMMY_TRANSACTION);
+                if (staleNodeGroups.contains(StorageUtils::getNodeGroupIdx(entry.offset))) {
+                    continue;
+                }
+                for (; freshIter != freshEntries.end() && EntryLess{}(*freshIter, entry);
+                     ++freshIter) {
+                    write(*freshIter);
+                }
+                write(entry);
+            }
+            for (; freshIter != freshEntries.end(); ++freshIter) {
+                write(*freshIter);
+            }
+        }
+        run->checkpoint();
+        run->checkpointInMemoryIfNecessary();
+        readHeader = writeHeader;
+        numRunEntries = numEntries;
+        delta.clear();
+        staleNodeGroups.clear();
+    }
+
+    void serialize(Serializer& serializer) const override {
+        serializer.writeDebuggingInfo("property_index");
+        serializer.serializeValue<uint64_t>(readHeader.numElements);
+        serializer.serializeValue<page_idx_t>(readHeader.firstPIPPageIdx);
+        serializer.serializeValue<uint64_t>(numRunEntries);
+    }
+
+    uint64_t getNumEntries() const override { return numRunEntries + delta.size(); }
+
+private:
+    DiskArrayHeader readHeader;
+    DiskArrayHeader writeHeader;
+    // The run may be shorter than the disk array, whose capacity is reused by later checkpoints.
+    uint64_t numRunEntries;
+    std::unique_ptr<DiskArray<Entry>> run;
+    // Entries inserted since the last checkpoint. Duplicate keys are kept apart by the offset,
+    // which also makes repeated insertions of the same version idempotent.
+    std::set<Entry, EntryLess> delta;
+    // Node groups whose entries are rebuilt by the next checkpoint.
+    std::unordered_set<node_group_idx_t> staleNodeGroups;
+};
+
+PropertyIndex::PropertyIndex(const LogicalType& keyType, FileHandle& dataFH,
+    ShadowFile& shadowFile, Deserializer* deSer) {
+    KU_ASSERT(isSupportedType(keyType));
+    TypeUtils::visit(
+        keyType.getPhysicalType(),
+        [&]<typename T>(T)
+            requires(std::is_arithmetic_v<T> || std::is_same_v<T, int128_t> ||
+                     std::is_same_v<T, ku_string_t>)
+        { storage = std::make_unique<PropertyIndexStorageImpl<T>>(dataFH, shadowFile, deSer); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+PropertyIndex::~PropertyIndex() = default;
+
+bool PropertyIndex::isSupportedType(const LogicalType& type) {
+    // Only types whose physical order matches their logical order.
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void PropertyIndex::insert(const ValueVector& keyVector, const ValueVector& nodeIDVector) {
+    KU_ASSERT(keyVector.state == nodeIDVector.state);
+    std::unique_lock lck{mtx};
+    for (auto i = 0u; i < nodeIDVector.state->getSelVector().getSelSize(); i++) {
+        const auto pos = nodeIDVector.state->getSelVector()[i];
+        if (keyVector.isNull(pos) || nodeIDVector.isNull(pos)) {
+            continue;
+        }
+        storage->insert(keyVector, pos, nodeIDVector.readNodeOffset(pos));
+    }
+}
+
+void PropertyIndex::insert(const ValueVector& keyVector, sel_t pos, offset_t offset) {
+    std::unique_lock lck{mtx};
+    if (keyVector.isNull(pos)) {
+        // The previous value of the node is outdated.
+        storage->markStale(offset);
+        return;
+    }
+    storage->insert(keyVector, pos, offset);
+}
+
+void PropertyIndex::markStale(offset_t offset) {
+    std::unique_lock lck{mtx};
+    storage->markStale(offset);
+}
+
+void PropertyIndex::lookup(const std::vector<ColumnConstantPredicate>& predicates,
+    const std::function<void(offset_t)>& func) const {
+    std::unique_lock lck{mtx};
+    storage->lookup(predicates, func);
+}
+
+void PropertyIndex::checkpoint(const node_group_scanner_t& scanNodeGroup) {
+    std::unique_lock lck{mtx};
+    storage->checkpoint(scanNodeGroup);
+}
+
+void PropertyIndex::serialize(Serializer& serializer) const {
+    std::unique_lock lck{mtx};
+    storage->serialize(serializer);
+}
+
+uint64_t PropertyIndex::getNumEntries() const {
+    std::unique_lock lck{mtx};
+    return storage->getNumEntries();
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,255 @@
+#include "storage/stats/table_statistics_collector.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "catalog/catalog_entry/rel_table_catalog_entry.h"
+#include "common/data_chunk/data_chunk.h"
+#include "common/type_utils.h"
+#include "function/hash/vector_hash_functions.h"
+#include "storage/storage_manager.h"
+#include "storage/store/csr_node_group.h"
+#include "storage/store/node_table.h"
+#include "storage/store/rel_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::function;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+ColumnStatisticsCollector::ColumnStatisticsCollector(const LogicalType& type,
+    MemoryManager* memoryManager, bool buildHistogram)
+    : buildHistogram{false}, min{std::numeric_limits<double>::max()},
+      max{std::numeric_limits<double>::lowest()}, hashVector{LogicalType::HASH(), memoryManager},
+      randomEngine{0 /* seed */, 0 /* stream */} {
+    if (buildHistogram) {
+        TypeUtils::visit(
+            type.getPhysicalType(),
+            [&]<typename T>(T)
+                requires(std::is_arithmetic_v<T>)
+            { this->buildHistogram = true; },
+            [](auto) {});
+    }
+}
+
+void ColumnStatisticsCollector::update(const ValueVector& vector) {
+    auto& selVector = vector.state->getSelVector();
+    VectorHashFunction::computeHash(vector, selVector, hashVector, selVector);
+    uint64_t numNulls = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (vector.isNull(pos)) {
+            numNulls++;
+        } else {
+            hyperLogLog.insert(hashVector.getValue<hash_t>(pos));
+        }
+    }
+    statistics.numNulls += numNulls;
+    statistics.numNonNulls += selVector.getSelSize() - numNulls;
+    if (buildHistogram) {
+        TypeUtils::visit(
+            vector.dataType.getPhysicalType(),
+            [&]<typename T>(T)
+                requires(std::is_arithmetic_v<T>)
+            {
+                for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                    const auto pos = selVector[i];
+                    if (!vector.isNull(pos)) {
+                        addToSample((double)vector.getValue<T>(pos));
+                    }
+                }
+            },
+            [](auto) { KU_UNREACHABLE; });
+    }
+}
+
+void ColumnStatisticsCollector::merge(const ColumnStatisticsCollector& other) {
+    // Merging uniform samples of different sizes would bias the histogram.
+    KU_ASSERT(!buildHistogram && !other.buildHistogram);
+    statistics.numNulls += other.statistics.numNulls;
+    statistics.numNonNulls += other.statistics.numNonNulls;
+    hyperLogLog.merge(other.hyperLogLog);
+}
+
+ColumnStatistics ColumnStatisticsCollector::finalize() {
+    statistics.numDistinctValues = std::min(hyperLogLog.estimate(), statistics.numNonNulls);
+    if (statistics.numNonNulls > 0 && statistics.numDistinctValues == 0) {
+        statistics.numDistinctValues = 1;
+    }
+    if (!sample.empty()) {
+        std::sort(sample.begin(), sample.end());
+        const auto numBuckets = std::min<uint64_t>(NUM_HISTOGRAM_BUCKETS, sample.size());
+        statistics.histogramBounds.push_back(min);
+        for (auto i = 1u; i < numBuckets; i++) {
+            statistics.histogramBounds.push_back(sample[i * sample.size() / numBuckets]);
+        }
+        statistics.histogramBounds.push_back(max);
+    }
+    return std::move(statistics);
+}
+
+void ColumnStatisticsCollector::addToSample(double value) {
+    min = std::min(min, value);
+    max = std::max(max, value);
+    numSampledValues++;
+    if (sample.size() < SAMPLE_SIZE) {
+        sample.push_back(value);
+        return;
+    }
+    const auto idx = randomEngine.nextRandomInteger(
+        (uint32_t)std::min<uint64_t>(numSampledValues, std::numeric_limits<uint32_t>::max()));
+    if (idx < SAMPLE_SIZE) {
+        sample[idx] = value;
+    }
+}
+
+TableStatisticsCollector::TableStatisticsCollector(const TableCatalogEntry& entry,
+    MemoryManager* memoryManager, bool buildHistograms)
+    : memoryManager{memoryManager} {
+    for (auto& property : entry.getProperties()) {
+        if (property.getName() == InternalKeyword::ID) {
+            continue;
+        }
+        propertyNames.push_back(property.getName());
+        columnIDs.push_back(entry.getColumnID(property.getName()));
+        columnCollectors.push_back(std::make_unique<ColumnStatisticsCollector>(property.getType(),
+            memoryManager, buildHistograms));
+    }
+}
+
+void TableStatisticsCollector::addDegree(RelDataDirection direction, uint64_t degree) {
+    if (degree == 0) {
+        return;
+    }
+    auto& statistics = direction == RelDataDirection::FWD ? fwdDegrees : bwdDegrees;
+    statistics.numRels += degree;
+    statistics.numNodesWithRels++;
+    statistics.maxDegree = std::max(statistics.maxDegree, degree);
+    statistics.sumSquaredDegrees += (double)degree * (double)degree;
+}
+
+static void mergeDegrees(DegreeStatistics& statistics, const DegreeStatistics& other) {
+    statistics.numRels += other.numRels;
+    statistics.numNodesWithRels += other.numNodesWithRels;
+    statistics.maxDegree = std::max(statistics.maxDegree, other.maxDegree);
+    statistics.sumSquaredDegrees += other.sumSquaredDegrees;
+}
+
+void TableStatisticsCollector::merge(const TableStatisticsCollector& other) {
+    KU_ASSERT(columnCollectors.size() == other.columnCollectors.size());
+    for (auto i = 0u; i < columnCollectors.size(); i++) {
+        columnCollectors[i]->merge(*other.columnCollectors[i]);
+    }
+    mergeDegrees(fwdDegrees, other.fwdDegrees);
+    mergeDegrees(bwdDegrees, other.bwdDegrees);
+}
+
+TableStatistics TableStatisticsCollector::finalize(uint64_t numRows) {
+    TableStatistics statistics{numRows};
+    for (auto i = 0u; i < propertyNames.size(); i++) {
+        statistics.setColumnStatistics(propertyNames[i], columnCollectors[i]->finalize());
+    }
+    statistics.setDegreeStatistics(RelDataDirection::FWD, fwdDegrees);
+    statistics.setDegreeStatistics(RelDataDirection::BWD, bwdDegrees);
+    return statistics;
+}
+
+TableStatistics TableStatisticsCollector::collect(Transaction* transaction,
+    MemoryManager* memoryManager, StorageManager& storageManager, const TableCatalogEntry& entry) {
+    TableStatisticsCollector collector{entry, memoryManager, true /* buildHistograms */};
+    if (entry.getTableType() == TableType::NODE) {
+        const auto numRows = collector.scanNodeTable(transaction, storageManager, entry);
+        return collector.finalize(numRows);
+    }
+    // Each rel is stored in both directions, so properties only need to be scanned in one.
+    collector.scanRelTable(transaction, storageManager, entry, RelDataDirection::FWD,
+        true /* scanProperties */);
+    collector.scanRelTable(transaction, storageManager, entry, RelDataDirection::BWD,
+        false /* scanProperties */);
+    const auto numRels = collector.fwdDegrees.numRels;
+    return collector.finalize(numRels);
+}
+
+uint64_t TableStatisticsCollector::scanNodeTable(Transaction* transaction,
+    StorageManager& storageManager, const TableCatalogEntry& entry) {
+    auto& table = storageManager.getTable(entry.getTableID())->cast<NodeTable>();
+    std::vector<Column*> columns;
+    DataChunk dataChunk{(uint32_t)propertyNames.size()};
+    for (auto i = 0u; i < propertyNames.size(); i++) {
+        columns.push_back(table.getColumnPtr(columnIDs[i]));
+        const auto& type = entry.getProperty(propertyNames[i]).getType();
+        dataChunk.insert(i, std::make_shared<ValueVector>(type.copy(), memoryManager));
+    }
+    ValueVector nodeIDVector(LogicalType::INTERNAL_ID(), memoryManager);
+    nodeIDVector.setState(dataChunk.state);
+    NodeTableScanState scanState{table.getTableID(), columnIDs, columns};
+    for (auto& vector : dataChunk.valueVectors) {
+        scanState.outputVectors.push_back(vector.get());
+    }
+    scanState.nodeIDVector = &nodeIDVector;
+    scanState.rowIdxVector->state = dataChunk.state;
+    scanState.outState = dataChunk.state.get();
+    scanState.source = TableScanSource::COMMITTED;
+    uint64_t numRows = 0;
+    for (node_group_idx_t i = 0; i < table.getNumNodeGroups(); i++) {
+        scanState.nodeGroupIdx = i;
+        table.initScanState(transaction, scanState);
+        while (table.scan(transaction, scanState)) {
+            numRows += dataChunk.state->getSelVector().getSelSize();
+            for (auto j = 0u; j < columnCollectors.size(); j++) {
+                columnCollectors[j]->update(*dataChunk.valueVectors[j]);
+            }
+        }
+    }
+    return numRows;
+}
+
+void TableStatisticsCollector::scanRelTable(Transaction* transaction,
+    StorageManager& storageManager, const TableCatalogEntry& entry, RelDataDirection direction,
+    bool scanProperties) {
+    auto& table = storageManager.getTable(entry.getTableID())->cast<RelTable>();
+    const auto numProperties = scanProperties ? propertyNames.size() : 0;
+    std::vector<column_id_t> scanColumnIDs{NBR_ID_COLUMN_ID};
+    DataChunk dataChunk{(uint32_t)(1 + numProperties)};
+    dataChunk.insert(0, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID(), memoryManager));
+    for (auto i = 0u; i < numProperties; i++) {
+        scanColumnIDs.push_back(columnIDs[i]);
+        const auto& type = entry.getProperty(propertyNames[i]).getType();
+        dataChunk.insert(i + 1, std::make_shared<ValueVector>(type.copy(), memoryManager));
+    }
+    std::vector<Column*> columns;
+    for (const auto columnID : scanColumnIDs) {
+        columns.push_back(table.getColumn(columnID, direction));
+    }
+    ValueVector boundNodeIDVector(LogicalType::INTERNAL_ID(), memoryManager);
+    boundNodeIDVector.state = DataChunkState::getSingleValueDataChunkState();
+    RelTableScanState scanState{*memoryManager, table.getTableID(), scanColumnIDs, columns,
+        table.getCSROffsetColumn(direction), table.getCSRLengthColumn(direction), direction};
+    scanState.nodeIDVector = &boundNodeIDVector;
+    for (auto& vector : dataChunk.valueVectors) {
+        scanState.outputVectors.push_back(vector.get());
+    }
+    scanState.rowIdxVector->state = dataChunk.state;
+    scanState.outState = dataChunk.state.get();
+    const auto boundTableID =
+        entry.constCast<RelTableCatalogEntry>().getBoundTableID(direction);
+    const auto numBoundNodes = storageManager.getTable(boundTableID)->getNumRows();
+    for (offset_t offset = 0; offset < numBoundNodes; offset++) {
+        boundNodeIDVector.setValue<nodeID_t>(0, nodeID_t{offset, boundTableID});
+        table.initScanState(transaction, scanState);
+        uint64_t degree = 0;
+        while (table.scan(transaction, scanState)) {
+            degree += dataChunk.state->getSelVector().getSelSize();
+            for (auto i = 0u; i < numProperties; i++) {
+                columnCollectors[i]->update(*dataChunk.valueVectors[i + 1]);
+            }
+        }
+        addDegree(direction, degree);
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -8,6 +8,7 @@
 #include "main/database.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/stats/table_statistics_collector.h"
 #include "storage/store/node_table.h"
 #include "storage/store/rel_table.h"
 #include "storage/wal_replayer.h"
@@ -207,10 +208,29 @@ ShadowFile& StorageManager::getShadowFile() const {
     return *shadowFile;
 }
 
+void StorageManager::preCheckpoint() {
+    if (main::DBConfig::isDBPathInMemory(databasePath)) {
+        return;
+    }
+    // Tables are never removed from the storage manager, so they can be flushed without holding
+    // the lock, which would block creating tables.
+    std::vector<Table*> tablesToFlush;
+    {
+        std::lock_guard lck{mtx};
+        for (const auto& [tableID, table] : tables) {
+            tablesToFlush.push_back(table.get());
+        }
+    }
+    for (const auto table : tablesToFlush) {
+        table->preCheckpoint();
+    }
+}
+
 void StorageManager::checkpoint(main::ClientContext& clientContext) {
     if (main::DBConfig::isDBPathInMemory(databasePath)) {
         return;
     }
+    refreshStatistics(clientContext);
     std::lock_guard lck{mtx};
     const auto metadataFileInfo = clientContext.getVFSUnsafe()->openFile(
         StorageUtils::getMetadataFName(clientContext.getVFSUnsafe(), databasePath,
@@ -246,6 +266,39 @@ void StorageManager::checkpoint(main::ClientContext& clientContext) {
     shadowFile->flushAll();
 }
 
+void StorageManager::refreshStatistics(main::ClientContext& clientContext) {
+    const auto catalog = clientContext.getCatalog();
+    std::vector<TableCatalogEntry*> tableEntries;
+    for (const auto entry : catalog->getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION)) {
+        tableEntries.push_back(entry);
+    }
+    for (const auto entry : catalog->getRelTableEntries(&DUMMY_CHECKPOINT_TRANSACTION)) {
+        tableEntries.push_back(entry);
+    }
+    for (const auto tableEntry : tableEntries) {
+        const auto tableID = tableEntry->getTableID();
+        const auto numRows = getTable(tableID)->getNumRows();
+        if (tableEntry->getStatistics() == nullptr) {
+            if (numRows == 0) {
+                continue;
+            }
+        } else {
+            if (!numRowsAtLastStatistics.contains(tableID)) {
+                numRowsAtLastStatistics[tableID] = numRows;
+            }
+            const auto lastNumRows = numRowsAtLastStatistics.at(tableID);
+            const auto numChangedRows =
+                numRows > lastNumRows ? numRows - lastNumRows : lastNumRows - numRows;
+            if ((double)numChangedRows <= (double)lastNumRows * STATISTICS_REFRESH_RATIO) {
+                continue;
+            }
+        }
+        tableEntry->setStatistics(TableStatisticsCollector::collect(&DUMMY_CHECKPOINT_TRANSACTION,
+            clientContext.getMemoryManager(), *this, *tableEntry));
+        numRowsAtLastStatistics[tableID] = numRows;
+    }
+}
+
 StorageManager::~StorageManager() = default;
 
 } // namespace storage
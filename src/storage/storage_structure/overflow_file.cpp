@@ -6,6 +6,7 @@
 #include "common/type_utils.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/compression/block_compression.h"
 #include "storage/file_handle.h"
 #include "storage/shadow_utils.h"
 #include "storage/storage_structure/in_mem_page.h"
@@ -24,24 +25,13 @@ std::string OverflowFileHandle::readString(TransactionType trxType, const ku_str
     } else {
         PageCursor cursor;
         TypeUtils::decodeOverflowPtr(str.overflowPtr, cursor.pageIdx, cursor.elemPosInPage);
-        std::string retVal;
-        retVal.reserve(str.len);
-        int32_t remainingLength = str.len;
-        while (remainingLength > 0) {
-            auto numBytesToReadInPage = std::min(static_cast<uint32_t>(remainingLength),
-                END_OF_PAGE - cursor.elemPosInPage);
-            auto startPosInSrc = retVal.size();
-            read(trxType, cursor.pageIdx, [&](uint8_t* frame) {
-                // Replace rather than append, since optimistic read may call the function multiple
-                // times
-                retVal.replace(startPosInSrc, numBytesToReadInPage,
-                    std::string_view(reinterpret_cast<const char*>(frame) + cursor.elemPosInPage,
-                        numBytesToReadInPage));
-                cursor.pageIdx = *(page_idx_t*)(frame + END_OF_PAGE);
-            });
-            remainingLength -= numBytesToReadInPage;
-            // After the first page we always start reading from the beginning of the page.
-            cursor.elemPosInPage = 0;
+        std::string retVal(str.len, '\0');
+        if (cursor.elemPosInPage & COMPRESSED_FLAG) {
+            cursor.elemPosInPage &= ~COMPRESSED_FLAG;
+            readCompressedString(trxType, cursor, reinterpret_cast<uint8_t*>(retVal.data()),
+                str.len);
+        } else {
+            readFromPages(trxType, cursor, reinterpret_cast<uint8_t*>(retVal.data()), str.len);
         }
         return retVal;
     }
@@ -51,6 +41,13 @@ bool OverflowFileHandle::equals(TransactionType trxType, std::string_view keyToL
     const ku_string_t& keyInEntry) const {
     PageCursor cursor;
     TypeUtils::decodeOverflowPtr(keyInEntry.overflowPtr, cursor.pageIdx, cursor.elemPosInPage);
+    if (cursor.elemPosInPage & COMPRESSED_FLAG) {
+        cursor.elemPosInPage &= ~COMPRESSED_FLAG;
+        std::string value(keyInEntry.len, '\0');
+        readCompressedString(trxType, cursor, reinterpret_cast<uint8_t*>(value.data()),
+            keyInEntry.len);
+        return keyToLookup == value;
+    }
     auto lengthRead = 0u;
     while (lengthRead < keyInEntry.len) {
         auto numBytesToCheckInPage = std::min(static_cast<page_idx_t>(keyInEntry.len) - lengthRead,
@@ -71,6 +68,42 @@ bool OverflowFileHandle::equals(TransactionType trxType, std::string_view keyToL
     return true;
 }
 
+void OverflowFileHandle::readFromPages(TransactionType trxType, PageCursor& cursor,
+    uint8_t* result, uint64_t numBytes) const {
+    while (numBytes > 0) {
+        auto numBytesToReadInPage =
+            std::min(numBytes, static_cast<uint64_t>(END_OF_PAGE - cursor.elemPosInPage));
+        page_idx_t nextPageIdx = INVALID_PAGE_IDX;
+        read(trxType, cursor.pageIdx, [&](uint8_t* frame) {
+            // Optimistic reads may call the function multiple times, so it must not update the
+            // cursor itself
+            memcpy(result, frame + cursor.elemPosInPage, numBytesToReadInPage);
+            nextPageIdx = *(page_idx_t*)(frame + END_OF_PAGE);
+        });
+        numBytes -= numBytesToReadInPage;
+        result += numBytesToReadInPage;
+        cursor.elemPosInPage += numBytesToReadInPage;
+        // Writers start a new page as soon as a page is full
+        if (cursor.elemPosInPage >= END_OF_PAGE) {
+            cursor.pageIdx = nextPageIdx;
+            cursor.elemPosInPage = 0;
+        }
+    }
+}
+
+void OverflowFileHandle::readCompressedString(TransactionType trxType, PageCursor& cursor,
+    uint8_t* result, uint64_t length) const {
+    uint8_t compression = 0;
+    uint32_t compressedSize = 0;
+    readFromPages(trxType, cursor, &compression, sizeof(compression));
+    readFromPages(trxType, cursor, reinterpret_cast<uint8_t*>(&compressedSize),
+        sizeof(compressedSize));
+    std::vector<uint8_t> compressedData(compressedSize);
+    readFromPages(trxType, cursor, compressedData.data(), compressedSize);
+    BlockCompression::decompressBlock(static_cast<CompressionType>(compression), compressedData,
+        std::span(result, length));
+}
+
 uint8_t* OverflowFileHandle::addANewPage() {
     page_idx_t newPageIdx = overflowFile.getNewPageIdx();
     if (pageWriteCache.size() > 0) {
@@ -106,16 +139,37 @@ void OverflowFileHandle::setStringOverflow(const char* srcRawString, uint64_t le
                 });
         }
     }
-    int32_t remainingLength = len;
-    TypeUtils::encodeOverflowPtr(diskDstString.overflowPtr, nextPosToWriteTo.pageIdx,
-        nextPosToWriteTo.elemPosInPage);
-    while (remainingLength > 0) {
-        auto bytesWritten = len - remainingLength;
-        auto numBytesToWriteInPage = std::min(static_cast<uint32_t>(remainingLength),
-            END_OF_PAGE - nextPosToWriteTo.elemPosInPage);
-        memcpy(pageToWrite + nextPosToWriteTo.elemPosInPage, srcRawString + bytesWritten,
+    std::optional<BlockCompression::CompressedData> compressedData;
+    if (len >= MIN_LENGTH_TO_COMPRESS) {
+        compressedData = BlockCompression::compressValue(
+            std::span(reinterpret_cast<const uint8_t*>(srcRawString), len));
+    }
+    auto posInPage = nextPosToWriteTo.elemPosInPage;
+    if (compressedData) {
+        posInPage |= COMPRESSED_FLAG;
+    }
+    TypeUtils::encodeOverflowPtr(diskDstString.overflowPtr, nextPosToWriteTo.pageIdx, posInPage);
+    if (compressedData) {
+        const auto compression = static_cast<uint8_t>(compressedData->compression);
+        const auto compressedSize = static_cast<uint32_t>(compressedData->data.size());
+        writeToPages(pageToWrite, &compression, sizeof(compression));
+        writeToPages(pageToWrite, reinterpret_cast<const uint8_t*>(&compressedSize),
+            sizeof(compressedSize));
+        writeToPages(pageToWrite, compressedData->data.data(), compressedSize);
+    } else {
+        writeToPages(pageToWrite, reinterpret_cast<const uint8_t*>(srcRawString), len);
+    }
+}
+
+void OverflowFileHandle::writeToPages(uint8_t*& pageToWrite, const uint8_t* data,
+    uint64_t numBytes) {
+    uint64_t bytesWritten = 0;
+    while (bytesWritten < numBytes) {
+        auto numBytesToWriteInPage = std::min(numBytes - bytesWritten,
+            static_cast<uint64_t>(END_OF_PAGE - nextPosToWriteTo.elemPosInPage));
+        memcpy(pageToWrite + nextPosToWriteTo.elemPosInPage, data + bytesWritten,
             numBytesToWriteInPage);
-        remainingLength -= numBytesToWriteInPage;
+        bytesWritten += numBytesToWriteInPage;
         nextPosToWriteTo.elemPosInPage += numBytesToWriteInPage;
         if (nextPosToWriteTo.elemPosInPage >= END_OF_PAGE) {
             pageToWrite = addANewPage();
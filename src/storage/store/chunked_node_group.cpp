@@ -2,6 +2,7 @@
 
 #include "common/assert.h"
 #include "common/constants.h"
+#include "common/exception/runtime.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -134,6 +135,7 @@ uint64_t ChunkedNodeGroup::append(const Transaction* transaction,
         chunk->getData().append(columnVector, selVector);
     }
     if (transaction->getID() != Transaction::DUMMY_TRANSACTION_ID) {
+        std::unique_lock lck{writeMtx};
         if (!versionInfo) {
             versionInfo = std::make_unique<VersionInfo>();
         }
@@ -165,6 +167,7 @@ offset_t ChunkedNodeGroup::append(const Transaction* transaction,
             numToAppendInChunkedGroup);
     }
     if (transaction->getID() != Transaction::DUMMY_TRANSACTION_ID) {
+        std::unique_lock lck{writeMtx};
         if (!versionInfo) {
             versionInfo = std::make_unique<VersionInfo>();
         }
@@ -296,10 +299,25 @@ bool ChunkedNodeGroup::lookup(Transaction* transaction, const TableScanState& st
 
 void ChunkedNodeGroup::update(Transaction* transaction, row_idx_t rowIdxInChunk,
     column_id_t columnID, const ValueVector& propertyVector) {
+    std::unique_lock lck{writeMtx};
+    if (transaction->getID() != Transaction::DUMMY_TRANSACTION_ID && versionInfo &&
+        versionInfo->isDeletedByOtherTransaction(transaction, rowIdxInChunk)) {
+        throw RuntimeException(
+            "Write-write conflict: updating a row that is deleted by another transaction.");
+    }
     getColumnChunk(columnID).update(transaction, rowIdxInChunk, propertyVector);
 }
 
 bool ChunkedNodeGroup::delete_(const Transaction* transaction, row_idx_t rowIdxInChunk) {
+    std::unique_lock lck{writeMtx};
+    if (transaction->getID() != Transaction::DUMMY_TRANSACTION_ID) {
+        for (const auto& chunk : chunks) {
+            if (chunk->isUpdatedByOtherTransaction(transaction, rowIdxInChunk)) {
+                throw RuntimeException(
+                    "Write-write conflict: deleting a row that is updated by another transaction.");
+            }
+        }
+    }
     if (!versionInfo) {
         versionInfo = std::make_unique<VersionInfo>();
     }
@@ -398,11 +416,33 @@ bool ChunkedNodeGroup::hasUpdates() const {
     return false;
 }
 
+bool ChunkedNodeGroup::hasOnlyCommittedInsertions(bool allowDeletions) {
+    std::unique_lock lck{writeMtx};
+    if (hasUpdates()) {
+        return false;
+    }
+    if (!versionInfo) {
+        return true;
+    }
+    if (!allowDeletions && versionInfo->hasDeletions()) {
+        return false;
+    }
+    for (auto row = 0u; row < numRows; row++) {
+        // The checkpoint transaction sees all committed insertions, but no uncommitted ones.
+        if (!versionInfo->isInserted(&DUMMY_CHECKPOINT_TRANSACTION, row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void ChunkedNodeGroup::commitInsert(row_idx_t startRow, row_idx_t numRows, transaction_t commitTS) {
+    std::unique_lock lck{writeMtx};
     versionInfo->commitInsert(startRow, numRows, commitTS);
 }
 
 void ChunkedNodeGroup::rollbackInsert(row_idx_t startRow, row_idx_t numRows_) {
+    std::unique_lock lck{writeMtx};
     if (startRow == 0) {
         setNumRows(0);
         versionInfo.reset();
@@ -418,10 +458,12 @@ void ChunkedNodeGroup::rollbackInsert(row_idx_t startRow, row_idx_t numRows_) {
 
 void ChunkedNodeGroup::commitDelete(row_idx_t startRow, row_idx_t numRows_,
     transaction_t commitTS) {
+    std::unique_lock lck{writeMtx};
     versionInfo->commitDelete(startRow, numRows_, commitTS);
 }
 
 void ChunkedNodeGroup::rollbackDelete(row_idx_t startRow, row_idx_t numRows_) {
+    std::unique_lock lck{writeMtx};
     versionInfo->rollbackDelete(startRow, numRows_);
 }
 
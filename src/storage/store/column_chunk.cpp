@@ -121,6 +121,13 @@ bool ColumnChunk::hasUpdates(const Transaction* transaction, row_idx_t startRow,
     return updateInfo && updateInfo->hasUpdates(transaction, startRow, numRows);
 }
 
+bool ColumnChunk::isUpdatedByOtherTransaction(const Transaction* transaction,
+    offset_t offsetInChunk) const {
+    return updateInfo &&
+           updateInfo->isUpdatedByOtherTransaction(transaction,
+               offsetInChunk / DEFAULT_VECTOR_CAPACITY, offsetInChunk % DEFAULT_VECTOR_CAPACITY);
+}
+
 void ColumnChunk::scanCommittedUpdates(const Transaction* transaction, ColumnChunkData& output,
     offset_t startOffsetInOutput, row_idx_t startRowScanned, row_idx_t numRows) const {
     if (!updateInfo) {
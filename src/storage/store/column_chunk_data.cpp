@@ -120,6 +120,15 @@ void ColumnChunkData::initializeFunction(bool enableCompression) {
     flushBufferFunction = initializeFlushBufferFunction(compression);
 }
 
+void ColumnChunkData::enableBlockCompression() {
+    KU_ASSERT(dataType.getPhysicalType() == PhysicalTypeID::UINT8);
+    const auto cache = std::make_shared<BlockCompressionCache>();
+    getMetadataFunction = GetBlockCompressionMetadata(
+        GetCompressionMetadata(getCompression(dataType, false /*enableCompression*/), dataType),
+        cache);
+    flushBufferFunction = BlockCompressedFlushBuffer(cache);
+}
+
 ColumnChunkData::flush_buffer_func_t ColumnChunkData::initializeFlushBufferFunction(
     std::shared_ptr<CompressionAlg> compression) const {
     switch (dataType.getPhysicalType()) {
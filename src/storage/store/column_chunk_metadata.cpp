@@ -61,6 +61,27 @@ ColumnChunkMetadata GetCompressionMetadata::operator()(std::span<const uint8_t>
     }
 }
 
+ColumnChunkMetadata GetBlockCompressionMetadata::operator()(std::span<const uint8_t> buffer,
+    uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max) const {
+    auto metadata = fallback(buffer, capacity, numValues, min, max);
+    if (metadata.compMeta.isConstant()) {
+        return metadata;
+    }
+    KU_ASSERT(numValues <= buffer.size());
+    auto compressedData = BlockCompression::compress(buffer.first(numValues));
+    if (!compressedData) {
+        return metadata;
+    }
+    const auto numPages = ColumnChunkData::getNumPagesForBytes(compressedData->data.size());
+    const auto compression = compressedData->compression;
+    std::unique_lock lck{cache->mtx};
+    cache->buffer = buffer.data();
+    cache->numValues = numValues;
+    cache->compressedData = std::move(compressedData);
+    return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues,
+        CompressionMetadata(min, max, compression));
+}
+
 ColumnChunkMetadata uncompressedGetMetadata(std::span<const uint8_t> buffer, uint64_t /*capacity*/,
     uint64_t numValues, StorageValue min, StorageValue max) {
     return uncompressedGetMetadataInternal(buffer.size(), numValues, min, max);
@@ -177,6 +177,13 @@ public:
         auto pageCursor = getPageCursorForOffsetInGroup(startNodeOffset, chunkMeta.pageIdx,
             state.numValuesPerPage);
         KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
+        // Filtered scans may skip pages and single values are usually lookups, so only plain range
+        // scans read ahead.
+        if (numValuesToScan > 1 && !filterFunc.has_value()) {
+            prefetchPages(transaction, chunkMeta, pageCursor.pageIdx);
+        }
+        const auto accessPattern =
+            numValuesToScan > 1 ? PageAccessPattern::SCAN : PageAccessPattern::RANDOM;
 
         uint64_t numValuesScanned = 0;
         while (numValuesScanned < numValuesToScan) {
@@ -191,7 +198,8 @@ public:
                     readFunc(frame, pageCursor, result, numValuesScanned + startOffsetInResult,
                         numValuesToScanInPage, chunkMeta.compMeta);
                 };
-                readFromPage(transaction, pageCursor.pageIdx, std::cref(readFromPageFunc));
+                readFromPage(transaction, pageCursor.pageIdx, std::cref(readFromPageFunc),
+                    accessPattern);
             }
             numValuesScanned += numValuesToScanInPage;
             pageCursor.nextPage();
@@ -430,7 +438,7 @@ ColumnReadWriter::ColumnReadWriter(DBFileID dbFileID, FileHandle* dataFH,
     : dbFileID(dbFileID), dataFH(dataFH), bufferManager(bufferManager), shadowFile(shadowFile) {}
 
 void ColumnReadWriter::readFromPage(Transaction* transaction, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readFunc) {
+    const std::function<void(uint8_t*)>& readFunc, PageAccessPattern accessPattern) {
     // For constant compression, call read on a nullptr since there is no data on disk and
     // decompression only requires metadata
     if (pageIdx == INVALID_PAGE_IDX) {
@@ -438,7 +446,28 @@ void ColumnReadWriter::readFromPage(Transaction* transaction, page_idx_t pageIdx
     }
     auto [fileHandleToPin, pageIdxToPin] = ShadowUtils::getFileHandleAndPhysicalPageIdxToPin(
         *dataFH, pageIdx, *shadowFile, transaction->getType());
-    fileHandleToPin->optimisticReadPage(pageIdxToPin, readFunc);
+    fileHandleToPin->optimisticReadPage(pageIdxToPin, readFunc, accessPattern);
+}
+
+void ColumnReadWriter::prefetchPages(Transaction* transaction,
+    const ColumnChunkMetadata& metadata, page_idx_t startPageIdx) {
+    // Checkpoints may read shadow pages instead, and there is nothing to read for constant
+    // compression.
+    if (transaction->getType() == TransactionType::CHECKPOINT || startPageIdx == INVALID_PAGE_IDX) {
+        return;
+    }
+    // Pages are read in the background, so the next window is requested once the page half a
+    // window ahead is not cached, while the scan still has the rest of the current one to process.
+    // Scans over cached pages only check two page states.
+    const auto numPagesLeftInChunk = metadata.pageIdx + metadata.numPages - startPageIdx;
+    const auto numPagesToPrefetch =
+        std::min(numPagesLeftInChunk, BufferManager::MAX_NUM_PAGES_TO_PREFETCH);
+    const auto lookAheadPageIdx = startPageIdx + numPagesToPrefetch / 2;
+    if (dataFH->getPageState(startPageIdx)->getState() != PageState::EVICTED &&
+        dataFH->getPageState(lookAheadPageIdx)->getState() != PageState::EVICTED) {
+        return;
+    }
+    dataFH->prefetchPages(startPageIdx, numPagesToPrefetch);
 }
 
 void ColumnReadWriter::updatePageWithCursor(PageCursor cursor,
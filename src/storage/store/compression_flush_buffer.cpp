@@ -15,6 +15,35 @@ ColumnChunkMetadata uncompressedFlushBuffer(std::span<const uint8_t> buffer, Fil
         metadata.compMeta);
 }
 
+ColumnChunkMetadata BlockCompressedFlushBuffer::operator()(std::span<const uint8_t> buffer,
+    FileHandle* dataFH, common::page_idx_t startPageIdx,
+    const ColumnChunkMetadata& metadata) const {
+    if (!BlockCompression::isBlockCompression(metadata.compMeta.compression)) {
+        return uncompressedFlushBuffer(buffer, dataFH, startPageIdx, metadata);
+    }
+    std::optional<BlockCompression::CompressedData> compressedData;
+    {
+        std::unique_lock lck{cache->mtx};
+        if (cache->buffer == buffer.data() && cache->numValues == metadata.numValues) {
+            compressedData = std::move(cache->compressedData);
+        }
+        cache->buffer = nullptr;
+        cache->compressedData.reset();
+    }
+    if (!compressedData || compressedData->compression != metadata.compMeta.compression) {
+        compressedData = BlockCompression::compress(buffer.first(metadata.numValues));
+        KU_ASSERT(compressedData && compressedData->compression == metadata.compMeta.compression);
+    }
+    auto& data = compressedData->data;
+    KU_ASSERT(ColumnChunkData::getNumPagesForBytes(data.size()) == metadata.numPages);
+    KU_ASSERT(dataFH->getNumPages() >= startPageIdx + metadata.numPages);
+    // Pad the data to whole pages so that the on-disk file is the right length
+    data.resize(metadata.numPages * PAGE_SIZE);
+    dataFH->writePagesToFile(data.data(), data.size(), startPageIdx);
+    return ColumnChunkMetadata(startPageIdx, metadata.numPages, metadata.numValues,
+        metadata.compMeta);
+}
+
 ColumnChunkMetadata CompressedFlushBuffer::operator()(std::span<const uint8_t> buffer,
     FileHandle* dataFH, common::page_idx_t startPageIdx,
     const ColumnChunkMetadata& metadata) const {
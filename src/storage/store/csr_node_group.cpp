@@ -1,5 +1,7 @@
 #include "storage/store/csr_node_group.h"
 
+#include <numeric>
+
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/store/rel_table.h"
@@ -311,8 +313,11 @@ void CSRNodeGroup::appendChunkedCSRGroup(const Transaction* transaction,
     for (auto i = 0u; i < chunkedGroup.getNumColumns(); i++) {
         chunkedGroupForProperties[i] = &chunkedGroup.getColumnChunk(i);
     }
-    auto startRow =
-        NodeGroup::append(transaction, chunkedGroupForProperties, 0, chunkedGroup.getNumRows());
+    // The csr index is updated under the same lock as the appended rows, so that the background
+    // checkpointer flushing the node group sees both consistently.
+    const auto lock = chunkedGroups.lock();
+    auto startRow = NodeGroup::append(lock, transaction, chunkedGroupForProperties, 0,
+        chunkedGroup.getNumRows());
     if (!csrIndex) {
         csrIndex = std::make_unique<CSRIndex>();
     }
@@ -325,7 +330,8 @@ void CSRNodeGroup::appendChunkedCSRGroup(const Transaction* transaction,
 
 void CSRNodeGroup::append(const Transaction* transaction, offset_t boundOffsetInGroup,
     const std::vector<ColumnChunk*>& chunks, row_idx_t startRowInChunks, row_idx_t numRows) {
-    const auto startRow = NodeGroup::append(transaction, chunks, startRowInChunks, numRows);
+    const auto lock = chunkedGroups.lock();
+    const auto startRow = NodeGroup::append(lock, transaction, chunks, startRowInChunks, numRows);
     if (!csrIndex) {
         csrIndex = std::make_unique<CSRIndex>();
     }
@@ -434,11 +440,35 @@ void CSRNodeGroup::serialize(Serializer& serializer) {
     }
 }
 
+void CSRNodeGroup::preCheckpoint(MemoryManager& memoryManager, FileHandle& dataFH) {
+    const auto lock = chunkedGroups.lock();
+    // Only node groups without persistent data are flushed ahead. Merging changes into persistent
+    // CSR regions is left to the checkpoint. Rels can still be appended to the node group, in
+    // which case the data flushed before is replaced.
+    if (persistentChunkGroup || numRows == 0 ||
+        (preCheckpointedGroup && numRows == numPreCheckpointedRows)) {
+        return;
+    }
+    // Deleted rels are left out of the flushed CSR lists, so deletions change the data to flush.
+    if (!hasOnlyCommittedInsertions(lock, false /* allowDeletions */)) {
+        return;
+    }
+    std::vector<column_id_t> columnIDs(dataTypes.size());
+    std::iota(columnIDs.begin(), columnIDs.end(), 0);
+    CSRNodeGroupCheckpointState state{std::move(columnIDs), {} /* columns */, dataFH,
+        &memoryManager, nullptr /* csrOffsetCol */, nullptr /* csrLengthCol */};
+    if (auto flushedGroup = flushInMemOnly(lock, state)) {
+        setPreCheckpointedGroup(lock, std::move(flushedGroup));
+    }
+}
+
 void CSRNodeGroup::checkpoint(MemoryManager&, NodeGroupCheckpointState& state) {
     const auto lock = chunkedGroups.lock();
+    auto preCheckpointedChunkedGroup =
+        takePreCheckpointedGroup(lock, state.columnIDs, false /* allowDeletions */);
     if (!persistentChunkGroup) {
         // No persistent data in the node group.
-        checkpointInMemOnly(lock, state);
+        checkpointInMemOnly(lock, state, std::move(preCheckpointedChunkedGroup));
         return;
     }
     checkpointInMemAndOnDisk(lock, state);
@@ -737,17 +767,34 @@ static DataChunk initScanDataChunk(const CSRNodeGroupCheckpointState& csrState,
     return dataChunk;
 }
 
-void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpointState& state) {
+void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpointState& state,
+    std::unique_ptr<ChunkedNodeGroup> preCheckpointedChunkedGroup) {
+    auto flushedGroup = preCheckpointedChunkedGroup ?
+                            std::move(preCheckpointedChunkedGroup) :
+                            flushInMemOnly(lock, state.cast<CSRNodeGroupCheckpointState>());
+    if (!flushedGroup) {
+        return;
+    }
+    persistentChunkGroup = std::move(flushedGroup);
+    // TODO(Guodong): Use `finalizeCheckpoint`.
+    chunkedGroups.clear(lock);
+    // Set `numRows` back to 0 is to reflect that the in mem part of the node group is empty.
+    numRows = 0;
+    csrIndex.reset();
+}
+
+std::unique_ptr<ChunkedNodeGroup> CSRNodeGroup::flushInMemOnly(const UniqLock& lock,
+    CSRNodeGroupCheckpointState& csrState) {
     auto numRels = 0u;
     for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
         numRels += chunkedGroup->getNumRows();
     }
     if (numRels == 0) {
-        return;
+        return nullptr;
     }
     // Construct in-mem csr header chunks.
-    auto& csrState = state.cast<CSRNodeGroupCheckpointState>();
-    csrState.newHeader = std::make_unique<ChunkedCSRHeader>(*state.mm, false /*enableCompression*/,
+    csrState.newHeader = std::make_unique<ChunkedCSRHeader>(*csrState.mm,
+        false /*enableCompression*/,
         StorageConstants::NODE_GROUP_SIZE, ResidencyState::IN_MEMORY);
     const auto numNodes = csrIndex->getMaxOffsetWithRels() + 1;
     csrState.newHeader->setNumValues(numNodes);
@@ -773,7 +820,7 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     for (auto i = 0u; i < numColumnsToCheckpoint; i++) {
         const auto columnID = csrState.columnIDs[i];
         KU_ASSERT(columnID < dataTypes.size());
-        dataChunksToFlush[i] = std::make_unique<ColumnChunk>(*state.mm, dataTypes[columnID],
+        dataChunksToFlush[i] = std::make_unique<ColumnChunk>(*csrState.mm, dataTypes[columnID],
             chunkCapacity, enableCompression, ResidencyState::IN_MEMORY);
     }
 
@@ -827,13 +874,8 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     }
     csrState.newHeader->offset->getData().flush(csrState.dataFH);
     csrState.newHeader->length->getData().flush(csrState.dataFH);
-    persistentChunkGroup = std::make_unique<ChunkedCSRNodeGroup>(std::move(*csrState.newHeader),
+    return std::make_unique<ChunkedCSRNodeGroup>(std::move(*csrState.newHeader),
         std::move(dataChunksToFlush), 0);
-    // TODO(Guodong): Use `finalizeCheckpoint`.
-    chunkedGroups.clear(lock);
-    // Set `numRows` back to 0 is to reflect that the in mem part of the node group is empty.
-    numRows = 0;
-    csrIndex.reset();
 }
 
 void CSRNodeGroup::initScanStateFromScanChunk(const CSRNodeGroupCheckpointState& csrState,
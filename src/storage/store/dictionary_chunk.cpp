@@ -24,9 +24,13 @@ DictionaryChunk::DictionaryChunk(MemoryManager& mm, uint64_t capacity, bool enab
     ResidencyState residencyState)
     : enableCompression{enableCompression},
       indexTable(0, StringOps(this) /*hash*/, StringOps(this) /*equals*/) {
-    // Bitpacking might save 1 bit per value with regular ascii compared to UTF-8
+    // Bitpacking might save 1 bit per value with regular ascii compared to UTF-8, so the string
+    // data is instead compressed with LZ4/ZSTD as a whole when flushed.
     stringDataChunk = ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT8(),
         false /*enableCompression*/, capacity, residencyState, false /*hasNullData*/);
+    if (enableCompression) {
+        stringDataChunk->enableBlockCompression();
+    }
     offsetChunk =
         ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT64(), enableCompression,
             capacity * OFFSET_CHUNK_CAPACITY_FACTOR, residencyState, false /*hasNullData*/);
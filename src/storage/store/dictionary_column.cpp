@@ -5,6 +5,7 @@
 #include "common/types/ku_string.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/block_compression.h"
 #include "storage/storage_structure/disk_array_collection.h"
 #include "storage/store/string_column.h"
 #include <bit>
@@ -18,6 +19,104 @@ namespace storage {
 using string_index_t = DictionaryChunk::string_index_t;
 using string_offset_t = DictionaryChunk::string_offset_t;
 
+// Reads string data from a data chunk compressed with BlockCompression. The block header is read
+// once, and the most recently decompressed block is kept since strings are mostly scanned in order.
+class BlockCompressedDataReader {
+public:
+    BlockCompressedDataReader(Transaction* transaction, ColumnReadWriter& readWriter,
+        const ColumnChunkMetadata& metadata)
+        : transaction{transaction}, readWriter{readWriter}, metadata{metadata},
+          headerSize{BlockCompression::getHeaderSize(metadata.numValues)},
+          blockEnds(BlockCompression::getNumBlocks(metadata.numValues)),
+          cachedBlockIdx{INVALID_IDX} {
+        KU_ASSERT(BlockCompression::isBlockCompression(metadata.compMeta.compression));
+        readCompressedData(0 /*offset*/, headerSize, reinterpret_cast<uint8_t*>(blockEnds.data()),
+            PageAccessPattern::RANDOM);
+    }
+
+    // Reads the uncompressed data in [startOffset, endOffset).
+    void read(uint64_t startOffset, uint64_t endOffset, uint8_t* result) {
+        while (startOffset < endOffset) {
+            const auto blockIdx = startOffset / BlockCompression::BLOCK_SIZE;
+            const auto blockStart = blockIdx * BlockCompression::BLOCK_SIZE;
+            const auto blockSize = BlockCompression::getBlockSize(metadata.numValues, blockIdx);
+            const auto numBytesToRead =
+                std::min(endOffset, blockStart + blockSize) - startOffset;
+            if (numBytesToRead == blockSize && blockIdx != cachedBlockIdx) {
+                // Long strings covering whole blocks are decompressed directly into the result
+                decompressBlock(blockIdx, std::span(result, blockSize), PageAccessPattern::RANDOM);
+            } else {
+                if (blockIdx != cachedBlockIdx) {
+                    cachedBlock.resize(blockSize);
+                    decompressBlock(blockIdx, cachedBlock, PageAccessPattern::RANDOM);
+                    cachedBlockIdx = blockIdx;
+                }
+                memcpy(result, cachedBlock.data() + startOffset - blockStart, numBytesToRead);
+            }
+            result += numBytesToRead;
+            startOffset += numBytesToRead;
+        }
+    }
+
+    // Reads all of the uncompressed data.
+    void readAll(uint8_t* result) {
+        // Read all compressed blocks with one pass over the pages
+        compressedBuffer.resize(blockEnds.empty() ? 0 : blockEnds.back());
+        readCompressedData(headerSize, compressedBuffer.size(), compressedBuffer.data(),
+            PageAccessPattern::SCAN);
+        for (auto blockIdx = 0u; blockIdx < blockEnds.size(); blockIdx++) {
+            const auto compressedStart = getCompressedBlockStart(blockIdx);
+            BlockCompression::decompressBlock(metadata.compMeta.compression,
+                std::span(compressedBuffer.data() + compressedStart,
+                    blockEnds[blockIdx] - compressedStart),
+                std::span(result + blockIdx * BlockCompression::BLOCK_SIZE,
+                    BlockCompression::getBlockSize(metadata.numValues, blockIdx)));
+        }
+    }
+
+private:
+    uint64_t getCompressedBlockStart(uint64_t blockIdx) const {
+        return blockIdx == 0 ? 0 : blockEnds[blockIdx - 1];
+    }
+
+    void decompressBlock(uint64_t blockIdx, std::span<uint8_t> result,
+        PageAccessPattern accessPattern) {
+        const auto compressedStart = getCompressedBlockStart(blockIdx);
+        compressedBuffer.resize(blockEnds[blockIdx] - compressedStart);
+        readCompressedData(headerSize + compressedStart, compressedBuffer.size(),
+            compressedBuffer.data(), accessPattern);
+        BlockCompression::decompressBlock(metadata.compMeta.compression, compressedBuffer, result);
+    }
+
+    // Reads bytes of the compressed layout, starting from the given offset in the chunk's pages.
+    void readCompressedData(uint64_t offset, uint64_t numBytes, uint8_t* result,
+        PageAccessPattern accessPattern) const {
+        while (numBytes > 0) {
+            const auto pageIdx = offset / PAGE_SIZE;
+            const auto posInPage = offset % PAGE_SIZE;
+            const auto numBytesInPage = std::min(numBytes, PAGE_SIZE - posInPage);
+            KU_ASSERT(pageIdx < metadata.numPages);
+            readWriter.readFromPage(
+                transaction, metadata.pageIdx + pageIdx,
+                [&](const uint8_t* frame) { memcpy(result, frame + posInPage, numBytesInPage); },
+                accessPattern);
+            offset += numBytesInPage;
+            numBytes -= numBytesInPage;
+            result += numBytesInPage;
+        }
+    }
+
+private:
+    Transaction* transaction;
+    ColumnReadWriter& readWriter;
+    const ColumnChunkMetadata& metadata;
+    uint64_t headerSize;
+    std::vector<uint64_t> blockEnds;
+    std::vector<uint8_t> compressedBuffer;
+    idx_t cachedBlockIdx;
+    std::vector<uint8_t> cachedBlock;
+};
+
 DictionaryColumn::DictionaryColumn(const std::string& name, FileHandle* dataFH, MemoryManager* mm,
     ShadowFile* shadowFile, bool enableCompression) {
     auto dataColName = StorageUtils::getColumnName(name, StorageUtils::ColumnType::DATA, "");
@@ -37,8 +136,15 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& state,
     if (dataMetadata.numValues > stringDataChunk->getCapacity()) {
         stringDataChunk->resize(std::bit_ceil(dataMetadata.numValues));
     }
-    dataColumn->scan(transaction,
-        StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA), stringDataChunk);
+    auto& dataState = StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA);
+    if (BlockCompression::isBlockCompression(dataMetadata.compMeta.compression)) {
+        BlockCompressedDataReader reader{transaction, *dataColumn->columnReadWriter,
+            dataMetadata};
+        reader.readAll(stringDataChunk->getData());
+        stringDataChunk->setNumValues(dataMetadata.numValues);
+    } else {
+        dataColumn->scan(transaction, dataState, stringDataChunk);
+    }
 
     auto& offsetMetadata =
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET).metadata;
@@ -81,12 +187,18 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& offsetSt
     std::vector<string_offset_t> offsets(numOffsetsToScan + 1);
     scanOffsets(transaction, offsetState, offsets.data(), firstOffsetToScan, numOffsetsToScan,
         dataState.metadata.numValues);
+    std::optional<BlockCompressedDataReader> compressedDataReader;
+    if (BlockCompression::isBlockCompression(dataState.metadata.compMeta.compression)) {
+        compressedDataReader.emplace(transaction, *dataColumn->columnReadWriter,
+            dataState.metadata);
+    }
 
     for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
         auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
         auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
         scanValueToVector(transaction, dataState, startOffset, endOffset, resultVector,
-            offsetsToScan[pos].second);
+            offsetsToScan[pos].second,
+            compressedDataReader ? &compressedDataReader.value() : nullptr);
         auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
         // For each string which has the same index in the dictionary as the one we scanned,
         // copy the scanned string to its position in the result vector
@@ -122,12 +234,18 @@ void DictionaryColumn::scanOffsets(Transaction* transaction, const ChunkState& s
 }
 
 void DictionaryColumn::scanValueToVector(Transaction* transaction, const ChunkState& dataState,
-    uint64_t startOffset, uint64_t endOffset, ValueVector* resultVector, uint64_t offsetInVector) {
+    uint64_t startOffset, uint64_t endOffset, ValueVector* resultVector, uint64_t offsetInVector,
+    BlockCompressedDataReader* compressedDataReader) {
     KU_ASSERT(endOffset >= startOffset);
     // Add string to vector first and read directly into the vector
     auto& kuString =
         StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
-    dataColumn->scan(transaction, dataState, startOffset, endOffset, (uint8_t*)kuString.getData());
+    if (compressedDataReader) {
+        compressedDataReader->read(startOffset, endOffset, (uint8_t*)kuString.getData());
+    } else {
+        dataColumn->scan(transaction, dataState, startOffset, endOffset,
+            (uint8_t*)kuString.getData());
+    }
     // Update prefix to match the scanned string data
     if (!ku_string_t::isShortString(kuString.len)) {
         memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
@@ -152,7 +270,11 @@ bool DictionaryColumn::canCommitInPlace(const ChunkState& state, uint64_t numNew
 
 bool DictionaryColumn::canDataCommitInPlace(const ChunkState& dataState,
     uint64_t totalStringLengthToAdd) {
-    // Make sure there is sufficient space in the data chunk (not currently compressed)
+    // Block compressed data can only be rewritten as a whole
+    if (BlockCompression::isBlockCompression(dataState.metadata.compMeta.compression)) {
+        return false;
+    }
+    // Make sure there is sufficient space in the uncompressed data chunk
     auto totalStringDataAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
     if (totalStringDataAfterUpdate > dataState.metadata.numPages * PAGE_SIZE) {
         // Data cannot be updated in place
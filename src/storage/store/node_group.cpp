@@ -1,5 +1,7 @@
 #include "storage/store/node_group.h"
 
+#include <numeric>
+
 #include "common/types/types.h"
 #include "main/client_context.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -32,6 +34,12 @@ row_idx_t NodeGroup::append(const Transaction* transaction,
     const std::vector<ColumnChunk*>& chunkedGroup, row_idx_t startRowIdx,
     row_idx_t numRowsToAppend) {
     const auto lock = chunkedGroups.lock();
+    return append(lock, transaction, chunkedGroup, startRowIdx, numRowsToAppend);
+}
+
+row_idx_t NodeGroup::append(const UniqLock& lock, const Transaction* transaction,
+    const std::vector<ColumnChunk*>& chunkedGroup, row_idx_t startRowIdx,
+    row_idx_t numRowsToAppend) {
     const auto numRowsBeforeAppend = getNumRows();
     auto& mm = *transaction->getClientContext()->getMemoryManager();
     if (chunkedGroups.isEmpty(lock)) {
@@ -218,8 +226,8 @@ bool NodeGroup::hasDeletions(const Transaction* transaction) {
 
 void NodeGroup::addColumn(Transaction* transaction, TableAddColumnState& addColumnState,
     FileHandle* dataFH) {
-    dataTypes.push_back(addColumnState.propertyDefinition.getType().copy());
     const auto lock = chunkedGroups.lock();
+    dataTypes.push_back(addColumnState.propertyDefinition.getType().copy());
     for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
         chunkedGroup->addColumn(transaction, addColumnState, enableCompression, dataFH);
     }
@@ -245,6 +253,58 @@ void NodeGroup::flush(Transaction* transaction, FileHandle& dataFH) {
     chunkedGroups.resize(lock, 1);
 }
 
+void NodeGroup::preCheckpoint(MemoryManager& memoryManager, FileHandle& dataFH) {
+    const auto lock = chunkedGroups.lock();
+    // Only full node groups are flushed ahead, as no more rows can be appended to them. Node
+    // groups with persistent data are left to the checkpoint, which merges changes into it.
+    if (preCheckpointedGroup || !isFull() || chunkedGroups.isEmpty(lock) ||
+        chunkedGroups.getFirstGroup(lock)->getResidencyState() == ResidencyState::ON_DISK) {
+        return;
+    }
+    // Deletions don't change the data to flush, as they are checkpointed separately as metadata.
+    if (!hasOnlyCommittedInsertions(lock, true /* allowDeletions */)) {
+        return;
+    }
+    auto flushedGroup = std::make_unique<ChunkedNodeGroup>(memoryManager, dataTypes,
+        enableCompression, numRows, 0, ResidencyState::IN_MEMORY);
+    for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
+        flushedGroup->append(&DUMMY_CHECKPOINT_TRANSACTION, *chunkedGroup, 0,
+            chunkedGroup->getNumRows());
+    }
+    flushedGroup->flush(dataFH);
+    setPreCheckpointedGroup(lock, std::move(flushedGroup));
+}
+
+bool NodeGroup::hasOnlyCommittedInsertions(const UniqLock& lock, bool allowDeletions) {
+    for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
+        if (!chunkedGroup->hasOnlyCommittedInsertions(allowDeletions)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void NodeGroup::setPreCheckpointedGroup(const UniqLock&,
+    std::unique_ptr<ChunkedNodeGroup> flushedGroup) {
+    preCheckpointedGroup = std::move(flushedGroup);
+    numPreCheckpointedRows = numRows;
+    preCheckpointedColumnIDs.resize(dataTypes.size());
+    std::iota(preCheckpointedColumnIDs.begin(), preCheckpointedColumnIDs.end(), 0);
+}
+
+std::unique_ptr<ChunkedNodeGroup> NodeGroup::takePreCheckpointedGroup(const UniqLock& lock,
+    const std::vector<column_id_t>& columnIDs, bool allowDeletions) {
+    auto flushedGroup = std::move(preCheckpointedGroup);
+    // The flushed data is stale if rows were appended or updated since, or if columns were added
+    // or dropped. Its pages are left unused then, like pages of data rewritten out of place.
+    if (!flushedGroup || numRows != numPreCheckpointedRows ||
+        columnIDs != preCheckpointedColumnIDs ||
+        !hasOnlyCommittedInsertions(lock, allowDeletions)) {
+        return nullptr;
+    }
+    return flushedGroup;
+}
+
 void NodeGroup::checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state) {
     // We don't need to consider deletions here, as they are flushed separately as metadata.
     // TODO(Guodong): A special case can be all rows are deleted or rollbacked, then we can skip
@@ -253,11 +313,15 @@ void NodeGroup::checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointStat
     KU_ASSERT(chunkedGroups.getNumGroups(lock) >= 1);
     const auto firstGroup = chunkedGroups.getFirstGroup(lock);
     const auto hasPersistentData = firstGroup->getResidencyState() == ResidencyState::ON_DISK;
+    auto preCheckpointedChunkedGroup =
+        takePreCheckpointedGroup(lock, state.columnIDs, true /* allowDeletions */);
     // Re-populate version info here first.
     auto checkpointedVersionInfo = checkpointVersionInfo(lock, &DUMMY_CHECKPOINT_TRANSACTION);
     std::unique_ptr<ChunkedNodeGroup> checkpointedChunkedGroup;
     if (hasPersistentData) {
         checkpointedChunkedGroup = checkpointInMemAndOnDisk(memoryManager, lock, state);
+    } else if (preCheckpointedChunkedGroup) {
+        checkpointedChunkedGroup = std::move(preCheckpointedChunkedGroup);
     } else {
         checkpointedChunkedGroup = checkpointInMemOnly(memoryManager, lock, state);
     }
@@ -186,6 +186,22 @@ uint64_t NodeGroupCollection::getEstimatedMemoryUsage() {
     return estimatedMemUsage;
 }
 
+void NodeGroupCollection::preCheckpoint(MemoryManager& memoryManager) {
+    KU_ASSERT(dataFH);
+    // Node groups are only appended to the collection, so they can be flushed without holding the
+    // lock of the collection, which would block appends to it.
+    std::vector<NodeGroup*> groupsToFlush;
+    {
+        const auto lock = nodeGroups.lock();
+        for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+            groupsToFlush.push_back(nodeGroup.get());
+        }
+    }
+    for (const auto nodeGroup : groupsToFlush) {
+        nodeGroup->preCheckpoint(memoryManager, *dataFH);
+    }
+}
+
 void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
     NodeGroupCheckpointState& state) {
     KU_ASSERT(dataFH);
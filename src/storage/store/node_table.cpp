@@ -11,6 +11,7 @@
 #include "storage/local_storage/local_storage.h"
 #include "storage/local_storage/local_table.h"
 #include "storage/storage_manager.h"
+#include "storage/wal/local_wal.h"
 #include "transaction/transaction.h"
 
 using namespace kuzu::catalog;
@@ -60,6 +61,60 @@ NodeTable::NodeTable(const StorageManager* storageManager,
         getNodeTableColumnTypes(*this), enableCompression, storageManager->getDataFH(), deSer);
     initializePKIndex(storageManager->getDatabasePath(), nodeTableEntry,
         storageManager->isReadOnly(), vfs, context);
+    if (deSer) {
+        std::string key;
+        uint64_t numPropertyIndexes = 0;
+        deSer->validateDebuggingInfo(key, "property_indexes");
+        deSer->deserializeValue<uint64_t>(numPropertyIndexes);
+        for (auto i = 0u; i < numPropertyIndexes; i++) {
+            column_id_t columnID = INVALID_COLUMN_ID;
+            deSer->deserializeValue<column_id_t>(columnID);
+            columnIndexes[columnID] = std::make_shared<PropertyIndex>(
+                columns[columnID]->getDataType(), *dataFH, *shadowFile, deSer);
+        }
+        uint64_t numVectorIndexes = 0;
+        deSer->validateDebuggingInfo(key, "vector_indexes");
+        deSer->deserializeValue<uint64_t>(numVectorIndexes);
+        for (auto i = 0u; i < numVectorIndexes; i++) {
+            column_id_t columnID = INVALID_COLUMN_ID;
+            deSer->deserializeValue<column_id_t>(columnID);
+            const auto& vectorIndexes = nodeTableEntry->getVectorIndexes();
+            const auto vectorIndex = std::find_if(vectorIndexes.begin(), vectorIndexes.end(),
+                [&](const auto& index) {
+                    return nodeTableEntry->getColumnID(index.propertyName) == columnID;
+                });
+            KU_ASSERT(vectorIndex != vectorIndexes.end());
+            columnIndexes[columnID] = std::make_shared<HNSWIndex>(columns[columnID]->getDataType(),
+                vectorIndex->metric, memoryManager, *dataFH, *shadowFile, deSer);
+        }
+        uint64_t numFTSIndexes = 0;
+        deSer->validateDebuggingInfo(key, "fts_indexes");
+        deSer->deserializeValue<uint64_t>(numFTSIndexes);
+        for (auto i = 0u; i < numFTSIndexes; i++) {
+            column_id_t columnID = INVALID_COLUMN_ID;
+            deSer->deserializeValue<column_id_t>(columnID);
+            columnIndexes[columnID] = std::make_shared<FTSIndex>(*dataFH, *shadowFile, deSer);
+        }
+    }
+    for (auto& propertyName : nodeTableEntry->getIndexedProperties()) {
+        // Indexes created since the last checkpoint are rebuilt.
+        const auto columnID = nodeTableEntry->getColumnID(propertyName);
+        if (!columnIndexes.contains(columnID)) {
+            buildPropertyIndex(&DUMMY_CHECKPOINT_TRANSACTION, columnID);
+        }
+    }
+    for (auto& vectorIndex : nodeTableEntry->getVectorIndexes()) {
+        const auto columnID = nodeTableEntry->getColumnID(vectorIndex.propertyName);
+        if (!columnIndexes.contains(columnID)) {
+            buildVectorIndex(&DUMMY_CHECKPOINT_TRANSACTION, columnID, vectorIndex.metric);
+        }
+    }
+    for (auto& propertyName : nodeTableEntry->getFTSIndexedProperties()) {
+        const auto columnID = nodeTableEntry->getColumnID(propertyName);
+        if (!columnIndexes.contains(columnID)) {
+            buildFTSIndex(&DUMMY_CHECKPOINT_TRANSACTION, columnID);
+        }
+    }
 }
 
 std::unique_ptr<NodeTable> NodeTable::loadTable(Deserializer& deSer, const Catalog& catalog,
@@ -184,7 +239,7 @@ void NodeTable::insert(Transaction* transaction, TableInsertState& insertState)
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
         KU_ASSERT(transaction->getClientContext());
-        auto& wal = transaction->getClientContext()->getStorageManager()->getWAL();
+        auto& wal = transaction->getLocalWAL();
         wal.logTableInsertion(tableID, TableType::NODE,
             nodeInsertState.nodeIDVector.state->getSelVector().getSelSize(),
             insertState.propertyVectors);
@@ -215,6 +270,12 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         if (nodeUpdateState.columnID == pkColumnID && pkIndex) {
             insertPK(transaction, nodeUpdateState.nodeIDVector, nodeUpdateState.propertyVector);
         }
+        if (const auto columnIndex = getColumnIndex(nodeUpdateState.columnID)) {
+            // The old value stays a candidate until the next checkpoint. Readers re-check the
+            // predicate on candidates.
+            columnIndex->insert(nodeUpdateState.propertyVector,
+                nodeUpdateState.propertyVector.state->getSelVector()[0], nodeOffset);
+        }
         const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(nodeOffset);
         const auto rowIdxInGroup =
             nodeOffset - StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
@@ -225,7 +286,7 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
         KU_ASSERT(transaction->getClientContext());
-        auto& wal = transaction->getClientContext()->getStorageManager()->getWAL();
+        auto& wal = transaction->getLocalWAL();
         wal.logNodeUpdate(tableID, nodeUpdateState.columnID, nodeOffset,
             &nodeUpdateState.propertyVector);
     }
@@ -251,13 +312,18 @@ bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
         const auto rowIdxInGroup =
             nodeOffset - StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
         isDeleted = nodeGroups->getNodeGroup(nodeGroupIdx)->delete_(transaction, rowIdxInGroup);
+        if (isDeleted) {
+            for (auto& [columnID, columnIndex] : getColumnIndexes()) {
+                columnIndex->markStale(nodeOffset);
+            }
+        }
     }
     if (isDeleted) {
         hasChanges = true;
         if (transaction->shouldLogToWAL()) {
             KU_ASSERT(transaction->isWriteTransaction());
             KU_ASSERT(transaction->getClientContext());
-            auto& wal = transaction->getClientContext()->getStorageManager()->getWAL();
+            auto& wal = transaction->getLocalWAL();
             wal.logNodeDeletion(tableID, nodeOffset, &nodeDeleteState.pkVector);
         }
     }
@@ -283,7 +349,36 @@ void NodeTable::addColumn(Transaction* transaction, TableAddColumnState& addColu
 std::pair<offset_t, offset_t> NodeTable::appendToLastNodeGroup(Transaction* transaction,
     ChunkedNodeGroup& chunkedGroup) {
     hasChanges = true;
-    return nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    const auto [startOffset, numRowsAppended] =
+        nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    insertIntoColumnIndexes(chunkedGroup, startOffset, numRowsAppended);
+    return {startOffset, numRowsAppended};
+}
+
+void NodeTable::insertIntoColumnIndexes(const ChunkedNodeGroup& chunkedGroup,
+    offset_t startOffset, row_idx_t numRows) const {
+    const auto columnIndexesToInsert = getColumnIndexes();
+    if (columnIndexesToInsert.empty()) {
+        return;
+    }
+    const auto state = std::make_shared<DataChunkState>();
+    ValueVector nodeIDVector(LogicalType::INTERNAL_ID());
+    nodeIDVector.setState(state);
+    for (auto& [columnID, columnIndex] : columnIndexesToInsert) {
+        ValueVector keyVector(columns[columnID]->getDataType().copy(), memoryManager);
+        keyVector.setState(state);
+        const auto& chunkData = chunkedGroup.getColumnChunk(columnID).getData();
+        for (row_idx_t row = 0; row < numRows; row += DEFAULT_VECTOR_CAPACITY) {
+            const auto numRowsToScan = std::min(numRows - row, DEFAULT_VECTOR_CAPACITY);
+            state->getSelVectorUnsafe().setSelSize(numRowsToScan);
+            keyVector.resetAuxiliaryBuffer();
+            chunkData.scan(keyVector, row, numRowsToScan);
+            for (auto i = 0u; i < numRowsToScan; i++) {
+                nodeIDVector.setValue(i, nodeID_t{startOffset + row + i, tableID});
+            }
+            columnIndex->insert(keyVector, nodeIDVector);
+        }
+    }
 }
 
 void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
@@ -317,9 +412,19 @@ void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
         numLocalRows += localNodeGroup->getNumRows();
     }
     // 3. Scan pk column for newly inserted tuples that are not deleted and insert into pk index.
+    // Uniqueness is checked against the latest committed state instead of the snapshot of this
+    // transaction, as concurrent transactions may have committed the same keys after it started.
+    // Columns with secondary indexes are scanned alongside to index the new tuples.
+    const Transaction latestTransaction{TransactionType::WRITE, transaction->getID(),
+        transaction->getCommitTS()};
+    const auto columnIndexesToInsert = getColumnIndexes();
     std::vector<column_id_t> columnIDs{getPKColumnID()};
     std::vector<LogicalType> types;
     types.push_back(columns[pkColumnID]->getDataType().copy());
+    for (auto& [columnID, _] : columnIndexesToInsert) {
+        columnIDs.push_back(columnID);
+        types.push_back(columns[columnID]->getDataType().copy());
+    }
     const auto dataChunk = constructDataChunk({types});
     ValueVector nodeIDVector(LogicalType::INTERNAL_ID());
     nodeIDVector.setState(dataChunk->state);
@@ -345,7 +450,11 @@ void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
             for (auto i = 0u; i < scanResult.numRows; i++) {
                 nodeIDVector.setValue(i, nodeID_t{startNodeOffset + i, tableID});
             }
-            insertPK(transaction, nodeIDVector, *scanState->outputVectors[0]);
+            insertPK(transaction, nodeIDVector, *scanState->outputVectors[0], &latestTransaction);
+            for (auto i = 0u; i < columnIndexesToInsert.size(); i++) {
+                columnIndexesToInsert[i].second->insert(*scanState->outputVectors[i + 1],
+                    nodeIDVector);
+            }
             startNodeOffset += scanResult.numRows;
         }
         nodeGroupToScan++;
@@ -355,7 +464,10 @@ void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
 }
 
 void NodeTable::insertPK(const Transaction* transaction, const ValueVector& nodeIDVector,
-    const ValueVector& pkVector) const {
+    const ValueVector& pkVector, const Transaction* visibilityTransaction) const {
+    if (!visibilityTransaction) {
+        visibilityTransaction = transaction;
+    }
     for (auto i = 0u; i < nodeIDVector.state->getSelVector().getSelSize(); i++) {
         const auto nodeIDPos = nodeIDVector.state->getSelVector()[i];
         const auto offset = nodeIDVector.readNodeOffset(nodeIDPos);
@@ -364,7 +476,16 @@ void NodeTable::insertPK(const Transaction* transaction, const ValueVector& node
             throw RuntimeException(ExceptionMessage::nullPKException());
         }
         if (!pkIndex->insert(transaction, const_cast<ValueVector*>(&pkVector), pkPos, offset,
-                [&](offset_t offset_) { return isVisible(transaction, offset_); })) {
+                [&](offset_t offset_) { return isVisible(visibilityTransaction, offset_); })) {
+            offset_t existingOffset = INVALID_OFFSET;
+            if (visibilityTransaction != transaction &&
+                !pkIndex->lookup(transaction, const_cast<ValueVector*>(&pkVector), pkPos,
+                    existingOffset,
+                    [&](offset_t offset_) { return isVisible(transaction, offset_); })) {
+                throw RuntimeException(stringFormat(
+                    "Write-write conflict: primary key {} is inserted by a concurrent transaction.",
+                    pkVector.getAsValue(pkPos)->toString()));
+            }
             throw RuntimeException(
                 ExceptionMessage::duplicatePKException(pkVector.getAsValue(pkPos)->toString()));
         }
@@ -372,6 +493,24 @@ void NodeTable::insertPK(const Transaction* transaction, const ValueVector& node
 }
 
 void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
+    // Keep the secondary indexes still defined in the catalog, keyed by property name as column
+    // ids can be changed by vacuuming below. Indexes dropped or rolled back are released here.
+    std::unordered_map<std::string, std::shared_ptr<ColumnIndex>> indexesToKeep;
+    const auto nodeTableEntry = tableEntry->ptrCast<NodeTableCatalogEntry>();
+    auto keepIndex = [&](const std::string& propertyName) {
+        if (auto columnIndex = getColumnIndex(tableEntry->getColumnID(propertyName))) {
+            indexesToKeep.emplace(propertyName, std::move(columnIndex));
+        }
+    };
+    for (auto& propertyName : nodeTableEntry->getIndexedProperties()) {
+        keepIndex(propertyName);
+    }
+    for (auto& vectorIndex : nodeTableEntry->getVectorIndexes()) {
+        keepIndex(vectorIndex.propertyName);
+    }
+    for (auto& propertyName : nodeTableEntry->getFTSIndexedProperties()) {
+        keepIndex(propertyName);
+    }
     if (hasChanges) {
         // Deleted columns are vaccumed and not checkpointed or serialized.
         std::vector<std::unique_ptr<Column>> checkpointColumns;
@@ -389,12 +528,133 @@ void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
         columns = std::move(state.columns);
         tableEntry->vacuumColumnIDs(0);
     }
+    std::unique_lock lck{columnIndexesMtx};
+    columnIndexes.clear();
+    for (auto& [propertyName, columnIndex] : indexesToKeep) {
+        columnIndexes.emplace(tableEntry->getColumnID(propertyName), std::move(columnIndex));
+    }
+    lck.unlock();
+    for (auto& [columnID, columnIndex] : getColumnIndexes()) {
+        columnIndex->checkpoint(
+            [&](node_group_idx_t nodeGroupIdx, const index_scan_func_t& func) {
+                scanColumnForIndex(&DUMMY_CHECKPOINT_TRANSACTION, columnID, nodeGroupIdx, func);
+            });
+    }
     serialize(ser);
 }
 
+void NodeTable::buildPropertyIndex(Transaction* transaction, column_id_t columnID) {
+    KU_ASSERT(columnID < columns.size() && columns[columnID]);
+    buildColumnIndex(transaction, columnID,
+        std::make_shared<PropertyIndex>(columns[columnID]->getDataType(), *dataFH, *shadowFile));
+}
+
+void NodeTable::buildVectorIndex(Transaction* transaction, column_id_t columnID,
+    VectorDistanceMetric metric) {
+    KU_ASSERT(columnID < columns.size() && columns[columnID]);
+    buildColumnIndex(transaction, columnID,
+        std::make_shared<HNSWIndex>(columns[columnID]->getDataType(), metric, memoryManager,
+            *dataFH, *shadowFile));
+}
+
+void NodeTable::buildFTSIndex(Transaction* transaction, column_id_t columnID) {
+    KU_ASSERT(columnID < columns.size() && columns[columnID]);
+    buildColumnIndex(transaction, columnID, std::make_shared<FTSIndex>(*dataFH, *shadowFile));
+}
+
+void NodeTable::buildColumnIndex(Transaction* transaction, column_id_t columnID,
+    std::shared_ptr<ColumnIndex> columnIndex) {
+    {
+        std::unique_lock lck{columnIndexesMtx};
+        columnIndexes[columnID] = columnIndex;
+    }
+    const auto numNodeGroups = nodeGroups->getNumNodeGroups();
+    for (node_group_idx_t nodeGroupIdx = 0; nodeGroupIdx < numNodeGroups; nodeGroupIdx++) {
+        scanColumnForIndex(transaction, columnID, nodeGroupIdx,
+            [&](const ValueVector& keyVector, const ValueVector& nodeIDVector) {
+                columnIndex->insert(keyVector, nodeIDVector);
+            });
+    }
+}
+
+void NodeTable::scanColumnForIndex(Transaction* transaction, column_id_t columnID,
+    node_group_idx_t nodeGroupIdx, const index_scan_func_t& func) {
+    std::vector<LogicalType> types;
+    types.push_back(columns[columnID]->getDataType().copy());
+    const auto dataChunk = constructDataChunk(types);
+    ValueVector nodeIDVector(LogicalType::INTERNAL_ID());
+    nodeIDVector.setState(dataChunk->state);
+    const auto scanState = std::make_unique<NodeTableScanState>(tableID,
+        std::vector<column_id_t>{columnID}, std::vector<Column*>{columns[columnID].get()});
+    scanState->outputVectors.push_back(dataChunk->valueVectors[0].get());
+    scanState->nodeIDVector = &nodeIDVector;
+    scanState->rowIdxVector->state = dataChunk->state;
+    scanState->outState = dataChunk->state.get();
+    scanState->source = TableScanSource::COMMITTED;
+    scanState->nodeGroupIdx = nodeGroupIdx;
+    initScanState(transaction, *scanState);
+    while (scanInternal(transaction, *scanState)) {
+        func(*scanState->outputVectors[0], nodeIDVector);
+    }
+}
+
+std::shared_ptr<PropertyIndex> NodeTable::getPropertyIndex(column_id_t columnID) const {
+    return std::dynamic_pointer_cast<PropertyIndex>(getColumnIndex(columnID));
+}
+
+std::shared_ptr<HNSWIndex> NodeTable::getVectorIndex(column_id_t columnID) const {
+    return std::dynamic_pointer_cast<HNSWIndex>(getColumnIndex(columnID));
+}
+
+std::shared_ptr<FTSIndex> NodeTable::getFTSIndex(column_id_t columnID) const {
+    return std::dynamic_pointer_cast<FTSIndex>(getColumnIndex(columnID));
+}
+
+std::shared_ptr<ColumnIndex> NodeTable::getColumnIndex(column_id_t columnID) const {
+    std::unique_lock lck{columnIndexesMtx};
+    const auto iter = columnIndexes.find(columnID);
+    return iter == columnIndexes.end() ? nullptr : iter->second;
+}
+
+std::vector<std::pair<column_id_t, std::shared_ptr<ColumnIndex>>>
+NodeTable::getColumnIndexes() const {
+    std::unique_lock lck{columnIndexesMtx};
+    return {columnIndexes.begin(), columnIndexes.end()};
+}
+
 void NodeTable::serialize(Serializer& serializer) const {
     Table::serialize(serializer);
     nodeGroups->serialize(serializer);
+    std::vector<std::pair<column_id_t, std::shared_ptr<PropertyIndex>>> propertyIndexes;
+    std::vector<std::pair<column_id_t, std::shared_ptr<HNSWIndex>>> vectorIndexes;
+    std::vector<std::pair<column_id_t, std::shared_ptr<FTSIndex>>> ftsIndexes;
+    for (auto& [columnID, columnIndex] : getColumnIndexes()) {
+        if (auto propertyIndex = std::dynamic_pointer_cast<PropertyIndex>(columnIndex)) {
+            propertyIndexes.emplace_back(columnID, std::move(propertyIndex));
+        } else if (auto vectorIndex = std::dynamic_pointer_cast<HNSWIndex>(columnIndex)) {
+            vectorIndexes.emplace_back(columnID, std::move(vectorIndex));
+        } else if (auto ftsIndex = std::dynamic_pointer_cast<FTSIndex>(columnIndex)) {
+            ftsIndexes.emplace_back(columnID, std::move(ftsIndex));
+        }
+    }
+    serializer.writeDebuggingInfo("property_indexes");
+    serializer.serializeValue<uint64_t>(propertyIndexes.size());
+    for (auto& [columnID, propertyIndex] : propertyIndexes) {
+        serializer.serializeValue<column_id_t>(columnID);
+        propertyIndex->serialize(serializer);
+    }
+    serializer.writeDebuggingInfo("vector_indexes");
+    serializer.serializeValue<uint64_t>(vectorIndexes.size());
+    for (auto& [columnID, vectorIndex] : vectorIndexes) {
+        serializer.serializeValue<column_id_t>(columnID);
+        vectorIndex->serialize(serializer);
+    }
+    serializer.writeDebuggingInfo("fts_indexes");
+    serializer.serializeValue<uint64_t>(ftsIndexes.size());
+    for (auto& [columnID, ftsIndex] : ftsIndexes) {
+        serializer.serializeValue<column_id_t>(columnID);
+        ftsIndex->serialize(serializer);
+    }
 }
 
 bool NodeTable::isVisible(const Transaction* transaction, offset_t offset) const {
@@ -8,6 +8,7 @@
 #include "storage/storage_manager.h"
 #include "storage/store/node_table.h"
 #include "storage/store/rel_table_data.h"
+#include "storage/wal/local_wal.h"
 #include "transaction/transaction.h"
 
 using namespace kuzu::catalog;
@@ -174,7 +175,7 @@ void RelTable::insert(Transaction* transaction, TableInsertState& insertState) {
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
         KU_ASSERT(transaction->getClientContext());
-        auto& wal = transaction->getClientContext()->getStorageManager()->getWAL();
+        auto& wal = transaction->getLocalWAL();
         const auto& relInsertState = insertState.cast<RelTableInsertState>();
         std::vector<ValueVector*> vectorsToLog;
         vectorsToLog.push_back(&relInsertState.srcNodeIDVector);
@@ -207,7 +208,7 @@ void RelTable::update(Transaction* transaction, TableUpdateState& updateState) {
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
         KU_ASSERT(transaction->getClientContext());
-        auto& wal = transaction->getClientContext()->getStorageManager()->getWAL();
+        auto& wal = transaction->getLocalWAL();
         wal.logRelUpdate(tableID, relUpdateState.columnID, &relUpdateState.srcNodeIDVector,
             &relUpdateState.dstNodeIDVector, &relUpdateState.relIDVector,
             &relUpdateState.propertyVector);
@@ -239,7 +240,7 @@ bool RelTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
         if (transaction->shouldLogToWAL()) {
             KU_ASSERT(transaction->isWriteTransaction());
             KU_ASSERT(transaction->getClientContext());
-            auto& wal = transaction->getClientContext()->getStorageManager()->getWAL();
+            auto& wal = transaction->getLocalWAL();
             wal.logRelDelete(tableID, &relDeleteState.srcNodeIDVector,
                 &relDeleteState.dstNodeIDVector, &relDeleteState.relIDVector);
         }
@@ -278,7 +279,7 @@ void RelTable::detachDelete(Transaction* transaction, RelDataDirection direction
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
         KU_ASSERT(transaction->getClientContext());
-        auto& wal = transaction->getClientContext()->getStorageManager()->getWAL();
+        auto& wal = transaction->getLocalWAL();
         wal.logRelDetachDelete(tableID, direction, &deleteState->srcNodeIDVector);
     }
     hasChanges = true;
@@ -17,6 +17,7 @@ namespace storage {
 
 VectorUpdateInfo* UpdateInfo::update(MemoryManager& memoryManager, const Transaction* transaction,
     const idx_t vectorIdx, const sel_t rowIdxInVector, const ValueVector& values) {
+    std::unique_lock lck{mtx};
     auto& vectorUpdateInfo = getOrCreateVectorInfo(memoryManager, transaction, vectorIdx,
         rowIdxInVector, values.dataType);
     // Check if the row is already updated in this transaction. Overwrite if so.
@@ -36,10 +37,17 @@ VectorUpdateInfo* UpdateInfo::update(MemoryManager& memoryManager, const Transac
         vectorUpdateInfo.data->write(&values, values.state->getSelVector()[0],
             vectorUpdateInfo.numRowsUpdated++);
     }
+    vectorUpdateInfo.rowsWritten.set(rowIdxInVector);
     return &vectorUpdateInfo;
 }
 
 VectorUpdateInfo* UpdateInfo::getVectorInfo(const Transaction* transaction, idx_t idx) const {
+    std::unique_lock lck{mtx};
+    return getVectorInfoNoLock(transaction, idx);
+}
+
+VectorUpdateInfo* UpdateInfo::getVectorInfoNoLock(const Transaction* transaction,
+    idx_t idx) const {
     if (idx >= vectorsInfo.size() || !vectorsInfo[idx]) {
         return nullptr;
     }
@@ -59,23 +67,120 @@ VectorUpdateInfo* UpdateInfo::getVectorInfo(const Transaction* transaction, idx_
 }
 
 row_idx_t UpdateInfo::getNumUpdatedRows(const Transaction* transaction) const {
+    std::unique_lock lck{mtx};
     row_idx_t numUpdatedRows = 0u;
     for (auto i = 0u; i < vectorsInfo.size(); i++) {
-        if (const auto vectorInfo = getVectorInfo(transaction, i)) {
+        if (const auto vectorInfo = getVectorInfoNoLock(transaction, i)) {
             numUpdatedRows += vectorInfo->numRowsUpdated;
         }
     }
     return numUpdatedRows;
 }
 
+bool UpdateInfo::isUpdatedByOtherTransaction(const Transaction* transaction, idx_t vectorIdx,
+    sel_t rowIdxInVector) const {
+    std::unique_lock lck{mtx};
+    if (vectorIdx >= vectorsInfo.size()) {
+        return false;
+    }
+    for (auto current = vectorsInfo[vectorIdx].get(); current; current = current->getPrev()) {
+        if (current->version != transaction->getID() &&
+            current->version > transaction->getStartTS() &&
+            current->rowsWritten[rowIdxInVector]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UpdateInfo::commitVectorInfo(idx_t vectorIdx, VectorUpdateInfo& vectorInfo,
+    transaction_t commitTS) {
+    std::unique_lock lck{mtx};
+    if (vectorInfo.version < Transaction::START_TRANSACTION_ID) {
+        // Already committed through another undo record of the same version.
+        return;
+    }
+    KU_ASSERT(vectorIdx < vectorsInfo.size() && vectorsInfo[vectorIdx]);
+    // Committed versions are ordered by commit timestamp from the head of the chain, so the first
+    // committed one is the latest.
+    VectorUpdateInfo* latestCommitted = nullptr;
+    for (auto current = vectorsInfo[vectorIdx].get(); current; current = current->getPrev()) {
+        if (current != &vectorInfo && current->version < Transaction::START_TRANSACTION_ID) {
+            latestCommitted = current;
+            break;
+        }
+    }
+    if (latestCommitted) {
+        std::array<sel_t, DEFAULT_VECTOR_CAPACITY> posInVectorInfo{};
+        posInVectorInfo.fill(INVALID_SEL);
+        for (auto i = 0u; i < vectorInfo.numRowsUpdated; i++) {
+            posInVectorInfo[vectorInfo.rowsInVector[i]] = i;
+        }
+        for (auto i = 0u; i < latestCommitted->numRowsUpdated; i++) {
+            const auto row = latestCommitted->rowsInVector[i];
+            if (vectorInfo.rowsWritten[row]) {
+                continue;
+            }
+            if (posInVectorInfo[row] == INVALID_SEL) {
+                vectorInfo.rowsInVector[vectorInfo.numRowsUpdated] = row;
+                vectorInfo.data->append(latestCommitted->data.get(), i, 1);
+                vectorInfo.numRowsUpdated++;
+            } else {
+                vectorInfo.data->write(latestCommitted->data.get(), i, posInVectorInfo[row], 1);
+            }
+        }
+    }
+    if (vectorsInfo[vectorIdx].get() != &vectorInfo) {
+        // Move the version to the head of the chain.
+        const auto newerVersion = vectorInfo.getNext();
+        auto self = newerVersion->movePrev();
+        KU_ASSERT(self.get() == &vectorInfo);
+        if (auto olderVersion = vectorInfo.movePrev()) {
+            olderVersion->setNext(newerVersion);
+            newerVersion->setPrev(std::move(olderVersion));
+        }
+        vectorInfo.setNext(nullptr);
+        vectorsInfo[vectorIdx]->setNext(&vectorInfo);
+        vectorInfo.setPrev(std::move(vectorsInfo[vectorIdx]));
+        vectorsInfo[vectorIdx] = std::move(self);
+    }
+    vectorInfo.version = commitTS;
+}
+
+void UpdateInfo::rollbackVectorInfo(const Transaction* transaction, idx_t vectorIdx,
+    const VectorUpdateInfo* vectorInfo) {
+    std::unique_lock lck{mtx};
+    if (getVectorInfoNoLock(transaction, vectorIdx) != vectorInfo) {
+        // The version has already been removed through another undo record of the same version.
+        return;
+    }
+    if (const auto newerVersion = vectorInfo->getNext()) {
+        // Has newer versions. Simply remove the current one from the version chain.
+        auto self = newerVersion->movePrev();
+        if (auto olderVersion = self->movePrev()) {
+            olderVersion->setNext(newerVersion);
+            newerVersion->setPrev(std::move(olderVersion));
+        }
+    } else {
+        // This is the begin of the version chain.
+        KU_ASSERT(vectorsInfo[vectorIdx].get() == vectorInfo);
+        auto olderVersion = vectorsInfo[vectorIdx]->movePrev();
+        if (olderVersion) {
+            olderVersion->setNext(nullptr);
+        }
+        vectorsInfo[vectorIdx] = std::move(olderVersion);
+    }
+}
+
 bool UpdateInfo::hasUpdates(const Transaction* transaction, row_idx_t startRow,
     length_t numRows) const {
+    std::unique_lock lck{mtx};
     auto [startVector, rowInStartVector] =
         StorageUtils::getQuotientRemainder(startRow, DEFAULT_VECTOR_CAPACITY);
     auto [endVectorIdx, rowInEndVector] =
         StorageUtils::getQuotientRemainder(startRow + numRows, DEFAULT_VECTOR_CAPACITY);
     for (idx_t vectorIdx = startVector; vectorIdx <= endVectorIdx; ++vectorIdx) {
-        const auto updateVector = getVectorInfo(transaction, vectorIdx);
+        const auto updateVector = getVectorInfoNoLock(transaction, vectorIdx);
         if (!updateVector || updateVector->numRowsUpdated == 0) {
             continue;
         }
@@ -99,14 +204,9 @@ VectorUpdateInfo& UpdateInfo::getOrCreateVectorInfo(MemoryManager& memoryManager
     if (vectorIdx >= vectorsInfo.size()) {
         vectorsInfo.resize(vectorIdx + 1);
     }
-    if (!vectorsInfo[vectorIdx]) {
-        vectorsInfo[vectorIdx] = std::make_unique<VectorUpdateInfo>(memoryManager,
-            transaction->getID(), dataType.copy());
-        return *vectorsInfo[vectorIdx];
-    }
-    auto* current = vectorsInfo[vectorIdx].get();
     VectorUpdateInfo* info = nullptr;
-    while (current) {
+    VectorUpdateInfo* visibleInfo = nullptr;
+    for (auto current = vectorsInfo[vectorIdx].get(); current; current = current->getPrev()) {
         if (current->version == transaction->getID()) {
             // Same transaction.
             KU_ASSERT(current->version >= Transaction::START_TRANSACTION_ID);
@@ -114,30 +214,33 @@ VectorUpdateInfo& UpdateInfo::getOrCreateVectorInfo(MemoryManager& memoryManager
         } else if (current->version > transaction->getStartTS()) {
             // Potentially there can be conflicts. `current` can be uncommitted transaction (version
             // is transaction ID) or committed transaction started after this transaction.
-            for (auto i = 0u; i < current->numRowsUpdated; i++) {
-                if (current->rowsInVector[i] == rowIdxInVector) {
-                    throw RuntimeException("Write-write conflict of updating the same row.");
-                }
+            if (current->rowsWritten[rowIdxInVector]) {
+                throw RuntimeException("Write-write conflict of updating the same row.");
             }
+        } else if (!visibleInfo) {
+            visibleInfo = current;
         }
-        current = current->next;
     }
     if (!info) {
         // Create a new version here.
         auto newInfo = std::make_unique<VectorUpdateInfo>(memoryManager, transaction->getID(),
             dataType.copy());
-        vectorsInfo[vectorIdx]->next = newInfo.get();
-        newInfo->prev = std::move(vectorsInfo[vectorIdx]);
-        vectorsInfo[vectorIdx] = std::move(newInfo);
-        info = vectorsInfo[vectorIdx].get();
-        if (info->prev) {
-            // Copy the data from the previous version.
-            for (auto i = 0u; i < info->prev->numRowsUpdated; i++) {
-                info->rowsInVector[i] = info->prev->rowsInVector[i];
+        if (visibleInfo) {
+            // Copy the data from the version visible to this transaction. Versions of uncommitted
+            // transactions or transactions committed after this one started must not leak into it.
+            // Rows committed in between are carried over when this version commits.
+            for (auto i = 0u; i < visibleInfo->numRowsUpdated; i++) {
+                newInfo->rowsInVector[i] = visibleInfo->rowsInVector[i];
             }
-            info->data->append(info->prev->data.get(), 0, info->prev->numRowsUpdated);
-            info->numRowsUpdated = info->prev->numRowsUpdated;
+            newInfo->data->append(visibleInfo->data.get(), 0, visibleInfo->numRowsUpdated);
+            newInfo->numRowsUpdated = visibleInfo->numRowsUpdated;
+        }
+        if (vectorsInfo[vectorIdx]) {
+            vectorsInfo[vectorIdx]->setNext(newInfo.get());
         }
+        newInfo->setPrev(std::move(vectorsInfo[vectorIdx]));
+        vectorsInfo[vectorIdx] = std::move(newInfo);
+        info = vectorsInfo[vectorIdx].get();
     }
     return *info;
 }
@@ -134,6 +134,20 @@ bool VectorVersionInfo::isDeleted(const transaction_t startTS, const transaction
     }
 }
 
+bool VectorVersionInfo::isDeletedByOtherTransaction(const transaction_t transactionID,
+    const row_idx_t rowIdx) const {
+    if (deletionStatus == DeletionStatus::NO_DELETED) {
+        return false;
+    }
+    transaction_t deletion = INVALID_TRANSACTION;
+    if (isSameDeletionVersion()) {
+        deletion = sameDeletionVersion;
+    } else if (deletedVersions) {
+        deletion = deletedVersions->operator[](rowIdx);
+    }
+    return deletion != INVALID_TRANSACTION && deletion != transactionID;
+}
+
 bool VectorVersionInfo::isInserted(const transaction_t startTS, const transaction_t transactionID,
     const row_idx_t rowIdx) const {
     switch (insertionStatus) {
@@ -488,6 +502,17 @@ bool VersionInfo::isDeleted(const transaction::Transaction* transaction,
     return false;
 }
 
+bool VersionInfo::isDeletedByOtherTransaction(const transaction::Transaction* transaction,
+    row_idx_t rowInChunk) const {
+    auto [vectorIdx, rowInVector] =
+        StorageUtils::getQuotientRemainder(rowInChunk, DEFAULT_VECTOR_CAPACITY);
+    const auto vectorVersion = getVectorVersionInfo(vectorIdx);
+    if (vectorVersion) {
+        return vectorVersion->isDeletedByOtherTransaction(transaction->getID(), rowInVector);
+    }
+    return false;
+}
+
 bool VersionInfo::isInserted(const transaction::Transaction* transaction,
     row_idx_t rowInChunk) const {
     auto [vectorIdx, rowInVector] =
@@ -225,7 +225,9 @@ void UndoBuffer::commitVersionInfo(UndoRecordType recordType, const uint8_t* rec
 
 void UndoBuffer::commitVectorUpdateInfo(const uint8_t* record, transaction_t commitTS) const {
     auto& undoRecord = *reinterpret_cast<VectorUpdateRecord const*>(record);
-    undoRecord.vectorUpdateInfo->version = commitTS;
+    KU_ASSERT(undoRecord.updateInfo);
+    undoRecord.updateInfo->commitVectorInfo(undoRecord.vectorIdx, *undoRecord.vectorUpdateInfo,
+        commitTS);
 }
 
 void UndoBuffer::rollbackRecord(const UndoRecordType recordType, const uint8_t* record) {
@@ -304,25 +306,8 @@ void UndoBuffer::rollbackVersionInfo(UndoRecordType recordType, const uint8_t* r
 void UndoBuffer::rollbackVectorUpdateInfo(const uint8_t* record) const {
     auto& undoRecord = *reinterpret_cast<VectorUpdateRecord const*>(record);
     KU_ASSERT(undoRecord.updateInfo);
-    if (undoRecord.updateInfo->getVectorInfo(transaction, undoRecord.vectorIdx) !=
-        undoRecord.vectorUpdateInfo) {
-        // The version chain has been updated. No need to rollback.
-        return;
-    }
-    if (undoRecord.vectorUpdateInfo->getNext()) {
-        // Has newer versions. Simply remove the current one from the version chain.
-        const auto newerVersion = undoRecord.vectorUpdateInfo->getNext();
-        auto prevVersion = undoRecord.vectorUpdateInfo->movePrev();
-        prevVersion->next = newerVersion;
-        newerVersion->setPrev(std::move(prevVersion));
-    } else {
-        // This is the begin of the version chain.
-        if (auto prevVersion = undoRecord.vectorUpdateInfo->movePrev()) {
-            undoRecord.updateInfo->setVectorInfo(undoRecord.vectorIdx, std::move(prevVersion));
-        } else {
-            undoRecord.updateInfo->clearVectorInfo(undoRecord.vectorIdx);
-        }
-    }
+    undoRecord.updateInfo->rollbackVectorInfo(transaction, undoRecord.vectorIdx,
+        undoRecord.vectorUpdateInfo);
 }
 
 } // namespace storage
@@ -0,0 +1,126 @@
+#include "storage/wal/local_wal.h"
+
+#include "binder/ddl/bound_alter_info.h"
+#include "binder/ddl/bound_create_table_info.h"
+#include "common/serializer/serializer.h"
+#include "common/vector/value_vector.h"
+#include "storage/buffer_manager/spiller.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::binder;
+
+namespace kuzu {
+namespace storage {
+
+LocalWAL::~LocalWAL() {
+    clear();
+}
+
+void LocalWAL::clear() {
+    if (hasSpilled()) {
+        spiller->releaseFile();
+        spilledBlocks.clear();
+        spilledSize = 0;
+    }
+    serializer->reset();
+    numRecords = 0;
+}
+
+void LocalWAL::logCreateTableEntryRecord(BoundCreateTableInfo tableInfo) {
+    CreateTableEntryRecord walRecord(std::move(tableInfo));
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logCreateCatalogEntryRecord(CatalogEntry* catalogEntry) {
+    CreateCatalogEntryRecord walRecord(catalogEntry);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logDropCatalogEntryRecord(table_id_t tableID, CatalogEntryType type) {
+    DropCatalogEntryRecord walRecord(tableID, type);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logAlterTableEntryRecord(const BoundAlterInfo* alterInfo) {
+    AlterTableEntryRecord walRecord(alterInfo);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logUpdateSequenceRecord(sequence_id_t sequenceID, uint64_t kCount) {
+    UpdateSequenceRecord walRecord(sequenceID, kCount);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logTableInsertion(table_id_t tableID, TableType tableType, row_idx_t numRows,
+    const std::vector<ValueVector*>& vectors) {
+    TableInsertionRecord walRecord(tableID, tableType, numRows, vectors);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logNodeDeletion(table_id_t tableID, offset_t nodeOffset, ValueVector* pkVector) {
+    NodeDeletionRecord walRecord(tableID, nodeOffset, pkVector);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logNodeUpdate(table_id_t tableID, column_id_t columnID, offset_t nodeOffset,
+    ValueVector* propertyVector) {
+    NodeUpdateRecord walRecord(tableID, columnID, nodeOffset, propertyVector);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logRelDelete(table_id_t tableID, ValueVector* srcNodeVector,
+    ValueVector* dstNodeVector, ValueVector* relIDVector) {
+    RelDeletionRecord walRecord(tableID, srcNodeVector, dstNodeVector, relIDVector);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logRelDetachDelete(table_id_t tableID, RelDataDirection direction,
+    ValueVector* srcNodeVector) {
+    RelDetachDeleteRecord walRecord(tableID, direction, srcNodeVector);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::logRelUpdate(table_id_t tableID, column_id_t columnID, ValueVector* srcNodeVector,
+    ValueVector* dstNodeVector, ValueVector* relIDVector, ValueVector* propertyVector) {
+    RelUpdateRecord walRecord(tableID, columnID, srcNodeVector, dstNodeVector, relIDVector,
+        propertyVector);
+    addNewWALRecord(walRecord);
+}
+
+void LocalWAL::addNewWALRecord(const WALRecord& walRecord) {
+    KU_ASSERT(walRecord.type != WALRecordType::INVALID_RECORD);
+    Serializer ser(serializer);
+    walRecord.serialize(ser);
+    numRecords++;
+    if (spiller != nullptr && serializer->getSize() >= SPILL_THRESHOLD) {
+        spill();
+    }
+}
+
+void LocalWAL::spill() {
+    if (!hasSpilled()) {
+        // Keeps queries finishing in the meantime from truncating the spiller's file.
+        spiller->retainFile();
+    }
+    const auto size = serializer->getSize();
+    const auto filePosition = spiller->spillToDisk(serializer->getBlobData(), size);
+    spilledBlocks.push_back(SpilledBlock{filePosition, size});
+    spilledSize += size;
+    serializer->reset();
+}
+
+void LocalWAL::writeTo(Writer& writer) const {
+    if (hasSpilled()) {
+        std::vector<uint8_t> buffer;
+        for (auto& block : spilledBlocks) {
+            buffer.resize(block.size);
+            spiller->loadFromDisk(buffer.data(), block.size, block.filePosition);
+            writer.write(buffer.data(), block.size);
+        }
+    }
+    writer.write(serializer->getBlobData(), serializer->getSize());
+}
+
+} // namespace storage
+} // namespace kuzu
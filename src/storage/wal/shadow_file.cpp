@@ -1,5 +1,7 @@
 #include "storage/wal/shadow_file.h"
 
+#include <unordered_set>
+
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/buffered_file.h"
 #include "common/serializer/deserializer.h"
@@ -76,20 +78,60 @@ page_idx_t ShadowFile::getShadowPage(file_idx_t originalFile, page_idx_t origina
 
 void ShadowFile::replayShadowPageRecords(ClientContext& context) const {
     std::unordered_map<DBFileID, std::unique_ptr<FileInfo>> fileCache;
-    const auto pageBuffer = std::make_unique<uint8_t[]>(PAGE_SIZE);
-    page_idx_t shadowPageIdx = 1; // Skip header page.
-    for (const auto& record : shadowPageRecords) {
-        const auto& dbFileID = record.dbFileID;
-        if (!fileCache.contains(dbFileID)) {
-            fileCache.insert(std::make_pair(dbFileID, getFileInfo(context, dbFileID)));
+    const auto pageBuffer = std::make_unique<uint8_t[]>(NUM_PAGES_PER_REPLAY_BATCH * PAGE_SIZE);
+    const auto bm = context.getMemoryManager()->getBufferManager();
+    // Prefetches submitted before the checkpoint could otherwise overwrite updated frames with the
+    // pages' old content.
+    bm->waitForPrefetchedPages();
+    // Shadow pages are stored in the order of their records, so each batch of them is read with a
+    // single request. Their writes back to the original files are then submitted as one batch per
+    // file, coalescing pages that are consecutive in both the batch and the original file.
+    // A page cleared from the shadow file and shadowed again has multiple records, which must be
+    // replayed in order. Since writes of a batch may complete in any order, such a record starts a
+    // new batch.
+    std::unordered_set<uint64_t> pagesInBatch;
+    for (auto batchStart = 0u; batchStart < shadowPageRecords.size();) {
+        page_idx_t numPagesInBatch = 0;
+        pagesInBatch.clear();
+        while (numPagesInBatch < NUM_PAGES_PER_REPLAY_BATCH &&
+               batchStart + numPagesInBatch < shadowPageRecords.size()) {
+            const auto& record = shadowPageRecords[batchStart + numPagesInBatch];
+            const auto page = (uint64_t)record.originalFileIdx << 32 | record.originalPageIdx;
+            if (!pagesInBatch.insert(page).second) {
+                break;
+            }
+            numPagesInBatch++;
+        }
+        shadowingFH->readPagesFromDisk(pageBuffer.get(), batchStart + 1 /* skip header page */,
+            numPagesInBatch);
+        std::unordered_map<DBFileID, std::vector<FileWriteRequest>> writeRequests;
+        for (auto i = 0u; i < numPagesInBatch; i++) {
+            const auto& record = shadowPageRecords[batchStart + i];
+            if (!fileCache.contains(record.dbFileID)) {
+                fileCache.insert(
+                    std::make_pair(record.dbFileID, getFileInfo(context, record.dbFileID)));
+            }
+            auto& requests = writeRequests[record.dbFileID];
+            const auto page = pageBuffer.get() + i * PAGE_SIZE;
+            const auto offset = (uint64_t)record.originalPageIdx * PAGE_SIZE;
+            if (!requests.empty() && requests.back().buffer + requests.back().numBytes == page &&
+                requests.back().offset + requests.back().numBytes == offset) {
+                requests.back().numBytes += PAGE_SIZE;
+            } else {
+                requests.push_back({page, PAGE_SIZE, offset});
+            }
+        }
+        for (auto& [dbFileID, requests] : writeRequests) {
+            fileCache.at(dbFileID)->writeFileBatch(requests);
+        }
+        for (auto i = 0u; i < numPagesInBatch; i++) {
+            const auto& record = shadowPageRecords[batchStart + i];
+            // NOTE: We're not taking lock here, as we assume this is only called with single
+            // thread.
+            bm->updateFrameIfPageIsInFrameWithoutLock(record.originalFileIdx,
+                pageBuffer.get() + i * PAGE_SIZE, record.originalPageIdx);
         }
-        const auto& fileInfoOfDBFile = fileCache.at(dbFileID);
-        shadowingFH->readPageFromDisk(pageBuffer.get(), shadowPageIdx++);
-        fileInfoOfDBFile->writeFile(pageBuffer.get(), PAGE_SIZE,
-            record.originalPageIdx * PAGE_SIZE);
-        // NOTE: We're not taking lock here, as we assume this is only called with single thread.
-        context.getMemoryManager()->getBufferManager()->updateFrameIfPageIsInFrameWithoutLock(
-            record.originalFileIdx, pageBuffer.get(), record.originalPageIdx);
+        batchStart += numPagesInBatch;
     }
 }
 
@@ -183,6 +183,23 @@ void AlterTableEntryRecord::serialize(Serializer& serializer) const {
         serializer.write(renamePropertyInfo->newName);
         serializer.write(renamePropertyInfo->oldName);
     } break;
+    case AlterType::CREATE_INDEX:
+    case AlterType::DROP_INDEX:
+    case AlterType::DROP_VECTOR_INDEX:
+    case AlterType::CREATE_FTS_INDEX:
+    case AlterType::DROP_FTS_INDEX: {
+        auto indexInfo = extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        serializer.write(indexInfo->propertyName);
+    } break;
+    case AlterType::CREATE_VECTOR_INDEX: {
+        auto indexInfo = extraInfo->constPtrCast<BoundExtraVectorIndexInfo>();
+        serializer.write(indexInfo->propertyName);
+        serializer.write(indexInfo->metric);
+    } break;
+    case AlterType::UPDATE_STATISTICS: {
+        auto statisticsInfo = extraInfo->constPtrCast<BoundExtraStatisticsInfo>();
+        statisticsInfo->statistics.serialize(serializer);
+    } break;
     case AlterType::COMMENT: {
         auto commentInfo = extraInfo->constPtrCast<BoundExtraCommentInfo>();
         serializer.write(commentInfo->comment);
@@ -222,6 +239,27 @@ std::unique_ptr<AlterTableEntryRecord> AlterTableEntryRecord::deserialize(
         extraInfo =
             std::make_unique<BoundExtraRenamePropertyInfo>(std::move(newName), std::move(oldName));
     } break;
+    case AlterType::CREATE_INDEX:
+    case AlterType::DROP_INDEX:
+    case AlterType::DROP_VECTOR_INDEX:
+    case AlterType::CREATE_FTS_INDEX:
+    case AlterType::DROP_FTS_INDEX: {
+        std::string propertyName;
+        deserializer.deserializeValue(propertyName);
+        extraInfo = std::make_unique<BoundExtraIndexInfo>(std::move(propertyName));
+    } break;
+    case AlterType::CREATE_VECTOR_INDEX: {
+        std::string propertyName;
+        auto metric = VectorDistanceMetric::L2;
+        deserializer.deserializeValue(propertyName);
+        deserializer.deserializeValue(metric);
+        extraInfo =
+            std::make_unique<BoundExtraVectorIndexInfo>(std::move(propertyName), metric);
+    } break;
+    case AlterType::UPDATE_STATISTICS: {
+        extraInfo = std::make_unique<BoundExtraStatisticsInfo>(
+            catalog::TableStatistics::deserialize(deserializer));
+    } break;
     case AlterType::COMMENT: {
         std::string comment;
         deserializer.deserializeValue(comment);
@@ -202,6 +202,38 @@ void WALReplayer::replayAlterTableEntryRecord(const WALRecord& walRecord) const
         KU_ASSERT(clientContext.getStorageManager());
         const auto storageManager = clientContext.getStorageManager();
         storageManager->getTable(schema->getTableID())->addColumn(clientContext.getTx(), state);
+    } else if (alterEntryRecord.ownedAlterInfo->alterType == AlterType::CREATE_INDEX) {
+        const auto indexInfo =
+            alterEntryRecord.ownedAlterInfo->extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        const auto schema = clientContext.getCatalog()->getTableCatalogEntry(clientContext.getTx(),
+            alterEntryRecord.ownedAlterInfo->tableName);
+        auto& nodeTable =
+            clientContext.getStorageManager()->getTable(schema->getTableID())->cast<NodeTable>();
+        Transaction buildTransaction{TransactionType::WRITE, clientContext.getTx()->getID(),
+            Transaction::START_TRANSACTION_ID - 1};
+        nodeTable.buildPropertyIndex(&buildTransaction,
+            schema->getColumnID(indexInfo->propertyName));
+    } else if (alterEntryRecord.ownedAlterInfo->alterType == AlterType::CREATE_VECTOR_INDEX) {
+        const auto indexInfo =
+            alterEntryRecord.ownedAlterInfo->extraInfo->constPtrCast<BoundExtraVectorIndexInfo>();
+        const auto schema = clientContext.getCatalog()->getTableCatalogEntry(clientContext.getTx(),
+            alterEntryRecord.ownedAlterInfo->tableName);
+        auto& nodeTable =
+            clientContext.getStorageManager()->getTable(schema->getTableID())->cast<NodeTable>();
+        Transaction buildTransaction{TransactionType::WRITE, clientContext.getTx()->getID(),
+            Transaction::START_TRANSACTION_ID - 1};
+        nodeTable.buildVectorIndex(&buildTransaction,
+            schema->getColumnID(indexInfo->propertyName), indexInfo->metric);
+    } else if (alterEntryRecord.ownedAlterInfo->alterType == AlterType::CREATE_FTS_INDEX) {
+        const auto indexInfo =
+            alterEntryRecord.ownedAlterInfo->extraInfo->constPtrCast<BoundExtraIndexInfo>();
+        const auto schema = clientContext.getCatalog()->getTableCatalogEntry(clientContext.getTx(),
+            alterEntryRecord.ownedAlterInfo->tableName);
+        auto& nodeTable =
+            clientContext.getStorageManager()->getTable(schema->getTableID())->cast<NodeTable>();
+        Transaction buildTransaction{TransactionType::WRITE, clientContext.getTx()->getID(),
+            Transaction::START_TRANSACTION_ID - 1};
+        nodeTable.buildFTSIndex(&buildTransaction, schema->getColumnID(indexInfo->propertyName));
     }
 }
 
@@ -3,9 +3,12 @@
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/runtime.h"
 #include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 #include "storage/local_storage/local_storage.h"
 #include "storage/store/version_info.h"
 #include "storage/undo_buffer.h"
+#include "storage/wal/local_wal.h"
 #include "storage/wal/wal.h"
 #include <main/db_config.h>
 
@@ -21,6 +24,10 @@ Transaction::Transaction(main::ClientContext& clientContext, TransactionType tra
     this->clientContext = &clientContext;
     localStorage = std::make_unique<storage::LocalStorage>(clientContext);
     undoBuffer = std::make_unique<storage::UndoBuffer>(this);
+    storage::Spiller* walSpiller = nullptr;
+    clientContext.getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+        [&](auto& spiller) { walSpiller = &spiller; });
+    localWAL = std::make_unique<storage::LocalWAL>(walSpiller);
     currentTS = common::Timestamp::getCurrentTimestamp().value;
 }
 
@@ -49,19 +56,17 @@ bool Transaction::shouldForceCheckpoint() const {
 void Transaction::commit(storage::WAL* wal) const {
     localStorage->commit();
     undoBuffer->commit(commitTS);
-    if (isWriteTransaction() && shouldLogToWAL()) {
+    if (isWriteTransaction() && shouldLogToWAL() && !localWAL->isEmpty()) {
         KU_ASSERT(wal);
-        wal->logAndFlushCommit();
+        wal->logCommittedWAL(*localWAL);
     }
 }
 
-void Transaction::rollback(storage::WAL* wal) const {
+void Transaction::rollback(storage::WAL*) const {
     localStorage->rollback();
     undoBuffer->rollback();
-    if (isWriteTransaction() && shouldLogToWAL()) {
-        KU_ASSERT(wal);
-        wal->logRollback();
-    }
+    // Nothing of this transaction has reached the WAL file yet, so there is nothing to undo there.
+    localWAL->clear();
 }
 
 uint64_t Transaction::getEstimatedMemUsage() const {
@@ -74,8 +79,7 @@ void Transaction::pushCatalogEntry(CatalogSet& catalogSet, CatalogEntry& catalog
     if (!shouldLogToWAL() || skipLoggingToWAL) {
         return;
     }
-    const auto wal = clientContext->getWAL();
-    KU_ASSERT(wal);
+    const auto wal = localWAL.get();
     const auto newCatalogEntry = catalogEntry.getNext();
     switch (newCatalogEntry->getType()) {
     case CatalogEntryType::NODE_TABLE_ENTRY:
@@ -163,7 +167,7 @@ void Transaction::pushSequenceChange(SequenceCatalogEntry* sequenceEntry, int64_
     const SequenceRollbackData& data) const {
     undoBuffer->createSequenceChange(*sequenceEntry, data);
     if (clientContext->getTx()->shouldLogToWAL()) {
-        clientContext->getWAL()->logUpdateSequenceRecord(sequenceEntry->getOID(), kCount);
+        localWAL->logUpdateSequenceRecord(sequenceEntry->getOID(), kCount);
     }
 }
 
@@ -1,5 +1,7 @@
 #include "transaction/transaction_manager.h"
 
+#include <chrono>
+#include <optional>
 #include <thread>
 
 #include "common/exception/transaction_manager.h"
@@ -33,13 +35,11 @@ std::unique_ptr<Transaction> TransactionManager::beginTransaction(
                 "Cannot start a new write transaction in the system. "
                 "Only one write transaction at a time is allowed in the system.");
         }
+        // Concurrent write transactions are allowed by default. Conflicting writes to the same
+        // row are detected in storage, and the later writer is aborted.
         transaction =
             std::make_unique<Transaction>(clientContext, type, ++lastTransactionID, lastTimestamp);
         activeWriteTransactions.insert(transaction->getID());
-        KU_ASSERT(clientContext.getStorageManager());
-        if (transaction->shouldLogToWAL()) {
-            clientContext.getStorageManager()->getWAL().logBeginTransaction();
-        }
     } break;
     default: {
         throw TransactionManagerException("Invalid transaction type to begin transaction.");
@@ -62,8 +62,16 @@ void TransactionManager::commit(main::ClientContext& clientContext) {
         transaction->commitTS = lastTimestamp;
         transaction->commit(&wal);
         activeWriteTransactions.erase(transaction->getID());
-        if (transaction->shouldForceCheckpoint() || canAutoCheckpoint(clientContext)) {
+        if (transaction->shouldForceCheckpoint()) {
             checkpointNoLock(clientContext);
+        } else if (canAutoCheckpoint(clientContext)) {
+            if (!clientContext.getDBConfig()->backgroundCheckpoint && canCheckpointNoLock()) {
+                checkpointNoLock(clientContext);
+            } else {
+                // Other transactions are still active. Instead of blocking this commit until they
+                // leave, hand the checkpoint over to the background checkpointer.
+                requestBackgroundCheckpointNoLock(clientContext);
+            }
         }
     } break;
     default: {
@@ -156,6 +164,17 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     // query stop working on the tasks of the query and these tasks are removed from the
     // query.
     stopNewTransactionsAndWaitUntilAllTransactionsLeave();
+    try {
+        checkpointStorageNoLock(clientContext);
+    } catch (...) {
+        allowReceivingNewTransactions();
+        throw;
+    }
+    // Resume receiving new transactions.
+    allowReceivingNewTransactions();
+}
+
+void TransactionManager::checkpointStorageNoLock(main::ClientContext& clientContext) {
     // Checkpoint node/relTables, which writes the updated/newly-inserted pages and metadata to
     // disk.
     clientContext.getStorageManager()->checkpoint(clientContext);
@@ -178,8 +197,116 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     clientContext.getStorageManager()->getShadowFile().clearAll(clientContext);
     StorageUtils::removeWALVersionFiles(clientContext.getDatabasePath(),
         clientContext.getVFSUnsafe());
-    // Resume receiving new transactions.
-    allowReceivingNewTransactions();
+}
+
+void TransactionManager::requestBackgroundCheckpointNoLock(
+    const main::ClientContext& clientContext) {
+    std::unique_lock lck{mtxForBackgroundCheckpoint};
+    if (!backgroundCheckpointer.joinable()) {
+        backgroundCheckpointContext =
+            std::make_unique<main::ClientContext>(clientContext.getDatabase());
+        backgroundCheckpointer = std::thread([this] { runBackgroundCheckpointer(); });
+    }
+    backgroundCheckpointRequested = true;
+    backgroundCheckpointCV.notify_one();
+}
+
+void TransactionManager::runBackgroundCheckpointer() {
+    std::unique_lock lck{mtxForBackgroundCheckpoint};
+    std::optional<std::chrono::steady_clock::time_point> requestedSince;
+    while (true) {
+        backgroundCheckpointCV.wait(lck,
+            [&] { return stopBackgroundCheckpointer || backgroundCheckpointRequested; });
+        if (stopBackgroundCheckpointer) {
+            return;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        const bool isNewRequest = !requestedSince.has_value();
+        if (isNewRequest) {
+            requestedSince = now;
+        }
+        // Stop waiting for the system to become idle once the checkpoint has been delayed for too
+        // long, otherwise a steady stream of transactions would keep it from ever running.
+        const bool waitForTransactions =
+            now - *requestedSince >
+            std::chrono::microseconds(BACKGROUND_CHECKPOINT_MAX_DELAY_IN_MICROS);
+        lck.unlock();
+        bool done = true;
+        try {
+            if (isNewRequest) {
+                // Most of the data is flushed while transactions keep running, so the checkpoint
+                // itself only has to flush what changed since and to swap the metadata.
+                backgroundCheckpointContext->getStorageManager()->preCheckpoint();
+            }
+            done = tryBackgroundCheckpoint(waitForTransactions);
+        } catch (...) { // NOLINT
+            // A failed checkpoint leaves the WAL in place, so nothing is lost. The next commit
+            // that exceeds the checkpoint threshold requests a new one.
+        }
+        lck.lock();
+        if (done) {
+            backgroundCheckpointRequested = false;
+            requestedSince.reset();
+        } else {
+            if (waitForTransactions) {
+                // Give transactions which outlived the wait timeout some time before new
+                // transactions are held back again.
+                requestedSince = std::chrono::steady_clock::now();
+            }
+            backgroundCheckpointCV.wait_for(lck,
+                std::chrono::microseconds(BACKGROUND_CHECKPOINT_RETRY_INTERVAL_IN_MICROS),
+                [&] { return stopBackgroundCheckpointer; });
+        }
+    }
+}
+
+bool TransactionManager::tryBackgroundCheckpoint(bool waitForTransactions) {
+    // Holding both locks while no transaction is active keeps new transactions out for the
+    // duration of the checkpoint only. The public function lock is only tried, because commits
+    // which checkpoint inline hold it while waiting for the lock to start new transactions.
+    std::unique_lock<std::mutex> newTransactionLck{mtxForStartingNewTransactions};
+    uint64_t numTimesWaited = 0;
+    while (true) {
+        std::unique_lock<std::mutex> publicFunctionLck{mtxForSerializingPublicFunctionCalls,
+            std::try_to_lock};
+        if (publicFunctionLck.owns_lock() && canCheckpointNoLock()) {
+            checkpointStorageNoLock(*backgroundCheckpointContext);
+            return true;
+        }
+        if (!waitForTransactions || numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
+                                        checkpointWaitTimeoutInMicros) {
+            return false;
+        }
+        publicFunctionLck = {};
+        numTimesWaited++;
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+    }
+}
+
+void TransactionManager::stopBackgroundCheckpoint() {
+    {
+        std::unique_lock lck{mtxForBackgroundCheckpoint};
+        stopBackgroundCheckpointer = true;
+        backgroundCheckpointCV.notify_one();
+    }
+    if (backgroundCheckpointer.joinable()) {
+        backgroundCheckpointer.join();
+    }
+    backgroundCheckpointContext.reset();
+}
+
+uint64_t TransactionManager::getNumActiveWriteTransactions() {
+    std::unique_lock lck{mtxForSerializingPublicFunctionCalls};
+    return activeWriteTransactions.size();
+}
+
+TransactionManager::TransactionManager(WAL& wal)
+    : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1},
+      backgroundCheckpointRequested{false}, stopBackgroundCheckpointer{false} {}
+
+TransactionManager::~TransactionManager() {
+    stopBackgroundCheckpoint();
 }
 
 } // namespace transaction
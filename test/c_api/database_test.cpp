@@ -90,3 +90,31 @@ TEST_F(CApiDatabaseTest, CreationHomeDir) {
     kuzu_database_destroy(&database);
     std::filesystem::remove_all(homePath + "/ku_test.db");
 }
+
+TEST_F(CApiDatabaseTest, BufferPoolInfo) {
+    kuzu_database database;
+    kuzu_connection connection;
+    kuzu_query_result queryResult;
+    kuzu_buffer_pool_info info;
+    auto databasePathCStr = databasePath.c_str();
+    auto systemConfig = kuzu_default_system_config();
+    systemConfig.buffer_pool_size = 64 * 1024 * 1024;
+    ASSERT_EQ(kuzu_database_init(databasePathCStr, systemConfig, &database), KuzuSuccess);
+    ASSERT_EQ(kuzu_database_get_buffer_pool_info(&database, &info), KuzuSuccess);
+    ASSERT_EQ(info.buffer_pool_size, 64ull * 1024 * 1024);
+    ASSERT_EQ(info.temp_pages_in_use, 0u);
+    ASSERT_EQ(kuzu_connection_init(&database, &connection), KuzuSuccess);
+    ASSERT_EQ(kuzu_connection_query(&connection,
+                  "UNWIND range(1, 100000) AS x RETURN x ORDER BY x DESC LIMIT 1", &queryResult),
+        KuzuSuccess);
+    kuzu_query_result_destroy(&queryResult);
+    ASSERT_EQ(kuzu_database_get_buffer_pool_info(&database, &info), KuzuSuccess);
+    // The intermediate results of the query were allocated as temp pages and freed afterwards.
+    ASSERT_GT(info.temp_page_allocations, 0u);
+    ASSERT_EQ(info.temp_pages_in_use, 0u);
+    ASSERT_GT(info.used_memory, 0u);
+    kuzu_connection_destroy(&connection);
+    kuzu_database_destroy(&database);
+    kuzu_database database2{nullptr};
+    ASSERT_EQ(kuzu_database_get_buffer_pool_info(&database2, &info), KuzuError);
+}
@@ -0,0 +1,153 @@
+#include <filesystem>
+#include <numeric>
+
+#include "common/constants.h"
+#include "common/exception/io.h"
+#include "common/file_system/io_uring.h"
+#include "common/file_system/local_file_system.h"
+#include "gtest/gtest.h"
+#include "test_helper/test_helper.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace testing {
+
+// Batched reads and writes go through io_uring where available, and through the synchronous
+// fallback otherwise. Each test covers both.
+class FileSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        tempDir = TestHelper::getTempDir("file_system_test");
+        path = LocalFileSystem::joinPath(tempDir, "file");
+    }
+
+    void TearDown() override {
+        IOUring::setDisabled(false);
+        std::filesystem::remove_all(tempDir);
+    }
+
+    // Returns false if the path cannot be tested on this platform.
+    bool setIOUringEnabled(bool enabled) {
+        IOUring::setDisabled(!enabled);
+        return !enabled || IOUring::isAvailable();
+    }
+
+    std::unique_ptr<FileInfo> openFile(
+        int flags = FileFlags::READ_ONLY | FileFlags::WRITE | FileFlags::CREATE_IF_NOT_EXISTS) {
+        return fileSystem.openFile(path, flags);
+    }
+
+    static std::vector<uint8_t> getPage(uint8_t value) {
+        return std::vector<uint8_t>(PAGE_SIZE, value);
+    }
+
+    void testBatchedWritesAndReads();
+    void testShortRead();
+    void testFailedWrite();
+
+protected:
+    LocalFileSystem fileSystem;
+    std::string tempDir;
+    std::string path;
+};
+
+void FileSystemTest::testBatchedWritesAndReads() {
+    constexpr uint64_t numPages = 8;
+    auto fileInfo = openFile();
+    std::vector<std::vector<uint8_t>> pages;
+    std::vector<FileWriteRequest> writeRequests;
+    // Write the pages out of order, with the last two of them coalesced in a single request.
+    for (auto i = 0u; i < numPages; i++) {
+        pages.push_back(getPage(i + 1));
+    }
+    std::vector<uint8_t> lastPages(pages[6]);
+    lastPages.insert(lastPages.end(), pages[7].begin(), pages[7].end());
+    for (const auto i : {5, 0, 3, 1, 4, 2}) {
+        writeRequests.push_back({pages[i].data(), PAGE_SIZE, i * PAGE_SIZE});
+    }
+    writeRequests.push_back({lastPages.data(), 2 * PAGE_SIZE, 6 * PAGE_SIZE});
+    fileInfo->writeFileBatch(writeRequests);
+    ASSERT_EQ(fileInfo->getFileSize(), numPages * PAGE_SIZE);
+
+    std::vector<std::vector<uint8_t>> readPages(numPages, getPage(0));
+    std::vector<FileReadRequest> readRequests;
+    for (auto i = 0u; i < numPages; i++) {
+        readRequests.push_back({readPages[i].data(), PAGE_SIZE, i * PAGE_SIZE});
+    }
+    fileInfo->readFromFileBatch(readRequests);
+    for (auto i = 0u; i < numPages; i++) {
+        EXPECT_EQ(readPages[i], pages[i]) << "page " << i;
+    }
+}
+
+void FileSystemTest::testShortRead() {
+    auto fileInfo = openFile();
+    std::vector<uint8_t> content(3 * PAGE_SIZE);
+    std::iota(content.begin(), content.end(), 0);
+    fileInfo->writeFile(content.data(), content.size(), 0);
+    // The second request reaches past the end of the file, so its batched read comes back short
+    // and is redone synchronously. Like unbatched reads, it reads up to the end of the file.
+    constexpr uint64_t position = 2 * PAGE_SIZE + 100;
+    auto firstPage = getPage(0);
+    auto lastPage = getPage(0xFF);
+    std::vector<FileReadRequest> requests{{firstPage.data(), PAGE_SIZE, 0},
+        {lastPage.data(), PAGE_SIZE, position}};
+    fileInfo->readFromFileBatch(requests);
+    auto expectedLastPage = getPage(0xFF);
+    fileInfo->readFromFile(expectedLastPage.data(), PAGE_SIZE, position);
+    EXPECT_TRUE(std::equal(firstPage.begin(), firstPage.end(), content.begin()));
+    EXPECT_TRUE(std::equal(lastPage.begin(), lastPage.begin() + PAGE_SIZE - 100,
+        content.begin() + position));
+    EXPECT_EQ(lastPage, expectedLastPage);
+}
+
+void FileSystemTest::testFailedWrite() {
+    openFile();
+    auto fileInfo = openFile(FileFlags::READ_ONLY);
+    auto page = getPage(1);
+    std::vector<FileWriteRequest> requests{{page.data(), PAGE_SIZE, 0},
+        {page.data(), PAGE_SIZE, PAGE_SIZE}};
+    // Failed batched writes are redone synchronously, which reports the error.
+    EXPECT_THROW(fileInfo->writeFileBatch(requests), IOException);
+    EXPECT_EQ(fileInfo->getFileSize(), 0);
+}
+
+TEST_F(FileSystemTest, BatchedWritesAndReads) {
+    ASSERT_TRUE(setIOUringEnabled(false));
+    testBatchedWritesAndReads();
+}
+
+TEST_F(FileSystemTest, BatchedWritesAndReadsWithIOUring) {
+    if (!setIOUringEnabled(true)) {
+        GTEST_SKIP();
+    }
+    testBatchedWritesAndReads();
+}
+
+TEST_F(FileSystemTest, ShortRead) {
+    ASSERT_TRUE(setIOUringEnabled(false));
+    testShortRead();
+}
+
+TEST_F(FileSystemTest, ShortReadWithIOUring) {
+    if (!setIOUringEnabled(true)) {
+        GTEST_SKIP();
+    }
+    testShortRead();
+}
+
+TEST_F(FileSystemTest, FailedWrite) {
+    ASSERT_TRUE(setIOUringEnabled(false));
+    testFailedWrite();
+}
+
+TEST_F(FileSystemTest, FailedWriteWithIOUring) {
+    if (!setIOUringEnabled(true)) {
+        GTEST_SKIP();
+    }
+    testFailedWrite();
+}
+
+} // namespace testing
+} // namespace kuzu
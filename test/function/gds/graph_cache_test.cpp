@@ -0,0 +1,32 @@
+#include "graph/graph_cache.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace testing {
+
+TEST(GraphCacheTest, PutOnlyReplacesSameProjection) {
+    GraphCache cache;
+    auto personKnows = std::make_shared<const InMemoryGraphData>();
+    auto personWorkAt = std::make_shared<const InMemoryGraphData>();
+    cache.put("person,knows", 1 /* version */, personKnows);
+    // A transaction reading a newer snapshot caches another projection. Transactions still
+    // reading the older snapshot keep using the first projection.
+    cache.put("person,workAt", 2 /* version */, personWorkAt);
+    ASSERT_EQ(cache.get("person,knows", 1), personKnows);
+    ASSERT_EQ(cache.get("person,workAt", 2), personWorkAt);
+    ASSERT_EQ(cache.get("person,knows", 2), nullptr);
+    // Caching the same projection for a newer snapshot replaces the older copy.
+    auto newPersonKnows = std::make_shared<const InMemoryGraphData>();
+    cache.put("person,knows", 2, newPersonKnows);
+    ASSERT_EQ(cache.get("person,knows", 1), nullptr);
+    ASSERT_EQ(cache.get("person,knows", 2), newPersonKnows);
+    // An older snapshot never replaces a newer copy.
+    cache.put("person,knows", 1, personKnows);
+    ASSERT_EQ(cache.get("person,knows", 2), newPersonKnows);
+    ASSERT_EQ(cache.get("person,workAt", 2), personWorkAt);
+}
+
+} // namespace testing
+} // namespace kuzu
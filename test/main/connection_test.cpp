@@ -132,6 +132,58 @@ TEST_F(ApiTest, MultipleQuery) {
     ASSERT_EQ(result->getNextQueryResult()->toString(), "3\n3\n");
 }
 
+TEST_F(ApiTest, StreamingResult) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true;")->isSuccess());
+    auto result = conn->query("UNWIND range(1, 100000) AS x RETURN x;");
+    ASSERT_TRUE(result->isSuccess());
+    auto expected = 1;
+    while (result->hasNext()) {
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), expected);
+        expected++;
+    }
+    ASSERT_EQ(expected, 100001);
+    ASSERT_EQ(result->getNumTuples(), 100000);
+    // The transaction of the streaming query is committed at the end of the result.
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 1000, fName: 'Streamer'});")->isSuccess());
+}
+
+TEST_F(ApiTest, StreamingResultCancelledByNextQuery) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true;")->isSuccess());
+    auto result = conn->query("UNWIND range(1, 10000000) AS x RETURN x;");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    // Running another query on the connection stops the unfinished streaming query.
+    ApiTest::assertMatchPersonCountStar(conn.get());
+    try {
+        while (result->hasNext()) {
+            result->getNext();
+        }
+        FAIL();
+    } catch (Exception& e) {
+        ASSERT_STREQ(e.what(), "Interrupted.");
+    }
+}
+
+TEST_F(ApiTest, StreamingResultDestroyedDuringNextQuery) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true;")->isSuccess());
+    for (auto i = 0u; i < 20; ++i) {
+        auto result = conn->query("UNWIND range(1, 10000000) AS x RETURN x;");
+        ASSERT_TRUE(result->isSuccess());
+        // Ending the transaction of the streaming query must not race with the next query.
+        std::thread destroyer([&result]() { result.reset(); });
+        ApiTest::assertMatchPersonCountStar(conn.get());
+        destroyer.join();
+    }
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 1000, fName: 'Streamer'});")->isSuccess());
+}
+
+TEST_F(ApiTest, StreamingResultError) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true;")->isSuccess());
+    auto result = conn->query("UNWIND [1, 9223372036854775807] AS x RETURN x + 1;");
+    ASSERT_FALSE(result->isSuccess());
+}
+
 TEST_F(ApiTest, SingleQueryHasNextQueryResult) {
     auto result = conn->query("MATCH (a:person) RETURN a.fName;");
     ASSERT_TRUE(result->isSuccess());
@@ -0,0 +1,185 @@
+#include <algorithm>
+
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/types/types.h"
+#include "graph_test/graph_test.h"
+#include "main/client_context.h"
+#include "processor/data_pos.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace testing {
+
+// Builds hash tables of keys which appear twice each, with the index of each tuple as payload, and
+// probes them with present and missing keys. Probes go through the inline compares of INT64 and
+// INTERNAL_ID keys, with tagged and untagged hash slots.
+class JoinHashTableTest : public EmptyDBTest {
+protected:
+    static constexpr int64_t NUM_KEYS = 1000;
+    static constexpr int64_t NUM_TUPLES = 2 * NUM_KEYS;
+    static constexpr int64_t NUM_PROBE_KEYS = 2 * NUM_KEYS;
+
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        memoryManager = getClientContext(*conn)->getMemoryManager();
+    }
+
+    std::unique_ptr<JoinHashTable> buildHashTable(const LogicalType& keyType, bool useTags) {
+        FactorizedTableSchema tableSchema;
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* groupID */,
+            LogicalTypeUtils::getRowLayoutSize(keyType)));
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* groupID */,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::HASH())));
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+        std::vector<LogicalType> keyTypes;
+        keyTypes.push_back(keyType.copy());
+        auto hashTable = std::make_unique<JoinHashTable>(*memoryManager, std::move(keyTypes),
+            std::move(tableSchema));
+        auto state = std::make_shared<DataChunkState>();
+        state->getSelVectorUnsafe().setSelSize(NUM_TUPLES);
+        ValueVector keyVector{keyType.copy(), memoryManager};
+        ValueVector payloadVector{LogicalType::INT64(), memoryManager};
+        keyVector.setState(state);
+        payloadVector.setState(state);
+        for (auto i = 0; i < NUM_TUPLES; i++) {
+            setKey(keyVector, i, i % NUM_KEYS);
+            payloadVector.setValue<int64_t>(i, i);
+        }
+        hashTable->appendVectors({&keyVector}, {&payloadVector}, state.get());
+        if (!useTags) {
+            hashTable->disableTags();
+        }
+        hashTable->allocateHashSlots(hashTable->getNumTuples());
+        hashTable->buildHashSlots();
+        return hashTable;
+    }
+
+    static void setKey(ValueVector& keyVector, sel_t pos, int64_t key) {
+        if (keyVector.dataType.getPhysicalType() == PhysicalTypeID::INTERNAL_ID) {
+            keyVector.setValue<internalID_t>(pos, internalID_t{(offset_t)key, 0 /* tableID */});
+        } else {
+            keyVector.setValue<int64_t>(pos, key);
+        }
+    }
+
+    static int64_t getKey(const LogicalType& keyType, const uint8_t* tuple) {
+        if (keyType.getPhysicalType() == PhysicalTypeID::INTERNAL_ID) {
+            return (int64_t)reinterpret_cast<const internalID_t*>(tuple)->offset;
+        }
+        return *reinterpret_cast<const int64_t*>(tuple);
+    }
+
+    static int64_t getPayload(JoinHashTable& hashTable, const uint8_t* tuple) {
+        return *reinterpret_cast<const int64_t*>(
+            tuple + hashTable.getTableSchema()->getColOffset(1));
+    }
+
+    void testFlatKey(const LogicalType& keyType, bool useTags);
+    void testUnFlatKey(const LogicalType& keyType, bool useTags);
+
+protected:
+    storage::MemoryManager* memoryManager = nullptr;
+};
+
+void JoinHashTableTest::testFlatKey(const LogicalType& keyType, bool useTags) {
+    auto hashTable = buildHashTable(keyType, useTags);
+    ValueVector keyVector{keyType.copy(), memoryManager};
+    keyVector.setState(DataChunkState::getSingleValueDataChunkState());
+    ValueVector hashVector{LogicalType::HASH(), memoryManager};
+    ValueVector tmpHashVector{LogicalType::HASH(), memoryManager};
+    SelectionVector hashSelVec{DEFAULT_VECTOR_CAPACITY};
+    auto probedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    auto matchedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    for (auto key = 0; key < NUM_PROBE_KEYS; key++) {
+        setKey(keyVector, 0, key);
+        probedTuples[0] = nullptr;
+        hashTable->probe({&keyVector}, hashVector, hashSelVec, tmpHashVector, probedTuples.get());
+        std::vector<int64_t> payloads;
+        while (probedTuples[0]) {
+            const auto numMatchedTuples =
+                hashTable->matchFlatKeys({&keyVector}, probedTuples.get(), matchedTuples.get());
+            for (auto i = 0u; i < numMatchedTuples; i++) {
+                ASSERT_EQ(getKey(keyType, matchedTuples[i]), key);
+                payloads.push_back(getPayload(*hashTable, matchedTuples[i]));
+            }
+        }
+        std::sort(payloads.begin(), payloads.end());
+        if (key < NUM_KEYS) {
+            EXPECT_EQ(payloads, (std::vector<int64_t>{key, key + NUM_KEYS})) << "key " << key;
+        } else {
+            EXPECT_TRUE(payloads.empty()) << "key " << key;
+        }
+    }
+}
+
+void JoinHashTableTest::testUnFlatKey(const LogicalType& keyType, bool useTags) {
+    auto hashTable = buildHashTable(keyType, useTags);
+    auto state = std::make_shared<DataChunkState>();
+    state->getSelVectorUnsafe().setSelSize(NUM_PROBE_KEYS);
+    ValueVector keyVector{keyType.copy(), memoryManager};
+    keyVector.setState(state);
+    // Probe keys are in reverse order, so that positions and keys differ.
+    for (auto i = 0; i < NUM_PROBE_KEYS; i++) {
+        setKey(keyVector, i, NUM_PROBE_KEYS - 1 - i);
+    }
+    ValueVector hashVector{LogicalType::HASH(), memoryManager};
+    ValueVector tmpHashVector{LogicalType::HASH(), memoryManager};
+    SelectionVector hashSelVec{DEFAULT_VECTOR_CAPACITY};
+    SelectionVector matchedSelVector{DEFAULT_VECTOR_CAPACITY};
+    matchedSelVector.setToFiltered();
+    auto probedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    auto matchedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    hashTable->probe({&keyVector}, hashVector, hashSelVec, tmpHashVector, probedTuples.get());
+    const auto numMatchedTuples = hashTable->matchUnFlatKey(&keyVector, probedTuples.get(),
+        matchedTuples.get(), matchedSelVector);
+    // At most one match is returned for each key.
+    ASSERT_EQ(numMatchedTuples, (sel_t)NUM_KEYS);
+    for (auto i = 0u; i < numMatchedTuples; i++) {
+        const auto key = NUM_PROBE_KEYS - 1 - (int64_t)matchedSelVector[i];
+        ASSERT_LT(key, NUM_KEYS);
+        EXPECT_EQ(getKey(keyType, matchedTuples[i]), key);
+        EXPECT_EQ(getPayload(*hashTable, matchedTuples[i]) % NUM_KEYS, key);
+    }
+}
+
+TEST_F(JoinHashTableTest, Int64FlatKey) {
+    testFlatKey(LogicalType::INT64(), true /* useTags */);
+}
+
+TEST_F(JoinHashTableTest, Int64UnFlatKey) {
+    testUnFlatKey(LogicalType::INT64(), true /* useTags */);
+}
+
+TEST_F(JoinHashTableTest, InternalIDFlatKey) {
+    testFlatKey(LogicalType::INTERNAL_ID(), true /* useTags */);
+}
+
+TEST_F(JoinHashTableTest, InternalIDUnFlatKey) {
+    testUnFlatKey(LogicalType::INTERNAL_ID(), true /* useTags */);
+}
+
+TEST_F(JoinHashTableTest, Int64FlatKeyWithoutTags) {
+    testFlatKey(LogicalType::INT64(), false /* useTags */);
+}
+
+TEST_F(JoinHashTableTest, Int64UnFlatKeyWithoutTags) {
+    testUnFlatKey(LogicalType::INT64(), false /* useTags */);
+}
+
+TEST_F(JoinHashTableTest, InternalIDFlatKeyWithoutTags) {
+    testFlatKey(LogicalType::INTERNAL_ID(), false /* useTags */);
+}
+
+TEST_F(JoinHashTableTest, InternalIDUnFlatKeyWithoutTags) {
+    testUnFlatKey(LogicalType::INTERNAL_ID(), false /* useTags */);
+}
+
+} // namespace testing
+} // namespace kuzu
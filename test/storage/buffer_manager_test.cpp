@@ -7,6 +7,7 @@
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/enums/residency_state.h"
+#include "storage/storage_manager.h"
 #include "storage/store/chunked_node_group.h"
 #include "storage/store/column_chunk.h"
 
@@ -38,6 +39,45 @@ TEST_F(BufferManagerTest, TestBMUsageForIdenticalQueries) {
     spdlog::info("Memory used after transactions: {}", memoryUsed);
 }
 
+TEST_F(BufferManagerTest, TestPrefetchPages) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    // Reopen the database so that most of its pages are evicted.
+    createDBAndConn();
+    auto bm = getBufferManager(*database);
+    auto& dataFH = *getStorageManager(*database)->getDataFH();
+    const auto numPages = dataFH.getNumPages();
+    ASSERT_GT(numPages, 1);
+    uint64_t numEvictedPages = 0;
+    for (auto pageIdx = 0u; pageIdx < numPages; ++pageIdx) {
+        numEvictedPages += dataFH.getPageState(pageIdx)->getState() == PageState::EVICTED;
+    }
+    ASSERT_GT(numEvictedPages, 0);
+    auto memoryUsed = bm->getUsedMemory();
+    dataFH.prefetchPages(0, numPages);
+    // Frames are reserved right away, while the pages are read in the background.
+    ASSERT_EQ(memoryUsed + numEvictedPages * PAGE_SIZE, bm->getUsedMemory());
+    // Prefetched pages are cached with the same content as on disk. Reads of pages which are still
+    // being prefetched wait for them.
+    auto page = std::make_unique<uint8_t[]>(PAGE_SIZE);
+    for (auto pageIdx = 0u; pageIdx < numPages; ++pageIdx) {
+        ASSERT_NE(dataFH.getPageState(pageIdx)->getState(), PageState::EVICTED);
+        dataFH.readPageFromDisk(page.get(), pageIdx);
+        dataFH.optimisticReadPage(pageIdx,
+            [&](auto* frame) { ASSERT_EQ(memcmp(frame, page.get(), PAGE_SIZE), 0); });
+    }
+    bm->waitForPrefetchedPages();
+    for (auto pageIdx = 0u; pageIdx < numPages; ++pageIdx) {
+        ASSERT_NE(dataFH.getPageState(pageIdx)->getState(), PageState::LOCKED);
+    }
+    // Prefetching cached pages does nothing.
+    dataFH.prefetchPages(0, numPages);
+    ASSERT_EQ(memoryUsed + numEvictedPages * PAGE_SIZE, bm->getUsedMemory());
+    auto result = conn->query("MATCH (p:person) RETURN count(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+}
+
 class EmptyBufferManagerTest : public DBTest {
 public:
     std::string getInputDir() override {
@@ -45,6 +85,46 @@ public:
     }
 };
 
+TEST_F(EmptyBufferManagerTest, TestScanResistance) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto runQuery = [&](const std::string& query) {
+        auto result = conn->query(query);
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+    };
+    runQuery("CREATE NODE TABLE H(id INT64, v INT64, PRIMARY KEY(id))");
+    runQuery("CREATE NODE TABLE B(id INT64, s STRING, PRIMARY KEY(id))");
+    runQuery("COPY H FROM (UNWIND range(0, 99999) AS i RETURN i, i * 3)");
+    runQuery("COPY B FROM (UNWIND range(0, 999999) AS i RETURN i, 'a string payload to make the "
+             "table much larger than the buffer pool ' + cast(i, 'STRING'))");
+    runQuery("CHECKPOINT");
+    // Reopen the database with a buffer pool that fits the hot table H, but not the table B.
+    systemConfig->bufferPoolSize = 32 * 1024 * 1024;
+    createDBAndConn();
+    auto bm = getBufferManager(*database);
+    auto runHotQueries = [&]() {
+        const auto numMisses = bm->getNumCacheMisses();
+        for (auto i = 0u; i < 100; ++i) {
+            runQuery("MATCH (h:H) WHERE h.id = " + std::to_string(i * 997) + " RETURN h.v");
+        }
+        runQuery("MATCH (h:H) RETURN sum(h.v)");
+        return bm->getNumCacheMisses() - numMisses;
+    };
+    const auto numColdMisses = runHotQueries();
+    ASSERT_GT(numColdMisses, 0);
+    // Pages reused by the second round are protected from eviction.
+    runHotQueries();
+    ASSERT_GT(bm->getNumProtectedPages(), 0);
+    const auto numHitsBeforeScan = bm->getNumCacheHits();
+    const auto numMissesBeforeScan = bm->getNumCacheMisses();
+    runQuery("MATCH (b:B) RETURN count(b.s), sum(size(b.s))");
+    ASSERT_GT(bm->getNumCacheMisses(), numMissesBeforeScan);
+    ASSERT_GT(bm->getNumCacheHits(), numHitsBeforeScan);
+    // The bulk scan of B only evicts pages it read itself, so the hot pages of H survive it.
+    ASSERT_LT(runHotQueries(), numColdMisses / 10);
+}
+
 TEST_F(EmptyBufferManagerTest, TestSpillToDiskMemoryUsage) {
     if (inMemMode) {
         GTEST_SKIP();
@@ -10,6 +10,7 @@
 #include "common/serializer/serializer.h"
 #include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
+#include "storage/compression/block_compression.h"
 #include "storage/compression/compression.h"
 #include "storage/storage_utils.h"
 
@@ -612,3 +613,66 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+/*
+ * BlockCompression Tests
+ */
+
+static std::vector<uint8_t> decompressBlocks(const BlockCompression::CompressedData& compressed,
+    uint64_t numBytes) {
+    std::vector<uint8_t> result(numBytes);
+    const auto headerSize = BlockCompression::getHeaderSize(numBytes);
+    const auto* blockEnds = reinterpret_cast<const uint64_t*>(compressed.data.data());
+    for (auto blockIdx = 0u; blockIdx < BlockCompression::getNumBlocks(numBytes); blockIdx++) {
+        const auto start = blockIdx == 0 ? 0 : blockEnds[blockIdx - 1];
+        BlockCompression::decompressBlock(compressed.compression,
+            std::span(compressed.data.data() + headerSize + start, blockEnds[blockIdx] - start),
+            std::span(result.data() + blockIdx * BlockCompression::BLOCK_SIZE,
+                BlockCompression::getBlockSize(numBytes, blockIdx)));
+    }
+    return result;
+}
+
+TEST(CompressionTests, BlockCompressionRoundTrip) {
+    std::string text;
+    for (auto i = 0u; text.size() < 5 * BlockCompression::BLOCK_SIZE + 123; i++) {
+        text += "the quick brown fox jumps over the lazy dog " + std::to_string(i);
+    }
+    const auto data = std::span(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    const auto compressed = BlockCompression::compress(data);
+    ASSERT_TRUE(compressed.has_value());
+    EXPECT_TRUE(BlockCompression::isBlockCompression(compressed->compression));
+    EXPECT_LT(compressed->data.size() * BlockCompression::MIN_COMPRESSION_RATIO, text.size());
+    const auto result = decompressBlocks(*compressed, text.size());
+    EXPECT_TRUE(std::equal(result.begin(), result.end(), data.begin(), data.end()));
+}
+
+TEST(CompressionTests, BlockCompressionSkipsIncompressibleData) {
+    std::vector<uint8_t> data(3 * BlockCompression::BLOCK_SIZE);
+    uint64_t state = 42;
+    for (auto& byte : data) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        byte = state >> 56;
+    }
+    EXPECT_FALSE(BlockCompression::compress(data).has_value());
+    EXPECT_FALSE(BlockCompression::compressValue(data).has_value());
+    EXPECT_FALSE(BlockCompression::compress(std::span<const uint8_t>()).has_value());
+}
+
+TEST(CompressionTests, BlockCompressionValueRoundTrip) {
+    std::string value;
+    for (auto i = 0u; i < 20; i++) {
+        value += "https://example.com/docs/";
+    }
+    const auto data = std::span(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+    const auto compressed = BlockCompression::compressValue(data);
+    ASSERT_TRUE(compressed.has_value());
+    std::vector<uint8_t> result(value.size());
+    BlockCompression::decompressBlock(compressed->compression, compressed->data, result);
+    EXPECT_TRUE(std::equal(result.begin(), result.end(), data.begin(), data.end()));
+    // Decompressing into a buffer of the wrong size is detected
+    std::vector<uint8_t> shortResult(value.size() - 1);
+    EXPECT_THROW(
+        BlockCompression::decompressBlock(compressed->compression, compressed->data, shortResult),
+        StorageException);
+}
@@ -0,0 +1,94 @@
+#include "common/constants.h"
+#include "common/file_system/io_uring.h"
+#include "graph_test/graph_test.h"
+#include "main/client_context.h"
+#include "storage/file_handle.h"
+#include "storage/storage_manager.h"
+#include "storage/wal/shadow_file.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace testing {
+
+class ShadowFileTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    void TearDown() override {
+        IOUring::setDisabled(false);
+        EmptyDBTest::TearDown();
+    }
+
+    // Writes a page filled with `version` to a new shadow page of the given data file page.
+    void shadowPage(page_idx_t pageIdx, uint8_t version) {
+        const auto storageManager = getClientContext(*conn)->getStorageManager();
+        auto& shadowFile = storageManager->getShadowFile();
+        const auto dataFileIdx = storageManager->getDataFH()->getFileIndex();
+        const auto shadowPageIdx =
+            shadowFile.getOrCreateShadowPage(DBFileID::newDataFileID(), dataFileIdx, pageIdx);
+        const std::vector<uint8_t> page(PAGE_SIZE, version);
+        shadowFile.getShadowingFH().writePageToFile(page.data(), shadowPageIdx);
+    }
+
+    void reshadowPage(page_idx_t pageIdx, uint8_t version) {
+        const auto storageManager = getClientContext(*conn)->getStorageManager();
+        storageManager->getShadowFile().clearShadowPage(
+            storageManager->getDataFH()->getFileIndex(), pageIdx);
+        shadowPage(pageIdx, version);
+    }
+
+    void testReplay();
+};
+
+void ShadowFileTest::testReplay() {
+    constexpr page_idx_t numPages = 100;
+    const auto context = getClientContext(*conn);
+    const auto storageManager = context->getStorageManager();
+    auto& shadowFile = storageManager->getShadowFile();
+    const auto dataFH = storageManager->getDataFH();
+    const auto startPageIdx = dataFH->addNewPages(numPages);
+    // The pages span multiple replay batches, and two of them are shadowed twice: page 5 right
+    // after the first ten pages, so that the first batch ends early, and page 90 at the very end,
+    // so that its second version is replayed in a batch of its own.
+    for (auto i = 0u; i < 10; i++) {
+        shadowPage(startPageIdx + i, 1);
+    }
+    reshadowPage(startPageIdx + 5, 2);
+    for (auto i = 10u; i < numPages; i++) {
+        shadowPage(startPageIdx + i, 1);
+    }
+    reshadowPage(startPageIdx + 90, 2);
+    shadowFile.flushAll();
+    shadowFile.replayShadowPageRecords(*context);
+
+    std::vector<uint8_t> page(PAGE_SIZE);
+    for (auto i = 0u; i < numPages; i++) {
+        dataFH->readPageFromDisk(page.data(), startPageIdx + i);
+        const uint8_t expectedVersion = i == 5 || i == 90 ? 2 : 1;
+        EXPECT_EQ(page, std::vector<uint8_t>(PAGE_SIZE, expectedVersion)) << "page " << i;
+    }
+    shadowFile.clearAll(*context);
+}
+
+TEST_F(ShadowFileTest, ReplayPageShadowedTwice) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    IOUring::setDisabled(true);
+    testReplay();
+}
+
+TEST_F(ShadowFileTest, ReplayPageShadowedTwiceWithIOUring) {
+    if (inMemMode || !IOUring::isAvailable()) {
+        GTEST_SKIP();
+    }
+    testReplay();
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,115 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/string_format.h"
+#include "graph_test/graph_test.h"
+#include "main/client_context.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace testing {
+
+class TableStatisticsTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE P(id INT64, age INT64, name STRING, PRIMARY "
+                                "KEY(id))")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE Knows(FROM P TO P, since INT64)")->isSuccess());
+    }
+
+    void TearDown() override { EmptyDBTest::TearDown(); }
+
+    std::unique_ptr<TableStatistics> getStatistics(const std::string& tableName) {
+        EXPECT_TRUE(conn->query("BEGIN TRANSACTION READ ONLY")->isSuccess());
+        const auto context = getClientContext(*conn);
+        const auto entry = context->getCatalog()->getTableCatalogEntry(context->getTx(), tableName);
+        const auto statistics = entry->getStatistics();
+        auto result =
+            statistics ? std::make_unique<TableStatistics>(statistics->copy()) : nullptr;
+        EXPECT_TRUE(conn->query("COMMIT")->isSuccess());
+        return result;
+    }
+
+    void copyPersons(int64_t start, int64_t end) {
+        ASSERT_TRUE(conn->query(stringFormat("COPY P FROM (UNWIND range({}, {}) AS i RETURN i, "
+                                             "CASE WHEN i % 10 = 0 THEN NULL ELSE i % 50 END, "
+                                             "concat('p', CAST(i % 7 AS STRING)))",
+                                    start, end))
+                        ->isSuccess());
+    }
+};
+
+TEST_F(TableStatisticsTest, CopyIntoEmptyTables) {
+    copyPersons(0, 999);
+    ASSERT_TRUE(conn->query("COPY Knows FROM (UNWIND range(1, 999) AS i RETURN CASE WHEN i % 2 = "
+                            "0 THEN 0 ELSE i END, (i * 7) % 1000, i % 3)")
+                    ->isSuccess());
+    const auto nodeStatistics = getStatistics("P");
+    ASSERT_NE(nodeStatistics, nullptr);
+    EXPECT_EQ(nodeStatistics->getNumRows(), 1000);
+    const auto& ageStatistics = nodeStatistics->getColumnStatistics("age");
+    EXPECT_EQ(ageStatistics.numNulls, 100);
+    EXPECT_EQ(ageStatistics.numNonNulls, 900);
+    // Ages of multiples of 10 are null, leaving 45 distinct values.
+    EXPECT_NEAR((double)ageStatistics.numDistinctValues, 45, 4);
+    // COPY doesn't sample values for histograms.
+    EXPECT_FALSE(ageStatistics.hasHistogram());
+    EXPECT_NEAR((double)nodeStatistics->getColumnStatistics("name").numDistinctValues, 7, 1);
+
+    const auto relStatistics = getStatistics("Knows");
+    ASSERT_NE(relStatistics, nullptr);
+    EXPECT_EQ(relStatistics->getNumRows(), 999);
+    EXPECT_NEAR((double)relStatistics->getColumnStatistics("since").numDistinctValues, 3, 1);
+    const auto& fwdDegrees = relStatistics->getDegreeStatistics(RelDataDirection::FWD);
+    EXPECT_EQ(fwdDegrees.numRels, 999);
+    EXPECT_EQ(fwdDegrees.numNodesWithRels, 501);
+    EXPECT_EQ(fwdDegrees.maxDegree, 499);
+    const auto& bwdDegrees = relStatistics->getDegreeStatistics(RelDataDirection::BWD);
+    EXPECT_EQ(bwdDegrees.numRels, 999);
+    EXPECT_EQ(bwdDegrees.numNodesWithRels, 999);
+    EXPECT_EQ(bwdDegrees.maxDegree, 1);
+}
+
+TEST_F(TableStatisticsTest, FailedCopy) {
+    // The duplicated primary key rolls back the copy together with its statistics.
+    ASSERT_FALSE(
+        conn->query("COPY P FROM (UNWIND [1, 2, 1] AS i RETURN i, i, 'p')")->isSuccess());
+    EXPECT_EQ(getStatistics("P"), nullptr);
+}
+
+TEST_F(TableStatisticsTest, RefreshAtCheckpoint) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(
+        conn->query("UNWIND range(0, 99) AS i CREATE (:P {id: i, age: i % 10})")->isSuccess());
+    EXPECT_EQ(getStatistics("P"), nullptr);
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    auto statistics = getStatistics("P");
+    ASSERT_NE(statistics, nullptr);
+    EXPECT_EQ(statistics->getNumRows(), 100);
+    EXPECT_NEAR((double)statistics->getColumnStatistics("age").numDistinctValues, 10, 1);
+    EXPECT_TRUE(statistics->getColumnStatistics("age").hasHistogram());
+    EXPECT_EQ(statistics->getColumnStatistics("name").numNulls, 100);
+
+    // Small changes keep the statistics.
+    copyPersons(100, 109);
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    EXPECT_EQ(getStatistics("P")->getNumRows(), 100);
+    // Large ones get them collected again.
+    copyPersons(110, 199);
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    statistics = getStatistics("P");
+    EXPECT_EQ(statistics->getNumRows(), 200);
+    EXPECT_EQ(statistics->getColumnStatistics("name").numNulls, 100);
+
+    createDBAndConn();
+    EXPECT_EQ(getStatistics("P")->getNumRows(), 200);
+}
+
+} // namespace testing
+} // namespace kuzu